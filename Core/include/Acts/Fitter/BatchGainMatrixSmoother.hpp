@@ -0,0 +1,143 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+#include "Acts/EventData/MultiTrajectory.hpp"
+#include "Acts/Fitter/KalmanFitterError.hpp"
+#include "Acts/Fitter/detail/KalmanBatchKernels.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Utilities/Logger.hpp"
+#include "Acts/Utilities/Result.hpp"
+
+namespace Acts {
+
+/// @brief Kalman smoother implementation based on Gain matrix formalism for
+/// many trajectories at once
+///
+/// The trajectories are smoothed in lock-step: in every iteration the
+/// next state (backwards) of every trajectory is smoothed with a single
+/// batched kernel. The results are identical to the GainMatrixSmoother
+/// within numerical precision.
+class BatchGainMatrixSmoother {
+ public:
+  /// Constructor with (non-owning) logger
+  /// @param logger a logger instance
+  BatchGainMatrixSmoother(
+      std::shared_ptr<const Logger> logger = std::shared_ptr<const Logger>(
+          getDefaultLogger("BatchGainMatrixSmoother", Logging::INFO)
+              .release()));
+
+  /// Operater for Kalman smoothing
+  ///
+  /// @tparam source_link_t The type of source link
+  ///
+  /// @param gctx The geometry context for the smoothing
+  /// @param trajectory The trajectory to be smoothed
+  /// @param entryIndices The indices of the states to start the smoothing,
+  /// one for each track
+  ///
+  /// @return Error if the smoothing failed for at least one state
+  /// @warning The tracks should not share states, otherwise the shared
+  ///          states are smoothed more than once.
+  template <typename source_link_t>
+  Result<void> operator()(const GeometryContext& /* gctx */,
+                          MultiTrajectory<source_link_t>& trajectory,
+                          const std::vector<size_t>& entryIndices) const {
+    ACTS_VERBOSE("Invoked BatchGainMatrixSmoother on " << entryIndices.size()
+                                                       << " tracks");
+    using ParMatrix = ActsSymMatrixD<eBoundParametersSize>;
+    using ConstParMap = Eigen::Map<const ParMatrix>;
+
+    // For the last states: smoothed is filtered
+    for (auto istate : entryIndices) {
+      auto ts = trajectory.getTrackState(istate);
+      ts.smoothed() = ts.filtered();
+      ts.smoothedCovariance() = ts.filteredCovariance();
+    }
+
+    // Process the tracks in chunks that stay in cache
+    detail::KalmanSmoothBatch batch;
+    std::vector<size_t> current;
+    std::vector<size_t> next;
+    for (size_t begin = 0; begin < entryIndices.size(); begin += kBatchSize) {
+      const size_t end = std::min(begin + kBatchSize, entryIndices.size());
+      current.assign(entryIndices.begin() + begin, entryIndices.begin() + end);
+
+      while (true) {
+        // Find all tracks that have a previous state left
+        next.clear();
+        for (auto istate : current) {
+          if (trajectory.getTrackState(istate).previous() !=
+              detail_lt::IndexData::kInvalid) {
+            next.push_back(istate);
+          }
+        }
+        if (next.empty()) {
+          break;
+        }
+
+        batch.resize(next.size());
+        for (size_t k = 0; k < next.size(); ++k) {
+          const auto nextTs = trajectory.getTrackState(next[k]);
+          const auto ts = trajectory.getTrackState(nextTs.previous());
+          // should have filtered and predicted, this should also include the
+          // covariances.
+          assert(ts.hasFiltered());
+          assert(ts.hasPredicted());
+          assert(nextTs.hasJacobian());
+
+          batch.indices[k] = ts.index();
+          batch.filtered.col(k) = ts.filtered();
+          Eigen::Map<ParMatrix>(batch.filteredCovariance.col(k).data()) =
+              ts.filteredCovariance();
+          // NB: The jacobian stored in a state is the jacobian from previous
+          // state to this state in forward propagation
+          Eigen::Map<ParMatrix>(batch.nextJacobian.col(k).data()) =
+              nextTs.jacobian();
+          batch.nextPredicted.col(k) = nextTs.predicted();
+          Eigen::Map<ParMatrix>(batch.nextPredictedCovariance.col(k).data()) =
+              nextTs.predictedCovariance();
+          batch.nextSmoothed.col(k) = nextTs.smoothed();
+          Eigen::Map<ParMatrix>(batch.nextSmoothedCovariance.col(k).data()) =
+              nextTs.smoothedCovariance();
+        }
+
+        ACTS_VERBOSE("Smoothing " << batch.size() << " track states");
+        if (detail::gainMatrixSmooth(batch) > 0) {
+          return KalmanFitterError::SmoothFailed;
+        }
+
+        for (size_t k = 0; k < batch.size(); ++k) {
+          auto ts = trajectory.getTrackState(batch.indices[k]);
+          ts.smoothed() = batch.smoothed.col(k);
+          ts.smoothedCovariance() =
+              ConstParMap(batch.smoothedCovariance.col(k).data());
+        }
+        std::swap(current, batch.indices);
+      }
+    }
+
+    return Result<void>::success();
+  }
+
+  /// Pointer to a logger that is owned by the parent, KalmanFilter
+  std::shared_ptr<const Logger> m_logger{nullptr};
+
+  /// Getter for the logger, to support logging macros
+  const Logger& logger() const;
+
+ private:
+  /// Maximum number of tracks processed together
+  static constexpr size_t kBatchSize = 64;
+};
+
+}  // namespace Acts
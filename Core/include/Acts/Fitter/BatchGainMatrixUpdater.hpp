@@ -0,0 +1,156 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <utility>
+#include <vector>
+#include "Acts/EventData/MultiTrajectory.hpp"
+#include "Acts/Fitter/KalmanFitterError.hpp"
+#include "Acts/Fitter/detail/KalmanBatchKernels.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Utilities/Definitions.hpp"
+#include "Acts/Utilities/Logger.hpp"
+#include "Acts/Utilities/Result.hpp"
+
+namespace Acts {
+
+/// @brief Update step of Kalman Filter using gain matrix formalism for
+/// many track states at once
+///
+/// The track states are grouped by measurement dimension and each group is
+/// updated with a fixed-size kernel, i.e. the dispatch on the measurement
+/// dimension happens once per group instead of once per track state.
+/// The results are identical to the GainMatrixUpdater within numerical
+/// precision.
+class BatchGainMatrixUpdater {
+ public:
+  /// Explicit constructor
+  ///
+  /// @param logger a logger instance
+  BatchGainMatrixUpdater(
+      std::shared_ptr<const Logger> logger = std::shared_ptr<const Logger>(
+          getDefaultLogger("BatchGainMatrixUpdater", Logging::INFO)
+              .release()));
+
+  /// @brief Update a set of track states of a trajectory
+  ///
+  /// @tparam source_link_t The type of source link
+  ///
+  /// @param gctx The current geometry context object, e.g. alignment
+  /// @param trajectory The trajectory holding the track states
+  /// @param trackStateIndices The indices of the measured track states
+  /// @param direction the navigation direction
+  ///
+  /// @return Error if at least one of the updates failed
+  /// @note Track states that fail the update keep their filtered state
+  template <typename source_link_t>
+  Result<void> operator()(const GeometryContext& /*gctx*/,
+                          MultiTrajectory<source_link_t>& trajectory,
+                          const std::vector<size_t>& trackStateIndices,
+                          const NavigationDirection& direction = forward) const {
+    ACTS_VERBOSE("Invoked BatchGainMatrixUpdater on "
+                 << trackStateIndices.size() << " track states");
+
+    // Group the track states by measurement dimension
+    std::array<std::vector<size_t>, eBoundParametersSize> indicesPerDim;
+    for (auto istate : trackStateIndices) {
+      const auto ts = trajectory.getTrackState(istate);
+      // we need a calibrated measurement, a predicted and a filtered state
+      assert(ts.hasCalibrated());
+      assert(ts.hasPredicted());
+      assert(ts.hasFiltered());
+      assert(ts.calibratedSize() > 0);
+      indicesPerDim[ts.calibratedSize() - 1].push_back(istate);
+    }
+
+    size_t nFailed =
+        updateAll(trajectory, indicesPerDim,
+                  std::make_index_sequence<eBoundParametersSize>());
+    if (nFailed > 0) {
+      ACTS_VERBOSE("Update failed for " << nFailed << " track states");
+      return (direction == forward) ? KalmanFitterError::ForwardUpdateFailed
+                                    : KalmanFitterError::BackwardUpdateFailed;
+    }
+    return Result<void>::success();
+  }
+
+  /// Pointer to a logger that is owned by the parent, KalmanFilter
+  std::shared_ptr<const Logger> m_logger{nullptr};
+
+  /// Getter for the logger, to support logging macros
+  const Logger& logger() const;
+
+ private:
+  /// Maximum number of track states processed by one kernel call
+  static constexpr size_t kBatchSize = 64;
+
+  /// Run the update for all measurement dimensions
+  template <typename source_link_t, size_t... kDims>
+  size_t updateAll(
+      MultiTrajectory<source_link_t>& trajectory,
+      const std::array<std::vector<size_t>, eBoundParametersSize>& indices,
+      std::index_sequence<kDims...> /*dims*/) const {
+    return (update<kDims + 1>(trajectory, indices[kDims]) + ...);
+  }
+
+  /// Gather, update and scatter the track states of one measurement dimension
+  template <size_t kMeasDim, typename source_link_t>
+  size_t update(MultiTrajectory<source_link_t>& trajectory,
+                const std::vector<size_t>& indices) const {
+    if (indices.empty()) {
+      return 0;
+    }
+    using ParMatrix = ActsSymMatrixD<eBoundParametersSize>;
+    using MeasMatrix = ActsSymMatrixD<kMeasDim>;
+    using Projector = ActsMatrixD<kMeasDim, eBoundParametersSize>;
+
+    // Process the track states in chunks that stay in cache
+    detail::KalmanUpdateBatch<kMeasDim> batch;
+    size_t nFailed = 0;
+    for (size_t begin = 0; begin < indices.size(); begin += kBatchSize) {
+      const size_t n = std::min(kBatchSize, indices.size() - begin);
+      batch.resize(n);
+      for (size_t k = 0; k < n; ++k) {
+        const auto ts = trajectory.getTrackState(indices[begin + k]);
+        batch.indices[k] = indices[begin + k];
+        batch.predicted.col(k) = ts.predicted();
+        Eigen::Map<ParMatrix>(batch.predictedCovariance.col(k).data()) =
+            ts.predictedCovariance();
+        batch.calibrated.col(k) = ts.calibrated().template head<kMeasDim>();
+        Eigen::Map<MeasMatrix>(batch.calibratedCovariance.col(k).data()) =
+            ts.calibratedCovariance()
+                .template topLeftCorner<kMeasDim, kMeasDim>();
+        Eigen::Map<Projector>(batch.projector.col(k).data()) =
+            ts.projector()
+                .template topLeftCorner<kMeasDim, eBoundParametersSize>();
+      }
+
+      ACTS_VERBOSE("Measurement dimension " << kMeasDim << ": updating "
+                                            << n << " track states");
+      nFailed += detail::gainMatrixUpdate(batch);
+
+      for (size_t k = 0; k < n; ++k) {
+        if (not batch.ok[k]) {
+          continue;
+        }
+        auto ts = trajectory.getTrackState(batch.indices[k]);
+        ts.filtered() = batch.filtered.col(k);
+        ts.filteredCovariance() =
+            Eigen::Map<const ParMatrix>(batch.filteredCovariance.col(k).data());
+        ts.chi2() = batch.chi2(k);
+      }
+    }
+    return nFailed;
+  }
+};
+
+}  // namespace Acts
@@ -0,0 +1,211 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <vector>
+
+#include <Eigen/Cholesky>
+
+#include "Acts/EventData/detail/covariance_helper.hpp"
+#include "Acts/Utilities/Definitions.hpp"
+#include "Acts/Utilities/ParameterDefinitions.hpp"
+
+namespace Acts {
+namespace detail {
+
+/// Column-wise storage for a batch of Kalman updates.
+///
+/// All track states in the batch share the same measurement dimension. Each
+/// quantity is stored as one fixed-size column per track state, i.e. with the
+/// same layout as the columns of the MultiTrajectory storage, such that
+/// gathering and scattering are plain column copies.
+///
+/// @tparam kMeasDim The measurement dimension
+template <size_t kMeasDim>
+struct KalmanUpdateBatch {
+  static constexpr size_t kParDim = eBoundParametersSize;
+
+  template <size_t kRows>
+  using Columns = Eigen::Matrix<double, kRows, Eigen::Dynamic>;
+
+  /// Track state indices in the source trajectory
+  std::vector<size_t> indices;
+
+  // input columns
+  Columns<kParDim> predicted;
+  Columns<kParDim * kParDim> predictedCovariance;
+  Columns<kMeasDim> calibrated;
+  Columns<kMeasDim * kMeasDim> calibratedCovariance;
+  Columns<kMeasDim * kParDim> projector;
+
+  // output columns
+  Columns<kParDim> filtered;
+  Columns<kParDim * kParDim> filteredCovariance;
+  Eigen::Matrix<double, 1, Eigen::Dynamic> chi2;
+  /// Whether the update of the corresponding track state succeeded
+  std::vector<bool> ok;
+
+  /// Number of track states in the batch
+  size_t size() const { return indices.size(); }
+
+  /// Resize all columns to hold @p n track states
+  void resize(size_t n) {
+    indices.resize(n);
+    predicted.resize(Eigen::NoChange, n);
+    predictedCovariance.resize(Eigen::NoChange, n);
+    calibrated.resize(Eigen::NoChange, n);
+    calibratedCovariance.resize(Eigen::NoChange, n);
+    projector.resize(Eigen::NoChange, n);
+    filtered.resize(Eigen::NoChange, n);
+    filteredCovariance.resize(Eigen::NoChange, n);
+    chi2.resize(Eigen::NoChange, n);
+    ok.assign(n, false);
+  }
+};
+
+/// Column-wise storage for a batch of Kalman smoothing steps.
+///
+/// Each entry smoothes one track state given its successor on the trajectory,
+/// i.e. the track state that was used as the starting point of the step.
+struct KalmanSmoothBatch {
+  static constexpr size_t kParDim = eBoundParametersSize;
+
+  template <size_t kRows>
+  using Columns = Eigen::Matrix<double, kRows, Eigen::Dynamic>;
+
+  /// Track state indices in the source trajectory
+  std::vector<size_t> indices;
+
+  // input columns of the track state to be smoothed
+  Columns<kParDim> filtered;
+  Columns<kParDim * kParDim> filteredCovariance;
+  // input columns of the already smoothed successor track state
+  Columns<kParDim * kParDim> nextJacobian;
+  Columns<kParDim> nextPredicted;
+  Columns<kParDim * kParDim> nextPredictedCovariance;
+  Columns<kParDim> nextSmoothed;
+  Columns<kParDim * kParDim> nextSmoothedCovariance;
+
+  // output columns
+  Columns<kParDim> smoothed;
+  Columns<kParDim * kParDim> smoothedCovariance;
+  /// Whether the smoothing of the corresponding track state succeeded
+  std::vector<bool> ok;
+
+  /// Number of track states in the batch
+  size_t size() const { return indices.size(); }
+
+  /// Resize all columns to hold @p n track states
+  void resize(size_t n) {
+    indices.resize(n);
+    filtered.resize(Eigen::NoChange, n);
+    filteredCovariance.resize(Eigen::NoChange, n);
+    nextJacobian.resize(Eigen::NoChange, n);
+    nextPredicted.resize(Eigen::NoChange, n);
+    nextPredictedCovariance.resize(Eigen::NoChange, n);
+    nextSmoothed.resize(Eigen::NoChange, n);
+    nextSmoothedCovariance.resize(Eigen::NoChange, n);
+    smoothed.resize(Eigen::NoChange, n);
+    smoothedCovariance.resize(Eigen::NoChange, n);
+    ok.assign(n, false);
+  }
+};
+
+/// Gain matrix update of all track states in a batch.
+///
+/// The gain matrix is obtained from a Cholesky decomposition of the residual
+/// covariance instead of an explicit inverse. The chi2 is computed from the
+/// predicted residual with the same decomposition, which is identical to the
+/// filtered residual chi2.
+///
+/// @tparam kMeasDim The measurement dimension
+/// @param batch The batch to be updated
+///
+/// @return Number of track states that failed the update
+template <size_t kMeasDim>
+size_t gainMatrixUpdate(KalmanUpdateBatch<kMeasDim>& batch) {
+  constexpr size_t kParDim = KalmanUpdateBatch<kMeasDim>::kParDim;
+  using ParVector = ActsVectorD<kParDim>;
+  using ParMatrix = ActsSymMatrixD<kParDim>;
+  using MeasVector = ActsVectorD<kMeasDim>;
+  using MeasMatrix = ActsSymMatrixD<kMeasDim>;
+  using Projector = ActsMatrixD<kMeasDim, kParDim>;
+
+  size_t nFailed = 0;
+  for (size_t i = 0; i < batch.size(); ++i) {
+    Eigen::Map<const ParVector> x(batch.predicted.col(i).data());
+    Eigen::Map<const ParMatrix> P(batch.predictedCovariance.col(i).data());
+    Eigen::Map<const MeasVector> m(batch.calibrated.col(i).data());
+    Eigen::Map<const MeasMatrix> V(batch.calibratedCovariance.col(i).data());
+    Eigen::Map<const Projector> H(batch.projector.col(i).data());
+
+    const ActsMatrixD<kMeasDim, kParDim> HP = H * P;
+    const MeasMatrix S = HP * H.transpose() + V;
+    const Eigen::LLT<MeasMatrix> llt(S);
+    if (llt.info() != Eigen::Success) {
+      batch.ok[i] = false;
+      ++nFailed;
+      continue;
+    }
+    // K = P H^T S^-1 = (S^-1 H P)^T, since P and S are symmetric
+    const ActsMatrixD<kParDim, kMeasDim> K = llt.solve(HP).transpose();
+    const MeasVector residual = m - H * x;
+
+    Eigen::Map<ParVector>(batch.filtered.col(i).data()) = x + K * residual;
+    Eigen::Map<ParMatrix>(batch.filteredCovariance.col(i).data()) = P - K * HP;
+    batch.chi2(i) = residual.dot(llt.solve(residual));
+    batch.ok[i] = true;
+  }
+  return nFailed;
+}
+
+/// Gain matrix smoothing of all track states in a batch.
+///
+/// The smoothing gain matrix is obtained from a LDLT decomposition of the
+/// predicted covariance of the successor instead of an explicit inverse.
+///
+/// @param batch The batch to be smoothed
+///
+/// @return Number of track states that failed the smoothing
+inline size_t gainMatrixSmooth(KalmanSmoothBatch& batch) {
+  constexpr size_t kParDim = KalmanSmoothBatch::kParDim;
+  using ParVector = ActsVectorD<kParDim>;
+  using ParMatrix = ActsSymMatrixD<kParDim>;
+
+  size_t nFailed = 0;
+  for (size_t i = 0; i < batch.size(); ++i) {
+    Eigen::Map<const ParVector> xf(batch.filtered.col(i).data());
+    Eigen::Map<const ParMatrix> Pf(batch.filteredCovariance.col(i).data());
+    Eigen::Map<const ParMatrix> J(batch.nextJacobian.col(i).data());
+    Eigen::Map<const ParVector> xp(batch.nextPredicted.col(i).data());
+    Eigen::Map<const ParMatrix> Pp(batch.nextPredictedCovariance.col(i).data());
+    Eigen::Map<const ParVector> xs(batch.nextSmoothed.col(i).data());
+    Eigen::Map<const ParMatrix> Ps(batch.nextSmoothedCovariance.col(i).data());
+
+    const Eigen::LDLT<ParMatrix> ldlt(Pp);
+    // G = Pf J^T Pp^-1 = (Pp^-1 J Pf)^T, since Pf and Pp are symmetric
+    const ParMatrix G = ldlt.solve(J * Pf).transpose();
+    if (ldlt.info() != Eigen::Success or G.hasNaN()) {
+      batch.ok[i] = false;
+      ++nFailed;
+      continue;
+    }
+
+    Eigen::Map<ParVector>(batch.smoothed.col(i).data()) = xf + G * (xs - xp);
+    ParMatrix smoothedCov = Pf - G * (Pp - Ps) * G.transpose();
+    // Make one attempt to replace a non semi-positive definite covariance
+    covariance_helper<ParMatrix>::validate(smoothedCov);
+    Eigen::Map<ParMatrix>(batch.smoothedCovariance.col(i).data()) = smoothedCov;
+    batch.ok[i] = true;
+  }
+  return nFailed;
+}
+
+}  // namespace detail
+}  // namespace Acts
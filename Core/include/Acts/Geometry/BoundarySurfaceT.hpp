@@ -122,6 +122,25 @@ class BoundarySurfaceT {
   /// The Surface Representation of this
   virtual const Surface& surfaceRepresentation() const;
 
+  /// The single volume attached in a navigation direction
+  ///
+  /// @param navDir The navigation direction, see attachVolume()
+  ///
+  /// @return The attached volume, nullptr if none or an array is attached
+  const volume_t* attachedVolume(NavigationDirection navDir) const {
+    return (navDir == backward) ? m_oppositeVolume : m_alongVolume;
+  }
+
+  /// The volume array attached in a navigation direction
+  ///
+  /// @param navDir The navigation direction, see attachVolumeArray()
+  ///
+  /// @return The attached volume array, nullptr if none is attached
+  const std::shared_ptr<const VolumeArray>& attachedVolumeArray(
+      NavigationDirection navDir) const {
+    return (navDir == backward) ? m_oppositeVolumeArray : m_alongVolumeArray;
+  }
+
   /// Helper method: attach a Volume to this BoundarySurfaceT
   /// this is done during the geometry construction.
   ///
@@ -12,6 +12,7 @@
 #include "Acts/Geometry/GeometryID.hpp"
 #include "Acts/Utilities/Definitions.hpp"
 
+#include <cstddef>
 #include <functional>
 #include <map>
 #include <memory>
@@ -101,13 +102,70 @@ class TrackingGeometry {
   void visitSurfaces(
       const std::function<void(const Acts::Surface*)>& visitor) const;
 
+  /// Search for a volume with the given identifier.
+  ///
+  /// @param id is the geometry identifier; only the volume part is used
+  /// @return plain pointer to the volume, nullptr if it does not exist
+  const TrackingVolume* findVolume(GeometryID id) const;
+
+  /// Search for a layer with the given identifier.
+  ///
+  /// @param id is the geometry identifier; only the volume and layer parts
+  ///        are used
+  /// @return plain pointer to the layer, nullptr if it does not exist
+  const Layer* findLayer(GeometryID id) const;
+
+  /// Search for a sensitive surface with the given identifier.
+  ///
+  /// @param id is the geometry identifier of the sensitive surface
+  /// @return plain pointer to the surface, nullptr if it does not exist
+  ///
+  /// @note The lookup uses flat tables built when closing the geometry and
+  ///       has constant complexity.
+  const Surface* findSurface(GeometryID id) const;
+
+  /// Contiguous ordinal of a sensitive surface.
+  ///
+  /// Ordinals are in [0, sensitiveSurfaces().size()) and ordered by
+  /// identifier. They can be used to index plain arrays of per-surface data.
+  ///
+  /// @param id is the geometry identifier of the sensitive surface
+  /// @return the surface ordinal, SIZE_MAX if the surface does not exist
+  size_t surfaceOrdinal(GeometryID id) const;
+
+  /// All sensitive surfaces on layers ordered by their ordinal.
+  const std::vector<const Surface*>& sensitiveSurfaces() const;
+
  private:
+  /// Lookup table entry for a single layer identifier.
+  struct LayerEntry {
+    const Layer* layer = nullptr;
+    /// Ordinal of the sensitive surface with sensitive identifier 1.
+    size_t firstOrdinal = 0;
+    /// Number of sensitive surface ordinals reserved for the layer.
+    size_t numSurfaces = 0;
+  };
+
+  /// Build the identifier lookup tables from the closed geometry.
+  void buildIndex();
+  /// Find the lookup table entry for the layer part of the identifier.
+  const LayerEntry* findLayerEntry(GeometryID id) const;
+
   /// The known world - and the beamline
   TrackingVolumePtr m_world;
   std::shared_ptr<const PerigeeSurface> m_beam;
 
   /// The Volumes in a map for string based search
   std::map<std::string, const TrackingVolume*> m_trackingVolumes;
+
+  /// Volumes indexed by volume identifier.
+  std::vector<const TrackingVolume*> m_volumes;
+  /// Layer entry range in m_layers as (offset, size) by volume identifier.
+  std::vector<std::pair<size_t, size_t>> m_volumeLayers;
+  /// Layer entries indexed by volume offset plus layer identifier.
+  std::vector<LayerEntry> m_layers;
+  /// Sensitive surfaces indexed by ordinal.
+  std::vector<const Surface*> m_surfaces;
 };
 
 }  // namespace Acts
@@ -0,0 +1,65 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <istream>
+#include <memory>
+#include <ostream>
+
+#include "Acts/Geometry/GeometryContext.hpp"
+
+namespace Acts {
+
+class TrackingGeometry;
+
+/// Write a binary snapshot of a closed tracking geometry
+///
+/// The snapshot contains the full object graph: volumes with their bounds,
+/// boundary surfaces and their attachments, layer and volume arrays, layers
+/// with approach surfaces and surface arrays, bounding volume hierarchies,
+/// all surface bounds and transforms, the assigned surface and volume
+/// material, and the geometry identifiers. Objects shared in the geometry,
+/// i.e. surface bounds, material and glued boundaries, are stored once.
+///
+/// Surfaces are stored with their transform in the given context. Of a
+/// detector element only its thickness is stored, see
+/// readTrackingGeometrySnapshot for what is restored.
+///
+/// @param gctx The geometry context used to evaluate the transforms
+/// @param tGeometry The geometry to be written
+/// @param os The binary output stream
+///
+/// @throws std::invalid_argument if the geometry contains objects that can
+///         not be stored, e.g. material maps of volumes or surface arrays
+///         which were not built by the SurfaceArrayCreator
+void writeTrackingGeometrySnapshot(const GeometryContext& gctx,
+                                   const TrackingGeometry& tGeometry,
+                                   std::ostream& os);
+
+/// Read a tracking geometry from a binary snapshot
+///
+/// The object graph is rebuilt in a single pass over the input without
+/// running any of the geometry builders. The geometry identifiers are
+/// assigned when closing the restored geometry and checked against the
+/// stored ones.
+///
+/// Every surface which had a detector element gets a minimal detector
+/// element with the stored transform and thickness, i.e. it is still a
+/// sensitive surface. These elements are owned by the returned pointer.
+/// They do not provide any detector specific information, e.g. a
+/// digitization module, and they can not be aligned.
+///
+/// @param is The binary input stream
+///
+/// @throws std::runtime_error if the input is not a valid snapshot or was
+///         written with a different format version
+std::shared_ptr<const TrackingGeometry> readTrackingGeometrySnapshot(
+    std::istream& is);
+
+}  // namespace Acts
@@ -332,6 +332,13 @@ class TrackingVolume : public Volume {
   /// @return If it has a BVH or not.
   bool hasBoundingVolumeHierarchy() const;
 
+  /// Return the top node of the BoundingVolumeHierarchy
+  /// @return The top node, nullptr if there is no BVH
+  const Volume::BoundingBox* boundingVolumeHierarchy() const;
+
+  /// Return the volumes contained in the BoundingVolumeHierarchy
+  const std::vector<std::unique_ptr<const Volume>>& descendantVolumes() const;
+
   /// Register the color code
   ///
   /// @param icolor is a color number
@@ -505,6 +512,16 @@ inline bool TrackingVolume::hasBoundingVolumeHierarchy() const {
   return m_bvhTop != nullptr;
 }
 
+inline const Volume::BoundingBox* TrackingVolume::boundingVolumeHierarchy()
+    const {
+  return m_bvhTop;
+}
+
+inline const std::vector<std::unique_ptr<const Volume>>&
+TrackingVolume::descendantVolumes() const {
+  return m_descendantVolumes;
+}
+
 #include "detail/TrackingVolume.ipp"
 
 }  // namespace Acts
\ No newline at end of file
@@ -73,6 +73,22 @@ fieldMapperRZ(const std::function<size_t(std::array<size_t, 2> binsRZ,
               double lengthUnit = UnitConstants::mm,
               double BFieldUnit = UnitConstants::T, bool firstQuadrant = false);
 
+/// Method to setup the FieldMapper with single precision field values
+///
+/// Identical to the double precision variant above, but the field values are
+/// stored and interpolated in single precision, which halves the memory
+/// footprint of the map. The returned field is converted to double precision.
+Acts::InterpolatedBFieldMapper<
+    Acts::detail::Grid<Acts::Vector2F, Acts::detail::EquidistantAxis,
+                       Acts::detail::EquidistantAxis>>
+fieldMapperRZ(const std::function<size_t(std::array<size_t, 2> binsRZ,
+                                         std::array<size_t, 2> nBinsRZ)>&
+                  localToGlobalBin,
+              std::vector<double> rPos, std::vector<double> zPos,
+              std::vector<Acts::Vector2F> bField,
+              double lengthUnit = UnitConstants::mm,
+              double BFieldUnit = UnitConstants::T, bool firstQuadrant = false);
+
 /// Method to setup the FieldMapper
 /// @param localToGlobalBin Function mapping the local bins of x,y,z to the
 /// global bin of the map magnetic field value
@@ -134,6 +150,22 @@ fieldMapperXYZ(const std::function<size_t(std::array<size_t, 3> binsXYZ,
                double lengthUnit = UnitConstants::mm,
                double BFieldUnit = UnitConstants::T, bool firstOctant = false);
 
+/// Method to setup the FieldMapper with single precision field values
+///
+/// Identical to the double precision variant above, but the field values are
+/// stored and interpolated in single precision, which halves the memory
+/// footprint of the map. The returned field is converted to double precision.
+Acts::InterpolatedBFieldMapper<Acts::detail::Grid<
+    Acts::Vector3F, Acts::detail::EquidistantAxis,
+    Acts::detail::EquidistantAxis, Acts::detail::EquidistantAxis>>
+fieldMapperXYZ(const std::function<size_t(std::array<size_t, 3> binsXYZ,
+                                          std::array<size_t, 3> nBinsXYZ)>&
+                   localToGlobalBin,
+               std::vector<double> xPos, std::vector<double> yPos,
+               std::vector<double> zPos, std::vector<Acts::Vector3F> bField,
+               double lengthUnit = UnitConstants::mm,
+               double BFieldUnit = UnitConstants::T, bool firstOctant = false);
+
 /// Function which takes an existing SolenoidBField instance and
 /// creates a field mapper by sampling grid points from the analytical
 /// solenoid field.
@@ -7,6 +7,9 @@
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 #pragma once
+#include <cstdint>
+#include <memory>
+#include <vector>
 #include "Acts/Material/ISurfaceMaterial.hpp"
 #include "Acts/Material/MaterialProperties.hpp"
 #include "Acts/Utilities/BinUtility.hpp"
@@ -17,8 +20,12 @@ namespace Acts {
 /// @class BinnedSurfaceMaterial
 ///
 /// It extends the SurfaceMaterial base class and is an array pf
-/// MaterialProperties. This is not memory optimised as every bin
-/// holds one material property object.
+/// MaterialProperties. Owned properties are stored once per unique
+/// value in a palette and every bin holds an index into it, which
+/// keeps maps with few distinct materials small and cache friendly.
+///
+/// Alternatively the properties reference external, contiguous storage,
+/// e.g. a memory-mapped material map file, without copying.
 
 class BinnedSurfaceMaterial : public ISurfaceMaterial {
  public:
@@ -55,6 +62,22 @@ class BinnedSurfaceMaterial : public ISurfaceMaterial {
                         MaterialPropertiesMatrix fullProperties,
                         double splitFactor = 0.);
 
+  /// Explicit constructor referencing external material properties,
+  /// for one- and two-dimensional binning.
+  ///
+  /// The storage must hold bins(0) * bins(1) properties with the bin
+  /// along the first dimension running fastest. It is shared and not copied,
+  /// use the aliasing constructor of std::shared_ptr to keep a larger
+  /// storage, e.g. a memory-mapped file, alive.
+  ///
+  /// @param binUtility defines the binning structure on the surface (copied)
+  /// @param sharedProperties is the external properties storage (shared)
+  /// @param splitFactor is the pre/post splitting directive
+  BinnedSurfaceMaterial(
+      const BinUtility& binUtility,
+      std::shared_ptr<const MaterialProperties> sharedProperties,
+      double splitFactor = 0.);
+
   /// Copy Move Constructor
   ///
   /// @param bsm is the source object to be copied
@@ -77,13 +100,28 @@ class BinnedSurfaceMaterial : public ISurfaceMaterial {
   /// Scale operator
   ///
   /// @param scale is the scale factor for the full material
+  ///
+  /// @note Referenced external properties are copied before scaling.
+  ///       Each unique palette entry is scaled only once.
   BinnedSurfaceMaterial& operator*=(double scale) final;
 
   /// Return the BinUtility
   const BinUtility& binUtility() const;
 
   /// @copydoc SurfaceMaterial::fullMaterial
-  const MaterialPropertiesMatrix& fullMaterial() const;
+  ///
+  /// @note This expands the full matrix, one entry per bin, and is
+  ///       intended for conversion; use materialProperties(size_t, size_t)
+  ///       for the lookup of single bins.
+  MaterialPropertiesMatrix fullMaterial() const;
+
+  /// Return the unique MaterialProperties of owned material
+  ///
+  /// @note This is empty if the material references external storage.
+  const MaterialPropertiesVector& palette() const;
+
+  /// Whether the material references external storage.
+  bool isShared() const;
 
   /// @copydoc SurfaceMaterial::materialProperties(const Vector2D&)
   const MaterialProperties& materialProperties(const Vector2D& lp) const final;
@@ -102,21 +140,41 @@ class BinnedSurfaceMaterial : public ISurfaceMaterial {
   /// The helper for the bin finding
   BinUtility m_binUtility;
 
-  /// The five different MaterialProperties
-  MaterialPropertiesMatrix m_fullMaterial;
+  /// Build the palette and bin indices from the full matrix
+  void fillPalette(const MaterialPropertiesMatrix& fullProperties);
+
+  /// The unique MaterialProperties
+  MaterialPropertiesVector m_palette;
+
+  /// Palette index per bin, the first dimension running fastest
+  std::vector<uint32_t> m_paletteIndices;
+
+  /// Referenced external MaterialProperties, if any
+  std::shared_ptr<const MaterialProperties> m_sharedMaterial;
+
+  /// Number of bins along the first dimension
+  size_t m_bins0 = 0;
 };
 
 inline const BinUtility& BinnedSurfaceMaterial::binUtility() const {
   return (m_binUtility);
 }
 
-inline const MaterialPropertiesMatrix& BinnedSurfaceMaterial::fullMaterial()
+inline const MaterialPropertiesVector& BinnedSurfaceMaterial::palette()
     const {
-  return m_fullMaterial;
+  return m_palette;
+}
+
+inline bool BinnedSurfaceMaterial::isShared() const {
+  return (m_sharedMaterial != nullptr);
 }
 
 inline const MaterialProperties& BinnedSurfaceMaterial::materialProperties(
     size_t bin0, size_t bin1) const {
-  return m_fullMaterial[bin1][bin0];
+  const size_t bin = bin1 * m_bins0 + bin0;
+  if (m_sharedMaterial) {
+    return m_sharedMaterial.get()[bin];
+  }
+  return m_palette[m_paletteIndices[bin]];
 }
 }  // namespace Acts
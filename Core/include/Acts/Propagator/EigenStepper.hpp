@@ -13,10 +13,12 @@
 #include <limits>
 
 #include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/MagneticField/ConstantBField.hpp"
 #include "Acts/Propagator/DefaultExtension.hpp"
 #include "Acts/Propagator/DenseEnvironmentExtension.hpp"
 #include "Acts/Propagator/EigenStepperError.hpp"
 #include "Acts/Propagator/StepperExtensionList.hpp"
+#include "Acts/Propagator/detail/AnalyticalTransport.hpp"
 #include "Acts/Propagator/detail/Auctioneer.hpp"
 #include "Acts/Propagator/detail/SteppingHelper.hpp"
 #include "Acts/Utilities/Intersection.hpp"
@@ -51,6 +53,13 @@ class EigenStepper {
   using CurvilinearState = std::tuple<CurvilinearParameters, Jacobian, double>;
   using BField = bfield_t;
 
+  /// In a homogeneous field and without extensions that alter the momentum
+  /// the trajectory is a helix and its transport jacobian is evaluated
+  /// analytically instead of from the Runge-Kutta integration.
+  static constexpr bool s_analyticalTransport =
+      std::is_same_v<bfield_t, ConstantBField> and
+      std::is_same_v<extensionlist_t, StepperExtensionList<DefaultExtension>>;
+
   /// @brief State for track parameter propagation
   ///
   /// It contains the stepping information and is provided thread local
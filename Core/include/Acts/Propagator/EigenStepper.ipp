@@ -170,7 +170,23 @@ Acts::Result<double> Acts::EigenStepper<B, E, A>::step(
   const double h = state.stepping.stepSize;
 
   // When doing error propagation, update the associated Jacobian matrix
-  if (state.stepping.covTransport) {
+  if constexpr (s_analyticalTransport) {
+    if (!state.stepping.extension.finalize(state, *this, h)) {
+      return EigenStepperError::StepInvalid;
+    }
+    if (state.stepping.covTransport) {
+      // Evaluate dt/dlambda
+      const double mass = state.options.mass;
+      const double dtdlambda =
+          h * mass * mass * state.stepping.q /
+          (state.stepping.p * std::hypot(1., mass / state.stepping.p));
+      // The closed-form helix step transport, using the direction at the
+      // start of the step
+      detail::transportHelix(state.stepping.jacTransport, state.stepping.dir,
+                             state.stepping.q / state.stepping.p, sd.B_first,
+                             h, dtdlambda);
+    }
+  } else if (state.stepping.covTransport) {
     // The step transport matrix in global coordinates
     FreeMatrix D;
     if (!state.stepping.extension.finalize(state, *this, h, D)) {
@@ -0,0 +1,114 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Propagator/EigenStepper.hpp"
+
+namespace Acts {
+
+/// @brief Runge-Kutta-Nystroem stepper with single precision integration
+///
+/// This stepper solves the same equations of motion as the @c EigenStepper,
+/// but evaluates the Runge-Kutta stages, the magnetic field and the error
+/// estimate in single precision. The global position, direction, time and
+/// path length are still accumulated in double precision, i.e. only the
+/// per-step increments are computed in single precision. This is sufficient
+/// for applications with relaxed precision requirements, e.g. online
+/// reconstruction, and can be combined with a single precision field map.
+///
+/// The stepper state, and therefore all bound and curvilinear state
+/// conversions, are identical to the @c EigenStepper. The covariance is
+/// always transported in double precision. By default the transport jacobian
+/// is evaluated from the single precision stages as in the @c EigenStepper.
+/// Optionally, it is approximated by the analytical jacobian of a helix in the
+/// field at the start of each step, which avoids the Runge-Kutta derivative
+/// evaluation. For a @c ConstantBField both are identical.
+///
+/// @tparam bfield_t The magnetic field type
+/// @tparam kLocalHelixTransport Approximate the transport jacobian by a helix
+///         in the local field
+template <typename bfield_t, bool kLocalHelixTransport = false>
+class MixedPrecisionEigenStepper : public EigenStepper<bfield_t> {
+ public:
+  using Base = EigenStepper<bfield_t>;
+  using State = typename Base::State;
+  using BField = bfield_t;
+
+  /// Constructor requires knowledge of the detector's magnetic field
+  MixedPrecisionEigenStepper(BField bField) : Base(std::move(bField)) {}
+
+  // The stepper concept checks the exact member function signatures of the
+  // stepper type itself, i.e. inherited members are not found. The unchanged
+  // interface of the base stepper is therefore re-exposed explicitly.
+
+  Vector3D getField(State& state, const Vector3D& pos) const {
+    return Base::getField(state, pos);
+  }
+  Vector3D position(const State& state) const {
+    return Base::position(state);
+  }
+  Vector3D direction(const State& state) const {
+    return Base::direction(state);
+  }
+  double momentum(const State& state) const { return Base::momentum(state); }
+  double charge(const State& state) const { return Base::charge(state); }
+  double time(const State& state) const { return Base::time(state); }
+  Intersection::Status updateSurfaceStatus(State& state, const Surface& surface,
+                                           const BoundaryCheck& bcheck) const {
+    return Base::updateSurfaceStatus(state, surface, bcheck);
+  }
+  void setStepSize(State& state, double stepSize,
+                   ConstrainedStep::Type stype = ConstrainedStep::actor) const {
+    Base::setStepSize(state, stepSize, stype);
+  }
+  void releaseStepSize(State& state) const { Base::releaseStepSize(state); }
+  std::string outputStepSize(const State& state) const {
+    return Base::outputStepSize(state);
+  }
+  double overstepLimit(const State& state) const {
+    return Base::overstepLimit(state);
+  }
+  typename Base::BoundState boundState(State& state,
+                                       const Surface& surface) const {
+    return Base::boundState(state, surface);
+  }
+  typename Base::CurvilinearState curvilinearState(State& state) const {
+    return Base::curvilinearState(state);
+  }
+  void update(State& state, const BoundParameters& pars) const {
+    Base::update(state, pars);
+  }
+  void update(State& state, const Vector3D& uposition,
+              const Vector3D& udirection, double up, double time) const {
+    Base::update(state, uposition, udirection, up, time);
+  }
+  void covarianceTransport(State& state) const {
+    Base::covarianceTransport(state);
+  }
+  void covarianceTransport(State& state, const Surface& surface) const {
+    Base::covarianceTransport(state, surface);
+  }
+
+  /// Perform a single precision Runge-Kutta track parameter propagation step
+  ///
+  /// @param [in,out] state is the propagation state associated with the track
+  /// parameters that are being propagated.
+  ///
+  ///                      the state contains the desired step size.
+  ///                      It can be negative during backwards track
+  ///                      propagation,
+  ///                      and since we're using an adaptive algorithm, it can
+  ///                      be modified by the stepper class during propagation.
+  template <typename propagator_state_t>
+  Result<double> step(propagator_state_t& state) const;
+};
+
+}  // namespace Acts
+
+#include "Acts/Propagator/MixedPrecisionEigenStepper.ipp"
@@ -0,0 +1,152 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+template <typename B, bool L>
+template <typename propagator_state_t>
+Acts::Result<double> Acts::MixedPrecisionEigenStepper<B, L>::step(
+    propagator_state_t& state) const {
+  auto& sd = state.stepping.stepData;
+  const auto& pos = state.stepping.pos;
+
+  // The extension is only used for the time propagation and the transport
+  // jacobian, but it still needs to be selected for this step
+  if (!state.stepping.extension.validExtensionForStep(state, *this)) {
+    return 0.;
+  }
+
+  // Single precision copies of the integration input
+  const Vector3F dir = state.stepping.dir.template cast<float>();
+  const float qop = state.stepping.q / state.stepping.p;
+  const float tolerance = state.options.tolerance;
+
+  // Runge-Kutta stages and field evaluations in single precision
+  Vector3F bFirst, bMiddle, bLast;
+  Vector3F k1, k2, k3, k4;
+  float errorEstimate = 0.;
+
+  // First Runge-Kutta point (at current position)
+  bFirst = this->getField(state.stepping, pos).template cast<float>();
+  k1 = qop * dir.cross(bFirst);
+
+  // The following functor performs a Runge-Kutta step of a certain size, up
+  // to the point where it can return an estimate of the local integration
+  // error. Only the offsets w.r.t. the current position are evaluated in
+  // single precision, the field is probed at the double precision positions.
+  const auto tryRungeKuttaStep = [&](const ConstrainedStep& step) -> bool {
+    const float h = step;
+    const float h2 = h * h;
+    const float halfH = 0.5f * h;
+
+    // Second and third Runge-Kutta point
+    const Vector3F offset1 = halfH * dir + 0.125f * h2 * k1;
+    const Vector3D pos1 = pos + offset1.template cast<double>();
+    bMiddle = this->getField(state.stepping, pos1).template cast<float>();
+    k2 = qop * (dir + halfH * k1).cross(bMiddle);
+    k3 = qop * (dir + halfH * k2).cross(bMiddle);
+
+    // Last Runge-Kutta point
+    const Vector3F offset2 = h * dir + 0.5f * h2 * k3;
+    const Vector3D pos2 = pos + offset2.template cast<double>();
+    bLast = this->getField(state.stepping, pos2).template cast<float>();
+    k4 = qop * (dir + h * k3).cross(bLast);
+
+    // Compute and check the local integration error estimate
+    errorEstimate =
+        std::max(h2 * (k1 - k2 - k3 + k4).template lpNorm<1>(), 1e-20f);
+    return (errorEstimate <= tolerance);
+  };
+
+  double stepSizeScaling = 1.;
+  size_t nStepTrials = 0;
+  // Select and adjust the appropriate Runge-Kutta step size as given
+  // ATL-SOFT-PUB-2009-001
+  while (!tryRungeKuttaStep(state.stepping.stepSize)) {
+    stepSizeScaling = std::min(
+        std::max(0.25, std::pow((state.options.tolerance /
+                                 std::abs(2. * errorEstimate)),
+                                0.25)),
+        4.);
+
+    state.stepping.stepSize = state.stepping.stepSize * stepSizeScaling;
+
+    // If step size becomes too small the particle remains at the initial
+    // place
+    if (state.stepping.stepSize * state.stepping.stepSize <
+        state.options.stepSizeCutOff * state.options.stepSizeCutOff) {
+      // Not moving due to too low momentum needs an aborter
+      return EigenStepperError::StepSizeStalled;
+    }
+
+    // If the parameter is off track too much or given stepSize is not
+    // appropriate
+    if (nStepTrials > state.options.maxRungeKuttaStepTrials) {
+      // Too many trials, have to abort
+      return EigenStepperError::StepSizeAdjustmentFailed;
+    }
+    nStepTrials++;
+  }
+
+  // use the adjusted step size
+  const double h = state.stepping.stepSize;
+  const float hF = h;
+
+  // Expose the stages in double precision, as used by the extension for the
+  // time propagation and the transport jacobian
+  sd.B_first = bFirst.template cast<double>();
+  sd.B_middle = bMiddle.template cast<double>();
+  sd.B_last = bLast.template cast<double>();
+  sd.k1 = k1.template cast<double>();
+  sd.k2 = k2.template cast<double>();
+  sd.k3 = k3.template cast<double>();
+  sd.k4 = k4.template cast<double>();
+  sd.kQoP = {0., 0., 0., 0.};
+
+  // When doing error propagation, update the associated Jacobian matrix
+  if constexpr (L or Base::s_analyticalTransport) {
+    if (!state.stepping.extension.finalize(state, *this, h)) {
+      return EigenStepperError::StepInvalid;
+    }
+    if (state.stepping.covTransport) {
+      // Evaluate dt/dlambda
+      const double mass = state.options.mass;
+      const double dtdlambda =
+          h * mass * mass * state.stepping.q /
+          (state.stepping.p * std::hypot(1., mass / state.stepping.p));
+      // The closed-form helix step transport in the field at the start of
+      // the step
+      detail::transportHelix(state.stepping.jacTransport, state.stepping.dir,
+                             state.stepping.q / state.stepping.p, sd.B_first,
+                             h, dtdlambda);
+    }
+  } else if (state.stepping.covTransport) {
+    // The step transport matrix in global coordinates
+    FreeMatrix transport;
+    if (!state.stepping.extension.finalize(state, *this, h, transport)) {
+      return EigenStepperError::StepInvalid;
+    }
+    state.stepping.jacTransport = transport * state.stepping.jacTransport;
+  } else {
+    if (!state.stepping.extension.finalize(state, *this, h)) {
+      return EigenStepperError::StepInvalid;
+    }
+  }
+
+  // Update the track parameters according to the equations of motion, the
+  // single precision increments are accumulated in double precision
+  const Vector3F dPos = hF * dir + hF * hF / 6.f * (k1 + k2 + k3);
+  const Vector3F dDir = hF / 6.f * (k1 + 2.f * (k2 + k3) + k4);
+  state.stepping.pos += dPos.template cast<double>();
+  state.stepping.dir += dDir.template cast<double>();
+  state.stepping.dir /= state.stepping.dir.norm();
+  if (state.stepping.covTransport) {
+    state.stepping.derivative.template head<3>() = state.stepping.dir;
+    state.stepping.derivative.template segment<3>(4) = sd.k4;
+  }
+  state.stepping.pathAccumulated += h;
+  return h;
+}
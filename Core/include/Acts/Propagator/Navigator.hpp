@@ -20,6 +20,7 @@
 #include "Acts/Propagator/ConstrainedStep.hpp"
 #include "Acts/Propagator/Propagator.hpp"
 #include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Utilities/Profiling.hpp"
 #include "Acts/Utilities/Units.hpp"
 
 namespace Acts {
@@ -230,6 +231,7 @@ class Navigator {
   /// @param [in] stepper Stepper in use
   template <typename propagator_state_t, typename stepper_t>
   void status(propagator_state_t& state, const stepper_t& stepper) const {
+    ACTS_PROFILE_SCOPE("Navigator::status");
     // Check if the navigator is inactive
     if (inactive(state, stepper)) {
       return;
@@ -373,6 +375,7 @@ class Navigator {
   /// @param [in] stepper Stepper in use
   template <typename propagator_state_t, typename stepper_t>
   void target(propagator_state_t& state, const stepper_t& stepper) const {
+    ACTS_PROFILE_SCOPE("Navigator::target");
     // Check if the navigator is inactive
     if (inactive(state, stepper)) {
       return;
@@ -7,11 +7,13 @@
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 #include "Acts/EventData/ParameterConcept.hpp"
+#include "Acts/Utilities/Profiling.hpp"
 
 template <typename S, typename N>
 template <typename result_t, typename propagator_state_t>
 auto Acts::Propagator<S, N>::propagate_impl(propagator_state_t& state) const
     -> Result<result_t> {
+  ACTS_PROFILE_SCOPE("Propagator::propagate");
   result_t result;
 
   // Pre-stepping call to the navigator and action list
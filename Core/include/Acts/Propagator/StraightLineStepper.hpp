@@ -16,6 +16,7 @@
 #include "Acts/MagneticField/MagneticFieldContext.hpp"
 #include "Acts/MagneticField/NullBField.hpp"
 #include "Acts/Propagator/ConstrainedStep.hpp"
+#include "Acts/Propagator/detail/AnalyticalTransport.hpp"
 #include "Acts/Propagator/detail/SteppingHelper.hpp"
 #include "Acts/Surfaces/Surface.hpp"
 #include "Acts/Utilities/Definitions.hpp"
@@ -317,18 +318,15 @@ class StraightLineStepper {
     state.stepping.t += h * dtds;
     // Propagate the jacobian
     if (state.stepping.covTransport) {
-      // The step transport matrix in global coordinates
-      FreeMatrix D = FreeMatrix::Identity();
-      D.block<3, 3>(0, 4) = ActsSymMatrixD<3>::Identity() * h;
-      // Extend the calculation by the time propagation
       // Evaluate dt/dlambda
-      D(3, 7) = h * state.options.mass * state.options.mass *
-                (state.stepping.q == 0. ? 1. : state.stepping.q) /
-                (state.stepping.p * dtds);
+      const double dtdlambda =
+          h * state.options.mass * state.options.mass *
+          (state.stepping.q == 0. ? 1. : state.stepping.q) /
+          (state.stepping.p * dtds);
       // Set the derivative factor the time
       state.stepping.derivative(3) = dtds;
-      // Update jacobian and derivative
-      state.stepping.jacTransport = D * state.stepping.jacTransport;
+      // Update jacobian and derivative with the closed-form step transport
+      detail::transportStraightLine(state.stepping.jacTransport, h, dtdlambda);
       state.stepping.derivative.template head<3>() = state.stepping.dir;
     }
     // state the path length
@@ -0,0 +1,48 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Utilities/Definitions.hpp"
+#include "Acts/Utilities/ParameterDefinitions.hpp"
+
+namespace Acts {
+
+/// @brief These functions update the free transport jacobian of a stepper with
+/// the closed-form jacobian of a single step, for the configurations where
+/// the trajectory is known analytically: a straight line without field and a
+/// helix in a homogeneous field.
+///
+/// The step jacobian of these trajectories does not depend on the start
+/// position and leaves the time and q/p rows untouched. Only the non-trivial
+/// blocks are applied to the transport jacobian, which avoids the full 8x8
+/// matrix multiplication per step.
+namespace detail {
+
+/// @brief Transport the jacobian along a straight line step
+///
+/// @param [in, out] transportJacobian Global jacobian since the last reset
+/// @param [in] h Signed step length
+/// @param [in] dtdlambda Derivative of the propagated time w.r.t. q/p
+void transportStraightLine(FreeMatrix& transportJacobian, double h,
+                           double dtdlambda);
+
+/// @brief Transport the jacobian along a helix step in a homogeneous field
+///
+/// @param [in, out] transportJacobian Global jacobian since the last reset
+/// @param [in] direction Normalised direction vector at the start of the step
+/// @param [in] qop Charge over momentum
+/// @param [in] bField The homogeneous magnetic field
+/// @param [in] h Signed step length
+/// @param [in] dtdlambda Derivative of the propagated time w.r.t. q/p
+void transportHelix(FreeMatrix& transportJacobian, const Vector3D& direction,
+                    double qop, const Vector3D& bField, double h,
+                    double dtdlambda);
+
+}  // namespace detail
+}  // namespace Acts
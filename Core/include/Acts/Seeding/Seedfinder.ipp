@@ -11,6 +11,7 @@
 #include <type_traits>
 
 #include "Acts/Seeding/SeedFilter.hpp"
+#include "Acts/Utilities/Profiling.hpp"
 
 namespace Acts {
 
@@ -39,6 +40,7 @@ template <typename sp_range_t>
 std::vector<Seed<external_spacepoint_t>>
 Seedfinder<external_spacepoint_t, platform_t>::createSeedsForGroup(
     sp_range_t bottomSPs, sp_range_t middleSPs, sp_range_t topSPs) const {
+  ACTS_PROFILE_SCOPE("Seedfinder::createSeedsForGroup");
   std::vector<Seed<external_spacepoint_t>> outputVec;
   for (auto spM : middleSPs) {
     float rM = spM->radius();
@@ -202,6 +202,15 @@ class AnnulusBounds : public DiscBounds {
   /// @return the poistion in the module polar coordiante system
   Vector2D stripXYToModulePC(const Vector2D& vStripXY) const;
 
+  /// Rotate a position in the strip polar system by the average phi, this is
+  /// the application of m_rotationStripPC without the affine transform
+  ///
+  /// @param lposition the position in the strip polar system
+  /// @return the rotated position in the strip polar system
+  Vector2D rotateStripPC(const Vector2D& lposition) const {
+    return Vector2D(lposition[eLOC_R], lposition[eLOC_PHI] - get(eAveragePhi));
+  }
+
   /// Private helper method
   Vector2D closestOnSegment(const Vector2D& a, const Vector2D& b,
                             const Vector2D& p,
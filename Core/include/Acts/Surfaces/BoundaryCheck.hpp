@@ -7,11 +7,13 @@
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 #pragma once
+#include <algorithm>
 #include <cfloat>
 #include <cmath>
 #include <iterator>
 #include <vector>
 
+#include "Acts/Surfaces/detail/ConvexPolygonEdges.hpp"
 #include "Acts/Surfaces/detail/VerticesHelper.hpp"
 #include "Acts/Utilities/Definitions.hpp"
 #include "Acts/Utilities/ParameterDefinitions.hpp"
@@ -69,6 +71,26 @@ class BoundaryCheck {
   template <typename Vector2DContainer>
   bool isInside(const Vector2D& point, const Vector2DContainer& vertices) const;
 
+  /// Check if the point is inside a polygon with precomputed edges.
+  ///
+  /// @param point   Test point
+  /// @param polygon Precomputed edge representation of a convex polygon
+  ///
+  /// Equivalent to the check against the polygon vertices, but points outside
+  /// of the tolerance-padded enclosing rectangle are rejected before any edge
+  /// is evaluated.
+  bool isInside(const Vector2D& point,
+                const detail::ConvexPolygonEdges& polygon) const;
+
+  /// Check a batch of points against a polygon with precomputed edges.
+  ///
+  /// @param points  Test points
+  /// @param polygon Precomputed edge representation of a convex polygon
+  /// @param inside  [out] one indicator per test point
+  void isInside(const std::vector<Vector2D>& points,
+                const detail::ConvexPolygonEdges& polygon,
+                std::vector<bool>& inside) const;
+
   /// Check if the point is inside a box aligned with the local axes.
   ///
   /// @param point   Test point
@@ -136,6 +158,9 @@ class BoundaryCheck {
   /// Check if the distance vector is within the absolute or relative limits.
   bool isTolerated(const Vector2D& delta) const;
 
+  /// Largest distance along each local axis that can still be tolerated.
+  Vector2D toleratedDistance() const;
+
   /// Compute vector norm based on the covariance.
   double squaredNorm(const Vector2D& x) const;
 
@@ -227,17 +252,68 @@ inline bool Acts::BoundaryCheck::isInside(
     //
     // This allows us to avoid the expensive computeClosestPointOnPolygon
     // computation in this simple case.
-    //
-    // TODO: When tolerance is not 0, we could also avoid this computation in
-    //       some cases by testing against a bounding box of the polygon, padded
-    //       on each side with our tolerance. Check if this optimization is
-    //       worthwhile in some production workflows, and if so implement it.
     return false;
-  } else {
-    // We are outside of the polygon, but there is a tolerance. Must find what
-    // the closest point on the polygon is and check if it's within tolerance.
-    auto closestPoint = computeClosestPointOnPolygon(point, vertices);
-    return isTolerated(closestPoint - point);
+  }
+  // The closest point on the polygon lies within its enclosing rectangle,
+  // points outside of the rectangle padded with the largest tolerated
+  // distance can thus be rejected without searching for the closest point.
+  Vector2D vmin = *std::begin(vertices);
+  Vector2D vmax = vmin;
+  for (const auto& vertex : vertices) {
+    vmin = vmin.cwiseMin(vertex);
+    vmax = vmax.cwiseMax(vertex);
+  }
+  const Vector2D padding = toleratedDistance();
+  if ((point.array() < (vmin - padding).array()).any() or
+      (point.array() > (vmax + padding).array()).any()) {
+    return false;
+  }
+  // We are outside of the polygon, but there is a tolerance. Must find what
+  // the closest point on the polygon is and check if it's within tolerance.
+  auto closestPoint = computeClosestPointOnPolygon(point, vertices);
+  return isTolerated(closestPoint - point);
+}
+
+inline bool Acts::BoundaryCheck::isInside(
+    const Vector2D& point, const detail::ConvexPolygonEdges& polygon) const {
+  if (m_type == Type::eNone) {
+    return true;
+  } else if (m_tolerance == Vector2D(0., 0.)) {
+    return polygon.isInside(point);
+  } else if (not polygon.isInsideBox(point, toleratedDistance())) {
+    return false;
+  } else if (polygon.isInside(point)) {
+    return true;
+  }
+  auto closestPoint = computeClosestPointOnPolygon(point, polygon.vertices());
+  return isTolerated(closestPoint - point);
+}
+
+inline void Acts::BoundaryCheck::isInside(
+    const std::vector<Vector2D>& points,
+    const detail::ConvexPolygonEdges& polygon,
+    std::vector<bool>& inside) const {
+  inside.resize(points.size());
+  if (m_type == Type::eNone) {
+    std::fill(inside.begin(), inside.end(), true);
+    return;
+  }
+  // resolve the check type and the padding once for the whole batch
+  const bool tolerated = (m_tolerance != Vector2D(0., 0.));
+  const Vector2D padding = tolerated ? toleratedDistance() : Vector2D(0., 0.);
+  for (size_t i = 0; i < points.size(); ++i) {
+    const Vector2D& point = points[i];
+    if (not polygon.isInsideBox(point, padding)) {
+      inside[i] = false;
+    } else if (polygon.isInside(point)) {
+      inside[i] = true;
+    } else if (tolerated) {
+      auto closestPoint =
+          computeClosestPointOnPolygon(point, polygon.vertices());
+      inside[i] = isTolerated(closestPoint - point);
+    } else {
+      inside[i] = false;
+    }
   }
 }
 
@@ -310,6 +386,21 @@ inline bool Acts::BoundaryCheck::isTolerated(const Vector2D& delta) const {
   }
 }
 
+inline Acts::Vector2D Acts::BoundaryCheck::toleratedDistance() const {
+  if (m_type == Type::eNone) {
+    return Vector2D(DBL_MAX, DBL_MAX);
+  } else if (m_type == Type::eAbsolute) {
+    return m_tolerance;
+  } else /* Type::eChi2 */ {
+    // for a fixed offset along one axis the Mahalanobis distance is smallest
+    // for the offset along the other axis that follows the correlation. it is
+    // given by the offset squared over the variance of this axis.
+    const double det = m_weight.determinant();
+    const Vector2D variance(m_weight(1, 1) / det, m_weight(0, 0) / det);
+    return (2 * m_tolerance[0] * variance).cwiseSqrt();
+  }
+}
+
 inline double Acts::BoundaryCheck::squaredNorm(const Vector2D& x) const {
   return (x.transpose() * m_weight * x).value();
 }
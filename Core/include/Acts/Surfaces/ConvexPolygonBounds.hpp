@@ -10,6 +10,7 @@
 
 #include "Acts/Surfaces/PlanarBounds.hpp"
 #include "Acts/Surfaces/RectangleBounds.hpp"
+#include "Acts/Surfaces/detail/ConvexPolygonEdges.hpp"
 #include "Acts/Utilities/Definitions.hpp"
 
 #include <boost/container/small_vector.hpp>
@@ -103,6 +104,15 @@ class ConvexPolygonBounds : public ConvexPolygonBoundsBase {
   bool inside(const Vector2D& lposition,
               const BoundaryCheck& bcheck) const final;
 
+  /// Return for each local 2D point of a batch whether it lies inside of the
+  /// bounds defined by this object.
+  /// @param lpositions The local positions to check
+  /// @param bcheck The `BoundaryCheck` object handling tolerances.
+  /// @param inside [out] Whether the points are inside
+  void insideBatch(const std::vector<Vector2D>& lpositions,
+                   const BoundaryCheck& bcheck,
+                   std::vector<bool>& inside) const final;
+
   /// Return the smallest distance to any point on the boundary of this bounds
   /// object.
   /// @param lposition The local position to get the distance to
@@ -126,6 +136,7 @@ class ConvexPolygonBounds : public ConvexPolygonBoundsBase {
  private:
   vertex_array m_vertices;
   RectangleBounds m_boundingBox;
+  detail::ConvexPolygonEdges m_edges;
 
   /// Return whether this bounds class is in fact convex
   /// throws a log error if not
@@ -164,6 +175,15 @@ class ConvexPolygonBounds<PolygonDynamic> : public ConvexPolygonBoundsBase {
   bool inside(const Vector2D& lposition,
               const BoundaryCheck& bcheck) const final;
 
+  /// Return for each local 2D point of a batch whether it lies inside of the
+  /// bounds defined by this object.
+  /// @param lpositions The local positions to check
+  /// @param bcheck The `BoundaryCheck` object handling tolerances.
+  /// @param inside [out] Whether the points are inside
+  void insideBatch(const std::vector<Vector2D>& lpositions,
+                   const BoundaryCheck& bcheck,
+                   std::vector<bool>& inside) const final;
+
   /// Return the smallest distance to any point on the boundary of this bounds
   /// object.
   /// @param lpos The lposition position to get the distance to
@@ -189,6 +209,7 @@ class ConvexPolygonBounds<PolygonDynamic> : public ConvexPolygonBoundsBase {
  private:
   boost::container::small_vector<Vector2D, 10> m_vertices;
   RectangleBounds m_boundingBox;
+  detail::ConvexPolygonEdges m_edges;
 
   /// Return whether this bounds class is in fact convex
   /// thorws a logic error if not
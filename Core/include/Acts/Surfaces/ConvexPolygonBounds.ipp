@@ -66,7 +66,9 @@ Acts::RectangleBounds Acts::ConvexPolygonBoundsBase::makeBoundingBox(
 template <int N>
 Acts::ConvexPolygonBounds<N>::ConvexPolygonBounds(
     const std::vector<Acts::Vector2D>& vertices) noexcept(false)
-    : m_vertices(), m_boundingBox(makeBoundingBox(vertices)) {
+    : m_vertices(),
+      m_boundingBox(makeBoundingBox(vertices)),
+      m_edges(vertices) {
   throw_assert(vertices.size() == N,
                "Size and number of given vertices do not match.");
   for (size_t i = 0; i < N; i++) {
@@ -78,18 +80,24 @@ Acts::ConvexPolygonBounds<N>::ConvexPolygonBounds(
 template <int N>
 Acts::ConvexPolygonBounds<N>::ConvexPolygonBounds(
     const vertex_array& vertices) noexcept(false)
-    : m_vertices(vertices), m_boundingBox(makeBoundingBox(vertices)) {
+    : m_vertices(vertices),
+      m_boundingBox(makeBoundingBox(vertices)),
+      m_edges(vertices) {
   checkConsistency();
 }
 
 template <int N>
 Acts::ConvexPolygonBounds<N>::ConvexPolygonBounds(
     const value_array& values) noexcept(false)
-    : m_vertices(), m_boundingBox(0., 0.) {
-  for (size_t i = 0; i < N; i++) {
-    m_vertices[i] = Vector2D(values[2 * i], values[2 * i + 1]);
-  }
-  makeBoundingBox(m_vertices);
+    : m_vertices([&values]() {
+        vertex_array vertices;
+        for (size_t i = 0; i < N; i++) {
+          vertices[i] = Vector2D(values[2 * i], values[2 * i + 1]);
+        }
+        return vertices;
+      }()),
+      m_boundingBox(makeBoundingBox(m_vertices)),
+      m_edges(m_vertices) {
   checkConsistency();
 }
 
@@ -101,7 +109,14 @@ Acts::SurfaceBounds::BoundsType Acts::ConvexPolygonBounds<N>::type() const {
 template <int N>
 bool Acts::ConvexPolygonBounds<N>::inside(
     const Acts::Vector2D& lposition, const Acts::BoundaryCheck& bcheck) const {
-  return bcheck.isInside(lposition, m_vertices);
+  return bcheck.isInside(lposition, m_edges);
+}
+
+template <int N>
+void Acts::ConvexPolygonBounds<N>::insideBatch(
+    const std::vector<Vector2D>& lpositions, const BoundaryCheck& bcheck,
+    std::vector<bool>& inside) const {
+  bcheck.isInside(lpositions, m_edges, inside);
 }
 
 template <int N>
@@ -10,6 +10,7 @@
 
 #include "Acts/Surfaces/PlanarBounds.hpp"
 #include "Acts/Surfaces/RectangleBounds.hpp"
+#include "Acts/Surfaces/detail/ConvexPolygonEdges.hpp"
 #include "Acts/Utilities/Definitions.hpp"
 #include "Acts/Utilities/ParameterDefinitions.hpp"
 
@@ -51,7 +52,8 @@ class DiamondBounds : public PlanarBounds {
                 -(*std::max_element(m_values.begin(), m_values.begin() + 2)),
                 -halfYneg},
             Vector2D{*std::max_element(m_values.begin(), m_values.begin() + 2),
-                     halfYpos}) {
+                     halfYpos}),
+        m_edges(vertices()) {
     checkConsistency();
   }
 
@@ -64,7 +66,8 @@ class DiamondBounds : public PlanarBounds {
             Vector2D{-(*std::max_element(values.begin(), values.begin() + 2)),
                      -values[eHalfLengthYneg]},
             Vector2D{*std::max_element(values.begin(), values.begin() + 2),
-                     values[eHalfLengthYpos]}) {}
+                     values[eHalfLengthYpos]}),
+        m_edges(vertices()) {}
 
   ~DiamondBounds() override = default;
 
@@ -85,6 +88,15 @@ class DiamondBounds : public PlanarBounds {
   bool inside(const Vector2D& lposition,
               const BoundaryCheck& bcheck) const final;
 
+  /// Inside check for a batch of local positions
+  ///
+  /// @param lpositions Local positions (assumed to be in right surface frame)
+  /// @param bcheck boundary check directive
+  /// @param inside [out] one indicator per local position
+  void insideBatch(const std::vector<Vector2D>& lpositions,
+                   const BoundaryCheck& bcheck,
+                   std::vector<bool>& inside) const final;
+
   /// Minimal distance to boundary ( > 0 if outside and <=0 if inside)
   ///
   /// @param lposition is the local position to check for the distance
@@ -116,6 +128,7 @@ class DiamondBounds : public PlanarBounds {
  private:
   std::array<double, eSize> m_values;
   RectangleBounds m_boundingBox;  ///< internal bounding box cache
+  detail::ConvexPolygonEdges m_edges;  ///< precomputed edges for inside checks
 
   /// Check the input values for consistency, will throw a logic_exception
   /// if consistency is not given
@@ -0,0 +1,115 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <vector>
+
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Surfaces/BoundaryCheck.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Utilities/Definitions.hpp"
+#include "Acts/Utilities/Intersection.hpp"
+
+namespace Acts {
+
+class DiscBounds;
+
+/// @class SurfaceBatchIntersector
+///
+/// Straight line intersections of many lines with one surface, or of one
+/// line with many surfaces.
+///
+/// The placement of each surface in the given geometry context is evaluated
+/// once at construction, together with the type specific quantities, i.e.
+/// the cylinder radius and the line bounds. Plane, disc, cylinder and line
+/// surfaces are then intersected with dedicated kernels that neither go
+/// through the virtual surface interface nor invert the surface transform.
+/// The results are those of `Surface::intersectionEstimate` up to rounding,
+/// all other surface types fall back to this method.
+///
+/// @note The surface transforms are assumed to be rigid, i.e. the inverse
+///       rotation is the transposed rotation
+/// @note Like `Surface::intersectionEstimate`, only the closest solution is
+///       returned for cylinders
+class SurfaceBatchIntersector {
+ public:
+  /// Constructor from the surfaces to be intersected
+  ///
+  /// @param gctx The geometry context in which the surfaces are placed
+  /// @param surfaces The surfaces, they have to outlive the intersector
+  ///
+  /// @throws std::invalid_argument if one of the surfaces is a nullptr
+  SurfaceBatchIntersector(const GeometryContext& gctx,
+                          std::vector<const Surface*> surfaces);
+
+  /// The surfaces in the order given at construction
+  const std::vector<const Surface*>& surfaces() const { return m_surfaces; }
+
+  /// Intersect one straight line with all surfaces
+  ///
+  /// @param position The start position of the line
+  /// @param direction The normalized direction of the line
+  /// @param bcheck The boundary check directive
+  /// @param intersections [out] One intersection per surface
+  void intersect(const Vector3D& position, const Vector3D& direction,
+                 const BoundaryCheck& bcheck,
+                 std::vector<SurfaceIntersection>& intersections) const;
+
+  /// Intersect many straight lines with one surface
+  ///
+  /// @param isurface The index of the surface
+  /// @param positions The start positions of the lines
+  /// @param directions The normalized directions of the lines
+  /// @param bcheck The boundary check directive
+  /// @param intersections [out] One intersection per line
+  void intersect(size_t isurface, const std::vector<Vector3D>& positions,
+                 const std::vector<Vector3D>& directions,
+                 const BoundaryCheck& bcheck,
+                 std::vector<SurfaceIntersection>& intersections) const;
+
+ private:
+  /// The intersection kernel used for a surface
+  enum class Kernel { ePlane, eDisc, eCylinder, eLine, eGeneric };
+
+  /// Precomputed placement of one surface
+  struct SurfaceData {
+    const Surface* surface = nullptr;
+    const SurfaceBounds* bounds = nullptr;
+    /// The disc bounds, nullptr for unbounded discs
+    const DiscBounds* discBounds = nullptr;
+    /// Whether the disc bounds cover the full azimuth
+    bool fullAzimuth = false;
+    Kernel kernel = Kernel::eGeneric;
+    /// The local axes as columns
+    RotationMatrix3D rotation = RotationMatrix3D::Identity();
+    Vector3D center = Vector3D::Zero();
+    /// Cylinder or line radius
+    double radius = 0.;
+    /// Line half length, negative for unbounded lines
+    double halfZ = -1.;
+    /// Radial tolerance of the cylinder on-surface check
+    double radialTolerance = 0.;
+  };
+
+  /// Intersect one line with one surface
+  ///
+  /// @param data The precomputed surface
+  /// @param position The start position of the line
+  /// @param direction The normalized direction of the line
+  /// @param bcheck The boundary check directive
+  Intersection intersect(const SurfaceData& data, const Vector3D& position,
+                         const Vector3D& direction,
+                         const BoundaryCheck& bcheck) const;
+
+  GeometryContext m_gctx;
+  std::vector<const Surface*> m_surfaces;
+  std::vector<SurfaceData> m_data;
+};
+
+}  // namespace Acts
@@ -8,6 +8,7 @@
 
 #pragma once
 #include <ostream>
+#include <vector>
 
 #include "Acts/Surfaces/BoundaryCheck.hpp"
 #include "Acts/Utilities/Definitions.hpp"
@@ -19,7 +20,7 @@ namespace Acts {
 /// Interface for surface bounds.
 ///
 /// Surface bounds provide:
-/// - inside() checks
+/// - inside() checks, for single positions or batches of positions
 /// - distance to boundary calculations
 /// - the BoundsType and a set of parameters to simplify persistency
 ///
@@ -68,6 +69,24 @@ class SurfaceBounds {
   virtual bool inside(const Vector2D& lposition,
                       const BoundaryCheck& bcheck) const = 0;
 
+  /// Inside check for a batch of local positions against the same bounds
+  ///
+  /// The default implementation calls the single position check for each
+  /// position. Bounds with a precomputed representation override it to
+  /// resolve the boundary check directive once for the whole batch.
+  ///
+  /// @param lpositions Local positions (assumed to be in right surface frame)
+  /// @param bcheck boundary check directive
+  /// @param inside [out] one indicator per local position
+  virtual void insideBatch(const std::vector<Vector2D>& lpositions,
+                           const BoundaryCheck& bcheck,
+                           std::vector<bool>& inside) const {
+    inside.resize(lpositions.size());
+    for (size_t i = 0; i < lpositions.size(); ++i) {
+      inside[i] = this->inside(lpositions[i], bcheck);
+    }
+  }
+
   /// Minimal distance to boundary ( > 0 if outside and <=0 if inside)
   ///
   /// @param lposition is the local position to check for the distance
@@ -11,6 +11,7 @@
 
 #include "Acts/Surfaces/PlanarBounds.hpp"
 #include "Acts/Surfaces/RectangleBounds.hpp"
+#include "Acts/Surfaces/detail/ConvexPolygonEdges.hpp"
 #include "Acts/Utilities/Definitions.hpp"
 #include "Acts/Utilities/ParameterDefinitions.hpp"
 
@@ -22,7 +23,8 @@ namespace Acts {
 ///
 /// @image html TrapezoidBounds.gif
 ///
-/// @todo can be speed optimized by calculating kappa/delta and caching it
+/// The edges of the trapezoid are precomputed at construction for the inside
+/// checks.
 
 class TrapezoidBounds : public PlanarBounds {
  public:
@@ -43,7 +45,8 @@ class TrapezoidBounds : public PlanarBounds {
   TrapezoidBounds(double halfXnegY, double halfXposY,
                   double halfY) noexcept(false)
       : m_values({halfXnegY, halfXposY, halfY}),
-        m_boundingBox(std::max(halfXnegY, halfXposY), halfY) {
+        m_boundingBox(std::max(halfXnegY, halfXposY), halfY),
+        m_edges(vertices()) {
     checkConsistency();
   }
 
@@ -54,7 +57,8 @@ class TrapezoidBounds : public PlanarBounds {
       : m_values(values),
         m_boundingBox(
             std::max(values[eHalfLengthXnegY], values[eHalfLengthXposY]),
-            values[eHalfLengthY]) {
+            values[eHalfLengthY]),
+        m_edges(vertices()) {
     checkConsistency();
   }
 
@@ -111,6 +115,15 @@ class TrapezoidBounds : public PlanarBounds {
   bool inside(const Vector2D& lposition,
               const BoundaryCheck& bcheck) const final;
 
+  /// Inside check for a batch of local positions
+  ///
+  /// @param lpositions Local positions (assumed to be in right surface frame)
+  /// @param bcheck boundary check directive
+  /// @param inside [out] one indicator per local position
+  void insideBatch(const std::vector<Vector2D>& lpositions,
+                   const BoundaryCheck& bcheck,
+                   std::vector<bool>& inside) const final;
+
   /// Minimal distance to boundary ( > 0 if outside and <=0 if inside)
   ///
   /// @param lposition is the local position to check for the distance
@@ -142,6 +155,8 @@ class TrapezoidBounds : public PlanarBounds {
  private:
   std::array<double, eSize> m_values;
   RectangleBounds m_boundingBox;
+  /// Precomputed edges for the inside checks
+  detail::ConvexPolygonEdges m_edges;
 
   /// Check the input values for consistency, will throw a logic_exception
   /// if consistency is not given
@@ -0,0 +1,105 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <iterator>
+#include <vector>
+
+#include "Acts/Utilities/Definitions.hpp"
+
+namespace Acts {
+namespace detail {
+
+/// Precomputed edge representation of a convex polygon.
+///
+/// Each edge is stored as the line equation `a * x + b * y + c = 0` with the
+/// normal `(a, b)` pointing into the polygon, i.e. a point is inside if the
+/// line equations of all edges are non-negative. The coefficients are stored
+/// as one array per coefficient such that the evaluation of all edges is a
+/// single vectorized expression. The vertices and the enclosing rectangle
+/// are kept for the fast rejection and the tolerance based checks.
+///
+/// All quantities are computed once at construction, the inside checks do
+/// not allocate.
+class ConvexPolygonEdges {
+ public:
+  using Coefficients = Eigen::Array<double, Eigen::Dynamic, 1>;
+
+  /// Construct from the polygon vertices
+  ///
+  /// @param vertices Forward iterable container of convex polygon vertices
+  ///                 in either orientation, `*it` must be convertible to
+  ///                 an `Acts::Vector2D`
+  template <typename vertex_container_t>
+  explicit ConvexPolygonEdges(const vertex_container_t& vertices)
+      : m_vertices(std::begin(vertices), std::end(vertices)) {
+    const size_t n = m_vertices.size();
+    m_a.resize(n);
+    m_b.resize(n);
+    m_c.resize(n);
+    m_min = m_vertices.front();
+    m_max = m_vertices.front();
+    // twice the signed area defines the orientation of the vertices
+    double area = 0.;
+    for (size_t i = 0; i < n; ++i) {
+      const Vector2D& v0 = m_vertices[i];
+      const Vector2D& v1 = m_vertices[(i + 1) % n];
+      area += v0.x() * v1.y() - v1.x() * v0.y();
+      m_min = m_min.cwiseMin(v0);
+      m_max = m_max.cwiseMax(v0);
+    }
+    const double orientation = (area < 0.) ? -1. : 1.;
+    for (size_t i = 0; i < n; ++i) {
+      const Vector2D& v0 = m_vertices[i];
+      const Vector2D edge = m_vertices[(i + 1) % n] - v0;
+      m_a[i] = -orientation * edge.y();
+      m_b[i] = orientation * edge.x();
+      m_c[i] = -(m_a[i] * v0.x() + m_b[i] * v0.y());
+    }
+  }
+
+  /// Check if a point is inside the polygon or on its boundary
+  ///
+  /// @param point Test point
+  bool isInside(const Vector2D& point) const {
+    return isInsideBox(point, Vector2D(0., 0.)) and
+           ((m_a * point.x() + m_b * point.y() + m_c) >= 0.).all();
+  }
+
+  /// Check if a point is inside the enclosing rectangle
+  ///
+  /// @param point Test point
+  /// @param padding Extension of the rectangle along each local axis
+  bool isInsideBox(const Vector2D& point, const Vector2D& padding) const {
+    return (m_min.x() - padding.x() <= point.x()) and
+           (point.x() <= m_max.x() + padding.x()) and
+           (m_min.y() - padding.y() <= point.y()) and
+           (point.y() <= m_max.y() + padding.y());
+  }
+
+  /// The polygon vertices in the order given at construction
+  const std::vector<Vector2D>& vertices() const { return m_vertices; }
+
+  /// Lower left corner of the enclosing rectangle
+  const Vector2D& min() const { return m_min; }
+
+  /// Upper right corner of the enclosing rectangle
+  const Vector2D& max() const { return m_max; }
+
+ private:
+  std::vector<Vector2D> m_vertices;
+  Coefficients m_a;
+  Coefficients m_b;
+  Coefficients m_c;
+  Vector2D m_min;
+  Vector2D m_max;
+};
+
+}  // namespace detail
+}  // namespace Acts
@@ -29,6 +29,7 @@
 #include "Acts/Utilities/Definitions.hpp"
 #include "Acts/Utilities/Helpers.hpp"
 #include "Acts/Utilities/Logger.hpp"
+#include "Acts/Utilities/Profiling.hpp"
 #include "Acts/Utilities/Result.hpp"
 
 #include <functional>
@@ -1096,6 +1097,7 @@ class CombinatorialKalmanFilter {
              const start_parameters_t& sParameters,
              const CombinatorialKalmanFilterOptions<source_link_selector_t>&
                  tfOptions) const {
+    ACTS_PROFILE_SCOPE("CombinatorialKalmanFilter::findTracks");
     using SourceLink = typename source_link_container_t::value_type;
     static_assert(SourceLinkConcept<SourceLink>,
                   "Source link does not fulfill SourceLinkConcept");
@@ -0,0 +1,162 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Acts/Utilities/Logger.hpp"
+
+namespace Acts {
+namespace Logging {
+
+/// @brief background writer for debug messages
+///
+/// Every thread that logs through the sink appends its messages to its own
+/// fixed-size ring buffer without locking. A single writer thread drains the
+/// buffers and runs the print policy of each message, i.e. all decorators
+/// and the final output. Messages of a single thread keep their order,
+/// messages of different threads may be interleaved differently than they
+/// were issued.
+///
+/// The buffer of a thread is released once the thread has exited and its
+/// remaining messages are written.
+///
+/// A sink can be shared by any number of loggers.
+class AsyncSink {
+ public:
+  /// @brief constructor
+  ///
+  /// @param [in] capacity     number of pending messages per thread
+  /// @param [in] pollInterval sleep time of the idle writer thread
+  explicit AsyncSink(
+      size_t capacity = 4096,
+      std::chrono::microseconds pollInterval = std::chrono::milliseconds(1));
+
+  /// @brief destructor
+  ///
+  /// All pending messages are written before the writer thread is stopped.
+  ~AsyncSink();
+
+  AsyncSink(const AsyncSink&) = delete;
+  AsyncSink& operator=(const AsyncSink&) = delete;
+
+  /// @brief queue a debug message for the writer thread
+  ///
+  /// @param [in] output  print policy used to write the message
+  /// @param [in] lvl     debug level of the message
+  /// @param [in] message text of the message
+  ///
+  /// @pre @p output must stay alive until the message is written, see flush()
+  /// @note This waits for the writer thread if the buffer of the calling
+  ///       thread is full.
+  /// @note Messages issued after the thread-local storage of the calling
+  ///       thread was destroyed, e.g. from the destructor of another
+  ///       thread-local or static object, are written directly after all
+  ///       previously queued messages.
+  void push(OutputPrintPolicy& output, const Level& lvl, std::string message);
+
+  /// @brief wait until all messages queued before the call are written
+  void flush();
+
+  /// @brief number of thread buffers currently held by the sink
+  size_t numThreadBuffers() const;
+
+ private:
+  class Buffer;
+  class ThreadBuffers;
+
+  /// buffer of the calling thread; created on first use
+  ///
+  /// @return nullptr if the thread-local storage is already destroyed
+  Buffer* threadBuffer();
+  /// write all pending messages
+  ///
+  /// @return @c true if any message was written
+  bool drain();
+  /// main loop of the writer thread
+  void run();
+
+  /// unique identifier to find the thread buffers of this sink
+  const uint64_t m_id;
+  size_t m_capacity;
+  std::chrono::microseconds m_pollInterval;
+
+  /// guards the buffer list and the flush bookkeeping
+  mutable std::mutex m_mutex;
+  std::condition_variable m_wakeWriter;
+  std::condition_variable m_flushed;
+  std::vector<std::shared_ptr<Buffer>> m_buffers;
+  /// serialises the writer thread and direct writes of exiting threads
+  std::mutex m_outputMutex;
+  uint64_t m_flushRequested = 0u;
+  uint64_t m_flushDone = 0u;
+  bool m_stop = false;
+
+  std::thread m_writer;
+};
+
+/// @brief print policy deferring the output to an asynchronous sink
+///
+/// The message text is queued together with its origin. The wrapped print
+/// policy, including all decorators, runs on the writer thread of the sink.
+/// Error and fatal messages wait until they are written.
+class AsyncPrintPolicy final : public OutputPrintPolicy {
+ public:
+  /// @brief constructor
+  ///
+  /// @param [in] sink   sink which writes the messages
+  /// @param [in] output print policy used on the writer thread
+  AsyncPrintPolicy(std::shared_ptr<AsyncSink> sink,
+                   std::unique_ptr<OutputPrintPolicy> output);
+
+  /// @brief destructor
+  ///
+  /// Waits until all pending messages are written.
+  ~AsyncPrintPolicy() override;
+
+  /// @brief queue the debug message
+  ///
+  /// @param [in] lvl   debug level of debug message
+  /// @param [in] input text of debug message
+  void flush(const Level& lvl, const std::ostringstream& input) final;
+
+ private:
+  /// sink which writes the messages
+  std::shared_ptr<AsyncSink> m_sink;
+
+  /// print policy used on the writer thread
+  std::unique_ptr<OutputPrintPolicy> m_output;
+};
+}  // namespace Logging
+
+/// @brief get asynchronous debug output logger
+///
+/// @param [in] name       name of the logger instance
+/// @param [in] lvl        debug threshold level
+/// @param [in] sink       sink which writes the messages
+/// @param [in] log_stream output stream used for printing debug messages
+///
+/// This function returns a pointer to a Logger instance with the same
+/// decorations as the default logger. Messages are formatted and written
+/// on the writer thread of the given sink.
+///
+/// @return pointer to logging instance
+std::unique_ptr<const Logger> getAsyncLogger(
+    const std::string& name, const Logging::Level& lvl,
+    std::shared_ptr<Logging::AsyncSink> sink,
+    std::ostream* log_stream = &std::cout);
+
+}  // namespace Acts
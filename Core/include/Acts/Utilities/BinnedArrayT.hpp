@@ -0,0 +1,270 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "Acts/Utilities/BinUtility.hpp"
+#include "Acts/Utilities/BinnedArray.hpp"
+#include "Acts/Utilities/BinnedArrayXD.hpp"
+#include "Acts/Utilities/BinningType.hpp"
+#include "Acts/Utilities/Helpers.hpp"
+
+namespace Acts {
+
+/// @class BinnedArrayT
+///
+/// One-dimensional binned array with the binning value and the binning type
+/// fixed at compile time.
+///
+/// This covers the open 1D binning used for layer and volume arrays. The
+/// objects are stored contiguously per bin and the bin is found without
+/// the runtime dispatch of the BinUtility: a clamped division for
+/// equidistant and a binary search in the boundaries for arbitrary binning.
+/// The bin utility is kept to serve the generic BinnedArray interface and
+/// the results are identical to the ones of the BinnedArrayXD.
+///
+/// @tparam T is the pointer type of the stored objects
+/// @tparam bValue is the binning value, one of binX, binY, binZ, binR
+/// @tparam bType is the binning type
+template <class T, BinningValue bValue, BinningType bType>
+class BinnedArrayT : public BinnedArray<T> {
+  static_assert(bValue == binX or bValue == binY or bValue == binZ or
+                    bValue == binR,
+                "Unsupported binning value");
+
+  /// typedef the object and position for readability
+  using TAP = std::pair<T, Vector3D>;
+
+ public:
+  /// Check whether a bin utility can be represented by this array
+  ///
+  /// @param bu is the bin utility to be checked
+  static bool accepts(const BinUtility& bu) {
+    if (bu.dimensions() != 1 or bu.transform() != nullptr) {
+      return false;
+    }
+    const BinningData& bData = bu.binningData()[0];
+    return (bData.binvalue == bValue and bData.type == bType and
+            bData.option == open and bData.subBinningData == nullptr);
+  }
+
+  /// Constructor with std::vector and a BinUtility
+  ///
+  /// @param tapvector is a vector of object and binning position
+  /// @param bu is the unique bin utility for this binned array
+  ///
+  /// @throws std::invalid_argument if the bin utility is not accepted
+  BinnedArrayT(const std::vector<TAP>& tapvector,
+               std::unique_ptr<const BinUtility> bu)
+      : BinnedArray<T>(), m_binUtility(std::move(bu)) {
+    if (not m_binUtility or not accepts(*m_binUtility)) {
+      throw std::invalid_argument(
+          "BinnedArrayT requires open 1D binning of matching value and type");
+    }
+    const BinningData& bData = m_binUtility->binningData()[0];
+    m_nBins = bData.bins();
+    m_min = bData.min;
+    m_step = bData.step;
+    m_boundaries = bData.boundaries();
+    m_objectGrid.assign(
+        1, std::vector<std::vector<T>>(1, std::vector<T>(m_nBins, nullptr)));
+    // fill in the same way as the BinnedArrayXD
+    m_arrayObjects.reserve(tapvector.size());
+    for (auto& tap : tapvector) {
+      if (m_binUtility->inside(tap.second)) {
+        m_objectGrid[0][0][m_binUtility->bin(tap.second, 0)] = tap.first;
+        if (std::find(m_arrayObjects.begin(), m_arrayObjects.end(),
+                      tap.first) == m_arrayObjects.end()) {
+          m_arrayObjects.push_back(tap.first);
+        }
+      }
+    }
+    m_objects = m_objectGrid[0][0].data();
+  }
+
+  /// Copy constructor
+  /// - not allowed, use the same array
+  BinnedArrayT(const BinnedArrayT& barr) = delete;
+
+  /// Assignment operator
+  /// - not allowed, use the same array
+  BinnedArrayT& operator=(const BinnedArrayT& barr) = delete;
+
+  /// Destructor
+  ~BinnedArrayT() override = default;
+
+  /// Returns the object in the array from a local position
+  ///
+  /// @param lposition is the local position for the bin search
+  /// @param bins is the bin triple filled during this access
+  ///
+  /// @return is the object in that bin
+  T object(const Vector2D& lposition, std::array<size_t, 3>& bins) const final {
+    // same convention as BinningData::value(const Vector2D&)
+    float value = (bValue == binX or bValue == binR) ? lposition[0]
+                                                      : lposition[1];
+    bins = {search(value), 0, 0};
+    return m_objects[bins[0]];
+  }
+
+  // satisfy overload / override
+  T object(const Vector2D& lposition) const override {
+    return m_objects[search(
+        (bValue == binX or bValue == binR) ? lposition[0] : lposition[1])];
+  }
+
+  /// Returns the object in the array from a global position
+  ///
+  /// @param position is the global position for the bin search
+  /// @param bins is the bins triple filled during access
+  ///
+  /// @return is the object in that bin
+  T object(const Vector3D& position, std::array<size_t, 3>& bins) const final {
+    bins = {search(value(position)), 0, 0};
+    return m_objects[bins[0]];
+  }
+
+  // satisfy overload / override
+  T object(const Vector3D& position) const override {
+    return m_objects[search(value(position))];
+  }
+
+  /// Return all unqiue object
+  /// @return vector of unique array objects
+  const std::vector<T>& arrayObjects() const final { return m_arrayObjects; }
+
+  /// Return the object grid
+  /// multiple entries are allowed and wanted
+  /// @return internal object grid
+  const std::vector<std::vector<std::vector<T>>>& objectGrid() const final {
+    return m_objectGrid;
+  }
+
+  /// Returns the object according to the bin triple
+  /// and their neighbour objects (if different)
+  ///
+  /// @param binTriple is the binning
+  ///
+  /// @return a vector of unique objects
+  std::vector<T> objectCluster(
+      const std::array<size_t, 3>& binTriple) const override {
+    std::vector<T> rvector;
+    size_t bin = binTriple[0];
+    T bObject = m_objects[bin];
+    size_t low = (0 < bin) ? bin - 1 : bin;
+    size_t high = (bin + 1 < m_nBins) ? bin + 1 : bin;
+    for (size_t b = low; b <= high; ++b) {
+      T object = m_objects[b];
+      if (object && object != bObject &&
+          std::find(rvector.begin(), rvector.end(), object) == rvector.end()) {
+        rvector.push_back(object);
+      }
+    }
+    return rvector;
+  }
+
+  /// Return the BinUtility
+  /// @return plain pointer to the bin utility of this array
+  const BinUtility* binUtility() const final { return (m_binUtility.get()); }
+
+ private:
+  /// The binning value of a global position
+  static float value(const Vector3D& position) {
+    if constexpr (bValue == binR) {
+      return VectorHelpers::perp(position);
+    } else {
+      return position[bValue];
+    }
+  }
+
+  /// The bin of a value, outside values are clamped to the boundary bins
+  size_t search(float value) const {
+    int bin = 0;
+    if constexpr (bType == equidistant) {
+      bin = (value - m_min) / m_step;
+    } else {
+      bin = std::upper_bound(m_boundaries.begin(), m_boundaries.end(), value) -
+            m_boundaries.begin() - 1;
+    }
+    return std::clamp(bin, 0, int(m_nBins - 1));
+  }
+
+  /// the data store - a 1x1xN grid for the interface
+  std::vector<std::vector<std::vector<T>>> m_objectGrid;
+  /// contiguous view of the objects per bin
+  const T* m_objects = nullptr;
+  /// Vector of unique Array objects
+  std::vector<T> m_arrayObjects;
+  /// binUtility for the interface and the filling
+  std::unique_ptr<const BinUtility> m_binUtility;
+  /// cached binning parameters
+  size_t m_nBins = 0;
+  float m_min = 0;
+  float m_step = 0;
+  std::vector<float> m_boundaries;
+};
+
+namespace detail {
+template <class T, BinningValue bValue>
+std::unique_ptr<const BinnedArray<T>> makeBinnedArrayT(
+    const std::vector<std::pair<T, Vector3D>>& tapvector,
+    std::unique_ptr<const BinUtility>& bu) {
+  if (BinnedArrayT<T, bValue, equidistant>::accepts(*bu)) {
+    return std::make_unique<const BinnedArrayT<T, bValue, equidistant>>(
+        tapvector, std::move(bu));
+  }
+  if (BinnedArrayT<T, bValue, arbitrary>::accepts(*bu)) {
+    return std::make_unique<const BinnedArrayT<T, bValue, arbitrary>>(
+        tapvector, std::move(bu));
+  }
+  return nullptr;
+}
+}  // namespace detail
+
+/// Create the fastest binned array for the given binning
+///
+/// Open 1D binning in x, y, z or r yields a BinnedArrayT, any other
+/// binning falls back to the generic BinnedArrayXD.
+///
+/// @param tapvector is a vector of object and binning position
+/// @param bu is the unique bin utility for this binned array
+template <class T>
+std::unique_ptr<const BinnedArray<T>> makeBinnedArray(
+    const std::vector<std::pair<T, Vector3D>>& tapvector,
+    std::unique_ptr<const BinUtility> bu) {
+  std::unique_ptr<const BinnedArray<T>> array;
+  if (bu->dimensions() == 1) {
+    switch (bu->binningData()[0].binvalue) {
+      case binX:
+        array = detail::makeBinnedArrayT<T, binX>(tapvector, bu);
+        break;
+      case binY:
+        array = detail::makeBinnedArrayT<T, binY>(tapvector, bu);
+        break;
+      case binZ:
+        array = detail::makeBinnedArrayT<T, binZ>(tapvector, bu);
+        break;
+      case binR:
+        array = detail::makeBinnedArrayT<T, binR>(tapvector, bu);
+        break;
+      default:
+        break;
+    }
+  }
+  if (not array) {
+    array = std::make_unique<const BinnedArrayXD<T>>(tapvector, std::move(bu));
+  }
+  return array;
+}
+
+}  // namespace Acts
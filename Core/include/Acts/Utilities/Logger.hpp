@@ -56,6 +56,33 @@
   };                                                                           \
   __local_acts_logger logger(log_object);
 
+/// @brief minimum debug level that is compiled in
+/// @ingroup Logging
+///
+/// Statements below this level are removed at compile time, including the
+/// run time level check and the evaluation of the message. The value is the
+/// numerical Acts::Logging::Level and set through the @c ACTS_LOG_MIN_LEVEL
+/// build option; all levels are kept by default.
+#ifndef ACTS_LOG_MIN_LEVEL
+#define ACTS_LOG_MIN_LEVEL 0
+#endif
+
+/// @brief macro for debug output with a given level
+/// @ingroup Logging
+///
+/// @param level debug level of type Acts::Logging::Level
+/// @param x debug message
+///
+/// @pre @c logger() must be a valid expression in the scope where this
+///      macro is used and it must return a Acts::Logger object.
+///
+/// The debug message is printed if the level is not below
+/// #ACTS_LOG_MIN_LEVEL and not below the current Acts::Logging::Level.
+#define ACTS_LOG(level, x)                                                     \
+  if constexpr ((level) >= ACTS_LOG_MIN_LEVEL)                                 \
+    if (logger().doPrint(level))                                               \
+      logger().log(level) << x;
+
 /// @brief macro for verbose debug output
 /// @ingroup Logging
 ///
@@ -66,9 +93,7 @@
 ///
 /// The debug message is printed if the current Acts::Logging::Level <=
 /// Acts::Logging::VERBOSE.
-#define ACTS_VERBOSE(x)                                                        \
-  if (logger().doPrint(Acts::Logging::VERBOSE))                                \
-    logger().log(Acts::Logging::VERBOSE) << x;
+#define ACTS_VERBOSE(x) ACTS_LOG(Acts::Logging::VERBOSE, x)
 
 /// @brief macro for debug debug output
 /// @ingroup Logging
@@ -80,9 +105,7 @@
 ///
 /// The debug message is printed if the current Acts::Logging::Level <=
 /// Acts::Logging::DEBUG.
-#define ACTS_DEBUG(x)                                                          \
-  if (logger().doPrint(Acts::Logging::DEBUG))                                  \
-    logger().log(Acts::Logging::DEBUG) << x;
+#define ACTS_DEBUG(x) ACTS_LOG(Acts::Logging::DEBUG, x)
 
 /// @brief macro for info debug output
 /// @ingroup Logging
@@ -94,9 +117,7 @@
 ///
 /// The debug message is printed if the current Acts::Logging::Level <=
 /// Acts::Logging::INFO.
-#define ACTS_INFO(x)                                                           \
-  if (logger().doPrint(Acts::Logging::INFO))                                   \
-    logger().log(Acts::Logging::INFO) << x;
+#define ACTS_INFO(x) ACTS_LOG(Acts::Logging::INFO, x)
 
 /// @brief macro for warning debug output
 /// @ingroup Logging
@@ -108,9 +129,7 @@
 ///
 /// The debug message is printed if the current Acts::Logging::Level <=
 /// Acts::Logging::WARNING.
-#define ACTS_WARNING(x)                                                        \
-  if (logger().doPrint(Acts::Logging::WARNING))                                \
-    logger().log(Acts::Logging::WARNING) << x;
+#define ACTS_WARNING(x) ACTS_LOG(Acts::Logging::WARNING, x)
 
 /// @brief macro for error debug output
 /// @ingroup Logging
@@ -122,9 +141,7 @@
 ///
 /// The debug message is printed if the current Acts::Logging::Level <=
 /// Acts::Logging::ERROR.
-#define ACTS_ERROR(x)                                                          \
-  if (logger().doPrint(Acts::Logging::ERROR))                                  \
-    logger().log(Acts::Logging::ERROR) << x;
+#define ACTS_ERROR(x) ACTS_LOG(Acts::Logging::ERROR, x)
 
 /// @brief macro for fatal debug output
 /// @ingroup Logging
@@ -136,9 +153,7 @@
 ///
 /// The debug message is printed if the current Acts::Logging::Level <=
 /// Acts::Logging::FATAL.
-#define ACTS_FATAL(x)                                                          \
-  if (logger().doPrint(Acts::Logging::FATAL))                                  \
-    logger().log(Acts::Logging::FATAL) << x;
+#define ACTS_FATAL(x) ACTS_LOG(Acts::Logging::FATAL, x)
 // clang-format on
 
 namespace Acts {
@@ -159,6 +174,36 @@ enum Level {
   FATAL         ///< FATAL level
 };
 
+/// @brief origin of a debug message
+///
+/// Messages can be printed after they were issued, e.g. on the writer thread
+/// of an asynchronous print policy. Decorators use the origin to report the
+/// time and thread of the original log statement.
+struct MessageOrigin {
+  /// time at which the message was issued
+  std::time_t time;
+  /// thread which issued the message
+  std::thread::id thread;
+};
+
+/// @cond
+namespace detail {
+/// origin of the deferred message that is currently flushed on this thread
+inline thread_local const MessageOrigin* t_deferredOrigin = nullptr;
+}  // namespace detail
+/// @endcond
+
+/// @brief get the origin of the debug message that is currently flushed
+///
+/// @return the origin of a deferred message if one is flushed on the calling
+///         thread, otherwise the current time and thread
+inline MessageOrigin currentMessageOrigin() {
+  if (detail::t_deferredOrigin != nullptr) {
+    return *detail::t_deferredOrigin;
+  }
+  return {std::time(nullptr), std::this_thread::get_id()};
+}
+
 /// @brief abstract base class for printing debug output
 ///
 /// Implementations of this interface need to define how and where to @a print
@@ -375,13 +420,12 @@ class TimedOutputDecorator final : public OutputDecorator {
   }
 
  private:
-  /// @brief get current time stamp
+  /// @brief get time stamp of the message
   ///
-  /// @return current time stamp as string
+  /// @return time stamp at which the message was issued as string
   std::string now() const {
     char buffer[20];
-    time_t t;
-    std::time(&t);
+    time_t t = currentMessageOrigin().time;
     std::strftime(buffer, sizeof(buffer), m_format.c_str(), localtime(&t));
     return buffer;
   }
@@ -410,7 +454,7 @@ class ThreadOutputDecorator final : public OutputDecorator {
   /// delegates the flushing of the whole message to its wrapped object.
   void flush(const Level& lvl, const std::ostringstream& input) override {
     std::ostringstream os;
-    os << std::left << std::setw(20) << std::this_thread::get_id()
+    os << std::left << std::setw(20) << currentMessageOrigin().thread
        << input.str();
     OutputDecorator::flush(lvl, os);
   }
@@ -0,0 +1,141 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace Acts {
+namespace Profiling {
+
+/// A single timed section.
+///
+/// Times are given in nanoseconds on the steady clock.
+struct Record {
+  /// Section name; must point to storage that outlives the collection.
+  const char* name = nullptr;
+  /// User-defined context, e.g. the event number.
+  uint64_t context = UINT64_MAX;
+  /// Sequential identifier of the recording thread.
+  uint32_t thread = 0u;
+  int64_t start = 0;
+  int64_t stop = 0;
+};
+
+/// Fixed-size ring buffer of records filled by a single thread.
+///
+/// Only the owning thread writes. Records are written before the head is
+/// published and can thus be read without locks from another thread once the
+/// owning thread does not record anymore. If the buffer is full, the oldest
+/// records are overwritten.
+class RecordBuffer {
+ public:
+  /// @param capacity is rounded up to the next power of two
+  /// @param thread is the sequential identifier of the owning thread
+  RecordBuffer(size_t capacity, uint32_t thread);
+
+  uint32_t thread() const { return m_thread; }
+  /// Add a record; only to be called from the owning thread.
+  void push(const char* name, uint64_t context, int64_t start, int64_t stop) {
+    uint64_t head = m_head.load(std::memory_order_relaxed);
+    Record& record = m_records[head & m_mask];
+    record.name = name;
+    record.context = context;
+    record.thread = m_thread;
+    record.start = start;
+    record.stop = stop;
+    m_head.store(head + 1, std::memory_order_release);
+  }
+  /// Append all available records to the output and clear the buffer.
+  ///
+  /// @return number of records that were overwritten and are lost
+  uint64_t drain(std::vector<Record>& output);
+
+ private:
+  std::vector<Record> m_records;
+  uint64_t m_mask;
+  uint32_t m_thread;
+  std::atomic<uint64_t> m_head{0u};
+  uint64_t m_tail = 0u;
+};
+
+namespace detail {
+extern std::atomic<bool> g_enabled;
+}  // namespace detail
+
+/// Enable or disable recording at runtime for all threads.
+///
+/// @param enabled whether records should be stored
+/// @param capacity is the number of records per thread for new buffers
+void setEnabled(bool enabled, size_t capacity = 1u << 16);
+/// Check whether recording is enabled.
+inline bool isEnabled() {
+  return detail::g_enabled.load(std::memory_order_relaxed);
+}
+/// Current steady clock time in nanoseconds.
+inline int64_t now() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+/// Set the context that is attached to records of the calling thread.
+void setThreadContext(uint64_t context);
+/// The record buffer of the calling thread; created on first use.
+RecordBuffer& threadBuffer();
+/// Collect the records of all threads sorted by start time.
+///
+/// Must only be called while no other thread is recording, e.g. after the
+/// event loop. The returned records are removed from the buffers.
+std::vector<Record> collect();
+
+/// Record the execution time of the enclosing scope if recording is enabled.
+class ScopedTimer {
+ public:
+  /// @param name must point to storage that outlives the collection
+  explicit ScopedTimer(const char* name)
+      : m_name(name), m_start(isEnabled() ? now() : INT64_MIN) {}
+  ~ScopedTimer() {
+    if (m_start != INT64_MIN) {
+      record(m_name, m_start, now());
+    }
+  }
+  ScopedTimer(const ScopedTimer&) = delete;
+  ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+  /// Store a record in the buffer of the calling thread.
+  static void record(const char* name, int64_t start, int64_t stop);
+
+ private:
+  const char* m_name;
+  int64_t m_start;
+};
+
+}  // namespace Profiling
+}  // namespace Acts
+
+#define ACTS_PROFILE_CONCAT_IMPL(a, b) a##b
+#define ACTS_PROFILE_CONCAT(a, b) ACTS_PROFILE_CONCAT_IMPL(a, b)
+
+/// Time the enclosing scope in core hot paths.
+///
+/// This compiles to nothing unless the library is built with
+/// `ACTS_ENABLE_PROFILING`. The name must be a string literal.
+#ifdef ACTS_ENABLE_PROFILING
+#define ACTS_PROFILE_SCOPE(name)                      \
+  ::Acts::Profiling::ScopedTimer ACTS_PROFILE_CONCAT( \
+      _actsProfileScope, __LINE__)(name)
+#else
+#define ACTS_PROFILE_SCOPE(name) \
+  do {                           \
+  } while (false)
+#endif
@@ -10,6 +10,8 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <iterator>
 #include <vector>
 #include "Acts/Utilities/IAxis.hpp"
 #include "Acts/Utilities/detail/AxisFwd.hpp"
@@ -284,6 +286,40 @@ class Axis<AxisType::Equidistant, bdt> final : public IAxis {
     return wrapBin(std::floor((x - getMin()) / getBinWidth()) + 1);
   }
 
+  /// @brief add the bin indices of many coordinates to global bin indices
+  ///
+  /// @tparam Point any type with point semantics supporting component access
+  ///               through @c operator[]
+  /// @param [in]     points points to look up along this axis
+  /// @param [in]     dim    component of the points along this axis
+  /// @param [in]     area   factor applied to the bin index of each point
+  /// @param [in,out] bins   global bin index of each point
+  ///
+  /// The bin index of each point is identical to getBin(). Open and bound
+  /// axes compute it with branch-free clamping instead of wrapBin().
+  template <class Point>
+  void addBins(const std::vector<Point>& points, size_t dim, size_t area,
+               std::vector<size_t>& bins) const {
+    if constexpr (bdt == AxisBoundaryType::Closed) {
+      for (size_t i = 0; i < points.size(); ++i) {
+        bins[i] += area * getBin(points[i][dim]);
+      }
+    } else {
+      constexpr int64_t first = (bdt == AxisBoundaryType::Open) ? 0 : 1;
+      const int64_t last =
+          (bdt == AxisBoundaryType::Open) ? m_bins + 1 : m_bins;
+      const double tmax = m_bins + 1.;
+      for (size_t i = 0; i < points.size(); ++i) {
+        // clamp before the integer conversion; NaN ends up at -1
+        const double t = std::min(
+            std::max(-1., (points[i][dim] - m_min) / m_width), tmax);
+        // floor(t) + 1 for t >= -1
+        const int64_t bin = static_cast<int64_t>(t) + 1 - (t < 0.);
+        bins[i] += area * std::min(std::max(bin, first), last);
+      }
+    }
+  }
+
   /// @brief get bin width
   ///
   /// @return constant width for all bins
@@ -390,7 +426,9 @@ class Axis<AxisType::Variable, bdt> final : public IAxis {
   /// Create a binning structure with @c nBins variable-sized bins from the
   /// given bin boundaries. @c nBins is given by the number of bin edges
   /// reduced by one.
-  Axis(std::vector<double> binEdges) : m_binEdges(std::move(binEdges)) {}
+  Axis(std::vector<double> binEdges) : m_binEdges(std::move(binEdges)) {
+    buildLookup();
+  }
 
   /// @brief returns whether the axis is equidistante
   ///
@@ -557,10 +595,49 @@ class Axis<AxisType::Variable, bdt> final : public IAxis {
   ///       bin with lower bound @c l and upper bound @c u.
   /// @note Bin indices start at @c 1. The underflow bin has the index @c 0
   ///       while the index <tt>nBins + 1</tt> indicates the overflow bin .
+  ///
+  /// A uniform lookup table gives the range of bin edges within the cell
+  /// containing the value, which is then searched with a binary search. The
+  /// result is identical to a binary search over all bin edges.
   size_t getBin(double x) const {
-    const auto it =
-        std::upper_bound(std::begin(m_binEdges), std::end(m_binEdges), x);
-    return wrapBin(std::distance(std::begin(m_binEdges), it));
+    // underflow; overflow including NaN
+    if (x < m_binEdges.front()) {
+      return wrapBin(0);
+    }
+    if (not(x < m_binEdges.back())) {
+      return wrapBin(m_binEdges.size());
+    }
+    const size_t cell =
+        std::min<size_t>((x - m_binEdges.front()) * m_lookupScale,
+                         m_lookup.size() - 2);
+    auto first = m_binEdges.begin() + m_lookup[cell];
+    auto last = m_binEdges.begin() + m_lookup[cell + 1];
+    // the rounded cell index can be off by one cell
+    if (first != m_binEdges.begin() and x < *std::prev(first)) {
+      first = m_binEdges.begin();
+    }
+    if (last != m_binEdges.end() and not(x < *last)) {
+      last = m_binEdges.end();
+    }
+    // number of bin edges <= x
+    return wrapBin(
+        std::distance(m_binEdges.begin(), std::upper_bound(first, last, x)));
+  }
+
+  /// @brief add the bin indices of many coordinates to global bin indices
+  ///
+  /// @tparam Point any type with point semantics supporting component access
+  ///               through @c operator[]
+  /// @param [in]     points points to look up along this axis
+  /// @param [in]     dim    component of the points along this axis
+  /// @param [in]     area   factor applied to the bin index of each point
+  /// @param [in,out] bins   global bin index of each point
+  template <class Point>
+  void addBins(const std::vector<Point>& points, size_t dim, size_t area,
+               std::vector<size_t>& bins) const {
+    for (size_t i = 0; i < points.size(); ++i) {
+      bins[i] += area * getBin(points[i][dim]);
+    }
   }
 
   /// @brief get bin width
@@ -571,7 +648,7 @@ class Axis<AxisType::Variable, bdt> final : public IAxis {
   /// @pre @c bin must be a valid bin index (excluding under-/overflow bins),
   ///      i.e. \f$1 \le \text{bin} \le \text{nBins}\f$
   double getBinWidth(size_t bin) const {
-    return m_binEdges.at(bin) - m_binEdges.at(bin - 1);
+    return m_binEdges[bin] - m_binEdges[bin - 1];
   }
 
   /// @brief get lower bound of bin
@@ -584,7 +661,7 @@ class Axis<AxisType::Variable, bdt> final : public IAxis {
   ///
   /// @note Bin intervals have a closed lower bound, i.e. the lower boundary
   ///       belongs to the bin with the given bin index.
-  double getBinLowerBound(size_t bin) const { return m_binEdges.at(bin - 1); }
+  double getBinLowerBound(size_t bin) const { return m_binEdges[bin - 1]; }
 
   /// @brief get upper bound of bin
   ///
@@ -596,7 +673,7 @@ class Axis<AxisType::Variable, bdt> final : public IAxis {
   ///
   /// @note Bin intervals have an open upper bound, i.e. the upper boundary
   ///       does @b not belong to the bin with the given bin index.
-  double getBinUpperBound(size_t bin) const { return m_binEdges.at(bin); }
+  double getBinUpperBound(size_t bin) const { return m_binEdges[bin]; }
 
   /// @brief get bin center
   ///
@@ -640,8 +717,47 @@ class Axis<AxisType::Variable, bdt> final : public IAxis {
   std::vector<double> getBinEdges() const override { return m_binEdges; }
 
  private:
+  /// Maximum number of lookup cells per bin
+  static constexpr size_t s_maxCellsPerBin = 16;
+
+  /// @brief fill the uniform lookup table for the bin search
+  ///
+  /// The axis range is divided into equal cells no wider than the narrowest
+  /// bin, but at most @c s_maxCellsPerBin cells per bin. For bins of similar
+  /// width every cell contains at most one bin edge. For strongly varying
+  /// widths, e.g. logarithmic bins, a cell can contain many bin edges. Entry
+  /// @c i stores the number of bin edges smaller or equal to the lower
+  /// boundary of cell @c i, the last entry the total number of bin edges.
+  void buildLookup() {
+    const double range = m_binEdges.back() - m_binEdges.front();
+    double minWidth = range;
+    for (size_t i = 1; i < m_binEdges.size(); ++i) {
+      minWidth = std::min(minWidth, m_binEdges[i] - m_binEdges[i - 1]);
+    }
+    const size_t nBins = getNBins();
+    size_t nCells = nBins;
+    if (0. < minWidth) {
+      nCells = std::clamp<double>(std::ceil(range / minWidth), nBins,
+                                  nBins * s_maxCellsPerBin);
+    }
+    m_lookupScale = (0. < range) ? nCells / range : 0.;
+    m_lookup.resize(nCells + 1);
+    auto edge = m_binEdges.begin();
+    for (size_t cell = 0; cell < nCells; ++cell) {
+      double low = m_binEdges.front() + cell * (range / nCells);
+      edge = std::upper_bound(edge, m_binEdges.end(), low);
+      m_lookup[cell] = std::distance(m_binEdges.begin(), edge);
+    }
+    m_lookup[nCells] = m_binEdges.size();
+  }
+
   /// vector of bin edges (sorted in ascending order)
   std::vector<double> m_binEdges;
+  /// upper bound edge index at the lower boundary of each lookup cell,
+  /// followed by the number of bin edges
+  std::vector<size_t> m_lookup;
+  /// number of lookup cells per unit length
+  double m_lookupScale = 0.;
 };
 }  // namespace detail
 
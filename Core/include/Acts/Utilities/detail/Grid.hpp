@@ -183,6 +183,23 @@ class Grid final {
     return globalBinFromLocalBins(localBinsFromPosition(point));
   }
 
+  /// @brief determine global indices for the bins containing many points
+  ///
+  /// @tparam Point any type with point semantics supporting component access
+  ///               through @c operator[]
+  ///
+  /// @param  [in]  points points to look up in the grid
+  /// @param  [out] bins   global index for the bin of each point
+  ///
+  /// @pre The given @c Point type must represent a point in d (or higher)
+  ///      dimensions where d is dimensionality of the grid.
+  /// @note This could be a under-/overflow bin along one or more axes.
+  template <class Point>
+  void globalBinsFromPositions(const std::vector<Point>& points,
+                               std::vector<size_t>& bins) const {
+    grid_helper::getGlobalBins(points, m_axes, bins);
+  }
+
   /// @brief determine global bin index from local bin indices along each axis
   ///
   /// @param  [in] localBins local bin indices along each axis
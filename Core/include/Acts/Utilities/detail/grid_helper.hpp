@@ -11,6 +11,7 @@
 #include <array>
 #include <tuple>
 #include <utility>
+#include <vector>
 #include "Acts/Utilities/IAxis.hpp"
 #include "Acts/Utilities/detail/Axis.hpp"
 
@@ -172,6 +173,17 @@ struct grid_helper_impl {
     grid_helper_impl<N - 1>::getLocalBinIndices(point, axes, indices);
   }
 
+  template <class Point, class... Axes>
+  static void getGlobalBins(const std::vector<Point>& points,
+                            const std::tuple<Axes...>& axes,
+                            std::vector<size_t>& bins, size_t area) {
+    const auto& thisAxis = std::get<N>(axes);
+    thisAxis.addBins(points, N, area, bins);
+    // make sure to account for under-/overflow bins
+    area *= (thisAxis.getNBins() + 2);
+    grid_helper_impl<N - 1>::getGlobalBins(points, axes, bins, area);
+  }
+
   template <class... Axes>
   static void getLocalBinIndices(size_t& bin, const std::tuple<Axes...>& axes,
                                  size_t& area,
@@ -316,6 +328,14 @@ struct grid_helper_impl<0u> {
     indices.at(0u) = thisAxis.getBin(point[0u]);
   }
 
+  template <class Point, class... Axes>
+  static void getGlobalBins(const std::vector<Point>& points,
+                            const std::tuple<Axes...>& axes,
+                            std::vector<size_t>& bins, size_t area) {
+    const auto& thisAxis = std::get<0u>(axes);
+    thisAxis.addBins(points, 0u, area, bins);
+  }
+
   template <class... Axes>
   static void getLocalBinIndices(size_t& bin,
                                  const std::tuple<Axes...>& /*axes*/,
@@ -530,6 +550,31 @@ struct grid_helper {
     return indices;
   }
 
+  /// @brief determine global bin indices for many points
+  ///
+  /// @tparam Point any type with point semantics supporting component access
+  ///               through @c operator[]
+  /// @tparam Axes parameter pack of axis types defining the grid
+  ///
+  /// @param  [in]  points points to look up in the grid
+  /// @param  [in]  axes   actual axis objects spanning the grid
+  /// @param  [out] bins   global bin index for each point
+  ///
+  /// The points are processed one axis at a time by the batched bin lookup
+  /// of each axis. The output vector is reused, i.e. it does not allocate if
+  /// its capacity suffices.
+  ///
+  /// @note This could be a under-/overflow bin along one or more axes.
+  template <class Point, class... Axes>
+  static void getGlobalBins(const std::vector<Point>& points,
+                            const std::tuple<Axes...>& axes,
+                            std::vector<size_t>& bins) {
+    constexpr size_t MAX = sizeof...(Axes) - 1;
+    bins.assign(points.size(), 0u);
+
+    grid_helper_impl<MAX>::getGlobalBins(points, axes, bins, 1u);
+  }
+
   /// @brief determine local bin index for each axis from global bin index
   ///
   /// @tparam Axes parameter pack of axis types defining the grid
@@ -9,11 +9,34 @@
 #pragma once
 
 #include <array>
+#include <type_traits>
 
 namespace Acts {
 
 namespace detail {
 
+/// @brief scalar type of the interpolation weights for a given value type
+///
+/// The weights are @c double by default. Values which define a @c Scalar
+/// type, e.g. Eigen vectors, are interpolated with weights of this type such
+/// that single precision values can be interpolated without conversion.
+///
+/// @tparam Value type of values to be interpolated
+template <typename Value, typename = void>
+struct interpolation_weight {
+  using type = double;
+};
+
+/// @cond
+template <typename Value>
+struct interpolation_weight<Value, std::void_t<typename Value::Scalar>> {
+  using type = typename Value::Scalar;
+};
+/// @endcond
+
+template <typename Value>
+using interpolation_weight_t = typename interpolation_weight<Value>::type;
+
 /// @brief check types for requirements needed by interpolation
 ///
 /// @tparam Point1 type for specifying geometric positions
@@ -37,8 +60,10 @@ template <typename Point1, typename Point2, typename Point3, typename Value>
 struct can_interpolate {
   template <typename C>
   static auto value_type_test(C* c)
-      -> decltype(C(std::declval<double>() * std::declval<C>() +
-                    std::declval<double>() * std::declval<C>()),
+      -> decltype(C(std::declval<interpolation_weight_t<C>>() *
+                        std::declval<C>() +
+                    std::declval<interpolation_weight_t<C>>() *
+                        std::declval<C>()),
                   std::true_type());
   template <typename C>
   static std::false_type value_type_test(...);
@@ -86,9 +111,10 @@ struct get_dimension<2u> {
 /// @tparam N      number of hyper box corners
 ///
 /// @note
-/// - Given @c U and @c V of value type @c T as well as two @c double @c a and
-/// @c b, then the following must be a valid expression <tt>a * U + b * V</tt>
-/// yielding an object which is (implicitly) convertible to @c T.
+/// - Given @c U and @c V of value type @c T as well as two weights @c a and
+/// @c b of type @c interpolation_weight_t<T>, then the following must be a
+/// valid expression <tt>a * U + b * V</tt> yielding an object which is
+/// (implicitly) convertible to @c T.
 /// - The @c Point types must represent d-dimensional positions and support
 /// coordinate access using @c operator[]. Coordinate indices must start at 0.
 /// - @c N is the number of hyper box corners which is \f$2^d\f$ where \f$d\f$
@@ -106,7 +132,8 @@ struct interpolate_impl {
   static T run(const Point1& pos, const Point2& lowerLeft,
                const Point3& upperRight, const std::array<T, N>& fields) {
     // get distance to lower boundary relative to total bin width
-    const double f = (pos[D] - lowerLeft[D]) / (upperRight[D] - lowerLeft[D]);
+    const interpolation_weight_t<T> f =
+        (pos[D] - lowerLeft[D]) / (upperRight[D] - lowerLeft[D]);
 
     std::array<T, (N >> 1)> newFields;
     for (size_t i = 0; i < N / 2; ++i) {
@@ -124,7 +151,8 @@ struct interpolate_impl<T, Point1, Point2, Point3, D, 2u> {
   static T run(const Point1& pos, const Point2& lowerLeft,
                const Point3& upperRight, const std::array<T, 2u>& fields) {
     // get distance to lower boundary relative to total bin width
-    const double f = (pos[D] - lowerLeft[D]) / (upperRight[D] - lowerLeft[D]);
+    const interpolation_weight_t<T> f =
+        (pos[D] - lowerLeft[D]) / (upperRight[D] - lowerLeft[D]);
 
     return (1 - f) * fields.at(0) + f * fields.at(1);
   }
@@ -10,6 +10,7 @@
 
 #include <map>
 #include <set>
+#include <vector>
 
 #include "Acts/EventData/TrackParameters.hpp"
 
@@ -55,6 +56,8 @@ class GaussianTrackDensity {
     double lowerBound = 0;
     // The upper bound
     double upperBound = 0;
+    // The input track this entry was created from
+    const input_track_t* track = nullptr;
   };
 
   /// @brief The Config struct
@@ -79,11 +82,21 @@ class GaussianTrackDensity {
   };
 
   /// @brief The State struct
+  ///
+  /// The track entries are kept sorted by their lower bound. Together with
+  /// the running maximum of the upper bounds this allows to select the
+  /// entries whose support contains a given z position with two binary
+  /// searches instead of looping over all tracks.
   struct State {
     // Constructor with size track map
-    State(unsigned int nTracks) { trackEntries.reserve(nTracks); }
-    // Vector to cache track information
+    State(unsigned int nTracks = 0) {
+      trackEntries.reserve(nTracks);
+      maxUpperBounds.reserve(nTracks);
+    }
+    // Vector to cache track information, sorted by lower bound
     std::vector<TrackEntry> trackEntries;
+    // Running maximum of the upper bounds of the sorted track entries
+    std::vector<double> maxUpperBounds;
   };
 
   /// Default constructor
@@ -129,11 +142,15 @@ class GaussianTrackDensity {
                        const std::function<BoundParameters(input_track_t)>&
                            extractParameters) const;
 
- private:
-  /// The configuration
-  Config m_cfg;
+  /// @brief Calculates z position of global maximum with Gaussian width
+  /// for the tracks already stored in the state
+  ///
+  /// @param state The track density state
+  ///
+  /// @return Pair of position of global maximum and Gaussian width
+  std::pair<double, double> globalMaximumWithWidth(State& state) const;
 
-  /// @brief Add a track to the set being considered
+  /// @brief Add tracks to the set being considered
   ///
   /// @param state The track density state
   /// @param trackList All input tracks
@@ -144,6 +161,25 @@ class GaussianTrackDensity {
                  const std::function<BoundParameters(input_track_t)>&
                      extractParameters) const;
 
+  /// @brief Remove tracks from the set being considered
+  ///
+  /// Tracks that are not part of the state (e.g. because they did not pass
+  /// the track selection) are ignored.
+  ///
+  /// @param state The track density state
+  /// @param trackList The tracks to be removed
+  void removeTracks(State& state,
+                    const std::vector<const input_track_t*>& trackList) const;
+
+ private:
+  /// The configuration
+  Config m_cfg;
+
+  /// @brief Recalculate the running maximum of the upper bounds
+  ///
+  /// @param state The track density state
+  void updateMaxUpperBounds(State& state) const;
+
   /// @brief Evaluate the density function and its two first
   /// derivatives at the specified coordinate along the beamline
   ///
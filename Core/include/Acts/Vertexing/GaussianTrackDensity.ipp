@@ -8,6 +8,9 @@
 
 #include <math.h>
 
+#include <algorithm>
+#include <limits>
+
 template <typename input_track_t>
 std::pair<double, double>
 Acts::GaussianTrackDensity<input_track_t>::globalMaximumWithWidth(
@@ -16,6 +19,13 @@ Acts::GaussianTrackDensity<input_track_t>::globalMaximumWithWidth(
     const {
   addTracks(state, trackList, extractParameters);
 
+  return globalMaximumWithWidth(state);
+}
+
+template <typename input_track_t>
+std::pair<double, double>
+Acts::GaussianTrackDensity<input_track_t>::globalMaximumWithWidth(
+    State& state) const {
   double maxPosition = 0.;
   double maxDensity = 0.;
   double maxSecondDerivative = 0.;
@@ -111,6 +121,46 @@ void Acts::GaussianTrackDensity<input_track_t>::addTracks(
 
     state.trackEntries.emplace_back(z0, constantTerm, linearTerm, quadraticTerm,
                                     zMin, zMax);
+    state.trackEntries.back().track = trk;
+  }
+
+  // Keep the entries sorted by lower bound for the density evaluation
+  std::stable_sort(state.trackEntries.begin(), state.trackEntries.end(),
+                   [](const TrackEntry& a, const TrackEntry& b) {
+                     return a.lowerBound < b.lowerBound;
+                   });
+  updateMaxUpperBounds(state);
+}
+
+template <typename input_track_t>
+void Acts::GaussianTrackDensity<input_track_t>::removeTracks(
+    State& state, const std::vector<const input_track_t*>& trackList) const {
+  if (trackList.empty()) {
+    return;
+  }
+  std::vector<const input_track_t*> sortedTracks(trackList);
+  std::sort(sortedTracks.begin(), sortedTracks.end());
+
+  // Erasing keeps the remaining entries sorted by lower bound
+  auto& entries = state.trackEntries;
+  entries.erase(std::remove_if(entries.begin(), entries.end(),
+                               [&sortedTracks](const TrackEntry& entry) {
+                                 return std::binary_search(sortedTracks.begin(),
+                                                           sortedTracks.end(),
+                                                           entry.track);
+                               }),
+                entries.end());
+  updateMaxUpperBounds(state);
+}
+
+template <typename input_track_t>
+void Acts::GaussianTrackDensity<input_track_t>::updateMaxUpperBounds(
+    State& state) const {
+  state.maxUpperBounds.resize(state.trackEntries.size());
+  double maxUpperBound = std::numeric_limits<double>::lowest();
+  for (size_t i = 0; i < state.trackEntries.size(); ++i) {
+    maxUpperBound = std::max(maxUpperBound, state.trackEntries[i].upperBound);
+    state.maxUpperBounds[i] = maxUpperBound;
   }
 }
 
@@ -119,8 +169,23 @@ std::tuple<double, double, double>
 Acts::GaussianTrackDensity<input_track_t>::trackDensityAndDerivatives(
     State& state, double z) const {
   GaussianTrackDensityStore densityResult(z);
-  for (const auto& trackEntry : state.trackEntries) {
-    densityResult.addTrackToDensity(trackEntry);
+  const auto& entries = state.trackEntries;
+  const auto& maxUpperBounds = state.maxUpperBounds;
+  // Only entries with a lower bound below z can contribute ...
+  auto last = std::lower_bound(
+      entries.begin(), entries.end(), z,
+      [](const TrackEntry& entry, double value) {
+        return entry.lowerBound < value;
+      });
+  size_t end = std::distance(entries.begin(), last);
+  // ... and all entries before the running maximum of the upper bounds
+  // exceeds z end before z
+  size_t begin = std::distance(
+      maxUpperBounds.begin(),
+      std::upper_bound(maxUpperBounds.begin(), maxUpperBounds.begin() + end,
+                       z));
+  for (size_t i = begin; i < end; ++i) {
+    densityResult.addTrackToDensity(entries[i]);
   }
   return densityResult.densityAndDerivatives();
 }
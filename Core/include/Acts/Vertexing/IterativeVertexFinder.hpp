@@ -62,6 +62,14 @@ class IterativeVertexFinder {
                 "Vertex fitter does not fulfill vertex fitter concept.");
   using Propagator_t = typename vfitter_t::Propagator_t;
   using Linearizer_t = typename vfitter_t::Linearizer_t;
+  using SeedFinderState_t = typename sfinder_t::State;
+
+  template <typename T, typename = int>
+  struct NeedsRemovedTracks : std::false_type {};
+
+  template <typename T>
+  struct NeedsRemovedTracks<T, decltype((void)T::tracksToRemove, 0)>
+      : std::true_type {};
 
  public:
   using InputTrack_t = typename vfitter_t::InputTrack_t;
@@ -167,11 +175,22 @@ class IterativeVertexFinder {
 
   /// @brief Method that calls seed finder to retrieve a vertex seed
   ///
+  /// If the seed finder state accepts removed tracks, the state is kept
+  /// between iterations and only the tracks removed from the seed tracks
+  /// since the previous call are handed to the seed finder. If the seed
+  /// finder then returns the vertex constraint, which signals that it could
+  /// not remove any of these tracks, the seed is searched again with a new
+  /// state.
+  ///
   /// @param seedTracks Seeding tracks
   /// @param vertexingOptions Vertexing options
+  /// @param seedFinderState The seed finder state
+  /// @param previousSeedTracks The sorted seed tracks of the previous call
   Result<Vertex<InputTrack_t>> getVertexSeed(
       const std::vector<const InputTrack_t*>& seedTracks,
-      const VertexingOptions<InputTrack_t>& vertexingOptions) const;
+      const VertexingOptions<InputTrack_t>& vertexingOptions,
+      SeedFinderState_t& seedFinderState,
+      std::vector<const InputTrack_t*>& previousSeedTracks) const;
 
   /// @brief Removes all tracks in perigeesToFit from seedTracks
   ///
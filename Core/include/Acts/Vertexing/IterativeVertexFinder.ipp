@@ -6,6 +6,9 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
+#include <algorithm>
+#include <iterator>
+
 template <typename vfitter_t, typename sfinder_t>
 auto Acts::IterativeVertexFinder<vfitter_t, sfinder_t>::find(
     const std::vector<const InputTrack_t*>& trackVector,
@@ -19,11 +22,16 @@ auto Acts::IterativeVertexFinder<vfitter_t, sfinder_t>::find(
   // List of vertices to be filled below
   std::vector<Vertex<InputTrack_t>> vertexCollection;
 
+  // Seed finder state and seed tracks used in the previous seeding
+  SeedFinderState_t seedFinderState;
+  std::vector<const InputTrack_t*> previousSeedTracks;
+
   int nInterations = 0;
   // begin iterating
   while (seedTracks.size() > 1 && nInterations < m_cfg.maxVertices) {
     /// Begin seeding
-    auto seedRes = getVertexSeed(seedTracks, vertexingOptions);
+    auto seedRes = getVertexSeed(seedTracks, vertexingOptions, seedFinderState,
+                                 previousSeedTracks);
     if (!seedRes.ok()) {
       return seedRes.error();
     }
@@ -149,10 +157,45 @@ auto Acts::IterativeVertexFinder<vfitter_t, sfinder_t>::find(
 template <typename vfitter_t, typename sfinder_t>
 auto Acts::IterativeVertexFinder<vfitter_t, sfinder_t>::getVertexSeed(
     const std::vector<const InputTrack_t*>& seedTracks,
-    const VertexingOptions<InputTrack_t>& vertexingOptions) const
+    const VertexingOptions<InputTrack_t>& vertexingOptions,
+    SeedFinderState_t& seedFinderState,
+    std::vector<const InputTrack_t*>& previousSeedTracks) const
     -> Result<Vertex<InputTrack_t>> {
-  typename sfinder_t::State state;
-  auto res = m_cfg.seedFinder.find(seedTracks, vertexingOptions, state);
+  bool reusedState = false;
+  if constexpr (NeedsRemovedTracks<SeedFinderState_t>::value) {
+    std::vector<const InputTrack_t*> sortedSeedTracks(seedTracks);
+    std::sort(sortedSeedTracks.begin(), sortedSeedTracks.end());
+    if (std::includes(previousSeedTracks.begin(), previousSeedTracks.end(),
+                      sortedSeedTracks.begin(), sortedSeedTracks.end())) {
+      seedFinderState.tracksToRemove.clear();
+      std::set_difference(previousSeedTracks.begin(), previousSeedTracks.end(),
+                          sortedSeedTracks.begin(), sortedSeedTracks.end(),
+                          std::back_inserter(seedFinderState.tracksToRemove));
+      reusedState = true;
+    } else {
+      // Tracks were added to the seed tracks, start from scratch
+      seedFinderState = SeedFinderState_t();
+    }
+    previousSeedTracks = std::move(sortedSeedTracks);
+  } else {
+    seedFinderState = SeedFinderState_t();
+  }
+  auto res =
+      m_cfg.seedFinder.find(seedTracks, vertexingOptions, seedFinderState);
+  // A seed finder with a cached state may return the vertex constraint to
+  // signal that none of the removed tracks contributed to its state, e.g.
+  // the GridDensityVertexFinder if they all failed its track selection.
+  // Seed again from scratch in that case, this yields the seed the finder
+  // would return without a cached state.
+  if (reusedState and res.ok() and not (*res).empty() and
+      (*res).back().fullPosition() ==
+          vertexingOptions.vertexConstraint.fullPosition() and
+      (*res).back().fullCovariance() ==
+          vertexingOptions.vertexConstraint.fullCovariance()) {
+    ACTS_DEBUG("Seed finder returned the vertex constraint, seed again.");
+    seedFinderState = SeedFinderState_t();
+    res = m_cfg.seedFinder.find(seedTracks, vertexingOptions, seedFinderState);
+  }
   if (res.ok()) {
     auto vertexCollection = *res;
     if (vertexCollection.empty()) {
@@ -48,16 +48,34 @@ class TrackDensityVertexFinder {
   struct Config {
     // The track density estimator
     track_density_t trackDensityEstimator;
+
+    // Cache the track density state between calls.
+    // If tracks are removed from the track collection, their entries are
+    // just removed from the cached state instead of extracting the track
+    // parameters and building the density state from scratch.
+    bool cacheDensityStateForTrackRemoval = false;
   };
 
-  /// @struct State State struct for fulfilling interface
-  struct State {};
+  /// @brief The State struct
+  ///
+  /// Only needed if cacheDensityStateForTrackRemoval == true
+  struct State {
+    // The cached track density state
+    typename track_density_t::State densityState;
+
+    // Store tracks that have been removed from track collection. These
+    // tracks will be removed from the density state
+    std::vector<const InputTrack_t*> tracksToRemove;
+
+    bool isInitialized = false;
+  };
 
   /// @brief Function that finds single vertex candidate
   ///
   /// @param trackVector Input track collection
   /// @param vertexingOptions Vertexing options
-  /// @param state State for fulfilling interfaces
+  /// @param state The state object to cache the track density state,
+  /// to be used if cacheDensityStateForTrackRemoval == true
   ///
   /// @return Vector of vertices, filled with a single
   ///         vertex (for consistent interfaces)
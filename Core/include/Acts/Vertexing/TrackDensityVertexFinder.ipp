@@ -10,13 +10,22 @@ template <typename vfitter_t, typename track_density_t>
 auto Acts::TrackDensityVertexFinder<vfitter_t, track_density_t>::find(
     const std::vector<const InputTrack_t*>& trackVector,
     const VertexingOptions<InputTrack_t>& vertexingOptions,
-    State& /*state*/) const -> Result<std::vector<Vertex<InputTrack_t>>> {
-  typename track_density_t::State densityState(trackVector.size());
+    State& state) const -> Result<std::vector<Vertex<InputTrack_t>>> {
+  if (m_cfg.cacheDensityStateForTrackRemoval && state.isInitialized) {
+    // Remove entries of tracks removed from track collection
+    m_cfg.trackDensityEstimator.removeTracks(state.densityState,
+                                             state.tracksToRemove);
+  } else {
+    state.densityState = typename track_density_t::State(trackVector.size());
+    m_cfg.trackDensityEstimator.addTracks(state.densityState, trackVector,
+                                          m_extractParameters);
+    state.isInitialized = m_cfg.cacheDensityStateForTrackRemoval;
+  }
+  state.tracksToRemove.clear();
 
   // Calculate z seed position
   std::pair<double, double> zAndWidth =
-      m_cfg.trackDensityEstimator.globalMaximumWithWidth(
-          densityState, trackVector, m_extractParameters);
+      m_cfg.trackDensityEstimator.globalMaximumWithWidth(state.densityState);
 
   double z = zAndWidth.first;
 
@@ -22,7 +22,7 @@
 #include "Acts/Surfaces/RectangleBounds.hpp"
 #include "Acts/Surfaces/SurfaceArray.hpp"
 #include "Acts/Utilities/BinnedArray.hpp"
-#include "Acts/Utilities/BinnedArrayXD.hpp"
+#include "Acts/Utilities/BinnedArrayT.hpp"
 #include "Acts/Utilities/Definitions.hpp"
 
 std::shared_ptr<const Acts::PlaneSurface>
@@ -212,8 +212,8 @@ Acts::MutableTrackingVolumePtr Acts::CuboidVolumeBuilder::trackingVolume(
   auto bu = std::make_unique<const BinUtility>(binData);
 
   // Build TrackingVolume array
-  std::shared_ptr<const TrackingVolumeArray> trVolArr(
-      new BinnedArrayXD<TrackingVolumePtr>(tapVec, std::move(bu)));
+  std::shared_ptr<const TrackingVolumeArray> trVolArr =
+      makeBinnedArray<TrackingVolumePtr>(tapVec, std::move(bu));
 
   // Create world volume
   MutableTrackingVolumePtr mtvp(TrackingVolume::create(
@@ -24,7 +24,7 @@
 #include "Acts/Surfaces/SurfaceBounds.hpp"
 #include "Acts/Surfaces/TrapezoidBounds.hpp"
 #include "Acts/Utilities/BinUtility.hpp"
-#include "Acts/Utilities/BinnedArrayXD.hpp"
+#include "Acts/Utilities/BinnedArrayT.hpp"
 #include "Acts/Utilities/Definitions.hpp"
 
 std::unique_ptr<const Acts::LayerArray> Acts::LayerArrayCreator::layerArray(
@@ -164,8 +164,7 @@ std::unique_ptr<const Acts::LayerArray> Acts::LayerArrayCreator::layerArray(
     }
   }
   // return the binned array
-  return std::make_unique<const BinnedArrayXD<LayerPtr>>(layerOrderVector,
-                                                         std::move(binUtility));
+  return makeBinnedArray<LayerPtr>(layerOrderVector, std::move(binUtility));
 }
 
 std::shared_ptr<Acts::Surface> Acts::LayerArrayCreator::createNavigationSurface(
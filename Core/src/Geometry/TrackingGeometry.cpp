@@ -10,6 +10,8 @@
 // TrackingGeometry.cpp, Acts project
 ///////////////////////////////////////////////////////////////////
 
+#include <algorithm>
+#include <cstdint>
 #include <functional>
 
 #include "Acts/Geometry/Layer.hpp"
@@ -26,6 +28,7 @@ Acts::TrackingGeometry::TrackingGeometry(
   // Close the geometry: assign geometryID and successively the material
   size_t volumeID = 0;
   highestVolume->closeGeometry(materialDecorator, m_trackingVolumes, volumeID);
+  buildIndex();
 }
 
 Acts::TrackingGeometry::~TrackingGeometry() = default;
@@ -75,3 +78,119 @@ void Acts::TrackingGeometry::visitSurfaces(
     const std::function<void(const Acts::Surface*)>& visitor) const {
   highestTrackingVolume()->visitSurfaces(visitor);
 }
+
+namespace {
+void collectVolumes(const Acts::TrackingVolume& volume,
+                    std::vector<const Acts::TrackingVolume*>& volumes) {
+  auto id = volume.geoID().volume();
+  if (volumes.size() <= id) {
+    volumes.resize(id + 1, nullptr);
+  }
+  volumes[id] = &volume;
+  if (volume.confinedVolumes()) {
+    for (const auto& confined : volume.confinedVolumes()->arrayObjects()) {
+      collectVolumes(*confined, volumes);
+    }
+  }
+  for (const auto& dense : volume.denseVolumes()) {
+    collectVolumes(*dense, volumes);
+  }
+}
+}  // namespace
+
+void Acts::TrackingGeometry::buildIndex() {
+  collectVolumes(*m_world, m_volumes);
+  m_volumeLayers.assign(m_volumes.size(), {0u, 0u});
+
+  // volumes and layers are visited ordered by identifier and the resulting
+  // surface ordinals are thus also ordered by identifier
+  for (size_t ivol = 0; ivol < m_volumes.size(); ++ivol) {
+    const TrackingVolume* volume = m_volumes[ivol];
+    if ((volume == nullptr) or (volume->confinedLayers() == nullptr)) {
+      continue;
+    }
+    const auto& layers = volume->confinedLayers()->arrayObjects();
+    size_t numLayers = 0;
+    for (const auto& layer : layers) {
+      numLayers = std::max<size_t>(numLayers, layer->geoID().layer() + 1);
+    }
+    size_t offset = m_layers.size();
+    m_volumeLayers[ivol] = {offset, numLayers};
+    m_layers.resize(offset + numLayers);
+    for (const auto& layer : layers) {
+      m_layers[offset + layer->geoID().layer()].layer = layer.get();
+    }
+    for (size_t ilay = offset; ilay < m_layers.size(); ++ilay) {
+      LayerEntry& entry = m_layers[ilay];
+      entry.firstOrdinal = m_surfaces.size();
+      if ((entry.layer == nullptr) or
+          (entry.layer->surfaceArray() == nullptr)) {
+        continue;
+      }
+      const auto& surfaces = entry.layer->surfaceArray()->surfaces();
+      for (const Surface* surface : surfaces) {
+        entry.numSurfaces = std::max<size_t>(entry.numSurfaces,
+                                             surface->geoID().sensitive());
+      }
+      // sensitive identifiers start at one
+      m_surfaces.resize(entry.firstOrdinal + entry.numSurfaces, nullptr);
+      for (const Surface* surface : surfaces) {
+        auto isensitive = surface->geoID().sensitive();
+        if (0u < isensitive) {
+          m_surfaces[entry.firstOrdinal + isensitive - 1] = surface;
+        }
+      }
+    }
+  }
+}
+
+const Acts::TrackingGeometry::LayerEntry*
+Acts::TrackingGeometry::findLayerEntry(GeometryID id) const {
+  auto ivol = id.volume();
+  if (m_volumeLayers.size() <= ivol) {
+    return nullptr;
+  }
+  const auto& range = m_volumeLayers[ivol];
+  auto ilay = id.layer();
+  if (range.second <= ilay) {
+    return nullptr;
+  }
+  return &m_layers[range.first + ilay];
+}
+
+const Acts::TrackingVolume* Acts::TrackingGeometry::findVolume(
+    GeometryID id) const {
+  auto ivol = id.volume();
+  return (ivol < m_volumes.size()) ? m_volumes[ivol] : nullptr;
+}
+
+const Acts::Layer* Acts::TrackingGeometry::findLayer(GeometryID id) const {
+  const LayerEntry* entry = findLayerEntry(id);
+  return (entry != nullptr) ? entry->layer : nullptr;
+}
+
+size_t Acts::TrackingGeometry::surfaceOrdinal(GeometryID id) const {
+  const LayerEntry* entry = findLayerEntry(id);
+  auto isensitive = id.sensitive();
+  if ((entry == nullptr) or (isensitive == 0u) or
+      (entry->numSurfaces < isensitive)) {
+    return SIZE_MAX;
+  }
+  size_t ordinal = entry->firstOrdinal + isensitive - 1;
+  // reject identifiers w/ additional boundary or approach components
+  const Surface* surface = m_surfaces[ordinal];
+  if ((surface == nullptr) or (surface->geoID() != id)) {
+    return SIZE_MAX;
+  }
+  return ordinal;
+}
+
+const Acts::Surface* Acts::TrackingGeometry::findSurface(GeometryID id) const {
+  size_t ordinal = surfaceOrdinal(id);
+  return (ordinal != SIZE_MAX) ? m_surfaces[ordinal] : nullptr;
+}
+
+const std::vector<const Acts::Surface*>&
+Acts::TrackingGeometry::sensitiveSurfaces() const {
+  return m_surfaces;
+}
@@ -0,0 +1,1809 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Geometry/TrackingGeometrySnapshot.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Acts/Geometry/AbstractVolume.hpp"
+#include "Acts/Geometry/ApproachDescriptor.hpp"
+#include "Acts/Geometry/BoundarySurfaceT.hpp"
+#include "Acts/Geometry/ConeLayer.hpp"
+#include "Acts/Geometry/ConeVolumeBounds.hpp"
+#include "Acts/Geometry/CuboidVolumeBounds.hpp"
+#include "Acts/Geometry/CutoutCylinderVolumeBounds.hpp"
+#include "Acts/Geometry/CylinderLayer.hpp"
+#include "Acts/Geometry/CylinderVolumeBounds.hpp"
+#include "Acts/Geometry/DetectorElementBase.hpp"
+#include "Acts/Geometry/DiscLayer.hpp"
+#include "Acts/Geometry/GenericApproachDescriptor.hpp"
+#include "Acts/Geometry/GenericCuboidVolumeBounds.hpp"
+#include "Acts/Geometry/Layer.hpp"
+#include "Acts/Geometry/NavigationLayer.hpp"
+#include "Acts/Geometry/PlaneLayer.hpp"
+#include "Acts/Geometry/TrackingGeometry.hpp"
+#include "Acts/Geometry/TrackingVolume.hpp"
+#include "Acts/Geometry/TrapezoidVolumeBounds.hpp"
+#include "Acts/Material/BinnedSurfaceMaterial.hpp"
+#include "Acts/Material/HomogeneousSurfaceMaterial.hpp"
+#include "Acts/Material/HomogeneousVolumeMaterial.hpp"
+#include "Acts/Material/ProtoSurfaceMaterial.hpp"
+#include "Acts/Material/ProtoVolumeMaterial.hpp"
+#include "Acts/Surfaces/AnnulusBounds.hpp"
+#include "Acts/Surfaces/ConeBounds.hpp"
+#include "Acts/Surfaces/ConeSurface.hpp"
+#include "Acts/Surfaces/ConvexPolygonBounds.hpp"
+#include "Acts/Surfaces/CylinderBounds.hpp"
+#include "Acts/Surfaces/CylinderSurface.hpp"
+#include "Acts/Surfaces/DiamondBounds.hpp"
+#include "Acts/Surfaces/DiscSurface.hpp"
+#include "Acts/Surfaces/DiscTrapezoidBounds.hpp"
+#include "Acts/Surfaces/EllipseBounds.hpp"
+#include "Acts/Surfaces/LineBounds.hpp"
+#include "Acts/Surfaces/PerigeeSurface.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Surfaces/RadialBounds.hpp"
+#include "Acts/Surfaces/RectangleBounds.hpp"
+#include "Acts/Surfaces/StrawSurface.hpp"
+#include "Acts/Surfaces/SurfaceArray.hpp"
+#include "Acts/Surfaces/TrapezoidBounds.hpp"
+#include "Acts/Utilities/BinUtility.hpp"
+#include "Acts/Utilities/BinnedArrayT.hpp"
+#include "Acts/Utilities/BoundingBox.hpp"
+#include "Acts/Utilities/Helpers.hpp"
+#include "Acts/Utilities/detail/Axis.hpp"
+
+namespace Acts {
+namespace {
+
+constexpr char kSnapshotMagic[8] = {'A', 'C', 'T', 'S', 'G', 'E', 'O', 'S'};
+constexpr uint32_t kSnapshotVersion = 2;
+
+/// Index into one of the snapshot tables, -1 if there is no object
+using Index = int32_t;
+
+/// Protects against unbounded recursion from corrupted input, hierarchies
+/// built with make_octree are far less deep
+constexpr size_t kMaxHierarchyDepth = 64;
+
+/// Layer kinds, the layer factory is selected from these
+enum class LayerKind : uint8_t {
+  eNavigation = 0,
+  eCylinder = 1,
+  eDisc = 2,
+  ePlane = 3,
+  eCone = 4
+};
+
+/// Surface array kinds, grids are restricted to the SurfaceArrayCreator
+/// layouts which are identified by their binning values
+enum class ArrayKind : uint8_t { eNone = 0, eSingle = 1, eGrid = 2 };
+enum class GridLayout : uint8_t { eCylinder = 0, eDisc = 1, ePlane = 2 };
+
+enum class SurfaceMaterialKind : uint8_t {
+  eHomogeneous = 0,
+  eBinned = 1,
+  eProto = 2
+};
+enum class VolumeMaterialKind : uint8_t { eHomogeneous = 0, eProto = 1 };
+
+using ISurfaceGridLookup = SurfaceArray::ISurfaceGridLookup;
+
+class SnapshotWriter {
+ public:
+  explicit SnapshotWriter(std::ostream& os) : m_os(os) {}
+
+  template <typename T>
+  void writeValue(const T& value) {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "Only trivially copyable values are written directly");
+    m_os.write(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+
+  template <typename T>
+  void writeVector(const std::vector<T>& values) {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "Only trivially copyable values are written directly");
+    writeValue<uint64_t>(values.size());
+    m_os.write(reinterpret_cast<const char*>(values.data()),
+               values.size() * sizeof(T));
+  }
+
+  void writeString(const std::string& value) {
+    writeValue<uint64_t>(value.size());
+    m_os.write(value.data(), value.size());
+  }
+
+  void writeTransform(const Transform3D& transform) {
+    // the affine part is sufficient, the last row is implicit
+    const auto& matrix = transform.matrix();
+    for (int col = 0; col < 4; ++col) {
+      for (int row = 0; row < 3; ++row) {
+        writeValue<double>(matrix(row, col));
+      }
+    }
+  }
+
+ private:
+  std::ostream& m_os;
+};
+
+class SnapshotReader {
+ public:
+  explicit SnapshotReader(std::istream& is) : m_is(is) {
+    // the size of a seekable input bounds all stored counts
+    const std::istream::pos_type begin = m_is.tellg();
+    if (begin != std::istream::pos_type(-1) and
+        m_is.seekg(0, std::ios_base::end)) {
+      m_end = m_is.tellg();
+      m_is.seekg(begin);
+    }
+    m_is.clear();
+  }
+
+  template <typename T>
+  T readValue() {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "Only trivially copyable values are read directly");
+    T value;
+    read(reinterpret_cast<char*>(&value), sizeof(T));
+    return value;
+  }
+
+  template <typename T>
+  std::vector<T> readVector() {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "Only trivially copyable values are read directly");
+    std::vector<T> values(readSize(sizeof(T)));
+    read(reinterpret_cast<char*>(values.data()), values.size() * sizeof(T));
+    return values;
+  }
+
+  std::string readString() {
+    std::string value(readSize(), '\0');
+    read(&value[0], value.size());
+    return value;
+  }
+
+  Transform3D readTransform() {
+    Transform3D transform = Transform3D::Identity();
+    auto& matrix = transform.matrix();
+    for (int col = 0; col < 4; ++col) {
+      for (int row = 0; row < 3; ++row) {
+        matrix(row, col) = readValue<double>();
+      }
+    }
+    return transform;
+  }
+
+  void read(char* data, size_t size) {
+    m_is.read(data, size);
+    if (not m_is or static_cast<size_t>(m_is.gcount()) != size) {
+      throw std::runtime_error("Truncated tracking geometry snapshot");
+    }
+  }
+
+  /// Read a number of entries which are stored with at least the given
+  /// number of bytes each
+  ///
+  /// All counts are read through here, this protects against allocations
+  /// from corrupted input.
+  size_t readSize(size_t entryBytes = 1) {
+    const uint64_t size = readValue<uint64_t>();
+    checkSize(size, entryBytes);
+    return size;
+  }
+
+  /// Check that a number of entries can still be contained in the input
+  void checkSize(uint64_t size, size_t entryBytes) {
+    uint64_t remaining = uint64_t(1) << 32u;
+    if (m_end != std::istream::pos_type(-1)) {
+      remaining = static_cast<uint64_t>(m_end - m_is.tellg());
+    }
+    if (size > remaining / std::max<size_t>(entryBytes, 1u)) {
+      throw std::runtime_error("Corrupted tracking geometry snapshot");
+    }
+  }
+
+ private:
+  std::istream& m_is;
+  std::istream::pos_type m_end = std::istream::pos_type(-1);
+};
+
+/// Access an entry of a restored table with a range check
+template <typename T>
+const T& entry(const std::vector<T>& table, Index index, const char* what) {
+  if (index < 0 or static_cast<size_t>(index) >= table.size()) {
+    throw std::runtime_error(std::string("Invalid ") + what +
+                             " index in tracking geometry snapshot");
+  }
+  return table[index];
+}
+
+/// Position in the center of a bin of one-dimensional binning
+Vector3D binCenter(const BinUtility& bu, size_t bin) {
+  const BinningData& bData = bu.binningData()[0];
+  const double value = bData.center(bin);
+  Vector3D position(0., 0., 0.);
+  switch (bData.binvalue) {
+    case binX:
+    case binR:
+      position.x() = value;
+      break;
+    case binY:
+      position.y() = value;
+      break;
+    case binZ:
+      position.z() = value;
+      break;
+    case binPhi:
+      position = Vector3D(std::cos(value), std::sin(value), 0.);
+      break;
+    default:
+      throw std::runtime_error(
+          "Unsupported binning value in tracking geometry snapshot");
+  }
+  return (bu.transform() != nullptr) ? Vector3D(*bu.transform() * position)
+                                     : position;
+}
+
+void writeVertex(SnapshotWriter& writer, const Vector3D& vertex) {
+  for (int i = 0; i < 3; ++i) {
+    writer.writeValue<double>(vertex[i]);
+  }
+}
+
+Vector3D readVertex(SnapshotReader& reader) {
+  Vector3D vertex;
+  for (int i = 0; i < 3; ++i) {
+    vertex[i] = reader.readValue<double>();
+  }
+  return vertex;
+}
+
+void writeVolumeBounds(SnapshotWriter& writer, const VolumeBounds& bounds) {
+  writer.writeValue<int32_t>(bounds.type());
+  writer.writeVector(bounds.values());
+}
+
+void writeBinUtility(SnapshotWriter& writer, const BinUtility& bu) {
+  const auto& binningData = bu.binningData();
+  writer.writeValue<uint32_t>(binningData.size());
+  for (const auto& bData : binningData) {
+    if (bData.subBinningData != nullptr) {
+      throw std::invalid_argument(
+          "Binning with sub structure can not be stored in a snapshot");
+    }
+    writer.writeValue<int32_t>(bData.type);
+    writer.writeValue<int32_t>(bData.option);
+    writer.writeValue<int32_t>(bData.binvalue);
+    if (bData.type == equidistant) {
+      writer.writeValue<uint64_t>(bData.bins());
+      writer.writeValue<float>(bData.min);
+      writer.writeValue<float>(bData.max);
+    } else {
+      writer.writeVector(bData.boundaries());
+    }
+  }
+  writer.writeValue<uint8_t>(bu.transform() != nullptr);
+  if (bu.transform() != nullptr) {
+    writer.writeTransform(*bu.transform());
+  }
+}
+
+BinUtility readBinUtility(SnapshotReader& reader) {
+  std::vector<BinningData> binningData;
+  const auto nDims = reader.readValue<uint32_t>();
+  if (nDims > 3u) {
+    throw std::runtime_error("Corrupted tracking geometry snapshot");
+  }
+  for (uint32_t idim = 0; idim < nDims; ++idim) {
+    const auto type = static_cast<BinningType>(reader.readValue<int32_t>());
+    const auto option = static_cast<BinningOption>(reader.readValue<int32_t>());
+    const auto value = static_cast<BinningValue>(reader.readValue<int32_t>());
+    if (type == equidistant) {
+      const auto bins = reader.readSize();
+      const auto min = reader.readValue<float>();
+      const auto max = reader.readValue<float>();
+      binningData.emplace_back(option, value, bins, min, max);
+    } else {
+      binningData.emplace_back(option, value, reader.readVector<float>());
+    }
+  }
+  std::shared_ptr<const Transform3D> transform = nullptr;
+  if (reader.readValue<uint8_t>() != 0u) {
+    transform = std::make_shared<const Transform3D>(reader.readTransform());
+  }
+  if (binningData.empty()) {
+    return BinUtility();
+  }
+  BinUtility bu(binningData[0], transform);
+  for (size_t idim = 1; idim < binningData.size(); ++idim) {
+    bu += BinUtility(binningData[idim]);
+  }
+  return bu;
+}
+
+/// Stored axis of a surface grid
+struct AxisRecord {
+  bool equidistant = true;
+  uint64_t nBins = 0;
+  double min = 0.;
+  double max = 0.;
+  std::vector<double> edges;
+
+  template <detail::AxisBoundaryType bdt>
+  detail::Axis<detail::AxisType::Equidistant, bdt> equidistantAxis() const {
+    return detail::Axis<detail::AxisType::Equidistant, bdt>(min, max, nBins);
+  }
+
+  template <detail::AxisBoundaryType bdt>
+  detail::Axis<detail::AxisType::Variable, bdt> variableAxis() const {
+    return detail::Axis<detail::AxisType::Variable, bdt>(edges);
+  }
+};
+
+template <typename axis_a_t, typename axis_b_t>
+std::unique_ptr<ISurfaceGridLookup> makeGridLookup(
+    std::function<Vector2D(const Vector3D&)> globalToLocal,
+    std::function<Vector3D(const Vector2D&)> localToGlobal, axis_a_t axisA,
+    axis_b_t axisB, std::vector<BinningValue> bValues) {
+  using SGL = SurfaceArray::SurfaceGridLookup<axis_a_t, axis_b_t>;
+  return std::make_unique<SGL>(std::move(globalToLocal),
+                               std::move(localToGlobal),
+                               std::make_tuple(std::move(axisA),
+                                               std::move(axisB)),
+                               std::move(bValues));
+}
+
+/// Create the grid lookup with the axis types of the SurfaceArrayCreator
+template <detail::AxisBoundaryType bdtA, detail::AxisBoundaryType bdtB>
+std::unique_ptr<ISurfaceGridLookup> makeGridLookup(
+    std::function<Vector2D(const Vector3D&)> globalToLocal,
+    std::function<Vector3D(const Vector2D&)> localToGlobal,
+    const AxisRecord& a, const AxisRecord& b,
+    std::vector<BinningValue> bValues) {
+  if (a.equidistant and b.equidistant) {
+    return makeGridLookup(globalToLocal, localToGlobal,
+                          a.equidistantAxis<bdtA>(), b.equidistantAxis<bdtB>(),
+                          bValues);
+  } else if (a.equidistant) {
+    return makeGridLookup(globalToLocal, localToGlobal,
+                          a.equidistantAxis<bdtA>(), b.variableAxis<bdtB>(),
+                          bValues);
+  } else if (b.equidistant) {
+    return makeGridLookup(globalToLocal, localToGlobal, a.variableAxis<bdtA>(),
+                          b.equidistantAxis<bdtB>(), bValues);
+  }
+  return makeGridLookup(globalToLocal, localToGlobal, a.variableAxis<bdtA>(),
+                        b.variableAxis<bdtB>(), bValues);
+}
+
+template <typename bounds_t>
+std::shared_ptr<const SurfaceBounds> makeBounds(
+    const std::vector<double>& values) {
+  std::array<double, bounds_t::eSize> parameters{};
+  if (values.size() != parameters.size()) {
+    throw std::runtime_error(
+        "Invalid number of bound values in tracking geometry snapshot");
+  }
+  std::copy(values.begin(), values.end(), parameters.begin());
+  return std::make_shared<const bounds_t>(parameters);
+}
+
+template <typename bounds_t>
+std::shared_ptr<const VolumeBounds> makeVolumeBounds(
+    const std::vector<double>& values) {
+  std::array<double, bounds_t::eSize> parameters{};
+  if (values.size() != parameters.size()) {
+    throw std::runtime_error(
+        "Invalid number of bound values in tracking geometry snapshot");
+  }
+  std::copy(values.begin(), values.end(), parameters.begin());
+  return std::make_shared<const bounds_t>(parameters);
+}
+
+std::shared_ptr<const VolumeBounds> readVolumeBounds(SnapshotReader& reader) {
+  const auto type =
+      static_cast<VolumeBounds::BoundsType>(reader.readValue<int32_t>());
+  const auto values = reader.readVector<double>();
+  switch (type) {
+    case VolumeBounds::eCone:
+      return makeVolumeBounds<ConeVolumeBounds>(values);
+    case VolumeBounds::eCuboid:
+      return makeVolumeBounds<CuboidVolumeBounds>(values);
+    case VolumeBounds::eCutoutCylinder:
+      return makeVolumeBounds<CutoutCylinderVolumeBounds>(values);
+    case VolumeBounds::eCylinder:
+      return makeVolumeBounds<CylinderVolumeBounds>(values);
+    case VolumeBounds::eGenericCuboid:
+      return makeVolumeBounds<GenericCuboidVolumeBounds>(values);
+    case VolumeBounds::eTrapezoid:
+      return makeVolumeBounds<TrapezoidVolumeBounds>(values);
+    default:
+      throw std::runtime_error(
+          "Invalid volume bounds in tracking geometry snapshot");
+  }
+}
+
+/// The child nodes of a bounding volume hierarchy node, the last child
+/// skips to the same node as its parent
+std::vector<const Volume::BoundingBox*> childNodes(
+    const Volume::BoundingBox& node) {
+  std::vector<const Volume::BoundingBox*> children;
+  for (auto child = node.getLeftChild();
+       child != nullptr and child != node.getSkip(); child = child->getSkip()) {
+    children.push_back(child);
+  }
+  return children;
+}
+
+/// The envelope of a node around its children
+///
+/// @throws std::invalid_argument if the envelope is not symmetric, only
+///         symmetric envelopes are restored by the node constructor
+Volume::BoundingBox::vertex_array_type nodeEnvelope(
+    const Volume::BoundingBox& node,
+    const std::vector<const Volume::BoundingBox*>& children) {
+  if (children.size() < 2u) {
+    throw std::invalid_argument(
+        "Bounding volume hierarchy nodes with less than two children can not "
+        "be stored in a snapshot");
+  }
+  const auto extent = Volume::BoundingBox::wrap(children);
+  const Volume::BoundingBox::vertex_array_type lower =
+      extent.first.array() - node.min().array();
+  const Volume::BoundingBox::vertex_array_type upper =
+      node.max().array() - extent.second.array();
+  const double tolerance = 1e-9 * (1. + node.min().cwiseAbs().maxCoeff() +
+                                   node.max().cwiseAbs().maxCoeff());
+  if (((lower - upper).abs() > tolerance).any()) {
+    throw std::invalid_argument(
+        "Bounding volume hierarchy nodes with an asymmetric envelope can not "
+        "be stored in a snapshot");
+  }
+  return lower;
+}
+
+/// Cast restored bounds to the type required by a surface or layer
+template <typename bounds_t>
+std::shared_ptr<const bounds_t> castBounds(
+    const std::shared_ptr<const SurfaceBounds>& bounds, bool required) {
+  if (bounds == nullptr and not required) {
+    return nullptr;
+  }
+  auto cBounds = std::dynamic_pointer_cast<const bounds_t>(bounds);
+  if (cBounds == nullptr) {
+    throw std::runtime_error(
+        "Bounds do not match the surface type in tracking geometry snapshot");
+  }
+  return cBounds;
+}
+
+/// Detector element of a sensitive surface restored from a snapshot
+///
+/// It provides the nominal transform and the thickness of the original
+/// detector element, which identifies the surface as sensitive. Detector
+/// specific information, e.g. a digitization module, is not restored.
+class SnapshotDetectorElement final : public DetectorElementBase {
+ public:
+  SnapshotDetectorElement(const Transform3D& transform, double thickness)
+      : m_transform(transform), m_thickness(thickness) {}
+
+  const Transform3D& transform(const GeometryContext& /*gctx*/) const final {
+    return m_transform;
+  }
+
+  const Surface& surface() const final { return *m_surface; }
+
+  double thickness() const final { return m_thickness; }
+
+  void assignSurface(std::shared_ptr<const Surface> surface) {
+    m_surface = std::move(surface);
+  }
+
+ private:
+  Transform3D m_transform;
+  double m_thickness;
+  std::shared_ptr<const Surface> m_surface;
+};
+
+/// A restored geometry which owns the detector elements of its surfaces
+struct RestoredGeometry {
+  std::vector<std::unique_ptr<const SnapshotDetectorElement>> detectorElements;
+  std::unique_ptr<const TrackingGeometry> trackingGeometry;
+};
+
+/// Collects the object graph of a geometry into tables and writes them
+class GeometryCollector {
+ public:
+  explicit GeometryCollector(const GeometryContext& gctx) : m_gctx(gctx) {}
+
+  void collectVolume(const TrackingVolume& volume) {
+    if (volume.hasBoundingVolumeHierarchy()) {
+      // only validates the hierarchy, nothing is written yet
+      writeHierarchy(nullptr, volume);
+    }
+    if (volume.confinedVolumes()) {
+      for (const auto& cVolume : volume.confinedVolumes()->arrayObjects()) {
+        collectVolume(*cVolume);
+      }
+    }
+    for (const auto& dVolume : volume.denseVolumes()) {
+      collectVolume(*dVolume);
+    }
+    if (volume.confinedLayers() != nullptr) {
+      checkArray(*volume.confinedLayers());
+      for (const auto& layer : volume.confinedLayers()->arrayObjects()) {
+        collectLayer(*layer);
+      }
+    }
+    collectVolumeMaterial(volume.volumeMaterialSharedPtr());
+    // children are stored first, the world volume is the last one
+    m_volumeIndices.emplace(&volume, m_volumes.size());
+    m_volumes.push_back(&volume);
+  }
+
+  /// The boundaries reference volumes, they are collected once all volumes
+  /// are known
+  void collectBoundaries() {
+    for (const auto volume : m_volumes) {
+      collectVolumeArray(volume->confinedVolumes());
+      for (const auto& boundary : volume->boundarySurfaces()) {
+        if (m_boundaryIndices.emplace(boundary.get(), m_boundaries.size())
+                .second) {
+          m_boundaries.push_back(boundary.get());
+          collectSurface(boundary->surfaceRepresentation());
+          for (auto navDir : {backward, forward}) {
+            volumeIndex(boundary->attachedVolume(navDir));
+            collectVolumeArray(boundary->attachedVolumeArray(navDir));
+          }
+        }
+      }
+    }
+  }
+
+  void write(SnapshotWriter& writer) const {
+    writeMaterials(writer);
+    writer.writeValue<uint64_t>(m_bounds.size());
+    for (const auto bounds : m_bounds) {
+      writer.writeValue<int32_t>(bounds->type());
+      writer.writeVector(bounds->values());
+    }
+    writer.writeValue<uint64_t>(m_surfaces.size());
+    for (const auto surface : m_surfaces) {
+      writer.writeValue<int32_t>(surface->type());
+      writer.writeTransform(surface->transform(m_gctx));
+      writer.writeValue<Index>(boundsIndex(surface->bounds()));
+      writer.writeValue<Index>(
+          m_surfaceMaterialIndices.at(surface->surfaceMaterial()));
+      writer.writeValue<uint64_t>(surface->geoID().value());
+      const DetectorElementBase* element = surface->associatedDetectorElement();
+      writer.writeValue<uint8_t>(element != nullptr);
+      if (element != nullptr) {
+        writer.writeValue<double>(element->thickness());
+      }
+    }
+    writer.writeValue<uint64_t>(m_layers.size());
+    for (const auto layer : m_layers) {
+      writeLayer(writer, *layer);
+    }
+    writer.writeValue<uint64_t>(m_volumeArrays.size());
+    for (const auto volumeArray : m_volumeArrays) {
+      writeArray(writer, *volumeArray, m_volumeIndices);
+    }
+    writer.writeValue<uint64_t>(m_volumes.size());
+    for (const auto volume : m_volumes) {
+      writeVolume(writer, *volume);
+    }
+    writer.writeValue<uint64_t>(m_boundaries.size());
+    for (const auto boundary : m_boundaries) {
+      writer.writeValue<Index>(
+          m_surfaceIndices.at(&boundary->surfaceRepresentation()));
+      for (auto navDir : {backward, forward}) {
+        writer.writeValue<Index>(volumeIndex(boundary->attachedVolume(navDir)));
+        writer.writeValue<Index>(
+            volumeArrayIndex(boundary->attachedVolumeArray(navDir)));
+      }
+    }
+    for (const auto volume : m_volumes) {
+      std::vector<Index> faces;
+      for (const auto& boundary : volume->boundarySurfaces()) {
+        faces.push_back(m_boundaryIndices.at(boundary.get()));
+      }
+      writer.writeVector(faces);
+    }
+  }
+
+ private:
+  template <typename T>
+  void checkArray(const BinnedArray<T>& array) const {
+    const BinUtility* bu = array.binUtility();
+    if (bu == nullptr or bu->dimensions() != 1u) {
+      throw std::invalid_argument(
+          "Only one-dimensional layer and volume arrays can be stored in a "
+          "snapshot");
+    }
+    switch (bu->binningData()[0].binvalue) {
+      case binX:
+      case binY:
+      case binZ:
+      case binR:
+      case binPhi:
+        break;
+      default:
+        throw std::invalid_argument(
+            "Unsupported binning value of a layer or volume array");
+    }
+  }
+
+  /// Write a one-dimensional array as its binning, the unique objects in
+  /// their order and the object index per bin
+  template <typename T, typename object_t>
+  void writeArray(
+      SnapshotWriter& writer, const BinnedArray<T>& array,
+      const std::unordered_map<const object_t*, Index>& indices) const {
+    writeBinUtility(writer, *array.binUtility());
+    std::vector<Index> objects;
+    for (const auto& object : array.arrayObjects()) {
+      objects.push_back(indices.at(object.get()));
+    }
+    writer.writeVector(objects);
+    const auto& bins = array.objectGrid().at(0).at(0);
+    std::vector<Index> binObjects(bins.size(), -1);
+    for (size_t ib = 0; ib < bins.size(); ++ib) {
+      for (size_t io = 0; io < array.arrayObjects().size(); ++io) {
+        if (bins[ib] != nullptr and bins[ib] == array.arrayObjects()[io]) {
+          binObjects[ib] = io;
+        }
+      }
+    }
+    writer.writeVector(binObjects);
+  }
+
+  void collectLayer(const Layer& layer) {
+    if (not m_layerIndices.emplace(&layer, m_layers.size()).second) {
+      return;
+    }
+    m_layers.push_back(&layer);
+    const Surface& representation = layer.surfaceRepresentation();
+    if (dynamic_cast<const NavigationLayer*>(&layer) != nullptr) {
+      collectSurface(representation);
+      return;
+    }
+    layerKind(layer);
+    collectBounds(representation.bounds());
+    collectSurfaceMaterial(representation.surfaceMaterialSharedPtr());
+    if (layer.approachDescriptor() != nullptr) {
+      for (const auto surface :
+           layer.approachDescriptor()->containedSurfaces()) {
+        collectSurface(*surface);
+      }
+    }
+    const SurfaceArray* surfaceArray = layer.surfaceArray();
+    if (surfaceArray != nullptr) {
+      for (const auto surface : surfaceArray->surfaces()) {
+        collectSurface(*surface);
+      }
+      if (not surfaceArray->getAxes().empty()) {
+        gridLayout(*surfaceArray);
+        for (size_t bin = 0; bin < surfaceArray->size(); ++bin) {
+          for (const auto surface : surfaceArray->at(bin)) {
+            if (m_surfaceIndices.count(surface) == 0u) {
+              throw std::invalid_argument(
+                  "Surface array bins contain unregistered surfaces");
+            }
+          }
+        }
+      }
+    }
+  }
+
+  LayerKind layerKind(const Layer& layer) const {
+    if (dynamic_cast<const NavigationLayer*>(&layer) != nullptr) {
+      return LayerKind::eNavigation;
+    } else if (dynamic_cast<const CylinderLayer*>(&layer) != nullptr) {
+      return LayerKind::eCylinder;
+    } else if (dynamic_cast<const DiscLayer*>(&layer) != nullptr) {
+      return LayerKind::eDisc;
+    } else if (dynamic_cast<const PlaneLayer*>(&layer) != nullptr) {
+      return LayerKind::ePlane;
+    } else if (dynamic_cast<const ConeLayer*>(&layer) != nullptr) {
+      return LayerKind::eCone;
+    }
+    throw std::invalid_argument("Unsupported layer type for a snapshot");
+  }
+
+  GridLayout gridLayout(const SurfaceArray& surfaceArray) const {
+    const auto axes = surfaceArray.getAxes();
+    const auto bValues = surfaceArray.binningValues();
+    if (axes.size() == 2u and bValues.size() == 2u) {
+      const auto bdtA = axes[0]->getBoundaryType();
+      const auto bdtB = axes[1]->getBoundaryType();
+      if (bValues[0] == binPhi and bValues[1] == binZ and
+          bdtA == detail::AxisBoundaryType::Closed and
+          bdtB == detail::AxisBoundaryType::Bound) {
+        return GridLayout::eCylinder;
+      } else if (bValues[0] == binR and bValues[1] == binPhi and
+                 bdtA == detail::AxisBoundaryType::Bound and
+                 bdtB == detail::AxisBoundaryType::Closed) {
+        return GridLayout::eDisc;
+      } else if (bValues[0] != binPhi and bValues[1] != binPhi and
+                 bdtA == detail::AxisBoundaryType::Bound and
+                 bdtB == detail::AxisBoundaryType::Bound) {
+        return GridLayout::ePlane;
+      }
+    }
+    throw std::invalid_argument(
+        "Only surface arrays with the SurfaceArrayCreator layouts can be "
+        "stored in a snapshot");
+  }
+
+  void writeLayer(SnapshotWriter& writer, const Layer& layer) const {
+    const Surface& representation = layer.surfaceRepresentation();
+    const LayerKind kind = layerKind(layer);
+    writer.writeValue<uint8_t>(static_cast<uint8_t>(kind));
+    writer.writeValue<double>(layer.thickness());
+    writer.writeValue<uint64_t>(layer.geoID().value());
+    if (kind == LayerKind::eNavigation) {
+      writer.writeValue<Index>(m_surfaceIndices.at(&representation));
+      return;
+    }
+    writer.writeTransform(representation.transform(m_gctx));
+    writer.writeValue<Index>(boundsIndex(representation.bounds()));
+    writer.writeValue<Index>(
+        m_surfaceMaterialIndices.at(representation.surfaceMaterial()));
+    writer.writeValue<int32_t>(layer.layerType());
+    writer.writeValue<uint8_t>(layer.approachDescriptor() != nullptr);
+    if (layer.approachDescriptor() != nullptr) {
+      writer.writeVector(
+          surfaceIndices(layer.approachDescriptor()->containedSurfaces()));
+    }
+    const SurfaceArray* surfaceArray = layer.surfaceArray();
+    if (surfaceArray == nullptr) {
+      writer.writeValue<uint8_t>(static_cast<uint8_t>(ArrayKind::eNone));
+      return;
+    }
+    const auto axes = surfaceArray->getAxes();
+    if (axes.empty()) {
+      writer.writeValue<uint8_t>(static_cast<uint8_t>(ArrayKind::eSingle));
+      writer.writeValue<Index>(
+          m_surfaceIndices.at(surfaceArray->surfaces().at(0)));
+      return;
+    }
+    writer.writeValue<uint8_t>(static_cast<uint8_t>(ArrayKind::eGrid));
+    writer.writeVector(surfaceIndices(surfaceArray->surfaces()));
+    const GridLayout layout = gridLayout(*surfaceArray);
+    writer.writeValue<uint8_t>(static_cast<uint8_t>(layout));
+    std::vector<int32_t> bValues;
+    for (auto bValue : surfaceArray->binningValues()) {
+      bValues.push_back(bValue);
+    }
+    writer.writeVector(bValues);
+    const Transform3D& transform = surfaceArray->transform();
+    writer.writeTransform(transform);
+    // the radius or z position of the grid surface in the local frame,
+    // evaluated from the center of any valid bin
+    double layoutParameter = 0.;
+    for (size_t bin = 0; bin < surfaceArray->size(); ++bin) {
+      if (surfaceArray->isValidBin(bin)) {
+        const Vector3D center = transform * surfaceArray->getBinCenter(bin);
+        layoutParameter =
+            (layout == GridLayout::eCylinder) ? VectorHelpers::perp(center)
+                                              : center.z();
+        break;
+      }
+    }
+    writer.writeValue<double>(layoutParameter);
+    for (const auto axis : axes) {
+      writer.writeValue<uint8_t>(axis->isEquidistant());
+      if (axis->isEquidistant()) {
+        writer.writeValue<uint64_t>(axis->getNBins());
+        writer.writeValue<double>(axis->getMin());
+        writer.writeValue<double>(axis->getMax());
+      } else {
+        writer.writeVector(axis->getBinEdges());
+      }
+    }
+    for (size_t bin = 0; bin < surfaceArray->size(); ++bin) {
+      writer.writeVector(surfaceIndices(surfaceArray->at(bin)));
+    }
+  }
+
+  void writeVolume(SnapshotWriter& writer, const TrackingVolume& volume) const {
+    writer.writeString(volume.volumeName());
+    writer.writeTransform(volume.transform());
+    writeVolumeBounds(writer, volume.volumeBounds());
+    writer.writeValue<Index>(
+        m_volumeMaterialIndices.at(volume.volumeMaterial()));
+    writer.writeValue<uint32_t>(volume.colorCode());
+    writer.writeValue<uint64_t>(volume.geoID().value());
+    writer.writeValue<Index>(volumeArrayIndex(volume.confinedVolumes()));
+    std::vector<Index> denseVolumes;
+    for (const auto& dVolume : volume.denseVolumes()) {
+      denseVolumes.push_back(m_volumeIndices.at(dVolume.get()));
+    }
+    writer.writeVector(denseVolumes);
+    writer.writeValue<uint8_t>(volume.confinedLayers() != nullptr);
+    if (volume.confinedLayers() != nullptr) {
+      writeArray(writer, *volume.confinedLayers(), m_layerIndices);
+    }
+    writer.writeValue<uint8_t>(volume.hasBoundingVolumeHierarchy());
+    if (volume.hasBoundingVolumeHierarchy()) {
+      writeHierarchy(&writer, volume);
+    }
+  }
+
+  /// Write the volumes of a bounding volume hierarchy and its nodes, the
+  /// hierarchy is only validated without a writer
+  void writeHierarchy(SnapshotWriter* writer,
+                      const TrackingVolume& volume) const {
+    std::unordered_map<const Volume*, Index> indices;
+    if (writer != nullptr) {
+      writer->writeValue<uint64_t>(volume.descendantVolumes().size());
+    }
+    for (const auto& dVolume : volume.descendantVolumes()) {
+      // only the boundary surfaces of abstract volumes are navigated
+      auto aVolume = dynamic_cast<const AbstractVolume*>(dVolume.get());
+      if (aVolume == nullptr) {
+        throw std::invalid_argument(
+            "Only abstract volumes in a bounding volume hierarchy can be "
+            "stored in a snapshot");
+      }
+      std::vector<uint64_t> boundaryIds;
+      for (const auto& boundary : aVolume->boundarySurfaces()) {
+        const Surface& surface = boundary->surfaceRepresentation();
+        if (surface.surfaceMaterial() != nullptr) {
+          throw std::invalid_argument(
+              "Material on bounding volume hierarchy volumes can not be "
+              "stored in a snapshot");
+        }
+        boundaryIds.push_back(surface.geoID().value());
+      }
+      indices.emplace(aVolume, indices.size());
+      if (writer != nullptr) {
+        writer->writeTransform(aVolume->transform());
+        writeVolumeBounds(*writer, aVolume->volumeBounds());
+        writer->writeVector(boundaryIds);
+      }
+    }
+    writeNode(writer, *volume.boundingVolumeHierarchy(), indices, 0);
+  }
+
+  /// Write a node and its children depth first
+  void writeNode(SnapshotWriter* writer, const Volume::BoundingBox& node,
+                 const std::unordered_map<const Volume*, Index>& indices,
+                 size_t depth) const {
+    if (depth > kMaxHierarchyDepth) {
+      throw std::invalid_argument(
+          "Bounding volume hierarchy is too deep to be stored in a snapshot");
+    }
+    if (node.getLeftChild() == nullptr) {
+      auto it = indices.find(node.entity());
+      if (it == indices.end()) {
+        throw std::invalid_argument(
+            "Bounding volume hierarchy leaves without a contained volume can "
+            "not be stored in a snapshot");
+      }
+      if (writer != nullptr) {
+        writer->writeValue<uint8_t>(true);
+        writer->writeValue<Index>(it->second);
+        writeVertex(*writer, node.min());
+        writeVertex(*writer, node.max());
+      }
+      return;
+    }
+    const auto children = childNodes(node);
+    const auto envelope = nodeEnvelope(node, children);
+    if (writer != nullptr) {
+      writer->writeValue<uint8_t>(false);
+      writeVertex(*writer, envelope.matrix());
+      writer->writeValue<uint64_t>(children.size());
+    }
+    for (const auto child : children) {
+      writeNode(writer, *child, indices, depth + 1);
+    }
+  }
+
+  void writeMaterials(SnapshotWriter& writer) const {
+    writer.writeValue<uint64_t>(m_surfaceMaterials.size());
+    for (const auto material : m_surfaceMaterials) {
+      const double splitFactor = material->factor(forward, postUpdate);
+      if (auto hsm =
+              dynamic_cast<const HomogeneousSurfaceMaterial*>(material)) {
+        writer.writeValue<uint8_t>(
+            static_cast<uint8_t>(SurfaceMaterialKind::eHomogeneous));
+        writer.writeValue<double>(splitFactor);
+        writer.writeValue(hsm->materialProperties(0, 0));
+      } else if (auto bsm =
+                     dynamic_cast<const BinnedSurfaceMaterial*>(material)) {
+        writer.writeValue<uint8_t>(
+            static_cast<uint8_t>(SurfaceMaterialKind::eBinned));
+        writer.writeValue<double>(splitFactor);
+        writeBinUtility(writer, bsm->binUtility());
+        // one entry per bin, the first dimension running fastest
+        std::vector<MaterialProperties> properties;
+        const size_t bins0 = bsm->binUtility().bins(0);
+        const size_t bins1 = bsm->binUtility().bins(1);
+        for (size_t bin1 = 0; bin1 < bins1; ++bin1) {
+          for (size_t bin0 = 0; bin0 < bins0; ++bin0) {
+            properties.push_back(bsm->materialProperties(bin0, bin1));
+          }
+        }
+        writer.writeVector(properties);
+      } else {
+        auto psm = dynamic_cast<const ProtoSurfaceMaterial*>(material);
+        writer.writeValue<uint8_t>(
+            static_cast<uint8_t>(SurfaceMaterialKind::eProto));
+        writer.writeValue<double>(splitFactor);
+        writeBinUtility(writer, psm->binUtility());
+      }
+    }
+    writer.writeValue<uint64_t>(m_volumeMaterials.size());
+    for (const auto material : m_volumeMaterials) {
+      if (auto hvm = dynamic_cast<const HomogeneousVolumeMaterial*>(material)) {
+        writer.writeValue<uint8_t>(
+            static_cast<uint8_t>(VolumeMaterialKind::eHomogeneous));
+        writer.writeValue(hvm->material(Vector3D(0., 0., 0.)));
+      } else {
+        auto pvm = dynamic_cast<const ProtoVolumeMaterial*>(material);
+        writer.writeValue<uint8_t>(
+            static_cast<uint8_t>(VolumeMaterialKind::eProto));
+        writeBinUtility(writer, pvm->binUtility());
+      }
+    }
+  }
+
+  void collectSurface(const Surface& surface) {
+    if (m_surfaceIndices.count(&surface) != 0u) {
+      return;
+    }
+    switch (surface.type()) {
+      case Surface::Cone:
+      case Surface::Cylinder:
+      case Surface::Disc:
+      case Surface::Perigee:
+      case Surface::Plane:
+      case Surface::Straw:
+        break;
+      default:
+        throw std::invalid_argument("Unsupported surface type for a snapshot");
+    }
+    if (surface.associatedDetectorElement() != nullptr) {
+      // restored through the detector element constructors which require
+      // bounds of the surface type
+      if (surface.type() == Surface::Cone or
+          surface.type() == Surface::Perigee or
+          surface.bounds().type() == SurfaceBounds::eBoundless) {
+        throw std::invalid_argument(
+            "Detector elements are only stored for bounded cylinder, disc, "
+            "plane and straw surfaces");
+      }
+    }
+    if (surface.type() != Surface::Perigee) {
+      collectBounds(surface.bounds());
+    }
+    collectSurfaceMaterial(surface.surfaceMaterialSharedPtr());
+    m_surfaceIndices.emplace(&surface, m_surfaces.size());
+    m_surfaces.push_back(&surface);
+  }
+
+  std::vector<Index> surfaceIndices(
+      const std::vector<const Surface*>& surfaces) const {
+    std::vector<Index> indices;
+    indices.reserve(surfaces.size());
+    for (const auto surface : surfaces) {
+      indices.push_back(m_surfaceIndices.at(surface));
+    }
+    return indices;
+  }
+
+  void collectBounds(const SurfaceBounds& bounds) {
+    if (bounds.type() == SurfaceBounds::eBoundless) {
+      return;
+    }
+    if (bounds.type() == SurfaceBounds::eOther) {
+      throw std::invalid_argument("Unsupported surface bounds for a snapshot");
+    }
+    if (m_boundsIndices.emplace(&bounds, m_bounds.size()).second) {
+      m_bounds.push_back(&bounds);
+    }
+  }
+
+  Index boundsIndex(const SurfaceBounds& bounds) const {
+    auto it = m_boundsIndices.find(&bounds);
+    return (it != m_boundsIndices.end()) ? it->second : -1;
+  }
+
+  void collectSurfaceMaterial(
+      const std::shared_ptr<const ISurfaceMaterial>& material) {
+    if (m_surfaceMaterialIndices.count(material.get()) != 0u) {
+      return;
+    }
+    if (dynamic_cast<const HomogeneousSurfaceMaterial*>(material.get()) ==
+            nullptr and
+        dynamic_cast<const BinnedSurfaceMaterial*>(material.get()) ==
+            nullptr and
+        dynamic_cast<const ProtoSurfaceMaterial*>(material.get()) == nullptr) {
+      throw std::invalid_argument(
+          "Unsupported surface material type for a snapshot");
+    }
+    m_surfaceMaterialIndices.emplace(material.get(), m_surfaceMaterials.size());
+    m_surfaceMaterials.push_back(material.get());
+  }
+
+  void collectVolumeMaterial(
+      const std::shared_ptr<const IVolumeMaterial>& material) {
+    if (m_volumeMaterialIndices.count(material.get()) != 0u) {
+      return;
+    }
+    if (dynamic_cast<const HomogeneousVolumeMaterial*>(material.get()) ==
+            nullptr and
+        dynamic_cast<const ProtoVolumeMaterial*>(material.get()) == nullptr) {
+      throw std::invalid_argument(
+          "Unsupported volume material type for a snapshot");
+    }
+    m_volumeMaterialIndices.emplace(material.get(), m_volumeMaterials.size());
+    m_volumeMaterials.push_back(material.get());
+  }
+
+  Index volumeIndex(const TrackingVolume* volume) const {
+    if (volume == nullptr) {
+      return -1;
+    }
+    auto it = m_volumeIndices.find(volume);
+    if (it == m_volumeIndices.end()) {
+      throw std::invalid_argument(
+          "Boundary surface is attached to a volume outside of the geometry");
+    }
+    return it->second;
+  }
+
+  Index volumeArrayIndex(
+      const std::shared_ptr<const TrackingVolumeArray>& volumeArray) const {
+    if (volumeArray == nullptr) {
+      return -1;
+    }
+    return m_volumeArrayIndices.at(volumeArray.get());
+  }
+
+  void collectVolumeArray(
+      const std::shared_ptr<const TrackingVolumeArray>& volumeArray) {
+    if (volumeArray == nullptr or
+        m_volumeArrayIndices.count(volumeArray.get()) != 0u) {
+      return;
+    }
+    checkArray(*volumeArray);
+    for (const auto& volume : volumeArray->arrayObjects()) {
+      volumeIndex(volume.get());
+    }
+    m_volumeArrayIndices.emplace(volumeArray.get(), m_volumeArrays.size());
+    m_volumeArrays.push_back(volumeArray.get());
+  }
+
+  const GeometryContext& m_gctx;
+
+  // the tables with the index of each object, the null material is
+  // always the first entry
+  std::vector<const ISurfaceMaterial*> m_surfaceMaterials;
+  std::unordered_map<const ISurfaceMaterial*, Index> m_surfaceMaterialIndices =
+      {{nullptr, -1}};
+  std::vector<const IVolumeMaterial*> m_volumeMaterials;
+  std::unordered_map<const IVolumeMaterial*, Index> m_volumeMaterialIndices = {
+      {nullptr, -1}};
+  std::vector<const SurfaceBounds*> m_bounds;
+  std::unordered_map<const SurfaceBounds*, Index> m_boundsIndices;
+  std::vector<const Surface*> m_surfaces;
+  std::unordered_map<const Surface*, Index> m_surfaceIndices;
+  std::vector<const Layer*> m_layers;
+  std::unordered_map<const Layer*, Index> m_layerIndices;
+  std::vector<const TrackingVolumeArray*> m_volumeArrays;
+  std::unordered_map<const TrackingVolumeArray*, Index> m_volumeArrayIndices;
+  std::vector<const TrackingVolume*> m_volumes;
+  std::unordered_map<const TrackingVolume*, Index> m_volumeIndices;
+  std::vector<const BoundarySurface*> m_boundaries;
+  std::unordered_map<const BoundarySurface*, Index> m_boundaryIndices;
+};
+
+/// Stored one-dimensional layer or volume array
+struct ArrayRecord {
+  BinUtility binUtility;
+  std::vector<Index> objects;
+  std::vector<Index> binObjects;
+
+  static ArrayRecord read(SnapshotReader& reader) {
+    ArrayRecord record;
+    record.binUtility = readBinUtility(reader);
+    record.objects = reader.readVector<Index>();
+    record.binObjects = reader.readVector<Index>();
+    if (record.binUtility.dimensions() != 1u or
+        record.binObjects.size() != record.binUtility.bins(0)) {
+      throw std::runtime_error(
+          "Invalid binned array in tracking geometry snapshot");
+    }
+    return record;
+  }
+
+  /// Rebuild the array, the objects are filled in their stored order to
+  /// keep the order of the array objects
+  template <typename T>
+  std::unique_ptr<const BinnedArray<T>> build(
+      const std::vector<T>& table, const char* what) const {
+    std::vector<std::pair<T, Vector3D>> tapvector;
+    for (size_t io = 0; io < objects.size(); ++io) {
+      const T& object = entry(table, objects[io], what);
+      if (object == nullptr) {
+        throw std::runtime_error(std::string("Unresolved ") + what +
+                                 " in tracking geometry snapshot");
+      }
+      for (size_t ib = 0; ib < binObjects.size(); ++ib) {
+        if (binObjects[ib] == static_cast<Index>(io)) {
+          tapvector.emplace_back(object, binCenter(binUtility, ib));
+        }
+      }
+    }
+    return makeBinnedArray(tapvector,
+                           std::make_unique<const BinUtility>(binUtility));
+  }
+};
+
+/// Restores the tables in the order they were written
+class GeometryRestorer {
+ public:
+  explicit GeometryRestorer(SnapshotReader& reader) : m_reader(reader) {}
+
+  RestoredGeometry read() {
+    readMaterials();
+    readBounds();
+    readSurfaces();
+    readLayers();
+    m_volumeArrayRecords.resize(m_reader.readSize());
+    for (auto& record : m_volumeArrayRecords) {
+      record = ArrayRecord::read(m_reader);
+    }
+    m_volumeArrays.resize(m_volumeArrayRecords.size());
+    readVolumes();
+    if (m_volumes.empty()) {
+      throw std::runtime_error("Tracking geometry snapshot without volumes");
+    }
+    readBoundaries();
+
+    RestoredGeometry restored;
+    restored.trackingGeometry =
+        std::make_unique<const TrackingGeometry>(m_volumes.back());
+    checkIdentifiers();
+    restored.detectorElements = std::move(m_detectorElements);
+    return restored;
+  }
+
+ private:
+  void readMaterials() {
+    m_surfaceMaterials.resize(m_reader.readSize());
+    for (auto& material : m_surfaceMaterials) {
+      const auto kind =
+          static_cast<SurfaceMaterialKind>(m_reader.readValue<uint8_t>());
+      const double splitFactor = m_reader.readValue<double>();
+      if (kind == SurfaceMaterialKind::eHomogeneous) {
+        material = std::make_shared<const HomogeneousSurfaceMaterial>(
+            m_reader.readValue<MaterialProperties>(), splitFactor);
+      } else if (kind == SurfaceMaterialKind::eBinned) {
+        BinUtility bu = readBinUtility(m_reader);
+        auto properties = m_reader.readVector<MaterialProperties>();
+        const size_t bins0 = bu.bins(0);
+        const size_t bins1 = bu.bins(1);
+        if (properties.size() != bins0 * bins1) {
+          throw std::runtime_error(
+              "Invalid binned material in tracking geometry snapshot");
+        }
+        MaterialPropertiesMatrix matrix(
+            bins1, MaterialPropertiesVector(bins0, MaterialProperties()));
+        for (size_t bin1 = 0; bin1 < bins1; ++bin1) {
+          for (size_t bin0 = 0; bin0 < bins0; ++bin0) {
+            matrix[bin1][bin0] = properties[bin1 * bins0 + bin0];
+          }
+        }
+        material = std::make_shared<const BinnedSurfaceMaterial>(
+            bu, std::move(matrix), splitFactor);
+      } else if (kind == SurfaceMaterialKind::eProto) {
+        material = std::make_shared<const ProtoSurfaceMaterial>(
+            readBinUtility(m_reader));
+      } else {
+        throw std::runtime_error(
+            "Invalid surface material in tracking geometry snapshot");
+      }
+    }
+    m_volumeMaterials.resize(m_reader.readSize());
+    for (auto& material : m_volumeMaterials) {
+      const auto kind =
+          static_cast<VolumeMaterialKind>(m_reader.readValue<uint8_t>());
+      if (kind == VolumeMaterialKind::eHomogeneous) {
+        material = std::make_shared<const HomogeneousVolumeMaterial>(
+            m_reader.readValue<Material>());
+      } else if (kind == VolumeMaterialKind::eProto) {
+        material = std::make_shared<const ProtoVolumeMaterial>(
+            readBinUtility(m_reader));
+      } else {
+        throw std::runtime_error(
+            "Invalid volume material in tracking geometry snapshot");
+      }
+    }
+  }
+
+  void readBounds() {
+    m_bounds.resize(m_reader.readSize());
+    for (auto& bounds : m_bounds) {
+      const auto type =
+          static_cast<SurfaceBounds::BoundsType>(m_reader.readValue<int32_t>());
+      const auto values = m_reader.readVector<double>();
+      switch (type) {
+        case SurfaceBounds::eCone:
+          bounds = makeBounds<ConeBounds>(values);
+          break;
+        case SurfaceBounds::eCylinder:
+          bounds = makeBounds<CylinderBounds>(values);
+          break;
+        case SurfaceBounds::eDiamond:
+          bounds = makeBounds<DiamondBounds>(values);
+          break;
+        case SurfaceBounds::eDisc:
+          bounds = makeBounds<RadialBounds>(values);
+          break;
+        case SurfaceBounds::eEllipse:
+          bounds = makeBounds<EllipseBounds>(values);
+          break;
+        case SurfaceBounds::eLine:
+          bounds = makeBounds<LineBounds>(values);
+          break;
+        case SurfaceBounds::eRectangle:
+          bounds = makeBounds<RectangleBounds>(values);
+          break;
+        case SurfaceBounds::eTrapezoid:
+          bounds = makeBounds<TrapezoidBounds>(values);
+          break;
+        case SurfaceBounds::eDiscTrapezoid:
+          bounds = makeBounds<DiscTrapezoidBounds>(values);
+          break;
+        case SurfaceBounds::eAnnulus:
+          bounds = makeBounds<AnnulusBounds>(values);
+          break;
+        case SurfaceBounds::eConvexPolygon: {
+          // the values are the flattened vertices
+          std::vector<Vector2D> vertices;
+          for (size_t iv = 0; iv + 1 < values.size(); iv += 2) {
+            vertices.emplace_back(values[iv], values[iv + 1]);
+          }
+          bounds =
+              std::make_shared<const ConvexPolygonBounds<PolygonDynamic>>(
+                  vertices);
+          break;
+        }
+        default:
+          throw std::runtime_error(
+              "Invalid surface bounds in tracking geometry snapshot");
+      }
+    }
+  }
+
+  void readSurfaces() {
+    const size_t nSurfaces = m_reader.readSize();
+    for (size_t is = 0; is < nSurfaces; ++is) {
+      const auto type =
+          static_cast<Surface::SurfaceType>(m_reader.readValue<int32_t>());
+      auto transform =
+          std::make_shared<const Transform3D>(m_reader.readTransform());
+      const Index boundsIndex = m_reader.readValue<Index>();
+      const Index materialIndex = m_reader.readValue<Index>();
+      m_surfaceIds.push_back(m_reader.readValue<uint64_t>());
+
+      std::shared_ptr<const SurfaceBounds> bounds =
+          (boundsIndex < 0) ? nullptr : entry(m_bounds, boundsIndex, "bounds");
+      if (m_reader.readValue<uint8_t>() != 0u) {
+        auto surface = sensitiveSurface(type, *transform, bounds,
+                                        m_reader.readValue<double>());
+        surface->assignSurfaceMaterial(surfaceMaterial(materialIndex));
+        m_surfaces.push_back(std::move(surface));
+        continue;
+      }
+      std::shared_ptr<Surface> surface;
+      switch (type) {
+        case Surface::Cone:
+          surface = Surface::makeShared<ConeSurface>(
+              transform, castBounds<ConeBounds>(bounds, true));
+          break;
+        case Surface::Cylinder:
+          surface = Surface::makeShared<CylinderSurface>(
+              transform, castBounds<CylinderBounds>(bounds, true));
+          break;
+        case Surface::Disc:
+          surface = Surface::makeShared<DiscSurface>(
+              transform, castBounds<DiscBounds>(bounds, false));
+          break;
+        case Surface::Perigee:
+          surface = Surface::makeShared<PerigeeSurface>(transform);
+          break;
+        case Surface::Plane:
+          surface = Surface::makeShared<PlaneSurface>(
+              transform, castBounds<PlanarBounds>(bounds, false));
+          break;
+        case Surface::Straw:
+          surface = Surface::makeShared<StrawSurface>(
+              transform, castBounds<LineBounds>(bounds, false));
+          break;
+        default:
+          throw std::runtime_error(
+              "Invalid surface type in tracking geometry snapshot");
+      }
+      surface->assignSurfaceMaterial(surfaceMaterial(materialIndex));
+      m_surfaces.push_back(std::move(surface));
+    }
+  }
+
+  /// Restore a surface of a detector element, the surface is placed by the
+  /// restored detector element
+  std::shared_ptr<Surface> sensitiveSurface(
+      Surface::SurfaceType type, const Transform3D& transform,
+      const std::shared_ptr<const SurfaceBounds>& bounds, double thickness) {
+    auto element =
+        std::make_unique<SnapshotDetectorElement>(transform, thickness);
+    std::shared_ptr<Surface> surface;
+    switch (type) {
+      case Surface::Cylinder:
+        surface = Surface::makeShared<CylinderSurface>(
+            castBounds<CylinderBounds>(bounds, true), *element);
+        break;
+      case Surface::Disc:
+        surface = Surface::makeShared<DiscSurface>(
+            castBounds<DiscBounds>(bounds, true), *element);
+        break;
+      case Surface::Plane:
+        surface = Surface::makeShared<PlaneSurface>(
+            castBounds<PlanarBounds>(bounds, true), *element);
+        break;
+      case Surface::Straw:
+        surface = Surface::makeShared<StrawSurface>(
+            castBounds<LineBounds>(bounds, true), *element);
+        break;
+      default:
+        throw std::runtime_error(
+            "Invalid detector element in tracking geometry snapshot");
+    }
+    element->assignSurface(surface);
+    m_detectorElements.push_back(std::move(element));
+    return surface;
+  }
+
+  void readLayers() {
+    const size_t nLayers = m_reader.readSize();
+    for (size_t il = 0; il < nLayers; ++il) {
+      const auto kind = static_cast<LayerKind>(m_reader.readValue<uint8_t>());
+      const double thickness = m_reader.readValue<double>();
+      m_layerIds.push_back(m_reader.readValue<uint64_t>());
+      if (kind == LayerKind::eNavigation) {
+        const Index surfaceIndex = m_reader.readValue<Index>();
+        m_layers.push_back(NavigationLayer::create(
+            entry(m_surfaces, surfaceIndex, "surface"), thickness));
+        continue;
+      }
+      auto transform =
+          std::make_shared<const Transform3D>(m_reader.readTransform());
+      const auto& bounds =
+          entry(m_bounds, m_reader.readValue<Index>(), "bounds");
+      const Index materialIndex = m_reader.readValue<Index>();
+      const auto layerType =
+          static_cast<LayerType>(m_reader.readValue<int32_t>());
+      std::unique_ptr<ApproachDescriptor> approachDescriptor = nullptr;
+      if (m_reader.readValue<uint8_t>() != 0u) {
+        std::vector<std::shared_ptr<const Surface>> approachSurfaces;
+        for (Index surfaceIndex : m_reader.readVector<Index>()) {
+          approachSurfaces.push_back(
+              entry(m_surfaces, surfaceIndex, "surface"));
+        }
+        approachDescriptor = std::make_unique<GenericApproachDescriptor>(
+            std::move(approachSurfaces));
+      }
+      auto surfaceArray = readSurfaceArray();
+
+      MutableLayerPtr layer;
+      switch (kind) {
+        case LayerKind::eCylinder:
+          layer = CylinderLayer::create(
+              transform, castBounds<CylinderBounds>(bounds, true),
+              std::move(surfaceArray), thickness, std::move(approachDescriptor),
+              layerType);
+          break;
+        case LayerKind::eDisc:
+          layer = DiscLayer::create(
+              transform, castBounds<DiscBounds>(bounds, true),
+              std::move(surfaceArray), thickness, std::move(approachDescriptor),
+              layerType);
+          break;
+        case LayerKind::ePlane:
+          layer = PlaneLayer::create(
+              transform, castBounds<PlanarBounds>(bounds, true),
+              std::move(surfaceArray), thickness, std::move(approachDescriptor),
+              layerType);
+          break;
+        case LayerKind::eCone:
+          layer = ConeLayer::create(
+              transform, castBounds<ConeBounds>(bounds, true),
+              std::move(surfaceArray), thickness, std::move(approachDescriptor),
+              layerType);
+          break;
+        default:
+          throw std::runtime_error(
+              "Invalid layer type in tracking geometry snapshot");
+      }
+      layer->surfaceRepresentation().assignSurfaceMaterial(
+          surfaceMaterial(materialIndex));
+      m_layers.push_back(std::move(layer));
+    }
+  }
+
+  std::unique_ptr<SurfaceArray> readSurfaceArray() {
+    const auto kind = static_cast<ArrayKind>(m_reader.readValue<uint8_t>());
+    if (kind == ArrayKind::eNone) {
+      return nullptr;
+    } else if (kind == ArrayKind::eSingle) {
+      return std::make_unique<SurfaceArray>(
+          entry(m_surfaces, m_reader.readValue<Index>(), "surface"));
+    } else if (kind != ArrayKind::eGrid) {
+      throw std::runtime_error(
+          "Invalid surface array in tracking geometry snapshot");
+    }
+    std::vector<std::shared_ptr<const Surface>> surfaces;
+    for (Index surfaceIndex : m_reader.readVector<Index>()) {
+      surfaces.push_back(entry(m_surfaces, surfaceIndex, "surface"));
+    }
+    const auto layout = static_cast<GridLayout>(m_reader.readValue<uint8_t>());
+    std::vector<BinningValue> bValues;
+    for (int32_t bValue : m_reader.readVector<int32_t>()) {
+      bValues.push_back(static_cast<BinningValue>(bValue));
+    }
+    const Transform3D transform = m_reader.readTransform();
+    const Transform3D itransform = transform.inverse();
+    const double layoutParameter = m_reader.readValue<double>();
+    AxisRecord axisA, axisB;
+    for (AxisRecord* axis : {&axisA, &axisB}) {
+      axis->equidistant = (m_reader.readValue<uint8_t>() != 0u);
+      if (axis->equidistant) {
+        axis->nBins = m_reader.readSize();
+        axis->min = m_reader.readValue<double>();
+        axis->max = m_reader.readValue<double>();
+      } else {
+        axis->edges = m_reader.readVector<double>();
+        axis->nBins = axis->edges.empty() ? 0u : axis->edges.size() - 1u;
+      }
+      if (axis->nBins == 0u) {
+        throw std::runtime_error(
+            "Invalid surface grid axis in tracking geometry snapshot");
+      }
+    }
+    // every bin including the under- and overflow bins stores its content
+    const uint64_t nBinsA = axisA.nBins + 2u;
+    const uint64_t nBinsB = axisB.nBins + 2u;
+    m_reader.checkSize(nBinsA, sizeof(uint64_t));
+    m_reader.checkSize(nBinsB, sizeof(uint64_t) * nBinsA);
+
+    // the transforms of the SurfaceArrayCreator
+    std::unique_ptr<ISurfaceGridLookup> sl;
+    if (layout == GridLayout::eCylinder) {
+      const double R = layoutParameter;
+      auto globalToLocal = [transform](const Vector3D& pos) {
+        Vector3D loc = transform * pos;
+        return Vector2D(VectorHelpers::phi(loc), loc.z());
+      };
+      auto localToGlobal = [itransform, R](const Vector2D& loc) {
+        return Vector3D(itransform * Vector3D(R * std::cos(loc[0]),
+                                              R * std::sin(loc[0]), loc[1]));
+      };
+      sl = makeGridLookup<detail::AxisBoundaryType::Closed,
+                          detail::AxisBoundaryType::Bound>(
+          globalToLocal, localToGlobal, axisA, axisB, bValues);
+    } else if (layout == GridLayout::eDisc) {
+      const double Z = layoutParameter;
+      auto globalToLocal = [transform](const Vector3D& pos) {
+        Vector3D loc = transform * pos;
+        return Vector2D(VectorHelpers::perp(loc), VectorHelpers::phi(loc));
+      };
+      auto localToGlobal = [itransform, Z](const Vector2D& loc) {
+        return Vector3D(itransform * Vector3D(loc[0] * std::cos(loc[1]),
+                                              loc[0] * std::sin(loc[1]), Z));
+      };
+      sl = makeGridLookup<detail::AxisBoundaryType::Bound,
+                          detail::AxisBoundaryType::Closed>(
+          globalToLocal, localToGlobal, axisA, axisB, bValues);
+    } else if (layout == GridLayout::ePlane) {
+      auto globalToLocal = [transform](const Vector3D& pos) {
+        Vector3D loc = transform * pos;
+        return Vector2D(loc.x(), loc.y());
+      };
+      auto localToGlobal = [itransform](const Vector2D& loc) {
+        return Vector3D(itransform * Vector3D(loc.x(), loc.y(), 0.));
+      };
+      sl = makeGridLookup<detail::AxisBoundaryType::Bound,
+                          detail::AxisBoundaryType::Bound>(
+          globalToLocal, localToGlobal, axisA, axisB, bValues);
+    } else {
+      throw std::runtime_error(
+          "Invalid surface grid layout in tracking geometry snapshot");
+    }
+
+    for (size_t bin = 0; bin < sl->size(); ++bin) {
+      auto& content = sl->lookup(bin);
+      for (Index surfaceIndex : m_reader.readVector<Index>()) {
+        content.push_back(entry(m_surfaces, surfaceIndex, "surface").get());
+      }
+    }
+    // fill nothing, only rebuilds the neighbor cache
+    sl->fill(GeometryContext(), {});
+    return std::make_unique<SurfaceArray>(
+        std::move(sl), std::move(surfaces),
+        std::make_shared<const Transform3D>(transform));
+  }
+
+  void readVolumes() {
+    const size_t nVolumes = m_reader.readSize();
+    for (size_t iv = 0; iv < nVolumes; ++iv) {
+      const std::string name = m_reader.readString();
+      auto transform =
+          std::make_shared<const Transform3D>(m_reader.readTransform());
+      auto bounds = readVolumeBounds(m_reader);
+      const Index materialIndex = m_reader.readValue<Index>();
+      const auto colorCode = m_reader.readValue<uint32_t>();
+      m_volumeIds.push_back(m_reader.readValue<uint64_t>());
+      const Index arrayIndex = m_reader.readValue<Index>();
+      MutableTrackingVolumeVector denseVolumes;
+      for (Index volumeIndex : m_reader.readVector<Index>()) {
+        denseVolumes.push_back(entry(m_volumes, volumeIndex, "volume"));
+      }
+      std::unique_ptr<const LayerArray> layerArray = nullptr;
+      if (m_reader.readValue<uint8_t>() != 0u) {
+        layerArray = ArrayRecord::read(m_reader).build(m_layers, "layer");
+      }
+      std::shared_ptr<const IVolumeMaterial> material =
+          (materialIndex < 0)
+              ? nullptr
+              : entry(m_volumeMaterials, materialIndex, "volume material");
+
+      MutableTrackingVolumePtr volume;
+      if (m_reader.readValue<uint8_t>() != 0u) {
+        // a volume with a hierarchy has no other content
+        if (layerArray != nullptr or arrayIndex >= 0 or
+            not denseVolumes.empty()) {
+          throw std::runtime_error(
+              "Invalid bounding volume hierarchy in tracking geometry "
+              "snapshot");
+        }
+        auto descendants = readDescendants();
+        std::vector<std::unique_ptr<Volume::BoundingBox>> boxStore;
+        const Volume::BoundingBox* top = readNode(descendants, boxStore, 0);
+        volume = TrackingVolume::create(
+            std::move(transform), std::move(bounds), std::move(boxStore),
+            std::move(descendants), top, std::move(material), name);
+      } else {
+        volume = TrackingVolume::create(
+            std::move(transform), std::move(bounds), std::move(material),
+            std::move(layerArray), volumeArray(arrayIndex),
+            std::move(denseVolumes), name);
+      }
+      volume->registerColorCode(colorCode);
+      m_volumes.push_back(std::move(volume));
+    }
+  }
+
+  /// The volumes of a bounding volume hierarchy
+  std::vector<std::unique_ptr<const Volume>> readDescendants() {
+    std::vector<std::unique_ptr<const Volume>> descendants(
+        m_reader.readSize());
+    for (auto& descendant : descendants) {
+      auto transform =
+          std::make_shared<const Transform3D>(m_reader.readTransform());
+      auto volume = std::make_unique<const AbstractVolume>(
+          std::move(transform), readVolumeBounds(m_reader));
+      const auto boundaryIds = m_reader.readVector<uint64_t>();
+      const auto& boundaries = volume->boundarySurfaces();
+      if (boundaryIds.size() != boundaries.size()) {
+        throw std::runtime_error(
+            "Invalid bounding volume hierarchy in tracking geometry snapshot");
+      }
+      for (size_t ib = 0; ib < boundaries.size(); ++ib) {
+        m_hierarchySurfaceIds.emplace_back(
+            &boundaries[ib]->surfaceRepresentation(), boundaryIds[ib]);
+      }
+      descendant = std::move(volume);
+    }
+    return descendants;
+  }
+
+  /// Restore a node of a bounding volume hierarchy and its children, the
+  /// node constructor links the children
+  Volume::BoundingBox* readNode(
+      const std::vector<std::unique_ptr<const Volume>>& descendants,
+      std::vector<std::unique_ptr<Volume::BoundingBox>>& boxStore,
+      size_t depth) {
+    if (depth > kMaxHierarchyDepth) {
+      throw std::runtime_error("Corrupted tracking geometry snapshot");
+    }
+    if (m_reader.readValue<uint8_t>() != 0u) {
+      const auto& entity =
+          entry(descendants, m_reader.readValue<Index>(), "hierarchy volume");
+      const Vector3D vmin = readVertex(m_reader);
+      const Vector3D vmax = readVertex(m_reader);
+      boxStore.push_back(
+          std::make_unique<Volume::BoundingBox>(entity.get(), vmin, vmax));
+      return boxStore.back().get();
+    }
+    const Volume::BoundingBox::vertex_array_type envelope =
+        readVertex(m_reader).array();
+    std::vector<Volume::BoundingBox*> children(m_reader.readSize());
+    if (children.size() < 2u) {
+      throw std::runtime_error(
+          "Invalid bounding volume hierarchy in tracking geometry snapshot");
+    }
+    for (auto& child : children) {
+      child = readNode(descendants, boxStore, depth + 1);
+    }
+    boxStore.push_back(
+        std::make_unique<Volume::BoundingBox>(children, envelope));
+    return boxStore.back().get();
+  }
+
+  void readBoundaries() {
+    std::vector<std::shared_ptr<const BoundarySurface>> boundaries;
+    const size_t nBoundaries = m_reader.readSize();
+    for (size_t ib = 0; ib < nBoundaries; ++ib) {
+      const auto& surface =
+          entry(m_surfaces, m_reader.readValue<Index>(), "surface");
+      auto boundary = std::make_shared<BoundarySurface>(
+          surface, static_cast<const TrackingVolume*>(nullptr),
+          static_cast<const TrackingVolume*>(nullptr));
+      for (auto navDir : {backward, forward}) {
+        const Index volumeIndex = m_reader.readValue<Index>();
+        if (volumeIndex >= 0) {
+          boundary->attachVolume(entry(m_volumes, volumeIndex, "volume").get(),
+                                 navDir);
+        }
+        boundary->attachVolumeArray(volumeArray(m_reader.readValue<Index>()),
+                                    navDir);
+      }
+      boundaries.push_back(std::move(boundary));
+    }
+    for (auto& volume : m_volumes) {
+      const auto faces = m_reader.readVector<Index>();
+      if (faces.size() != volume->boundarySurfaces().size()) {
+        throw std::runtime_error(
+            "Invalid volume boundaries in tracking geometry snapshot");
+      }
+      for (size_t face = 0; face < faces.size(); ++face) {
+        volume->updateBoundarySurface(
+            static_cast<BoundarySurfaceFace>(face),
+            entry(boundaries, faces[face], "boundary"), false);
+      }
+    }
+  }
+
+  /// The volume arrays are built once all their volumes are restored
+  std::shared_ptr<const TrackingVolumeArray> volumeArray(Index arrayIndex) {
+    if (arrayIndex < 0) {
+      return nullptr;
+    }
+    const auto& record =
+        entry(m_volumeArrayRecords, arrayIndex, "volume array");
+    auto& volumeArray = m_volumeArrays[arrayIndex];
+    if (volumeArray == nullptr) {
+      std::vector<TrackingVolumePtr> volumes(m_volumes.begin(),
+                                             m_volumes.end());
+      volumeArray = record.build(volumes, "volume");
+    }
+    return volumeArray;
+  }
+
+  std::shared_ptr<const ISurfaceMaterial> surfaceMaterial(Index index) const {
+    return (index < 0) ? nullptr
+                       : entry(m_surfaceMaterials, index, "surface material");
+  }
+
+  void checkIdentifiers() const {
+    bool matches = true;
+    for (size_t is = 0; is < m_surfaces.size(); ++is) {
+      matches = matches and
+                (m_surfaces[is]->geoID().value() == m_surfaceIds[is]);
+    }
+    for (size_t il = 0; il < m_layers.size(); ++il) {
+      matches =
+          matches and (m_layers[il]->geoID().value() == m_layerIds[il]);
+    }
+    for (size_t iv = 0; iv < m_volumes.size(); ++iv) {
+      matches =
+          matches and (m_volumes[iv]->geoID().value() == m_volumeIds[iv]);
+    }
+    for (const auto& [surface, id] : m_hierarchySurfaceIds) {
+      matches = matches and (surface->geoID().value() == id);
+    }
+    if (not matches) {
+      throw std::runtime_error(
+          "Geometry identifiers of the restored geometry do not match the "
+          "snapshot");
+    }
+  }
+
+  SnapshotReader& m_reader;
+
+  std::vector<std::unique_ptr<const SnapshotDetectorElement>>
+      m_detectorElements;
+  std::vector<std::shared_ptr<const ISurfaceMaterial>> m_surfaceMaterials;
+  std::vector<std::shared_ptr<const IVolumeMaterial>> m_volumeMaterials;
+  std::vector<std::shared_ptr<const SurfaceBounds>> m_bounds;
+  std::vector<std::shared_ptr<const Surface>> m_surfaces;
+  std::vector<uint64_t> m_surfaceIds;
+  std::vector<LayerPtr> m_layers;
+  std::vector<uint64_t> m_layerIds;
+  std::vector<ArrayRecord> m_volumeArrayRecords;
+  std::vector<std::shared_ptr<const TrackingVolumeArray>> m_volumeArrays;
+  std::vector<MutableTrackingVolumePtr> m_volumes;
+  std::vector<uint64_t> m_volumeIds;
+  std::vector<std::pair<const Surface*, uint64_t>> m_hierarchySurfaceIds;
+};
+
+}  // namespace
+}  // namespace Acts
+
+void Acts::writeTrackingGeometrySnapshot(const GeometryContext& gctx,
+                                         const TrackingGeometry& tGeometry,
+                                         std::ostream& os) {
+  GeometryCollector collector(gctx);
+  collector.collectVolume(*tGeometry.highestTrackingVolume());
+  collector.collectBoundaries();
+
+  SnapshotWriter writer(os);
+  os.write(kSnapshotMagic, sizeof(kSnapshotMagic));
+  writer.writeValue<uint32_t>(kSnapshotVersion);
+  writer.writeValue<uint32_t>(sizeof(MaterialProperties));
+  writer.writeValue<uint32_t>(sizeof(Material));
+  collector.write(writer);
+  os.write(kSnapshotMagic, sizeof(kSnapshotMagic));
+  if (not os) {
+    throw std::runtime_error("Could not write tracking geometry snapshot");
+  }
+}
+
+std::shared_ptr<const Acts::TrackingGeometry>
+Acts::readTrackingGeometrySnapshot(std::istream& is) {
+  SnapshotReader reader(is);
+  char magic[sizeof(kSnapshotMagic)];
+  reader.read(magic, sizeof(magic));
+  if (std::memcmp(magic, kSnapshotMagic, sizeof(magic)) != 0) {
+    throw std::runtime_error("Input is not a tracking geometry snapshot");
+  }
+  if (reader.readValue<uint32_t>() != kSnapshotVersion or
+      reader.readValue<uint32_t>() != sizeof(MaterialProperties) or
+      reader.readValue<uint32_t>() != sizeof(Material)) {
+    throw std::runtime_error(
+        "Tracking geometry snapshot was written with a different format");
+  }
+  GeometryRestorer restorer(reader);
+  auto restored = std::make_shared<RestoredGeometry>(restorer.read());
+  reader.read(magic, sizeof(magic));
+  if (std::memcmp(magic, kSnapshotMagic, sizeof(magic)) != 0) {
+    throw std::runtime_error("Corrupted tracking geometry snapshot");
+  }
+  // the returned pointer keeps the detector elements alive
+  return std::shared_ptr<const TrackingGeometry>(
+      restored, restored->trackingGeometry.get());
+}
@@ -15,7 +15,7 @@
 #include "Acts/Geometry/TrackingVolume.hpp"
 #include "Acts/Geometry/VolumeBounds.hpp"
 #include "Acts/Utilities/BinUtility.hpp"
-#include "Acts/Utilities/BinnedArrayXD.hpp"
+#include "Acts/Utilities/BinnedArrayT.hpp"
 #include "Acts/Utilities/Definitions.hpp"
 
 std::shared_ptr<const Acts::TrackingVolumeArray>
@@ -61,6 +61,6 @@ Acts::TrackingVolumeArrayCreator::trackingVolumeArray(
       std::make_unique<const BinUtility>(boundaries, open, bValue);
 
   // and return the newly created binned array
-  return std::make_shared<const BinnedArrayXD<TrackingVolumePtr>>(
-      tVolumesOrdered, std::move(binUtility));
+  return makeBinnedArray<TrackingVolumePtr>(tVolumesOrdered,
+                                            std::move(binUtility));
 }
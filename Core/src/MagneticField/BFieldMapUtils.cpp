@@ -16,15 +16,20 @@
 using Acts::VectorHelpers::perp;
 using Acts::VectorHelpers::phi;
 
+namespace {
+
+/// Field mapper in r and z for a given field value storage type
+template <typename value_t>
 Acts::InterpolatedBFieldMapper<
-    Acts::detail::Grid<Acts::Vector2D, Acts::detail::EquidistantAxis,
+    Acts::detail::Grid<value_t, Acts::detail::EquidistantAxis,
                        Acts::detail::EquidistantAxis>>
-Acts::fieldMapperRZ(const std::function<size_t(std::array<size_t, 2> binsRZ,
-                                               std::array<size_t, 2> nBinsRZ)>&
-                        localToGlobalBin,
-                    std::vector<double> rPos, std::vector<double> zPos,
-                    std::vector<Acts::Vector2D> bField, double lengthUnit,
-                    double BFieldUnit, bool firstQuadrant) {
+fieldMapperRZImpl(const std::function<size_t(std::array<size_t, 2> binsRZ,
+                                             std::array<size_t, 2> nBinsRZ)>&
+                      localToGlobalBin,
+                  std::vector<double> rPos, std::vector<double> zPos,
+                  std::vector<value_t> bField, double lengthUnit,
+                  double BFieldUnit, bool firstQuadrant) {
+  using Scalar = typename value_t::Scalar;
   // [1] Create Grid
   // sort the values
   std::sort(rPos.begin(), rPos.end());
@@ -63,37 +68,40 @@ Acts::fieldMapperRZ(const std::function<size_t(std::array<size_t, 2> binsRZ,
                                       nBinsZ);
 
   // Create the grid
-  using Grid_t =
-      Acts::detail::Grid<Acts::Vector2D, Acts::detail::EquidistantAxis,
-                         Acts::detail::EquidistantAxis>;
+  using Grid_t = Acts::detail::Grid<value_t, Acts::detail::EquidistantAxis,
+                                    Acts::detail::EquidistantAxis>;
   Grid_t grid(std::make_tuple(std::move(rAxis), std::move(zAxis)));
 
   // [2] Set the bField values
   for (size_t i = 1; i <= nBinsR; ++i) {
     for (size_t j = 1; j <= nBinsZ; ++j) {
       std::array<size_t, 2> nIndices = {{rPos.size(), zPos.size()}};
-      Grid_t::index_t indices = {{i, j}};
+      typename Grid_t::index_t indices = {{i, j}};
       if (firstQuadrant) {
         // std::vectors begin with 0 and we do not want the user needing to
         // take underflow or overflow bins in account this is why we need to
         // subtract by one
         size_t n = std::abs(int(j) - int(zPos.size()));
-        Grid_t::index_t indicesFirstQuadrant = {{i - 1, n}};
+        typename Grid_t::index_t indicesFirstQuadrant = {{i - 1, n}};
 
         grid.atLocalBins(indices) =
-            bField.at(localToGlobalBin(indicesFirstQuadrant, nIndices)) *
-            BFieldUnit;
+            (bField.at(localToGlobalBin(indicesFirstQuadrant, nIndices))
+                 .template cast<double>() *
+             BFieldUnit)
+                .template cast<Scalar>();
       } else {
         // std::vectors begin with 0 and we do not want the user needing to
         // take underflow or overflow bins in account this is why we need to
         // subtract by one
         grid.atLocalBins(indices) =
-            bField.at(localToGlobalBin({{i - 1, j - 1}}, nIndices)) *
-            BFieldUnit;
+            (bField.at(localToGlobalBin({{i - 1, j - 1}}, nIndices))
+                 .template cast<double>() *
+             BFieldUnit)
+                .template cast<Scalar>();
       }
     }
   }
-  grid.setExteriorBins(Acts::Vector2D::Zero());
+  grid.setExteriorBins(value_t::Zero());
 
   // [3] Create the transformation for the position
   // map (x,y,z) -> (r,z)
@@ -103,8 +111,7 @@ Acts::fieldMapperRZ(const std::function<size_t(std::array<size_t, 2> binsRZ,
 
   // [4] Create the transformation for the bfield
   // map (Br,Bz) -> (Bx,By,Bz)
-  auto transformBField = [](const Acts::Vector2D& field,
-                            const Acts::Vector3D& pos) {
+  auto transformBField = [](const value_t& field, const Acts::Vector3D& pos) {
     double r_sin_theta_2 = pos.x() * pos.x() + pos.y() * pos.y();
     double cos_phi, sin_phi;
     if (r_sin_theta_2 > std::numeric_limits<double>::min()) {
@@ -124,16 +131,18 @@ Acts::fieldMapperRZ(const std::function<size_t(std::array<size_t, 2> binsRZ,
                                                 std::move(grid));
 }
 
+/// Field mapper in x, y and z for a given field value storage type
+template <typename value_t>
 Acts::InterpolatedBFieldMapper<Acts::detail::Grid<
-    Acts::Vector3D, Acts::detail::EquidistantAxis,
-    Acts::detail::EquidistantAxis, Acts::detail::EquidistantAxis>>
-Acts::fieldMapperXYZ(
-    const std::function<size_t(std::array<size_t, 3> binsXYZ,
-                               std::array<size_t, 3> nBinsXYZ)>&
-        localToGlobalBin,
-    std::vector<double> xPos, std::vector<double> yPos,
-    std::vector<double> zPos, std::vector<Acts::Vector3D> bField,
-    double lengthUnit, double BFieldUnit, bool firstOctant) {
+    value_t, Acts::detail::EquidistantAxis, Acts::detail::EquidistantAxis,
+    Acts::detail::EquidistantAxis>>
+fieldMapperXYZImpl(const std::function<size_t(std::array<size_t, 3> binsXYZ,
+                                              std::array<size_t, 3> nBinsXYZ)>&
+                       localToGlobalBin,
+                   std::vector<double> xPos, std::vector<double> yPos,
+                   std::vector<double> zPos, std::vector<value_t> bField,
+                   double lengthUnit, double BFieldUnit, bool firstOctant) {
+  using Scalar = typename value_t::Scalar;
   // [1] Create Grid
   // Sort the values
   std::sort(xPos.begin(), xPos.end());
@@ -189,10 +198,9 @@ Acts::fieldMapperXYZ(
   Acts::detail::EquidistantAxis zAxis(zMin * lengthUnit, zMax * lengthUnit,
                                       nBinsZ);
   // Create the grid
-  using Grid_t =
-      Acts::detail::Grid<Acts::Vector3D, Acts::detail::EquidistantAxis,
-                         Acts::detail::EquidistantAxis,
-                         Acts::detail::EquidistantAxis>;
+  using Grid_t = Acts::detail::Grid<value_t, Acts::detail::EquidistantAxis,
+                                    Acts::detail::EquidistantAxis,
+                                    Acts::detail::EquidistantAxis>;
   Grid_t grid(
       std::make_tuple(std::move(xAxis), std::move(yAxis), std::move(zAxis)));
 
@@ -200,7 +208,7 @@ Acts::fieldMapperXYZ(
   for (size_t i = 1; i <= nBinsX; ++i) {
     for (size_t j = 1; j <= nBinsY; ++j) {
       for (size_t k = 1; k <= nBinsZ; ++k) {
-        Grid_t::index_t indices = {{i, j, k}};
+        typename Grid_t::index_t indices = {{i, j, k}};
         std::array<size_t, 3> nIndices = {
             {xPos.size(), yPos.size(), zPos.size()}};
         if (firstOctant) {
@@ -210,24 +218,28 @@ Acts::fieldMapperXYZ(
           size_t m = std::abs(int(i) - (int(xPos.size())));
           size_t n = std::abs(int(j) - (int(yPos.size())));
           size_t l = std::abs(int(k) - (int(zPos.size())));
-          Grid_t::index_t indicesFirstOctant = {{m, n, l}};
+          typename Grid_t::index_t indicesFirstOctant = {{m, n, l}};
 
           grid.atLocalBins(indices) =
-              bField.at(localToGlobalBin(indicesFirstOctant, nIndices)) *
-              BFieldUnit;
+              (bField.at(localToGlobalBin(indicesFirstOctant, nIndices))
+                   .template cast<double>() *
+               BFieldUnit)
+                  .template cast<Scalar>();
 
         } else {
           // std::vectors begin with 0 and we do not want the user needing to
           // take underflow or overflow bins in account this is why we need to
           // subtract by one
           grid.atLocalBins(indices) =
-              bField.at(localToGlobalBin({{i - 1, j - 1, k - 1}}, nIndices)) *
-              BFieldUnit;
+              (bField.at(localToGlobalBin({{i - 1, j - 1, k - 1}}, nIndices))
+                   .template cast<double>() *
+               BFieldUnit)
+                  .template cast<Scalar>();
         }
       }
     }
   }
-  grid.setExteriorBins(Acts::Vector3D::Zero());
+  grid.setExteriorBins(value_t::Zero());
 
   // [3] Create the transformation for the position
   // map (x,y,z) -> (r,z)
@@ -235,8 +247,10 @@ Acts::fieldMapperXYZ(
 
   // [4] Create the transformation for the bfield
   // map (Bx,By,Bz) -> (Bx,By,Bz)
-  auto transformBField = [](const Acts::Vector3D& field,
-                            const Acts::Vector3D& /*pos*/) { return field; };
+  auto transformBField = [](const value_t& field,
+                            const Acts::Vector3D& /*pos*/) {
+    return Acts::Vector3D(field.template cast<double>());
+  };
 
   // [5] Create the mapper & BField Service
   // create field mapping
@@ -244,6 +258,66 @@ Acts::fieldMapperXYZ(
                                                 std::move(grid));
 }
 
+}  // namespace
+
+Acts::InterpolatedBFieldMapper<
+    Acts::detail::Grid<Acts::Vector2D, Acts::detail::EquidistantAxis,
+                       Acts::detail::EquidistantAxis>>
+Acts::fieldMapperRZ(const std::function<size_t(std::array<size_t, 2> binsRZ,
+                                               std::array<size_t, 2> nBinsRZ)>&
+                        localToGlobalBin,
+                    std::vector<double> rPos, std::vector<double> zPos,
+                    std::vector<Acts::Vector2D> bField, double lengthUnit,
+                    double BFieldUnit, bool firstQuadrant) {
+  return fieldMapperRZImpl(localToGlobalBin, std::move(rPos), std::move(zPos),
+                           std::move(bField), lengthUnit, BFieldUnit,
+                           firstQuadrant);
+}
+
+Acts::InterpolatedBFieldMapper<
+    Acts::detail::Grid<Acts::Vector2F, Acts::detail::EquidistantAxis,
+                       Acts::detail::EquidistantAxis>>
+Acts::fieldMapperRZ(const std::function<size_t(std::array<size_t, 2> binsRZ,
+                                               std::array<size_t, 2> nBinsRZ)>&
+                        localToGlobalBin,
+                    std::vector<double> rPos, std::vector<double> zPos,
+                    std::vector<Acts::Vector2F> bField, double lengthUnit,
+                    double BFieldUnit, bool firstQuadrant) {
+  return fieldMapperRZImpl(localToGlobalBin, std::move(rPos), std::move(zPos),
+                           std::move(bField), lengthUnit, BFieldUnit,
+                           firstQuadrant);
+}
+
+Acts::InterpolatedBFieldMapper<Acts::detail::Grid<
+    Acts::Vector3D, Acts::detail::EquidistantAxis,
+    Acts::detail::EquidistantAxis, Acts::detail::EquidistantAxis>>
+Acts::fieldMapperXYZ(
+    const std::function<size_t(std::array<size_t, 3> binsXYZ,
+                               std::array<size_t, 3> nBinsXYZ)>&
+        localToGlobalBin,
+    std::vector<double> xPos, std::vector<double> yPos,
+    std::vector<double> zPos, std::vector<Acts::Vector3D> bField,
+    double lengthUnit, double BFieldUnit, bool firstOctant) {
+  return fieldMapperXYZImpl(localToGlobalBin, std::move(xPos), std::move(yPos),
+                            std::move(zPos), std::move(bField), lengthUnit,
+                            BFieldUnit, firstOctant);
+}
+
+Acts::InterpolatedBFieldMapper<Acts::detail::Grid<
+    Acts::Vector3F, Acts::detail::EquidistantAxis,
+    Acts::detail::EquidistantAxis, Acts::detail::EquidistantAxis>>
+Acts::fieldMapperXYZ(
+    const std::function<size_t(std::array<size_t, 3> binsXYZ,
+                               std::array<size_t, 3> nBinsXYZ)>&
+        localToGlobalBin,
+    std::vector<double> xPos, std::vector<double> yPos,
+    std::vector<double> zPos, std::vector<Acts::Vector3F> bField,
+    double lengthUnit, double BFieldUnit, bool firstOctant) {
+  return fieldMapperXYZImpl(localToGlobalBin, std::move(xPos), std::move(yPos),
+                            std::move(zPos), std::move(bField), lengthUnit,
+                            BFieldUnit, firstOctant);
+}
+
 Acts::InterpolatedBFieldMapper<
     Acts::detail::Grid<Acts::Vector2D, Acts::detail::EquidistantAxis,
                        Acts::detail::EquidistantAxis>>
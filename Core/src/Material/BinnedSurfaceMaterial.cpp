@@ -9,37 +9,121 @@
 #include "Acts/Material/BinnedSurfaceMaterial.hpp"
 #include "Acts/Material/MaterialProperties.hpp"
 
+#include <cstring>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+
+namespace {
+
+static_assert(std::is_trivially_copyable_v<Acts::MaterialProperties>,
+              "Material properties can not be compared bitwise");
+
+/// Bitwise hash and equality to find identical material properties.
+///
+/// Properties that compare equal but differ in their bits, e.g. -0 and 0,
+/// end up as separate palette entries which is harmless.
+struct PropertiesHash {
+  size_t operator()(const Acts::MaterialProperties& mp) const {
+    return std::hash<std::string_view>()(std::string_view(
+        reinterpret_cast<const char*>(&mp), sizeof(Acts::MaterialProperties)));
+  }
+};
+struct PropertiesEqual {
+  bool operator()(const Acts::MaterialProperties& lhs,
+                  const Acts::MaterialProperties& rhs) const {
+    return std::memcmp(&lhs, &rhs, sizeof(Acts::MaterialProperties)) == 0;
+  }
+};
+
+}  // namespace
+
 Acts::BinnedSurfaceMaterial::BinnedSurfaceMaterial(
     const BinUtility& binUtility, MaterialPropertiesVector fullProperties,
     double splitFactor)
     : ISurfaceMaterial(splitFactor), m_binUtility(binUtility) {
-  // fill the material with deep copy
-  m_fullMaterial.push_back(std::move(fullProperties));
+  fillPalette(MaterialPropertiesMatrix{std::move(fullProperties)});
 }
 
 Acts::BinnedSurfaceMaterial::BinnedSurfaceMaterial(
     const BinUtility& binUtility, MaterialPropertiesMatrix fullProperties,
     double splitFactor)
+    : ISurfaceMaterial(splitFactor), m_binUtility(binUtility) {
+  fillPalette(fullProperties);
+}
+
+Acts::BinnedSurfaceMaterial::BinnedSurfaceMaterial(
+    const BinUtility& binUtility,
+    std::shared_ptr<const MaterialProperties> sharedProperties,
+    double splitFactor)
     : ISurfaceMaterial(splitFactor),
       m_binUtility(binUtility),
-      m_fullMaterial(std::move(fullProperties)) {}
+      m_sharedMaterial(std::move(sharedProperties)),
+      m_bins0(m_binUtility.bins(0)) {}
 
 Acts::BinnedSurfaceMaterial& Acts::BinnedSurfaceMaterial::operator*=(
     double scale) {
-  for (auto& materialVector : m_fullMaterial) {
-    for (auto& materialBin : materialVector) {
-      materialBin.scaleThickness(scale);
-    }
+  // take a copy of referenced material before modifying it
+  if (m_sharedMaterial) {
+    fillPalette(fullMaterial());
+    m_sharedMaterial.reset();
+  }
+  // every bin refers to a palette entry, scale each entry once
+  for (auto& materialBin : m_palette) {
+    materialBin.scaleThickness(scale);
   }
   return (*this);
 }
 
+Acts::MaterialPropertiesMatrix Acts::BinnedSurfaceMaterial::fullMaterial()
+    const {
+  const size_t bins0 = m_bins0;
+  const size_t bins1 =
+      (bins0 != 0u) ? (m_sharedMaterial ? m_binUtility.bins(1)
+                                        : m_paletteIndices.size() / bins0)
+                    : 0u;
+  MaterialPropertiesMatrix fullProperties(bins1);
+  for (size_t bin1 = 0; bin1 < bins1; ++bin1) {
+    fullProperties[bin1].reserve(bins0);
+    for (size_t bin0 = 0; bin0 < bins0; ++bin0) {
+      fullProperties[bin1].push_back(materialProperties(bin0, bin1));
+    }
+  }
+  return fullProperties;
+}
+
+void Acts::BinnedSurfaceMaterial::fillPalette(
+    const MaterialPropertiesMatrix& fullProperties) {
+  m_bins0 = fullProperties.empty() ? 0u : fullProperties.front().size();
+  m_palette.clear();
+  m_paletteIndices.clear();
+  m_paletteIndices.reserve(fullProperties.size() * m_bins0);
+  std::unordered_map<MaterialProperties, uint32_t, PropertiesHash,
+                     PropertiesEqual>
+      known;
+  for (const auto& materialVector : fullProperties) {
+    if (materialVector.size() != m_bins0) {
+      throw std::invalid_argument(
+          "Material properties matrix rows have different sizes");
+    }
+    for (const auto& materialBin : materialVector) {
+      auto [it, inserted] = known.try_emplace(materialBin, m_palette.size());
+      if (inserted) {
+        m_palette.push_back(materialBin);
+      }
+      m_paletteIndices.push_back(it->second);
+    }
+  }
+  m_palette.shrink_to_fit();
+}
+
 const Acts::MaterialProperties& Acts::BinnedSurfaceMaterial::materialProperties(
     const Vector2D& lp) const {
   // the first bin
   size_t ibin0 = m_binUtility.bin(lp, 0);
   size_t ibin1 = m_binUtility.max(1) != 0u ? m_binUtility.bin(lp, 1) : 0;
-  return m_fullMaterial[ibin1][ibin0];
+  return materialProperties(ibin0, ibin1);
 }
 
 const Acts::MaterialProperties& Acts::BinnedSurfaceMaterial::materialProperties(
@@ -47,7 +131,7 @@ const Acts::MaterialProperties& Acts::BinnedSurfaceMaterial::materialProperties(
   // the first bin
   size_t ibin0 = m_binUtility.bin(gp, 0);
   size_t ibin1 = m_binUtility.max(1) != 0u ? m_binUtility.bin(gp, 1) : 0;
-  return m_fullMaterial[ibin1][ibin0];
+  return materialProperties(ibin0, ibin1);
 }
 
 std::ostream& Acts::BinnedSurfaceMaterial::toStream(std::ostream& sl) const {
@@ -56,15 +140,11 @@ std::ostream& Acts::BinnedSurfaceMaterial::toStream(std::ostream& sl) const {
      << " / " << m_binUtility.max(1) + 1 << std::endl;
   sl << "   - Parse full update material    : " << std::endl;  //
   // output  the full material
-  unsigned int imat1 = 0;
-  for (auto& materialVector : m_fullMaterial) {
-    unsigned int imat0 = 0;
-    // the vector iterator
-    for (auto& materialBin : materialVector) {
-      sl << " Bin [" << imat1 << "][" << imat0 << "] - " << (materialBin);
-      ++imat0;
+  for (size_t imat1 = 0; imat1 < m_binUtility.bins(1); ++imat1) {
+    for (size_t imat0 = 0; imat0 < m_binUtility.bins(0); ++imat0) {
+      sl << " Bin [" << imat1 << "][" << imat0 << "] - "
+         << materialProperties(imat0, imat1);
     }
-    ++imat1;
   }
   sl << "  - BinUtility: " << m_binUtility << std::endl;
   return sl;
@@ -0,0 +1,83 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Propagator/detail/AnalyticalTransport.hpp"
+
+#include <cmath>
+
+namespace Acts {
+
+void detail::transportStraightLine(FreeMatrix& transportJacobian, double h,
+                                   double dtdlambda) {
+  // The step jacobian is the identity apart from dx/dT = h and dt/dlambda
+  transportJacobian.topRows<3>() += h * transportJacobian.middleRows<3>(4);
+  transportJacobian.row(3) += dtdlambda * transportJacobian.row(7);
+}
+
+void detail::transportHelix(FreeMatrix& transportJacobian,
+                            const Vector3D& direction, double qop,
+                            const Vector3D& bField, double h,
+                            double dtdlambda) {
+  const double bNorm = bField.norm();
+  if (bNorm == 0.) {
+    transportStraightLine(transportJacobian, h, dtdlambda);
+    return;
+  }
+  // The direction rotates around the field axis b as dT/ds = omega b x T
+  const Vector3D b = bField / bNorm;
+  const double omega = -qop * bNorm;
+  const double theta = omega * h;
+
+  // Coefficients of the rotation and of its integrals. Their closed forms
+  // cancel catastrophically for small turning angles, use the series there.
+  const double sinTheta = std::sin(theta);
+  const double cosTheta = std::cos(theta);
+  const double theta2 = theta * theta;
+  double f1 = 0., f2 = 0., g1 = 0., g2 = 0.;
+  if (std::abs(theta) < 0.1) {
+    f1 = theta * (1. / 2. - theta2 * (1. / 24. - theta2 * (1. / 720. -
+                                                          theta2 / 40320.)));
+    f2 = theta2 * (1. / 6. - theta2 * (1. / 120. - theta2 * (1. / 5040. -
+                                                            theta2 / 362880.)));
+    g1 = theta * (1. / 3. - theta2 * (1. / 30. - theta2 * (1. / 840. -
+                                                          theta2 / 45360.)));
+    g2 = theta2 * (1. / 8. - theta2 * (1. / 144. - theta2 / 5760.));
+  } else {
+    f1 = (1. - cosTheta) / theta;
+    f2 = 1. - sinTheta / theta;
+    g1 = (sinTheta - theta * cosTheta) / theta2;
+    g2 = 0.5 - (cosTheta + theta * sinTheta - 1.) / theta2;
+  }
+
+  // Cross product matrix of the field axis, i.e. bx * v = b x v
+  ActsMatrixD<3, 3> bx;
+  bx << 0., -b.z(), b.y(), b.z(), 0., -b.x(), -b.y(), b.x(), 0.;
+  const ActsMatrixD<3, 3> bx2 = bx * bx;
+
+  // dT/dT0 = exp(theta bx), dx/dT0 is its integral along the step
+  const ActsMatrixD<3, 3> dTdT =
+      ActsMatrixD<3, 3>::Identity() + sinTheta * bx + (1. - cosTheta) * bx2;
+  const ActsMatrixD<3, 3> dxdT =
+      h * (ActsMatrixD<3, 3>::Identity() + f1 * bx + f2 * bx2);
+  // Derivatives w.r.t. q/p follow from dT(s)/dlambda = s T(s) x B
+  const Vector3D dTdL = h * (dTdT * direction).cross(bField);
+  const Vector3D dxdL =
+      (h * h *
+       (0.5 * direction + g1 * b.cross(direction) + g2 * bx2 * direction))
+          .cross(bField);
+
+  // Apply the non-trivial blocks, the direction rows are updated last
+  const ActsMatrixD<3, eFreeParametersSize> dirRows =
+      transportJacobian.middleRows<3>(4);
+  const FreeRowVector qopRow = transportJacobian.row(7);
+  transportJacobian.topRows<3>() += dxdT * dirRows + dxdL * qopRow;
+  transportJacobian.row(3) += dtdlambda * qopRow;
+  transportJacobian.middleRows<3>(4) = dTdT * dirRows + dTdL * qopRow;
+}
+
+}  // namespace Acts
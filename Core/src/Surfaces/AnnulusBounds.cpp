@@ -130,7 +130,7 @@ bool Acts::AnnulusBounds::inside(const Vector2D& lposition, double tolR,
                                  double tolPhi) const {
   // locpo is PC in STRIP SYSTEM
   // need to perform internal rotation induced by m_phiAvg
-  Vector2D locpo_rotated = m_rotationStripPC * lposition;
+  Vector2D locpo_rotated = rotateStripPC(lposition);
   double phiLoc = locpo_rotated[eLOC_PHI];
   double rLoc = locpo_rotated[eLOC_R];
 
@@ -139,6 +139,13 @@ bool Acts::AnnulusBounds::inside(const Vector2D& lposition, double tolR,
     return false;
   }
 
+  // the module origin is shifted by |m_shiftPC| in R, which limits the R in
+  // MODULE SYSTEM to rLoc +- |m_shiftPC| and allows a quick rejection
+  if (std::abs(rLoc) + m_shiftPC[eLOC_R] < get(eMinR) - tolR ||
+      std::abs(rLoc) - m_shiftPC[eLOC_R] > get(eMaxR) + tolR) {
+    return false;
+  }
+
   // calculate R in MODULE SYSTEM to evaluate R-bounds
   if (tolR == 0.) {
     // don't need R, can use R^2
@@ -176,7 +183,7 @@ bool Acts::AnnulusBounds::inside(const Vector2D& lposition,
     }
 
     // we need to rotated the locpo
-    Vector2D locpo_rotated = m_rotationStripPC * lposition;
+    Vector2D locpo_rotated = rotateStripPC(lposition);
 
     // covariance is given in STRIP SYSTEM in PC
     // we need to convert the covariance to the MODULE SYSTEM in PC
@@ -328,7 +335,7 @@ double Acts::AnnulusBounds::distanceToBoundary(
   // return smallest one
   // closest distance is cartesian, we want the result in mm.
 
-  Vector2D locpo_rotated = m_rotationStripPC * lposition;
+  Vector2D locpo_rotated = rotateStripPC(lposition);
 
   // locpo is given in STRIP PC, we need it in STRIP XY and possibly MODULE XY
   double rStrip = locpo_rotated[eLOC_R];
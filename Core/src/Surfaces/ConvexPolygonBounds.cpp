@@ -34,7 +34,8 @@ std::vector<double> Acts::ConvexPolygonBoundsBase::values() const {
 Acts::ConvexPolygonBounds<Acts::PolygonDynamic>::ConvexPolygonBounds(
     const std::vector<Vector2D>& vertices)
     : m_vertices(vertices.begin(), vertices.end()),
-      m_boundingBox(makeBoundingBox(vertices)) {}
+      m_boundingBox(makeBoundingBox(vertices)),
+      m_edges(vertices) {}
 
 Acts::SurfaceBounds::BoundsType
 Acts::ConvexPolygonBounds<Acts::PolygonDynamic>::type() const {
@@ -43,7 +44,13 @@ Acts::ConvexPolygonBounds<Acts::PolygonDynamic>::type() const {
 
 bool Acts::ConvexPolygonBounds<Acts::PolygonDynamic>::inside(
     const Acts::Vector2D& lposition, const Acts::BoundaryCheck& bcheck) const {
-  return bcheck.isInside(lposition, m_vertices);
+  return bcheck.isInside(lposition, m_edges);
+}
+
+void Acts::ConvexPolygonBounds<Acts::PolygonDynamic>::insideBatch(
+    const std::vector<Vector2D>& lpositions, const BoundaryCheck& bcheck,
+    std::vector<bool>& inside) const {
+  bcheck.isInside(lpositions, m_edges, inside);
 }
 
 double Acts::ConvexPolygonBounds<Acts::PolygonDynamic>::distanceToBoundary(
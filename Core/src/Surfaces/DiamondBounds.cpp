@@ -18,12 +18,18 @@ Acts::SurfaceBounds::BoundsType Acts::DiamondBounds::type() const {
 
 bool Acts::DiamondBounds::inside(const Acts::Vector2D& lposition,
                                  const Acts::BoundaryCheck& bcheck) const {
-  return bcheck.isInside(lposition, vertices());
+  return bcheck.isInside(lposition, m_edges);
+}
+
+void Acts::DiamondBounds::insideBatch(const std::vector<Vector2D>& lpositions,
+                                      const Acts::BoundaryCheck& bcheck,
+                                      std::vector<bool>& inside) const {
+  bcheck.isInside(lpositions, m_edges, inside);
 }
 
 double Acts::DiamondBounds::distanceToBoundary(
     const Acts::Vector2D& lposition) const {
-  return BoundaryCheck(true).distance(lposition, vertices());
+  return BoundaryCheck(true).distance(lposition, m_edges.vertices());
 }
 
 std::vector<Acts::Vector2D> Acts::DiamondBounds::vertices(
@@ -0,0 +1,220 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Surfaces/SurfaceBatchIntersector.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include "Acts/Surfaces/CylinderBounds.hpp"
+#include "Acts/Surfaces/DiscBounds.hpp"
+#include "Acts/Surfaces/LineBounds.hpp"
+#include "Acts/Utilities/Helpers.hpp"
+#include "Acts/Utilities/detail/RealQuadraticEquation.hpp"
+
+namespace {
+
+/// Intersection status of a valid solution at the given path length
+Acts::Intersection::Status pathStatus(double path) {
+  return (path * path < Acts::s_onSurfaceTolerance * Acts::s_onSurfaceTolerance)
+             ? Acts::Intersection::Status::onSurface
+             : Acts::Intersection::Status::reachable;
+}
+
+/// Intersection with a plane given by its center and normal
+Acts::Intersection planarIntersection(const Acts::Vector3D& center,
+                                      const Acts::Vector3D& normal,
+                                      const Acts::Vector3D& position,
+                                      const Acts::Vector3D& direction) {
+  double denom = direction.dot(normal);
+  if (denom == 0.) {
+    return Acts::Intersection();
+  }
+  double path = normal.dot(center - position) / denom;
+  return Acts::Intersection(position + path * direction, path,
+                            pathStatus(path));
+}
+
+/// Local polar coordinates from local cartesian coordinates on a disc
+Acts::Vector2D localPolar(const Acts::Vector2D& lcartesian) {
+  return Acts::Vector2D(Acts::VectorHelpers::perp(lcartesian),
+                        Acts::VectorHelpers::phi(lcartesian));
+}
+
+}  // namespace
+
+Acts::SurfaceBatchIntersector::SurfaceBatchIntersector(
+    const GeometryContext& gctx, std::vector<const Surface*> surfaces)
+    : m_gctx(gctx), m_surfaces(std::move(surfaces)) {
+  m_data.reserve(m_surfaces.size());
+  for (const Surface* surface : m_surfaces) {
+    if (surface == nullptr) {
+      throw std::invalid_argument("SurfaceBatchIntersector: nullptr surface");
+    }
+    SurfaceData data;
+    data.surface = surface;
+    data.bounds = &surface->bounds();
+    const Transform3D& transform = surface->transform(gctx);
+    data.rotation = transform.rotation();
+    data.center = transform.translation();
+    switch (surface->type()) {
+      case Surface::Plane:
+        data.kernel = Kernel::ePlane;
+        break;
+      case Surface::Disc:
+        data.kernel = Kernel::eDisc;
+        data.discBounds = dynamic_cast<const DiscBounds*>(data.bounds);
+        data.fullAzimuth = (data.discBounds != nullptr and
+                            data.discBounds->coversFullAzimuth());
+        break;
+      case Surface::Cylinder: {
+        auto cBounds = dynamic_cast<const CylinderBounds*>(data.bounds);
+        if (cBounds != nullptr) {
+          data.kernel = Kernel::eCylinder;
+          data.radius = cBounds->get(CylinderBounds::eR);
+          data.radialTolerance = std::max(0.0001 * data.radius, 0.01);
+        }
+        break;
+      }
+      case Surface::Straw:
+      case Surface::Perigee: {
+        data.kernel = Kernel::eLine;
+        auto lBounds = dynamic_cast<const LineBounds*>(data.bounds);
+        if (lBounds != nullptr) {
+          data.radius = lBounds->get(LineBounds::eR);
+          data.halfZ = lBounds->get(LineBounds::eHalfLengthZ);
+        }
+        break;
+      }
+      default:
+        break;
+    }
+    m_data.push_back(data);
+  }
+}
+
+void Acts::SurfaceBatchIntersector::intersect(
+    const Vector3D& position, const Vector3D& direction,
+    const BoundaryCheck& bcheck,
+    std::vector<SurfaceIntersection>& intersections) const {
+  intersections.clear();
+  intersections.reserve(m_data.size());
+  for (const auto& data : m_data) {
+    intersections.emplace_back(intersect(data, position, direction, bcheck),
+                               data.surface);
+  }
+}
+
+void Acts::SurfaceBatchIntersector::intersect(
+    size_t isurface, const std::vector<Vector3D>& positions,
+    const std::vector<Vector3D>& directions, const BoundaryCheck& bcheck,
+    std::vector<SurfaceIntersection>& intersections) const {
+  if (positions.size() != directions.size()) {
+    throw std::invalid_argument(
+        "SurfaceBatchIntersector: inconsistent number of lines");
+  }
+  const SurfaceData& data = m_data.at(isurface);
+  intersections.resize(positions.size());
+  for (size_t il = 0; il < positions.size(); ++il) {
+    intersections[il] = SurfaceIntersection(
+        intersect(data, positions[il], directions[il], bcheck), data.surface);
+  }
+}
+
+Acts::Intersection Acts::SurfaceBatchIntersector::intersect(
+    const SurfaceData& data, const Vector3D& position,
+    const Vector3D& direction, const BoundaryCheck& bcheck) const {
+  switch (data.kernel) {
+    case Kernel::ePlane:
+    case Kernel::eDisc: {
+      Intersection intersection = planarIntersection(
+          data.center, data.rotation.col(2), position, direction);
+      if (intersection.status == Intersection::Status::unreachable or
+          not bcheck) {
+        return intersection;
+      }
+      const Vector2D lcartesian = data.rotation.block<3, 2>(0, 0).transpose() *
+                                  (intersection.position - data.center);
+      bool inside = true;
+      if (data.kernel == Kernel::ePlane) {
+        inside = data.bounds->inside(lcartesian, bcheck);
+      } else if (data.discBounds == nullptr) {
+        inside = true;
+      } else if (bcheck.type() == BoundaryCheck::Type::eAbsolute and
+                 data.fullAzimuth) {
+        double tolerance = s_onSurfaceTolerance + bcheck.tolerance()[eLOC_R];
+        inside = data.discBounds->insideRadialBounds(
+            VectorHelpers::perp(lcartesian), tolerance);
+      } else {
+        inside = data.discBounds->inside(localPolar(lcartesian), bcheck);
+      }
+      if (not inside) {
+        intersection.status = Intersection::Status::missed;
+      }
+      return intersection;
+    }
+    case Kernel::eCylinder: {
+      // Quadratic equation in the plane transverse to the cylinder axis
+      const Vector3D caxis = data.rotation.col(2);
+      const Vector3D pcXcd = (position - data.center).cross(caxis);
+      const Vector3D ldXcd = direction.cross(caxis);
+      detail::RealQuadraticEquation qe(
+          ldXcd.dot(ldXcd), 2. * ldXcd.dot(pcXcd),
+          pcXcd.dot(pcXcd) - data.radius * data.radius);
+      if (qe.solutions == 0) {
+        return Intersection();
+      }
+      // Absolute smallest solution
+      double path =
+          qe.first * qe.first < qe.second * qe.second ? qe.first : qe.second;
+      Intersection intersection(position + path * direction, path,
+                                pathStatus(path));
+      if (bcheck) {
+        const Vector3D local3D =
+            data.rotation.transpose() * (intersection.position - data.center);
+        if (std::abs(VectorHelpers::perp(local3D) - data.radius) >
+                data.radialTolerance or
+            not data.bounds->inside(
+                Vector2D(data.radius * VectorHelpers::phi(local3D),
+                         local3D.z()),
+                bcheck)) {
+          intersection.status = Intersection::Status::missed;
+        }
+      }
+      return intersection;
+    }
+    case Kernel::eLine: {
+      // Closest approach of the line and the surface axis
+      const Vector3D eb = data.rotation.col(2);
+      const Vector3D mab = data.center - position;
+      double eaTeb = direction.dot(eb);
+      double denom = 1 - eaTeb * eaTeb;
+      if (denom * denom <= s_onSurfaceTolerance * s_onSurfaceTolerance) {
+        return Intersection(position, std::numeric_limits<double>::max(),
+                            Intersection::Status::unreachable);
+      }
+      double u = (mab.dot(direction) - mab.dot(eb) * eaTeb) / denom;
+      Intersection intersection(position + u * direction, u, pathStatus(u));
+      if (bcheck and data.halfZ >= 0.) {
+        const Vector3D vecLocal = intersection.position - data.center;
+        double cZ = vecLocal.dot(eb);
+        double hZ = data.halfZ + s_onSurfaceTolerance;
+        double hR = data.radius + s_onSurfaceTolerance;
+        if ((cZ * cZ > hZ * hZ) or ((vecLocal - cZ * eb).norm() > hR)) {
+          intersection.status = Intersection::Status::missed;
+        }
+      }
+      return intersection;
+    }
+    default:
+      return data.surface->intersectionEstimate(m_gctx, position, direction,
+                                                bcheck);
+  }
+}
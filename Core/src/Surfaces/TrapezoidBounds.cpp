@@ -20,12 +20,18 @@ Acts::SurfaceBounds::BoundsType Acts::TrapezoidBounds::type() const {
 
 bool Acts::TrapezoidBounds::inside(const Acts::Vector2D& lposition,
                                    const Acts::BoundaryCheck& bcheck) const {
-  return bcheck.isInside(lposition, vertices());
+  return bcheck.isInside(lposition, m_edges);
+}
+
+void Acts::TrapezoidBounds::insideBatch(
+    const std::vector<Vector2D>& lpositions, const Acts::BoundaryCheck& bcheck,
+    std::vector<bool>& inside) const {
+  bcheck.isInside(lpositions, m_edges, inside);
 }
 
 double Acts::TrapezoidBounds::distanceToBoundary(
     const Acts::Vector2D& lposition) const {
-  return BoundaryCheck(true).distance(lposition, vertices());
+  return BoundaryCheck(true).distance(lposition, m_edges.vertices());
 }
 
 std::vector<Acts::Vector2D> Acts::TrapezoidBounds::vertices(
@@ -0,0 +1,302 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Utilities/AsyncLogging.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <unordered_map>
+
+namespace {
+std::atomic<uint64_t> s_nextSinkId{0u};
+/// Set once the thread buffers of the current thread are destroyed. This is
+/// trivially destructible and thus usable until the very end of the thread.
+thread_local bool t_threadBuffersDestroyed = false;
+}  // namespace
+
+/// Pending messages of a single thread.
+///
+/// Only the owning thread pushes and only the writer thread drains. Each side
+/// publishes its position with release semantics after touching the slots.
+class Acts::Logging::AsyncSink::Buffer {
+ public:
+  struct Message {
+    OutputPrintPolicy* output = nullptr;
+    Level level = VERBOSE;
+    MessageOrigin origin{};
+    std::string text;
+  };
+
+  /// @param capacity is rounded up to the next power of two
+  explicit Buffer(size_t capacity) {
+    size_t size = 1u;
+    while (size < capacity) {
+      size <<= 1;
+    }
+    m_messages.resize(size);
+    m_mask = size - 1u;
+  }
+
+  /// Add a message; only to be called from the owning thread.
+  ///
+  /// @return false if the buffer is full and nothing was added
+  bool tryPush(OutputPrintPolicy& output, Level lvl,
+               const MessageOrigin& origin, std::string& text) {
+    const uint64_t head = m_head.load(std::memory_order_relaxed);
+    if (m_messages.size() <= head - m_tail.load(std::memory_order_acquire)) {
+      return false;
+    }
+    Message& message = m_messages[head & m_mask];
+    message.output = &output;
+    message.level = lvl;
+    message.origin = origin;
+    message.text = std::move(text);
+    m_head.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  /// Write all available messages; only to be called from the writer.
+  ///
+  /// @return true if any message was written
+  bool drain() {
+    const uint64_t head = m_head.load(std::memory_order_acquire);
+    uint64_t tail = m_tail.load(std::memory_order_relaxed);
+    if (tail == head) {
+      return false;
+    }
+    for (; tail < head; ++tail) {
+      Message& message = m_messages[tail & m_mask];
+      // decorators report the origin instead of the writer thread
+      detail::t_deferredOrigin = &message.origin;
+      std::ostringstream input(message.text);
+      message.output->flush(message.level, input);
+      detail::t_deferredOrigin = nullptr;
+      // release the slot content before handing it back
+      message.text.clear();
+      m_tail.store(tail + 1, std::memory_order_release);
+    }
+    return true;
+  }
+
+  /// Mark the buffer as unused; only to be called from the owning thread
+  /// after its last message was pushed.
+  void retire() { m_retired.store(true, std::memory_order_release); }
+
+  /// Whether the owning thread will not push any more messages.
+  ///
+  /// Messages pushed before the buffer was retired are visible to the next
+  /// drain() once this returned true.
+  bool isRetired() const { return m_retired.load(std::memory_order_acquire); }
+
+ private:
+  std::vector<Message> m_messages;
+  uint64_t m_mask;
+  alignas(64) std::atomic<uint64_t> m_head{0u};
+  alignas(64) std::atomic<uint64_t> m_tail{0u};
+  std::atomic<bool> m_retired{false};
+};
+
+/// Buffers of the current thread for all sinks it logged to.
+///
+/// The sinks own the buffers. The buffers are retired when the thread exits
+/// so that the writer can release them once their messages are written.
+class Acts::Logging::AsyncSink::ThreadBuffers {
+ public:
+  ~ThreadBuffers() {
+    t_threadBuffersDestroyed = true;
+    for (auto& entry : m_entries) {
+      // the sink might already be gone together with its buffers
+      if (auto buffer = entry.second.owned.lock()) {
+        buffer->retire();
+      }
+    }
+  }
+
+  /// The buffer of the given sink or nullptr if there is none yet.
+  Buffer* find(uint64_t sinkId) const {
+    auto it = m_entries.find(sinkId);
+    return (it != m_entries.end()) ? it->second.buffer : nullptr;
+  }
+
+  /// Register a new buffer of the given sink.
+  void insert(uint64_t sinkId, const std::shared_ptr<Buffer>& buffer) {
+    // drop the entries of destroyed sinks; sink identifiers are never reused
+    for (auto it = m_entries.begin(); it != m_entries.end();) {
+      it = it->second.owned.expired() ? m_entries.erase(it) : std::next(it);
+    }
+    m_entries[sinkId] = Entry{buffer.get(), buffer};
+  }
+
+ private:
+  struct Entry {
+    /// valid as long as the sink is alive, i.e. whenever it is used
+    Buffer* buffer = nullptr;
+    std::weak_ptr<Buffer> owned;
+  };
+  std::unordered_map<uint64_t, Entry> m_entries;
+};
+
+Acts::Logging::AsyncSink::AsyncSink(size_t capacity,
+                                    std::chrono::microseconds pollInterval)
+    : m_id(s_nextSinkId++),
+      m_capacity(std::max<size_t>(capacity, 1u)),
+      m_pollInterval(pollInterval),
+      m_writer(&AsyncSink::run, this) {}
+
+Acts::Logging::AsyncSink::~AsyncSink() {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stop = true;
+  }
+  m_wakeWriter.notify_one();
+  m_writer.join();
+}
+
+void Acts::Logging::AsyncSink::push(OutputPrintPolicy& output, const Level& lvl,
+                                    std::string message) {
+  Buffer* buffer = threadBuffer();
+  if (buffer == nullptr) {
+    // the thread is exiting, e.g. this runs in the destructor of a static or
+    // thread-local object. write after the queued messages of the thread.
+    flush();
+    std::lock_guard<std::mutex> lock(m_outputMutex);
+    std::ostringstream input(message);
+    output.flush(lvl, input);
+    return;
+  }
+  const MessageOrigin origin{std::time(nullptr), std::this_thread::get_id()};
+  while (not buffer->tryPush(output, lvl, origin, message)) {
+    // the writer only polls; wake it up to make room
+    m_wakeWriter.notify_one();
+    std::this_thread::yield();
+  }
+}
+
+void Acts::Logging::AsyncSink::flush() {
+  // messages issued by the output itself can not be waited for
+  if (std::this_thread::get_id() == m_writer.get_id()) {
+    return;
+  }
+  std::unique_lock<std::mutex> lock(m_mutex);
+  const uint64_t requested = ++m_flushRequested;
+  m_wakeWriter.notify_one();
+  m_flushed.wait(lock, [&] { return requested <= m_flushDone; });
+}
+
+Acts::Logging::AsyncSink::Buffer* Acts::Logging::AsyncSink::threadBuffer() {
+  // the thread-local buffers must not be touched after their destruction
+  if (t_threadBuffersDestroyed) {
+    return nullptr;
+  }
+  thread_local ThreadBuffers t_buffers;
+  Buffer* buffer = t_buffers.find(m_id);
+  if (buffer == nullptr) {
+    // only happens once per thread; the sink owns the buffer so that pending
+    // messages survive the thread exit
+    auto owned = std::make_shared<Buffer>(m_capacity);
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_buffers.push_back(owned);
+    }
+    t_buffers.insert(m_id, owned);
+    buffer = owned.get();
+  }
+  return buffer;
+}
+
+size_t Acts::Logging::AsyncSink::numThreadBuffers() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_buffers.size();
+}
+
+bool Acts::Logging::AsyncSink::drain() {
+  std::vector<std::shared_ptr<Buffer>> buffers;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    buffers = m_buffers;
+  }
+  bool written = false;
+  std::vector<Buffer*> released;
+  for (auto& buffer : buffers) {
+    // checked first, so that the drain catches the last messages
+    const bool retired = buffer->isRetired();
+    {
+      std::lock_guard<std::mutex> lock(m_outputMutex);
+      written = buffer->drain() or written;
+    }
+    if (retired) {
+      released.push_back(buffer.get());
+    }
+  }
+  if (not released.empty()) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_buffers.erase(
+        std::remove_if(m_buffers.begin(), m_buffers.end(),
+                       [&](const std::shared_ptr<Buffer>& buffer) {
+                         return std::find(released.begin(), released.end(),
+                                          buffer.get()) != released.end();
+                       }),
+        m_buffers.end());
+  }
+  return written;
+}
+
+void Acts::Logging::AsyncSink::run() {
+  std::unique_lock<std::mutex> lock(m_mutex);
+  while (true) {
+    // everything queued before these were read is written by the next drain
+    const uint64_t requested = m_flushRequested;
+    const bool stop = m_stop;
+    lock.unlock();
+    const bool written = drain();
+    lock.lock();
+    if (m_flushDone < requested) {
+      m_flushDone = requested;
+      m_flushed.notify_all();
+    }
+    if (stop) {
+      break;
+    }
+    if (not written and (requested == m_flushRequested) and not m_stop) {
+      m_wakeWriter.wait_for(lock, m_pollInterval);
+    }
+  }
+}
+
+Acts::Logging::AsyncPrintPolicy::AsyncPrintPolicy(
+    std::shared_ptr<AsyncSink> sink, std::unique_ptr<OutputPrintPolicy> output)
+    : m_sink(std::move(sink)), m_output(std::move(output)) {}
+
+Acts::Logging::AsyncPrintPolicy::~AsyncPrintPolicy() {
+  // queued messages reference the wrapped output
+  m_sink->flush();
+}
+
+void Acts::Logging::AsyncPrintPolicy::flush(const Level& lvl,
+                                            const std::ostringstream& input) {
+  m_sink->push(*m_output, lvl, input.str());
+  if (ERROR <= lvl) {
+    m_sink->flush();
+  }
+}
+
+std::unique_ptr<const Acts::Logger> Acts::getAsyncLogger(
+    const std::string& name, const Logging::Level& lvl,
+    std::shared_ptr<Logging::AsyncSink> sink, std::ostream* log_stream) {
+  using namespace Logging;
+  auto output = std::make_unique<LevelOutputDecorator>(
+      std::make_unique<NamedOutputDecorator>(
+          std::make_unique<TimedOutputDecorator>(
+              std::make_unique<DefaultPrintPolicy>(log_stream)),
+          name));
+  auto async =
+      std::make_unique<AsyncPrintPolicy>(std::move(sink), std::move(output));
+  auto print = std::make_unique<DefaultFilterPolicy>(lvl);
+  return std::make_unique<const Logger>(std::move(async), std::move(print));
+}
@@ -0,0 +1,99 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Utilities/Profiling.hpp"
+
+#include <algorithm>
+#include <mutex>
+
+std::atomic<bool> Acts::Profiling::detail::g_enabled{false};
+
+namespace {
+/// Owns the buffers of all threads so records survive the thread exit.
+struct Registry {
+  std::mutex mutex;
+  std::vector<std::shared_ptr<Acts::Profiling::RecordBuffer>> buffers;
+  size_t capacity = 1u << 16;
+};
+
+Registry& registry() {
+  static Registry s_registry;
+  return s_registry;
+}
+
+thread_local uint64_t t_context = UINT64_MAX;
+}  // namespace
+
+Acts::Profiling::RecordBuffer::RecordBuffer(size_t capacity, uint32_t thread)
+    : m_thread(thread) {
+  size_t size = 1u;
+  while (size < capacity) {
+    size <<= 1;
+  }
+  m_records.resize(size);
+  m_mask = size - 1u;
+}
+
+uint64_t Acts::Profiling::RecordBuffer::drain(std::vector<Record>& output) {
+  uint64_t head = m_head.load(std::memory_order_acquire);
+  uint64_t lost = 0u;
+  if (m_records.size() < (head - m_tail)) {
+    lost = head - m_tail - m_records.size();
+    m_tail += lost;
+  }
+  for (; m_tail < head; ++m_tail) {
+    output.push_back(m_records[m_tail & m_mask]);
+  }
+  return lost;
+}
+
+void Acts::Profiling::setEnabled(bool enabled, size_t capacity) {
+  {
+    std::lock_guard<std::mutex> lock(registry().mutex);
+    registry().capacity = std::max<size_t>(capacity, 1u);
+  }
+  detail::g_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+void Acts::Profiling::setThreadContext(uint64_t context) {
+  t_context = context;
+}
+
+Acts::Profiling::RecordBuffer& Acts::Profiling::threadBuffer() {
+  thread_local RecordBuffer* t_buffer = nullptr;
+  if (t_buffer == nullptr) {
+    // only happens once per thread
+    auto& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    reg.buffers.push_back(
+        std::make_shared<RecordBuffer>(reg.capacity, reg.buffers.size()));
+    t_buffer = reg.buffers.back().get();
+  }
+  return *t_buffer;
+}
+
+std::vector<Acts::Profiling::Record> Acts::Profiling::collect() {
+  std::vector<Record> records;
+  {
+    auto& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    for (auto& buffer : reg.buffers) {
+      buffer->drain(records);
+    }
+  }
+  std::sort(records.begin(), records.end(),
+            [](const Record& lhs, const Record& rhs) {
+              return lhs.start < rhs.start;
+            });
+  return records;
+}
+
+void Acts::Profiling::ScopedTimer::record(const char* name, int64_t start,
+                                          int64_t stop) {
+  threadBuffer().push(name, t_context, start, stop);
+}
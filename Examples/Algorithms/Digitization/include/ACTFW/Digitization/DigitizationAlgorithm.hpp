@@ -10,7 +10,7 @@
 
 #include <memory>
 #include <string>
-#include <unordered_map>
+#include <vector>
 
 #include "ACTFW/Framework/BareAlgorithm.hpp"
 #include "ACTFW/Framework/RandomNumbers.hpp"
@@ -40,6 +40,16 @@ class DigitizationAlgorithm final : public BareAlgorithm {
     std::shared_ptr<const Acts::PlanarModuleStepper> planarModuleStepper;
     /// Random numbers tool.
     std::shared_ptr<const RandomNumbers> randomNumbers;
+    /// Merge the cells from all hits on a module into clusters.
+    ///
+    /// By default, one cluster is created for each simulated hit. If enabled,
+    /// overlapping hits are combined into a single cluster that references
+    /// all contributing hits.
+    bool mergeHits = false;
+    /// Merge cells sharing only a common corner into the same cluster.
+    bool commonCorner = true;
+    /// Minimum accumulated path length in a cell for merged clusters.
+    double cellThreshold = 0.;
   };
 
   /// Construct the digitization algorithm.
@@ -62,8 +72,8 @@ class DigitizationAlgorithm final : public BareAlgorithm {
   };
 
   Config m_cfg;
-  /// Lookup container for all digitizable surfaces
-  std::unordered_map<Acts::GeometryID, Digitizable> m_digitizables;
+  /// Digitizable surfaces indexed by the tracking geometry surface ordinal
+  std::vector<Digitizable> m_digitizables;
 };
 
 }  // namespace FW
@@ -0,0 +1,30 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "ACTFW/Digitization/DigitizationAlgorithm.hpp"
+#include "ACTFW/Utilities/OptionsFwd.hpp"
+
+namespace FW {
+namespace Options {
+
+/// Add Digitization options.
+///
+/// @param desc The options description to add options to
+void addDigitizationOptions(Description& desc);
+
+/// Read Digitization options into the algorithm config.
+///
+/// @param vars The variables to read from
+/// @param cfg The config to be updated; unrelated members are not modified
+void readDigitizationConfig(const Variables& vars,
+                            DigitizationAlgorithm::Config& cfg);
+
+}  // namespace Options
+}  // namespace FW
@@ -9,7 +9,6 @@
 #pragma once
 
 #include <string>
-#include <unordered_map>
 
 #include "ACTFW/Framework/BareAlgorithm.hpp"
 #include "ACTFW/Framework/RandomNumbers.hpp"
@@ -48,8 +47,6 @@ class HitSmearing final : public BareAlgorithm {
 
  private:
   Config m_cfg;
-  /// Lookup container for hit surfaces that generate smeared hits
-  std::unordered_map<Acts::GeometryID, const Acts::Surface*> m_surfaces;
 };
 
 }  // namespace FW
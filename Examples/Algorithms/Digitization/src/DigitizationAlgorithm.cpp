@@ -8,8 +8,12 @@
 
 #include "ACTFW/Digitization/DigitizationAlgorithm.hpp"
 
+#include <algorithm>
 #include <iostream>
+#include <limits>
+#include <numeric>
 #include <stdexcept>
+#include <tuple>
 
 #include "ACTFW/EventData/GeometryContainers.hpp"
 #include "ACTFW/EventData/SimHit.hpp"
@@ -20,6 +24,7 @@
 #include "Acts/Geometry/DetectorElementBase.hpp"
 #include "Acts/Geometry/GeometryID.hpp"
 #include "Acts/Geometry/TrackingGeometry.hpp"
+#include "Acts/Plugins/Digitization/Clusterization.hpp"
 #include "Acts/Plugins/Digitization/DigitizationModule.hpp"
 #include "Acts/Plugins/Digitization/PlanarModuleCluster.hpp"
 #include "Acts/Plugins/Digitization/PlanarModuleStepper.hpp"
@@ -47,28 +52,31 @@ FW::DigitizationAlgorithm::DigitizationAlgorithm(
   if (!m_cfg.randomNumbers) {
     throw std::invalid_argument("Missing random numbers tool");
   }
-  // fill the digitizables map to allow lookup by geometry id only
-  m_cfg.trackingGeometry->visitSurfaces([this](const Acts::Surface* surface) {
+  // fill the digitizables indexed by surface ordinal; surfaces that can not
+  // be digitized are left empty
+  const auto& surfaces = m_cfg.trackingGeometry->sensitiveSurfaces();
+  m_digitizables.resize(surfaces.size());
+  for (size_t ordinal = 0; ordinal < surfaces.size(); ++ordinal) {
     Digitizable dg;
     // require a valid surface
-    dg.surface = surface;
+    dg.surface = surfaces[ordinal];
     if (not dg.surface) {
-      return;
+      continue;
     }
     // require an associated detector element
     dg.detectorElement = dynamic_cast<const Acts::IdentifiedDetectorElement*>(
         dg.surface->associatedDetectorElement());
     if (not dg.detectorElement) {
-      return;
+      continue;
     }
     // require an associated digitization module
     dg.digitizer = dg.detectorElement->digitizationModule().get();
     if (not dg.digitizer) {
-      return;
+      continue;
     }
     // record all valid surfaces
-    this->m_digitizables.insert_or_assign(surface->geoID(), dg);
-  });
+    m_digitizables[ordinal] = dg;
+  }
 }
 
 FW::ProcessCode FW::DigitizationAlgorithm::execute(
@@ -77,17 +85,32 @@ FW::ProcessCode FW::DigitizationAlgorithm::execute(
   const auto& hits =
       ctx.eventStore.get<SimHitContainer>(m_cfg.inputSimulatedHits);
   FW::GeometryIdMultimap<Acts::PlanarModuleCluster> clusters;
+  // digitization steps buffer that is reused for all hits
+  std::vector<Acts::DigitizationStep> dSteps;
+  // cells from all hits on a module and their hit index/time for merging
+  std::vector<Acts::DigitizationCell> moduleCells;
+  std::vector<std::pair<std::size_t, double>> cellHits;
+  std::vector<std::size_t> cellLabels;
+  std::vector<std::size_t> cellOrder;
+
+  // the covariance is currently set to 0.
+  Acts::ActsSymMatrixD<3> cov;
+  cov << 0.05, 0., 0., 0., 0.05, 0., 0., 0.,
+      900. * Acts::UnitConstants::ps * Acts::UnitConstants::ps;
 
   for (auto&& [moduleGeoId, moduleHits] : groupByModule(hits)) {
     // can only digitize hits on digitizable surfaces
-    const auto it = m_digitizables.find(moduleGeoId);
-    if (it == m_digitizables.end()) {
+    const size_t ordinal = m_cfg.trackingGeometry->surfaceOrdinal(moduleGeoId);
+    if ((ordinal == SIZE_MAX) or
+        (m_digitizables[ordinal].digitizer == nullptr)) {
       continue;
     }
 
-    const auto& dg = it->second;
+    const auto& dg = m_digitizables[ordinal];
     // local intersection / direction
     const auto invTransfrom = dg.surface->transform(ctx.geoContext).inverse();
+    moduleCells.clear();
+    cellHits.clear();
 
     // use iterators manually so we can retrieve the hit index in the container
     for (auto ih = moduleHits.begin(); ih != moduleHits.end(); ++ih) {
@@ -104,14 +127,24 @@ FW::ProcessCode FW::DigitizationAlgorithm::execute(
       auto lorentzShift = thickness * std::tan(lorentzAngle);
       lorentzShift *= -(dg.digitizer->readoutDirection());
       // now calculate the steps through the silicon
-      std::vector<Acts::DigitizationStep> dSteps =
-          m_cfg.planarModuleStepper->cellSteps(ctx.geoContext, *dg.digitizer,
-                                               localIntersect, localDirection);
+      dSteps.clear();
+      m_cfg.planarModuleStepper->cellSteps(ctx.geoContext, *dg.digitizer,
+                                           localIntersect, localDirection,
+                                           dSteps);
       // everything under threshold or edge effects
       if (!dSteps.size()) {
         ACTS_VERBOSE("No steps returned from stepper.");
         continue;
       }
+      // collect the cells from all hits to build clusters afterwards
+      if (m_cfg.mergeHits) {
+        for (const auto& dStep : dSteps) {
+          moduleCells.emplace_back(dStep.stepCell.channel0,
+                                   dStep.stepCell.channel1, dStep.stepLength);
+          cellHits.emplace_back(idx, hit.time());
+        }
+        continue;
+      }
 
       // lets create a cluster - centroid method
       double localX = 0.;
@@ -121,7 +154,7 @@ FW::ProcessCode FW::DigitizationAlgorithm::execute(
       std::vector<Acts::DigitizationCell> usedCells;
       usedCells.reserve(dSteps.size());
       // loop over the steps
-      for (auto dStep : dSteps) {
+      for (const auto& dStep : dSteps) {
         // @todo implement smearing
         localX += dStep.stepLength * dStep.stepCellCenter.x();
         localY += dStep.stepLength * dStep.stepCellCenter.y();
@@ -144,21 +177,89 @@ FW::ProcessCode FW::DigitizationAlgorithm::execute(
       // size_t bin1 = binUtility.bin(localPosition, 1);
       // size_t binSerialized = binUtility.serialize({{bin0, bin1, 0}});
 
-      // the covariance is currently set to 0.
-      Acts::ActsSymMatrixD<3> cov;
-      cov << 0.05, 0., 0., 0., 0.05, 0., 0., 0.,
-          900. * Acts::UnitConstants::ps * Acts::UnitConstants::ps;
-
       // create the planar cluster
       Acts::PlanarModuleCluster pCluster(
           dg.surface->getSharedPtr(), Identifier(identifier_type(idx), {idx}),
-          std::move(cov), localX, localY, hit.time(), std::move(usedCells));
+          cov, localX, localY, hit.time(), std::move(usedCells));
 
       // insert into the cluster container. since the input data is already
       // sorted by geoId, we should always be able to add at the end.
       clusters.emplace_hint(clusters.end(), hit.geometryId(),
                             std::move(pCluster));
     }
+
+    if (not m_cfg.mergeHits or moduleCells.empty()) {
+      continue;
+    }
+    // cells from different hits at the same position are merged; the cell
+    // content is the path length and must be accumulated as analogue readout
+    const auto nClusters = Acts::labelClusters(
+        moduleCells, cellLabels, m_cfg.commonCorner, m_cfg.cellThreshold, true);
+    ACTS_VERBOSE("Merged " << moduleCells.size() << " cells from "
+                           << moduleHits.size() << " hits into " << nClusters
+                           << " clusters");
+    // order the cells by cluster and by position within each cluster. cells
+    // below threshold have the largest label and are sorted last.
+    cellOrder.resize(moduleCells.size());
+    std::iota(cellOrder.begin(), cellOrder.end(), 0u);
+    std::sort(cellOrder.begin(), cellOrder.end(), [&](auto lhs, auto rhs) {
+      return std::make_tuple(cellLabels[lhs], moduleCells[lhs].channel1,
+                             moduleCells[lhs].channel0) <
+             std::make_tuple(cellLabels[rhs], moduleCells[rhs].channel1,
+                             moduleCells[rhs].channel0);
+    });
+
+    const Acts::Segmentation& segmentation = dg.digitizer->segmentation();
+    const auto lorentzShift = -dg.digitizer->readoutDirection() *
+                              dg.detectorElement->thickness() *
+                              std::tan(dg.digitizer->lorentzAngle());
+    for (auto begin = cellOrder.begin(); begin != cellOrder.end();) {
+      const auto label = cellLabels[*begin];
+      if (label == Acts::kNoCluster) {
+        break;
+      }
+      const auto end = std::find_if(begin, cellOrder.end(), [&](auto i) {
+        return cellLabels[i] != label;
+      });
+
+      // path length weighted centroid as for single hits
+      double localX = 0.;
+      double localY = 0.;
+      double totalPath = 0.;
+      double time = std::numeric_limits<double>::infinity();
+      std::vector<Acts::DigitizationCell> usedCells;
+      std::vector<std::size_t> hitIndices;
+      for (auto i = begin; i != end; ++i) {
+        const auto& cell = moduleCells[*i];
+        const auto cellCenter = segmentation.cellPosition(cell);
+        localX += cell.data * cellCenter.x();
+        localY += cell.data * cellCenter.y();
+        totalPath += cell.data;
+        if (not usedCells.empty() and
+            (usedCells.back().channel0 == cell.channel0) and
+            (usedCells.back().channel1 == cell.channel1)) {
+          usedCells.back().addCell(cell, true);
+        } else {
+          usedCells.push_back(cell);
+        }
+        hitIndices.push_back(cellHits[*i].first);
+        // the earliest hit defines the cluster time
+        time = std::min(time, cellHits[*i].second);
+      }
+      localX = localX / totalPath + lorentzShift;
+      localY /= totalPath;
+      std::sort(hitIndices.begin(), hitIndices.end());
+      hitIndices.erase(std::unique(hitIndices.begin(), hitIndices.end()),
+                       hitIndices.end());
+
+      const auto idx = hitIndices.front();
+      Acts::PlanarModuleCluster pCluster(
+          dg.surface->getSharedPtr(),
+          Identifier(identifier_type(idx), std::move(hitIndices)), cov, localX,
+          localY, time, std::move(usedCells));
+      clusters.emplace_hint(clusters.end(), moduleGeoId, std::move(pCluster));
+      begin = end;
+    }
   }
 
   ACTS_DEBUG("digitized " << hits.size() << " hits into " << clusters.size()
@@ -0,0 +1,37 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ACTFW/Digitization/DigitizationOptions.hpp"
+
+#include <boost/program_options.hpp>
+
+#include "Acts/Utilities/Units.hpp"
+
+void FW::Options::addDigitizationOptions(FW::Options::Description& desc) {
+  using boost::program_options::bool_switch;
+  using boost::program_options::value;
+
+  auto opt = desc.add_options();
+  opt("digi-merge-hits", bool_switch(),
+      "Merge the cells from all hits on a module into clusters instead of "
+      "creating one cluster per hit");
+  opt("digi-common-corner", value<bool>()->default_value(true),
+      "Merge cells that only share a common corner into the same cluster");
+  opt("digi-cell-threshold-um", value<double>()->default_value(0.0),
+      "Minimum path length in a cell for merged clusters in um");
+}
+
+void FW::Options::readDigitizationConfig(
+    const FW::Options::Variables& vars,
+    FW::DigitizationAlgorithm::Config& cfg) {
+  using namespace Acts::UnitLiterals;
+
+  cfg.mergeHits = vars["digi-merge-hits"].as<bool>();
+  cfg.commonCorner = vars["digi-common-corner"].as<bool>();
+  cfg.cellThreshold = vars["digi-cell-threshold-um"].as<double>() * 1_um;
+}
@@ -32,14 +32,6 @@ FW::HitSmearing::HitSmearing(const Config& cfg, Acts::Logging::Level lvl)
   if (!m_cfg.randomNumbers) {
     throw std::invalid_argument("Missing random numbers tool");
   }
-  // fill the surface map to allow lookup by geometry id only
-  m_cfg.trackingGeometry->visitSurfaces([this](const Acts::Surface* surface) {
-    // for now we just require a valid surface
-    if (not surface) {
-      return;
-    }
-    this->m_surfaces.insert_or_assign(surface->geoID(), surface);
-  });
 }
 
 FW::ProcessCode FW::HitSmearing::execute(const AlgorithmContext& ctx) const {
@@ -61,13 +53,13 @@ FW::ProcessCode FW::HitSmearing::execute(const AlgorithmContext& ctx) const {
 
   for (auto&& [moduleGeoId, moduleHits] : groupByModule(hits)) {
     // check if we should create hits for this surface
-    const auto is = m_surfaces.find(moduleGeoId);
-    if (is == m_surfaces.end()) {
+    const Acts::Surface* surface =
+        m_cfg.trackingGeometry->findSurface(moduleGeoId);
+    if (surface == nullptr) {
       continue;
     }
 
     // smear all truth hits for this module
-    const Acts::Surface* surface = is->second;
     for (const auto& hit : moduleHits) {
       // transform global position into local coordinates
       Acts::Vector2D pos(0, 0);
@@ -8,16 +8,32 @@
 
 #pragma once
 
+#include <algorithm>
+#include <functional>
+#include <iterator>
 #include <memory>
 #include <string>
+#include <system_error>
+#include <vector>
 
 #include "ACTFW/EventData/SimHit.hpp"
 #include "ACTFW/EventData/SimParticle.hpp"
 #include "ACTFW/Framework/BareAlgorithm.hpp"
 #include "ACTFW/Framework/RandomNumbers.hpp"
 #include "ACTFW/Framework/WhiteBoard.hpp"
+#include "ActsFatras/Utilities/PhiloxRandomEngine.hpp"
 
 namespace FW {
+namespace detail {
+
+/// Run the body for every block index in [0, nBlocks) on the thread pool.
+///
+/// @param nBlocks is the number of blocks
+/// @param body is called once per block index, possibly concurrently
+void parallelForEachBlock(size_t nBlocks,
+                          const std::function<void(size_t)>& body);
+
+}  // namespace detail
 
 /// Fast track simulation using the Acts propagation and navigation.
 ///
@@ -38,6 +54,13 @@ class FatrasAlgorithm final : public BareAlgorithm {
     simulator_t simulator;
     /// Random number service.
     std::shared_ptr<const RandomNumbers> randomNumbers;
+    /// Simulate primary particles and their secondaries in parallel.
+    ///
+    /// Each particle draws from a counter-based random number stream keyed by
+    /// its particle id and the event seed. The results are identical for any
+    /// number of threads, but differ from the sequential simulation which uses
+    /// a single random number generator for the whole event.
+    bool parallel = false;
 
     /// Construct the algorithm config with the simulator kernel.
     Config(simulator_t&& simulator_) : simulator(std::move(simulator_)) {}
@@ -64,21 +87,25 @@ class FatrasAlgorithm final : public BareAlgorithm {
     // read input containers
     const auto& inputParticles =
         ctx.eventStore.get<SimParticleContainer>(m_cfg.inputParticles);
-    // prepare output containers
-    SimParticleContainer::sequence_type particlesInitialUnordered;
-    SimParticleContainer::sequence_type particlesFinalUnordered;
-    SimHitContainer::sequence_type hitsUnordered;
+    // prepare output buffers. the simulator appends generated particles and
+    // hits directly to them since they use the same type as its internal
+    // buffers.
+    ParticleBuffer particlesInitialUnordered;
+    ParticleBuffer particlesFinalUnordered;
+    HitBuffer hitsUnordered;
     // reserve appropriate resources
-    constexpr auto meanHitsPerParticle = 16u;
     particlesInitialUnordered.reserve(inputParticles.size());
     particlesFinalUnordered.reserve(inputParticles.size());
-    hitsUnordered.reserve(meanHitsPerParticle * inputParticles.size());
+    hitsUnordered.reserve(kMeanHitsPerParticle * inputParticles.size());
 
     // run the simulation w/ a local random generator
-    auto rng = m_cfg.randomNumbers->spawnGenerator(ctx);
-    auto ret = m_cfg.simulator.simulate(
-        ctx.geoContext, ctx.magFieldContext, rng, inputParticles,
-        particlesInitialUnordered, particlesFinalUnordered, hitsUnordered);
+    auto ret = m_cfg.parallel
+                   ? simulateParallel(ctx, inputParticles,
+                                      particlesInitialUnordered,
+                                      particlesFinalUnordered, hitsUnordered)
+                   : simulateSequential(ctx, inputParticles,
+                                        particlesInitialUnordered,
+                                        particlesFinalUnordered, hitsUnordered);
     // fatal error leads to panic
     if (not ret.ok()) {
       ACTS_FATAL("event " << ctx.eventNumber << " simulation failed with error "
@@ -107,10 +134,15 @@ class FatrasAlgorithm final : public BareAlgorithm {
     // restore ordering for output containers
     SimParticleContainer particlesInitial;
     SimParticleContainer particlesFinal;
-    SimHitContainer hits;
-    particlesInitial.adopt_sequence(std::move(particlesInitialUnordered));
-    particlesFinal.adopt_sequence(std::move(particlesFinalUnordered));
-    hits.adopt_sequence(std::move(hitsUnordered));
+    particlesInitial.adopt_sequence(SimParticleContainer::sequence_type(
+        std::make_move_iterator(particlesInitialUnordered.begin()),
+        std::make_move_iterator(particlesInitialUnordered.end())));
+    particlesFinal.adopt_sequence(SimParticleContainer::sequence_type(
+        std::make_move_iterator(particlesFinalUnordered.begin()),
+        std::make_move_iterator(particlesFinalUnordered.end())));
+    // single radix sort pass over the geometry identifiers
+    SimHitContainer hits =
+        makeGeometryIdMultiset<SimHit>(std::move(hitsUnordered));
 
     // store ordered output containers
     ctx.eventStore.add(m_cfg.outputParticlesInitial,
@@ -122,6 +154,105 @@ class FatrasAlgorithm final : public BareAlgorithm {
   }
 
  private:
+  /// Expected number of hits per particle used to reserve the hit buffers.
+  static constexpr size_t kMeanHitsPerParticle = 16u;
+
+  using ParticleBuffer = std::vector<SimParticle>;
+  using HitBuffer = std::vector<SimHit>;
+  using SimulationResult = decltype(std::declval<simulator_t>().simulate(
+      std::declval<const Acts::GeometryContext&>(),
+      std::declval<const Acts::MagneticFieldContext&>(),
+      std::declval<RandomEngine&>(),
+      std::declval<const SimParticleContainer&>(),
+      std::declval<ParticleBuffer&>(), std::declval<ParticleBuffer&>(),
+      std::declval<HitBuffer&>()));
+
+  /// Simulate all particles w/ a single event-local random generator.
+  SimulationResult simulateSequential(
+      const AlgorithmContext& ctx, const SimParticleContainer& inputParticles,
+      ParticleBuffer& particlesInitial, ParticleBuffer& particlesFinal,
+      HitBuffer& hits) const {
+    auto rng = m_cfg.randomNumbers->spawnGenerator(ctx);
+    return m_cfg.simulator.simulate(ctx.geoContext, ctx.magFieldContext, rng,
+                                    inputParticles, particlesInitial,
+                                    particlesFinal, hits);
+  }
+
+  /// Simulate blocks of primary particles in parallel w/ per-particle
+  /// counter-based random streams.
+  SimulationResult simulateParallel(
+      const AlgorithmContext& ctx, const SimParticleContainer& inputParticles,
+      ParticleBuffer& particlesInitial, ParticleBuffer& particlesFinal,
+      HitBuffer& hits) const {
+    using FailedParticle = typename simulator_t::FailedParticle;
+
+    // outputs for a fixed block of primary particles. the blocks do not depend
+    // on the scheduling and are merged in order after the simulation.
+    struct BlockOutput {
+      ParticleBuffer particlesInitial;
+      ParticleBuffer particlesFinal;
+      HitBuffer hits;
+      std::vector<FailedParticle> failedParticles;
+      std::error_code error;
+    };
+    constexpr size_t kPrimariesPerBlock = 16u;
+
+    const size_t nBlocks =
+        (inputParticles.size() + kPrimariesPerBlock - 1) / kPrimariesPerBlock;
+    std::vector<BlockOutput> blocks(nBlocks);
+
+    // every particle gets its own random stream keyed by its particle id
+    const uint64_t seed = m_cfg.randomNumbers->generateSeed(ctx);
+    auto makeGenerator = [=](const ActsFatras::Particle& particle) {
+      return ActsFatras::PhiloxRandomEngine(seed,
+                                            particle.particleId().value());
+    };
+
+    detail::parallelForEachBlock(nBlocks, [&](size_t iblock) {
+      BlockOutput& block = blocks[iblock];
+      const size_t ibegin = iblock * kPrimariesPerBlock;
+      const size_t iend =
+          std::min(ibegin + kPrimariesPerBlock, inputParticles.size());
+      block.particlesInitial.reserve(iend - ibegin);
+      block.particlesFinal.reserve(iend - ibegin);
+      block.hits.reserve(kMeanHitsPerParticle * (iend - ibegin));
+      for (size_t iprimary = ibegin; iprimary < iend; ++iprimary) {
+        const auto& primary = *std::next(inputParticles.begin(), iprimary);
+        auto ret = m_cfg.simulator.simulatePrimary(
+            ctx.geoContext, ctx.magFieldContext, makeGenerator, primary,
+            block.particlesInitial, block.particlesFinal, block.hits,
+            block.failedParticles);
+        if (not ret.ok()) {
+          block.error = ret.error();
+          break;
+        }
+      }
+    });
+
+    // merge the block outputs in order
+    std::vector<FailedParticle> failedParticles;
+    for (BlockOutput& block : blocks) {
+      if (block.error) {
+        return block.error;
+      }
+      particlesInitial.insert(
+          particlesInitial.end(),
+          std::make_move_iterator(block.particlesInitial.begin()),
+          std::make_move_iterator(block.particlesInitial.end()));
+      particlesFinal.insert(
+          particlesFinal.end(),
+          std::make_move_iterator(block.particlesFinal.begin()),
+          std::make_move_iterator(block.particlesFinal.end()));
+      hits.insert(hits.end(), std::make_move_iterator(block.hits.begin()),
+                  std::make_move_iterator(block.hits.end()));
+      failedParticles.insert(
+          failedParticles.end(),
+          std::make_move_iterator(block.failedParticles.begin()),
+          std::make_move_iterator(block.failedParticles.end()));
+    }
+    return failedParticles;
+  }
+
   Config m_cfg;
 };
 
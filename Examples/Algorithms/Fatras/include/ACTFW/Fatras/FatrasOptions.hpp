@@ -64,6 +64,8 @@ typename FatrasAlgorithm<simulator_t>::Config readFatrasConfig(
         .template disable<ActsFatras::detail::StandardBetheHeitler>();
   }
 
+  cfg.parallel = variables["fatras-parallel"].as<bool>();
+
   // select hit surfaces for charged particles
   const std::string hits = variables["fatras-hits"].as<std::string>();
   if (hits == "sensitive") {
@@ -0,0 +1,22 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ACTFW/Fatras/FatrasAlgorithm.hpp"
+
+#include <tbb/tbb.h>
+
+void FW::detail::parallelForEachBlock(
+    size_t nBlocks, const std::function<void(size_t)>& body) {
+  tbb::parallel_for(tbb::blocked_range<size_t>(0u, nBlocks),
+                    [&](const tbb::blocked_range<size_t>& range) {
+                      for (size_t iblock = range.begin();
+                           iblock != range.end(); ++iblock) {
+                        body(iblock);
+                      }
+                    });
+}
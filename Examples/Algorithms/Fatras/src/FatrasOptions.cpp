@@ -28,4 +28,7 @@ void FW::Options::addFatrasOptions(FW::Options::Description& desc) {
           ->value_name("none|sensitive|material|all")
           ->default_value("sensitive"),
       "Which surfaces should record charged particle hits");
+  opt("fatras-parallel", bool_switch(),
+      "Simulate the primary particles within an event in parallel using "
+      "per-particle random streams");
 }
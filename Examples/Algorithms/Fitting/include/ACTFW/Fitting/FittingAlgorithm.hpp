@@ -12,6 +12,7 @@
 #include <memory>
 #include <vector>
 
+#include "ACTFW/EventData/ProtoTrack.hpp"
 #include "ACTFW/EventData/SimSourceLink.hpp"
 #include "ACTFW/EventData/Track.hpp"
 #include "ACTFW/Framework/BareAlgorithm.hpp"
@@ -49,6 +50,12 @@ class FittingAlgorithm final : public BareAlgorithm {
     std::string outputTrajectories;
     /// Type erased fitter function.
     FitterFunction fit;
+    /// Fit the tracks within one event in parallel.
+    ///
+    /// The fitter function must be safe to call concurrently, which is the
+    /// case for the one created by `makeFitterFunction`. The output order and
+    /// the fit results are identical to the serial mode.
+    bool parallelFits = false;
   };
 
   /// Constructor of the fitting algorithm
@@ -64,6 +71,25 @@ class FittingAlgorithm final : public BareAlgorithm {
   FW::ProcessCode execute(const FW::AlgorithmContext& ctx) const final override;
 
  private:
+  /// Fit a single proto track and store the result in the trajectory.
+  ///
+  /// @param ctx is the algorithm context that holds event-wise information
+  /// @param sourceLinks is the event source links container
+  /// @param protoTrack is the list of hit indices of the track
+  /// @param initialParams are the initial parameters of the track
+  /// @param target is the target surface of the fit
+  /// @param itrack is the index of the track, only used for logging
+  /// @param trackSourceLinks is the scratch buffer for the track source links
+  /// @param trajectory is the output trajectory
+  /// @return false if the proto track refers to an invalid hit index
+  bool fitTrack(const FW::AlgorithmContext& ctx,
+                const SimSourceLinkContainer& sourceLinks,
+                const ProtoTrack& protoTrack,
+                const TrackParameters& initialParams,
+                const Acts::Surface& target, std::size_t itrack,
+                std::vector<SimSourceLink>& trackSourceLinks,
+                SimMultiTrajectory& trajectory) const;
+
   Config m_cfg;
 };
 
@@ -8,8 +8,12 @@
 
 #include "ACTFW/Fitting/FittingAlgorithm.hpp"
 
+#include <atomic>
+#include <chrono>
 #include <stdexcept>
 
+#include <tbb/tbb.h>
+
 #include "ACTFW/EventData/ProtoTrack.hpp"
 #include "ACTFW/EventData/Track.hpp"
 #include "ACTFW/Framework/WhiteBoard.hpp"
@@ -48,80 +52,131 @@ FW::ProcessCode FW::FittingAlgorithm::execute(
     return ProcessCode::ABORT;
   }
 
-  // Prepare the output data with MultiTrajectory
-  TrajectoryContainer trajectories;
-  trajectories.reserve(protoTracks.size());
+  // Prepare the output data with MultiTrajectory. Each track writes only to
+  // its own pre-allocated entry, which keeps the output order independent of
+  // the execution order.
+  TrajectoryContainer trajectories(protoTracks.size());
 
   // Construct a perigee surface as the target surface
   auto pSurface = Acts::Surface::makeShared<Acts::PerigeeSurface>(
       Acts::Vector3D{0., 0., 0.});
 
-  // Perform the fit for each input track
-  std::vector<SimSourceLink> trackSourceLinks;
-  for (std::size_t itrack = 0; itrack < protoTracks.size(); ++itrack) {
-    // The list of hits and the initial start parameters
-    const auto& protoTrack = protoTracks[itrack];
-    const auto& initialParams = initialParameters[itrack];
-
-    // We can have empty tracks which must give empty fit results
-    if (protoTrack.empty()) {
-      trajectories.push_back(SimMultiTrajectory());
-      ACTS_WARNING("Empty track " << itrack << " found.");
-      continue;
+  auto start = std::chrono::high_resolution_clock::now();
+  std::size_t nThreads = 1;
+  bool valid = true;
+  if (m_cfg.parallelFits) {
+    // Per-worker scratch buffer for the track source links
+    tbb::enumerable_thread_specific<std::vector<SimSourceLink>> scratch;
+    std::atomic<bool> invalidHits(false);
+    tbb::parallel_for(
+        tbb::blocked_range<std::size_t>(0, protoTracks.size()),
+        [&](const tbb::blocked_range<std::size_t>& r) {
+          auto& trackSourceLinks = scratch.local();
+          for (std::size_t itrack = r.begin(); itrack != r.end(); ++itrack) {
+            if (invalidHits.load(std::memory_order_relaxed)) {
+              return;
+            }
+            if (not fitTrack(ctx, sourceLinks, protoTracks[itrack],
+                             initialParameters[itrack], *pSurface, itrack,
+                             trackSourceLinks, trajectories[itrack])) {
+              invalidHits = true;
+            }
+          }
+        });
+    // One scratch buffer exists for each thread that fitted tracks
+    nThreads = scratch.size();
+    valid = not invalidHits;
+  } else {
+    // Perform the fit for each input track
+    std::vector<SimSourceLink> trackSourceLinks;
+    for (std::size_t itrack = 0; itrack < protoTracks.size(); ++itrack) {
+      if (not fitTrack(ctx, sourceLinks, protoTracks[itrack],
+                       initialParameters[itrack], *pSurface, itrack,
+                       trackSourceLinks, trajectories[itrack])) {
+        valid = false;
+        break;
+      }
     }
+  }
+  if (not valid) {
+    return ProcessCode::ABORT;
+  }
+  std::chrono::duration<double> duration =
+      std::chrono::high_resolution_clock::now() - start;
 
-    // Clear & reserve the right size
-    trackSourceLinks.clear();
-    trackSourceLinks.reserve(protoTrack.size());
-
-    // Fill the source links via their indices from the container
-    for (auto hitIndex : protoTrack) {
-      auto sourceLink = sourceLinks.nth(hitIndex);
-      if (sourceLink == sourceLinks.end()) {
-        ACTS_FATAL("Proto track " << itrack << " contains invalid hit index"
-                                  << hitIndex);
-        return ProcessCode::ABORT;
-      }
-      trackSourceLinks.push_back(*sourceLink);
+  ACTS_INFO("Fitted " << protoTracks.size() << " tracks in "
+                      << duration.count() << " s using " << nThreads
+                      << " thread(s), i.e. "
+                      << protoTracks.size() / duration.count()
+                      << " fits per second");
+
+  ctx.eventStore.add(m_cfg.outputTrajectories, std::move(trajectories));
+  return FW::ProcessCode::SUCCESS;
+}
+
+bool FW::FittingAlgorithm::fitTrack(
+    const FW::AlgorithmContext& ctx, const SimSourceLinkContainer& sourceLinks,
+    const ProtoTrack& protoTrack, const TrackParameters& initialParams,
+    const Acts::Surface& target, std::size_t itrack,
+    std::vector<SimSourceLink>& trackSourceLinks,
+    SimMultiTrajectory& trajectory) const {
+  // We can have empty tracks which must give empty fit results
+  if (protoTrack.empty()) {
+    trajectory = SimMultiTrajectory();
+    ACTS_WARNING("Empty track " << itrack << " found.");
+    return true;
+  }
+
+  // Clear & reserve the right size
+  trackSourceLinks.clear();
+  trackSourceLinks.reserve(protoTrack.size());
+
+  // Fill the source links via their indices from the container
+  for (auto hitIndex : protoTrack) {
+    auto sourceLink = sourceLinks.nth(hitIndex);
+    if (sourceLink == sourceLinks.end()) {
+      ACTS_FATAL("Proto track " << itrack << " contains invalid hit index"
+                                << hitIndex);
+      return false;
     }
+    trackSourceLinks.push_back(*sourceLink);
+  }
 
-    // Set the KalmanFitter options
-    Acts::KalmanFitterOptions<Acts::VoidOutlierFinder> kfOptions(
-        ctx.geoContext, ctx.magFieldContext, ctx.calibContext,
-        Acts::VoidOutlierFinder(), &(*pSurface));
-
-    ACTS_DEBUG("Invoke fitter");
-    auto result = m_cfg.fit(trackSourceLinks, initialParams, kfOptions);
-    if (result.ok()) {
-      // Get the fit output object
-      const auto& fitOutput = result.value();
-      // The track entry indices container. One element here.
-      std::vector<size_t> trackTips;
-      trackTips.reserve(1);
-      trackTips.emplace_back(fitOutput.trackTip);
-      // The fitted parameters container. One element (at most) here.
-      IndexedParams indexedParams;
-      if (fitOutput.fittedParameters) {
-        const auto& params = fitOutput.fittedParameters.value();
-        ACTS_VERBOSE("Fitted paramemeters for track " << itrack);
-        ACTS_VERBOSE("  position: " << params.position().transpose());
-        ACTS_VERBOSE("  momentum: " << params.momentum().transpose());
-        // Push the fitted parameters to the container
-        indexedParams.emplace(fitOutput.trackTip, std::move(params));
-      } else {
-        ACTS_DEBUG("No fitted paramemeters for track " << itrack);
-      }
-      // Create a SimMultiTrajectory
-      trajectories.emplace_back(std::move(fitOutput.fittedStates),
-                                std::move(trackTips), std::move(indexedParams));
+  // Set the KalmanFitter options
+  Acts::KalmanFitterOptions<Acts::VoidOutlierFinder> kfOptions(
+      ctx.geoContext, ctx.magFieldContext, ctx.calibContext,
+      Acts::VoidOutlierFinder(), &target);
+
+  ACTS_DEBUG("Invoke fitter");
+  auto result = m_cfg.fit(trackSourceLinks, initialParams, kfOptions);
+  if (result.ok()) {
+    // Get the fit output object
+    const auto& fitOutput = result.value();
+    // The track entry indices container. One element here.
+    std::vector<size_t> trackTips;
+    trackTips.reserve(1);
+    trackTips.emplace_back(fitOutput.trackTip);
+    // The fitted parameters container. One element (at most) here.
+    IndexedParams indexedParams;
+    if (fitOutput.fittedParameters) {
+      const auto& params = fitOutput.fittedParameters.value();
+      ACTS_VERBOSE("Fitted paramemeters for track " << itrack);
+      ACTS_VERBOSE("  position: " << params.position().transpose());
+      ACTS_VERBOSE("  momentum: " << params.momentum().transpose());
+      // Push the fitted parameters to the container
+      indexedParams.emplace(fitOutput.trackTip, std::move(params));
     } else {
-      ACTS_WARNING("Fit failed for track " << itrack << " with error"
-                                           << result.error());
-      // Fit failed, but still create an empty SimMultiTrajectory
-      trajectories.push_back(SimMultiTrajectory());
+      ACTS_DEBUG("No fitted paramemeters for track " << itrack);
     }
+    // Create a SimMultiTrajectory
+    trajectory = SimMultiTrajectory(std::move(fitOutput.fittedStates),
+                                    std::move(trackTips),
+                                    std::move(indexedParams));
+  } else {
+    ACTS_WARNING("Fit failed for track " << itrack << " with error"
+                                         << result.error());
+    // Fit failed, but still create an empty SimMultiTrajectory
+    trajectory = SimMultiTrajectory();
   }
-
-  ctx.eventStore.add(m_cfg.outputTrajectories, std::move(trajectories));
-  return FW::ProcessCode::SUCCESS;
+  return true;
 }
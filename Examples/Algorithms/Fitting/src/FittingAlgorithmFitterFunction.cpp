@@ -14,6 +14,7 @@
 
 #include "ACTFW/Fitting/FittingAlgorithm.hpp"
 #include "ACTFW/Plugins/BField/ScalableBField.hpp"
+#include "ACTFW/Utilities/Logging.hpp"
 #include "Acts/Fitter/GainMatrixSmoother.hpp"
 #include "Acts/Fitter/GainMatrixUpdater.hpp"
 #include "Acts/Geometry/GeometryID.hpp"
@@ -71,7 +72,7 @@ FW::FittingAlgorithm::FitterFunction FW::FittingAlgorithm::makeFitterFunction(
         navigator.resolveSensitive = true;
         Propagator propagator(std::move(stepper), std::move(navigator));
         Fitter fitter(std::move(propagator),
-                      Acts::getDefaultLogger("KalmanFitter", lvl));
+                      FW::getDefaultLogger("KalmanFitter", lvl));
 
         // build the fitter functions. owns the fitter object.
         return FitterFunctionImpl<Fitter>(std::move(fitter));
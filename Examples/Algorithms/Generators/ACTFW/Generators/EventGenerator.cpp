@@ -13,9 +13,10 @@
 #include <stdexcept>
 
 #include "ACTFW/Framework/WhiteBoard.hpp"
+#include "ACTFW/Utilities/Logging.hpp"
 
 FW::EventGenerator::EventGenerator(const Config& cfg, Acts::Logging::Level lvl)
-    : m_cfg(cfg), m_logger(Acts::getDefaultLogger("EventGenerator", lvl)) {
+    : m_cfg(cfg), m_logger(FW::getDefaultLogger("EventGenerator", lvl)) {
   if (m_cfg.output.empty()) {
     throw std::invalid_argument("Missing output collection");
   }
@@ -12,6 +12,7 @@
 #include <stdexcept>
 
 #include "ACTFW/Plugins/BField/ScalableBField.hpp"
+#include "ACTFW/Utilities/Logging.hpp"
 #include "Acts/Fitter/GainMatrixSmoother.hpp"
 #include "Acts/Fitter/GainMatrixUpdater.hpp"
 #include "Acts/MagneticField/ConstantBField.hpp"
@@ -72,7 +73,7 @@ FW::TrackFindingAlgorithm::makeTrackFinderFunction(
         Propagator propagator(std::move(stepper), std::move(navigator));
         CKF trackFinder(
             std::move(propagator),
-            Acts::getDefaultLogger("CombinatorialKalmanFilter", lvl));
+            FW::getDefaultLogger("CombinatorialKalmanFilter", lvl));
 
         // build the track finder functions. owns the track finder object.
         return TrackFinderFunctionImpl<CKF>(std::move(trackFinder));
@@ -9,10 +9,12 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
 #include <boost/container/flat_map.hpp>
 #include <boost/container/flat_set.hpp>
 #include <cstddef>
 #include <utility>
+#include <vector>
 
 #include "ACTFW/Utilities/GroupBy.hpp"
 #include "ACTFW/Utilities/Range.hpp"
@@ -85,6 +87,61 @@ using GeometryIdMultiset =
 template <typename T>
 using GeometryIdMultimap = GeometryIdMultiset<std::pair<Acts::GeometryID, T>>;
 
+/// Create a geometry-ordered container from unordered elements.
+///
+/// @param elements unordered elements, e.g. simulated hits in creation order
+/// @return container with all elements moved into geometry order
+///
+/// Sorts the elements with a stable least-significant-digit radix sort on the
+/// encoded geometry identifier. Byte positions that are identical for all
+/// elements, e.g. unused identifier fields, are skipped. The sorted sequence
+/// is adopted by the container without any further sorting.
+template <typename T, typename Container>
+inline GeometryIdMultiset<T> makeGeometryIdMultiset(Container&& elements) {
+  using Key = std::pair<Acts::GeometryID::Value, std::size_t>;
+  constexpr std::size_t kRadixBits = 8u;
+  constexpr std::size_t kRadixSize = 1u << kRadixBits;
+
+  const std::size_t n = elements.size();
+  std::vector<Key> keys(n);
+  std::vector<Key> buffer(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    keys[i] = {detail::GeometryIdGetter()(elements[i]).value(), i};
+  }
+  for (std::size_t shift = 0u; shift < 8u * sizeof(Acts::GeometryID::Value);
+       shift += kRadixBits) {
+    auto digit = [=](const Key& key) {
+      return (key.first >> shift) & (kRadixSize - 1u);
+    };
+    std::array<std::size_t, kRadixSize> offsets = {};
+    for (const auto& key : keys) {
+      offsets[digit(key)] += 1u;
+    }
+    // all elements share this digit and the pass would not change anything
+    if ((0u < n) and (offsets[digit(keys.front())] == n)) {
+      continue;
+    }
+    std::size_t sum = 0u;
+    for (auto& offset : offsets) {
+      sum += offset;
+      offset = sum - offset;
+    }
+    for (const auto& key : keys) {
+      buffer[offsets[digit(key)]++] = key;
+    }
+    std::swap(keys, buffer);
+  }
+
+  typename GeometryIdMultiset<T>::sequence_type sorted;
+  sorted.reserve(n);
+  for (const auto& key : keys) {
+    sorted.push_back(std::move(elements[key.second]));
+  }
+  GeometryIdMultiset<T> container;
+  container.adopt_sequence(boost::container::ordered_range, std::move(sorted));
+  return container;
+}
+
 /// Select all elements within the given volume.
 template <typename T>
 inline Range<typename GeometryIdMultiset<T>::const_iterator> selectVolume(
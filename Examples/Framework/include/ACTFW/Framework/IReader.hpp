@@ -39,6 +39,13 @@ class IReader {
   /// will most likely not be called in order. Implementations must use the
   /// event number provided to select the proper data to be read.
   virtual ProcessCode read(const AlgorithmContext& context) = 0;
+
+  /// Whether the reader can be called concurrently for different events.
+  ///
+  /// Sequential readers are called for one event at a time and in increasing
+  /// event order when the sequencer prefetches events. Without prefetching,
+  /// they must still handle concurrent calls, e.g. by using an internal lock.
+  virtual bool isThreadSafe() const { return true; }
 };
 
 }  // namespace FW
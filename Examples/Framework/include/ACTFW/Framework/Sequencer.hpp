@@ -41,6 +41,15 @@ class Sequencer {
     int numThreads = -1;
     /// output directory for timing information, empty for working directory
     std::string outputDir;
+    /// number of events to read ahead on dedicated I/O threads, 0 to disable
+    size_t prefetchEvents = 0;
+    /// number of dedicated I/O threads used for prefetching
+    size_t prefetchThreads = 1;
+    /// write a Chrome trace and per-event timings to the output directory
+    bool outputTrace = false;
+    /// write the messages of all framework loggers created after the
+    /// sequencer on a dedicated thread, see FW::setLoggingSink
+    bool asyncLogging = false;
   };
 
   Sequencer(const Config& cfg);
@@ -92,6 +101,12 @@ class Sequencer {
   /// This will run the start-of-run hook for all configured services, run all
   /// configured readers, algorithms, and writers for each event, then invoke
   /// the end-of-run hook for all configured writers.
+  ///
+  /// If event prefetching is enabled, the services, context decorators, and
+  /// readers are run ahead of the event processing on dedicated I/O threads
+  /// with the same context as without prefetching. Sequential readers, i.e.
+  /// readers that are not thread-safe, are then called in increasing event
+  /// order and the time spent waiting for them is reported per reader.
   int run();
 
  private:
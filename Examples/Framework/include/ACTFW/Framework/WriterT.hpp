@@ -18,6 +18,7 @@
 
 #include "ACTFW/Framework/IWriter.hpp"
 #include "ACTFW/Framework/WhiteBoard.hpp"
+#include "ACTFW/Utilities/Logging.hpp"
 
 namespace FW {
 
@@ -79,7 +80,7 @@ FW::WriterT<write_data_t>::WriterT(std::string objectName,
                                    Acts::Logging::Level level)
     : m_objectName(std::move(objectName)),
       m_writerName(std::move(writerName)),
-      m_logger(Acts::getDefaultLogger(m_writerName, level)) {
+      m_logger(FW::getDefaultLogger(m_writerName, level)) {
   if (m_objectName.empty()) {
     throw std::invalid_argument("Missing input collection");
   } else if (m_writerName.empty()) {
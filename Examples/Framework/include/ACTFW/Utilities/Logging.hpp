@@ -0,0 +1,37 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include <Acts/Utilities/AsyncLogging.hpp>
+#include <Acts/Utilities/Logger.hpp>
+
+namespace FW {
+
+/// Write the messages of all subsequently created framework loggers through
+/// the given sink, i.e. on its writer thread.
+///
+/// @param sink the sink to use, nullptr to print directly again
+///
+/// Loggers that already exist keep their output mode.
+void setLoggingSink(std::shared_ptr<Acts::Logging::AsyncSink> sink);
+
+/// Default logger of the framework components.
+///
+/// @param name name of the logger instance
+/// @param lvl debug threshold level
+///
+/// Uses the same decorations as Acts::getDefaultLogger and writes through the
+/// sink given to setLoggingSink, if any.
+std::unique_ptr<const Acts::Logger> getDefaultLogger(const std::string& name,
+                                                     Acts::Logging::Level lvl);
+
+}  // namespace FW
@@ -8,9 +8,11 @@
 
 #include "ACTFW/Framework/BareAlgorithm.hpp"
 
+#include "ACTFW/Utilities/Logging.hpp"
+
 FW::BareAlgorithm::BareAlgorithm(std::string name, Acts::Logging::Level level)
     : m_name(std::move(name)),
-      m_logger(Acts::getDefaultLogger(m_name, level)) {}
+      m_logger(FW::getDefaultLogger(m_name, level)) {}
 
 std::string FW::BareAlgorithm::name() const {
   return m_name;
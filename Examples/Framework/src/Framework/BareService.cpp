@@ -8,11 +8,13 @@
 
 #include "ACTFW/Framework/BareService.hpp"
 
+#include "ACTFW/Utilities/Logging.hpp"
+
 namespace FW {
 
 BareService::BareService(std::string name, Acts::Logging::Level level)
     : m_name(std::move(name)),
-      m_logger(Acts::getDefaultLogger(m_name, level)) {}
+      m_logger(FW::getDefaultLogger(m_name, level)) {}
 
 std::string BareService::name() const {
   return m_name;
@@ -0,0 +1,203 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "EventPrefetcher.hpp"
+
+#include <Acts/Utilities/Profiling.hpp>
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+#include "ACTFW/Framework/AlgorithmContext.hpp"
+#include "ACTFW/Framework/ProcessCode.hpp"
+#include "ACTFW/Utilities/Logging.hpp"
+
+FW::EventPrefetcher::EventPrefetcher(
+    std::vector<std::shared_ptr<IService>> services,
+    std::vector<std::shared_ptr<IContextDecorator>> decorators,
+    std::vector<std::shared_ptr<IReader>> readers,
+    std::pair<size_t, size_t> events, size_t capacity, size_t numThreads,
+    Acts::Logging::Level logLevel)
+    : m_services(std::move(services)),
+      m_decorators(std::move(decorators)),
+      m_readers(std::move(readers)),
+      m_end(events.second),
+      m_capacity(std::max<size_t>(capacity, 1u)),
+      m_logLevel(logLevel),
+      m_nextEvent(events.first),
+      m_prepare(m_services.size() + m_decorators.size(), Duration::zero()),
+      m_read(m_readers.size(), Duration::zero()),
+      m_stall(m_readers.size(), Duration::zero()) {
+  // must be in the same order as the processing
+  for (const auto& service : m_services) {
+    m_names.push_back("Service:" + service->name());
+  }
+  for (const auto& decorator : m_decorators) {
+    m_names.push_back("Decorator:" + decorator->name());
+  }
+  for (size_t i = 0; i < m_readers.size(); ++i) {
+    m_names.push_back("Reader:" + m_readers[i]->name());
+    m_readerStates.push_back(std::make_unique<ReaderState>());
+    m_readerStates.back()->nextEvent = events.first;
+  }
+  numThreads = std::max<size_t>(numThreads, 1u);
+  m_numRunning = numThreads;
+  for (size_t i = 0; i < numThreads; ++i) {
+    m_threads.emplace_back([this]() { readEvents(); });
+  }
+}
+
+FW::EventPrefetcher::~EventPrefetcher() {
+  m_stop = true;
+  m_notFull.notify_all();
+  for (auto& state : m_readerStates) {
+    std::lock_guard<std::mutex> lock(state->mutex);
+    state->turn.notify_all();
+  }
+  for (auto& thread : m_threads) {
+    if (thread.joinable()) {
+      thread.join();
+    }
+  }
+}
+
+void FW::EventPrefetcher::readEvents() {
+  std::vector<Duration> prepare(m_prepare.size(), Duration::zero());
+  std::vector<Duration> read(m_readers.size(), Duration::zero());
+  std::vector<Duration> stall(m_readers.size(), Duration::zero());
+
+  try {
+    // events are claimed in increasing order; the lowest unfinished event is
+    // always owned by a running thread and sequential readers can not stall
+    for (size_t event = m_nextEvent++; (event < m_end) and not m_stop;
+         event = m_nextEvent++) {
+      auto store = std::make_unique<WhiteBoard>(FW::getDefaultLogger(
+          "EventStore#" + std::to_string(event), m_logLevel));
+      auto context = std::make_unique<AlgorithmContext>(0, event, *store);
+      Acts::Profiling::setThreadContext(event);
+
+      // prepare the context exactly as the Sequencer does without prefetching
+      // such that the readers see the decorated contexts and the same
+      // algorithm numbers, e.g. for the random number seeds
+      size_t iprep = 0;
+      for (const auto& service : m_services) {
+        Acts::Profiling::ScopedTimer trace(m_names[iprep].c_str());
+        auto start = Clock::now();
+        service->prepare(++(*context));
+        prepare[iprep++] += Clock::now() - start;
+      }
+      for (const auto& decorator : m_decorators) {
+        Acts::Profiling::ScopedTimer trace(m_names[iprep].c_str());
+        auto start = Clock::now();
+        if (decorator->decorate(++(*context)) != ProcessCode::SUCCESS) {
+          throw std::runtime_error("Failed to decorate event context");
+        }
+        prepare[iprep++] += Clock::now() - start;
+      }
+
+      for (size_t i = 0; i < m_readers.size(); ++i) {
+        auto& reader = *m_readers[i];
+        auto& state = *m_readerStates[i];
+        std::unique_lock<std::mutex> lock(state.mutex, std::defer_lock);
+        if (not reader.isThreadSafe()) {
+          auto start = Clock::now();
+          lock.lock();
+          state.turn.wait(lock, [&]() {
+            return (state.nextEvent == event) or m_stop;
+          });
+          stall[i] += Clock::now() - start;
+          if (m_stop) {
+            break;
+          }
+        }
+        auto start = Clock::now();
+        {
+          Acts::Profiling::ScopedTimer trace(m_names[iprep + i].c_str());
+          if (reader.read(++(*context)) != ProcessCode::SUCCESS) {
+            throw std::runtime_error("Failed to read input data");
+          }
+        }
+        read[i] += Clock::now() - start;
+        if (lock.owns_lock()) {
+          state.nextEvent = event + 1;
+          lock.unlock();
+          state.turn.notify_all();
+        }
+      }
+      if (m_stop) {
+        break;
+      }
+
+      std::unique_lock<std::mutex> lock(m_queueMutex);
+      m_notFull.wait(lock,
+                     [&]() { return (m_queue.size() < m_capacity) or m_stop; });
+      m_queue.push_back({event, std::move(store), std::move(context)});
+      lock.unlock();
+      m_notEmpty.notify_one();
+    }
+  } catch (...) {
+    fail(std::current_exception());
+  }
+
+  std::lock_guard<std::mutex> lock(m_queueMutex);
+  for (size_t i = 0; i < m_prepare.size(); ++i) {
+    m_prepare[i] += prepare[i];
+  }
+  for (size_t i = 0; i < m_readers.size(); ++i) {
+    m_read[i] += read[i];
+    m_stall[i] += stall[i];
+  }
+  m_numRunning -= 1u;
+  m_notEmpty.notify_all();
+}
+
+void FW::EventPrefetcher::fail(std::exception_ptr error) {
+  {
+    std::lock_guard<std::mutex> lock(m_queueMutex);
+    if (not m_error) {
+      m_error = std::move(error);
+    }
+  }
+  m_stop = true;
+  m_notFull.notify_all();
+  m_notEmpty.notify_all();
+  for (auto& state : m_readerStates) {
+    std::lock_guard<std::mutex> lock(state->mutex);
+    state->turn.notify_all();
+  }
+}
+
+bool FW::EventPrefetcher::pop(Event& event) {
+  std::unique_lock<std::mutex> lock(m_queueMutex);
+  if (m_queue.empty() and (0u < m_numRunning) and not m_stop) {
+    auto start = Clock::now();
+    m_notEmpty.wait(lock, [&]() {
+      return not m_queue.empty() or (m_numRunning == 0u) or m_stop;
+    });
+    m_wait += Clock::now() - start;
+  }
+  if (m_queue.empty() or m_error) {
+    return false;
+  }
+  event = std::move(m_queue.front());
+  m_queue.pop_front();
+  lock.unlock();
+  m_notFull.notify_one();
+  return true;
+}
+
+void FW::EventPrefetcher::join() {
+  for (auto& thread : m_threads) {
+    if (thread.joinable()) {
+      thread.join();
+    }
+  }
+  if (m_error) {
+    std::rethrow_exception(m_error);
+  }
+}
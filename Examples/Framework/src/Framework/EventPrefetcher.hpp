@@ -0,0 +1,131 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <Acts/Utilities/Logger.hpp>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "ACTFW/Framework/AlgorithmContext.hpp"
+#include "ACTFW/Framework/IContextDecorator.hpp"
+#include "ACTFW/Framework/IReader.hpp"
+#include "ACTFW/Framework/IService.hpp"
+#include "ACTFW/Framework/WhiteBoard.hpp"
+
+namespace FW {
+
+/// Read events ahead of the event processing on dedicated I/O threads.
+///
+/// The I/O threads claim events in increasing order, run all readers for
+/// each event into a separate event store, and append the filled stores to a
+/// bounded queue from which the event workers take them. Thread-safe readers
+/// are called concurrently from all I/O threads. Sequential readers are called
+/// for one event at a time in increasing event order. The readers see the
+/// same context as without prefetching, i.e. the services and the context
+/// decorators are run for each event before the readers and the algorithm
+/// number is advanced in the same order as in the Sequencer. The prepared
+/// context is handed to the workers together with the event store.
+class EventPrefetcher {
+ public:
+  using Clock = std::chrono::high_resolution_clock;
+  using Duration = Clock::duration;
+
+  /// A fully read event.
+  struct Event {
+    size_t number = SIZE_MAX;
+    std::unique_ptr<WhiteBoard> store;
+    /// Context after the services, decorators, and readers; refers to store
+    std::unique_ptr<AlgorithmContext> context;
+  };
+
+  /// Start reading events on the I/O threads.
+  ///
+  /// @param services are the services to prepare every event
+  /// @param decorators are the context decorators to run for every event
+  /// @param readers are the readers to run for every event
+  /// @param events is the range of events to read
+  /// @param capacity is the maximum number of read but unprocessed events
+  /// @param numThreads is the number of I/O threads
+  /// @param logLevel is the log level for the event stores
+  EventPrefetcher(std::vector<std::shared_ptr<IService>> services,
+                  std::vector<std::shared_ptr<IContextDecorator>> decorators,
+                  std::vector<std::shared_ptr<IReader>> readers,
+                  std::pair<size_t, size_t> events, size_t capacity,
+                  size_t numThreads, Acts::Logging::Level logLevel);
+  /// Stop reading and wait for all I/O threads.
+  ~EventPrefetcher();
+
+  /// Take the next read event from the queue and wait if necessary.
+  ///
+  /// @return false if there are no more events or reading failed
+  bool pop(Event& event);
+  /// Wait for all I/O threads and rethrow the first reading error if any.
+  ///
+  /// @throws std::runtime_error if a reader failed to read an event
+  void join();
+
+  /// Time spent in each service and decorator, in this order.
+  const std::vector<Duration>& prepareDurations() const { return m_prepare; }
+  /// Time spent in each reader.
+  const std::vector<Duration>& readDurations() const { return m_read; }
+  /// Time spent by I/O threads waiting for access to each sequential reader.
+  const std::vector<Duration>& stallDurations() const { return m_stall; }
+  /// Time spent by event workers waiting for read events.
+  Duration waitDuration() const { return m_wait; }
+
+ private:
+  /// Per-reader state to call sequential readers in event order.
+  struct ReaderState {
+    std::mutex mutex;
+    std::condition_variable turn;
+    size_t nextEvent = 0u;
+  };
+
+  void readEvents();
+  /// Mark reading as failed and wake all waiting threads.
+  void fail(std::exception_ptr error);
+
+  std::vector<std::shared_ptr<IService>> m_services;
+  std::vector<std::shared_ptr<IContextDecorator>> m_decorators;
+  std::vector<std::shared_ptr<IReader>> m_readers;
+  /// Service, decorator, and reader names used for the trace records.
+  std::vector<std::string> m_names;
+  std::vector<std::unique_ptr<ReaderState>> m_readerStates;
+  size_t m_end;
+  size_t m_capacity;
+  Acts::Logging::Level m_logLevel;
+  std::atomic<size_t> m_nextEvent;
+  std::atomic<bool> m_stop{false};
+
+  std::mutex m_queueMutex;
+  std::condition_variable m_notEmpty;
+  std::condition_variable m_notFull;
+  std::deque<Event> m_queue;
+  size_t m_numRunning = 0u;
+  std::exception_ptr m_error;
+
+  std::vector<Duration> m_prepare;
+  std::vector<Duration> m_read;
+  std::vector<Duration> m_stall;
+  Duration m_wait = Duration::zero();
+  std::vector<std::thread> m_threads;
+};
+
+}  // namespace FW
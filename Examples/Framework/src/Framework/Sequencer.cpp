@@ -8,22 +8,30 @@
 
 #include "ACTFW/Framework/Sequencer.hpp"
 
+#include <Acts/Utilities/Profiling.hpp>
 #include <TROOT.h>
 #include <algorithm>
 #include <chrono>
 #include <dfe/dfe_io_dsv.hpp>
 #include <dfe/dfe_namedtuple.hpp>
 #include <exception>
+#include <fstream>
+#include <iomanip>
+#include <map>
 #include <numeric>
 #include <tbb/tbb.h>
 
 #include "ACTFW/Framework/ProcessCode.hpp"
 #include "ACTFW/Framework/WhiteBoard.hpp"
+#include "ACTFW/Utilities/Logging.hpp"
 #include "ACTFW/Utilities/Paths.hpp"
+#include "EventPrefetcher.hpp"
 
-FW::Sequencer::Sequencer(const Sequencer::Config& cfg)
-    : m_cfg(cfg),
-      m_logger(Acts::getDefaultLogger("Sequencer", m_cfg.logLevel)) {
+FW::Sequencer::Sequencer(const Sequencer::Config& cfg) : m_cfg(cfg) {
+  if (m_cfg.asyncLogging) {
+    setLoggingSink(std::make_shared<Acts::Logging::AsyncSink>());
+  }
+  m_logger = FW::getDefaultLogger("Sequencer", m_cfg.logLevel);
   // automatically determine the number of concurrent threads to use
   if (m_cfg.numThreads < 0) {
     m_cfg.numThreads = tbb::task_scheduler_init::default_num_threads();
@@ -221,6 +229,64 @@ void storeTiming(const std::vector<std::string>& identifiers,
     writer.append(info);
   }
 }
+
+// Store per-event timing data
+struct EventTimingInfo {
+  uint64_t event_id;
+  std::string identifier;
+  uint32_t thread;
+  double time_s;
+
+  DFE_NAMEDTUPLE(EventTimingInfo, event_id, identifier, thread, time_s);
+};
+
+void storeEventTiming(const std::vector<Acts::Profiling::Record>& records,
+                      std::string path) {
+  // sections can be entered multiple times per event, e.g. the propagation
+  std::map<std::pair<uint64_t, std::string>, EventTimingInfo> infos;
+  for (const auto& record : records) {
+    if (record.context == UINT64_MAX) {
+      continue;
+    }
+    auto& info = infos[{record.context, record.name}];
+    info.event_id = record.context;
+    info.identifier = record.name;
+    info.thread = record.thread;
+    info.time_s += (record.stop - record.start) * 1e-9;
+  }
+  dfe::NamedTupleTsvWriter<EventTimingInfo> writer(std::move(path), 6);
+  for (const auto& entry : infos) {
+    writer.append(entry.second);
+  }
+}
+
+// Store all records as complete events in the Chrome trace event format that
+// can be viewed e.g. with chrome://tracing or https://ui.perfetto.dev
+void storeTrace(const std::vector<Acts::Profiling::Record>& records,
+                const std::string& path) {
+  std::ofstream os(path, std::ios::out | std::ios::trunc);
+  if (not os) {
+    throw std::ios_base::failure("Could not open '" + path + "' to write");
+  }
+  int64_t origin = records.empty() ? 0 : records.front().start;
+  // timestamps are in microseconds and need sub-microsecond resolution
+  os << std::fixed << std::setprecision(3);
+  os << "{\"traceEvents\":[";
+  for (size_t i = 0; i < records.size(); ++i) {
+    const auto& record = records[i];
+    // names are algorithm names or string literals and need no escaping
+    os << ((i == 0u) ? "\n" : ",\n");
+    os << "{\"name\":\"" << record.name << "\",\"ph\":\"X\",\"pid\":0";
+    os << ",\"tid\":" << record.thread;
+    os << ",\"ts\":" << (record.start - origin) * 1e-3;
+    os << ",\"dur\":" << (record.stop - record.start) * 1e-3;
+    if (record.context != UINT64_MAX) {
+      os << ",\"args\":{\"event\":" << record.context << "}";
+    }
+    os << "}";
+  }
+  os << "\n]}\n";
+}
 }  // namespace
 
 int FW::Sequencer::run() {
@@ -255,67 +321,169 @@ int FW::Sequencer::run() {
     service->startRun();
   }
 
+  // trace records refer to the names and need storage that is never modified
+  const std::vector<std::string> traceNames = names;
+
+  // process a single event; a prefetched event comes with the context after
+  // the services, decorators, and readers have already been run
+  auto processEvent = [&](size_t event, WhiteBoard& eventStore,
+                          const AlgorithmContext* prepared,
+                          std::vector<Duration>& localClocksAlgorithms) {
+    // If we ever wanted to run algorithms in parallel, this needs to be
+    // changed to Algorithm context copies
+    AlgorithmContext context =
+        prepared ? *prepared : AlgorithmContext(0, event, eventStore);
+    size_t ialgo = 0;
+    Acts::Profiling::setThreadContext(event);
+
+    if (prepared) {
+      // the context sub-event counter is already identical to the reading
+      ialgo = m_services.size() + m_decorators.size() + m_readers.size();
+    } else {
+      // Prepare event store w/ service information
+      for (auto& service : m_services) {
+        Acts::Profiling::ScopedTimer trace(traceNames[ialgo].c_str());
+        StopWatch sw(localClocksAlgorithms[ialgo++]);
+        service->prepare(++context);
+      }
+      /// Decorate the context
+      for (auto& cdr : m_decorators) {
+        Acts::Profiling::ScopedTimer trace(traceNames[ialgo].c_str());
+        StopWatch sw(localClocksAlgorithms[ialgo++]);
+        if (cdr->decorate(++context) != ProcessCode::SUCCESS) {
+          throw std::runtime_error("Failed to decorate event context");
+        }
+      }
+      // Read everything in
+      for (auto& rdr : m_readers) {
+        Acts::Profiling::ScopedTimer trace(traceNames[ialgo].c_str());
+        StopWatch sw(localClocksAlgorithms[ialgo++]);
+        if (rdr->read(++context) != ProcessCode::SUCCESS) {
+          throw std::runtime_error("Failed to read input data");
+        }
+      }
+    }
+    // Execute all algorithms
+    for (auto& alg : m_algorithms) {
+      Acts::Profiling::ScopedTimer trace(traceNames[ialgo].c_str());
+      StopWatch sw(localClocksAlgorithms[ialgo++]);
+      if (alg->execute(++context) != ProcessCode::SUCCESS) {
+        throw std::runtime_error("Failed to process event data");
+      }
+    }
+    // Write out results
+    for (auto& wrt : m_writers) {
+      Acts::Profiling::ScopedTimer trace(traceNames[ialgo].c_str());
+      StopWatch sw(localClocksAlgorithms[ialgo++]);
+      if (wrt->write(++context) != ProcessCode::SUCCESS) {
+        throw std::runtime_error("Failed to write output data");
+      }
+    }
+    ACTS_INFO("finished event " << event);
+  };
+  // add timing info to global information
+  auto mergeClocks = [&](const std::vector<Duration>& localClocksAlgorithms) {
+    tbb::queuing_mutex::scoped_lock lock(clocksAlgorithmsMutex);
+    for (size_t i = 0; i < clocksAlgorithms.size(); ++i) {
+      clocksAlgorithms[i] += localClocksAlgorithms[i];
+    }
+  };
+
+  // time spent waiting for prefetched input is not part of the processing
+  Duration totalStall = Duration::zero();
+
+  // record per-event timings
+  if (m_cfg.outputTrace) {
+    Acts::Profiling::setEnabled(true);
+  }
+  // must be called while the record names are still available
+  auto exportTrace = [&]() {
+    if (not m_cfg.outputTrace) {
+      return;
+    }
+    Acts::Profiling::setEnabled(false);
+    auto records = Acts::Profiling::collect();
+    ACTS_INFO("Writing " << records.size() << " trace records");
+    storeTrace(records, joinPaths(m_cfg.outputDir, "trace.json"));
+    storeEventTiming(records, joinPaths(m_cfg.outputDir, "timing_events.tsv"));
+  };
+
   // execute the parallel event loop
   tbb::task_scheduler_init init(m_cfg.numThreads);
-  tbb::parallel_for(
-      tbb::blocked_range<size_t>(eventsRange.first, eventsRange.second),
-      [&](const tbb::blocked_range<size_t>& r) {
-        std::vector<Duration> localClocksAlgorithms(names.size(),
-                                                    Duration::zero());
-
-        for (size_t event = r.begin(); event != r.end(); ++event) {
-          // Use per-event store
-          WhiteBoard eventStore(Acts::getDefaultLogger(
-              "EventStore#" + std::to_string(event), m_cfg.logLevel));
-          // If we ever wanted to run algorithms in parallel, this needs to be
-          // changed to Algorithm context copies
-          AlgorithmContext context(0, event, eventStore);
-          size_t ialgo = 0;
-
-          // Prepare event store w/ service information
-          for (auto& service : m_services) {
-            StopWatch sw(localClocksAlgorithms[ialgo++]);
-            service->prepare(++context);
-          }
-          /// Decorate the context
-          for (auto& cdr : m_decorators) {
-            StopWatch sw(localClocksAlgorithms[ialgo++]);
-            if (cdr->decorate(++context) != ProcessCode::SUCCESS) {
-              throw std::runtime_error("Failed to decorate event context");
-            }
-          }
-          // Read everything in
-          for (auto& rdr : m_readers) {
-            StopWatch sw(localClocksAlgorithms[ialgo++]);
-            if (rdr->read(++context) != ProcessCode::SUCCESS) {
-              throw std::runtime_error("Failed to read input data");
-            }
-          }
-          // Execute all algorithms
-          for (auto& alg : m_algorithms) {
-            StopWatch sw(localClocksAlgorithms[ialgo++]);
-            if (alg->execute(++context) != ProcessCode::SUCCESS) {
-              throw std::runtime_error("Failed to process event data");
-            }
-          }
-          // Write out results
-          for (auto& wrt : m_writers) {
-            StopWatch sw(localClocksAlgorithms[ialgo++]);
-            if (wrt->write(++context) != ProcessCode::SUCCESS) {
-              throw std::runtime_error("Failed to write output data");
-            }
-          }
-          ACTS_INFO("finished event " << event);
-        }
+  if ((0u < m_cfg.prefetchEvents) and not m_readers.empty()) {
+    ACTS_INFO("Prefetching up to " << m_cfg.prefetchEvents << " events with "
+                                   << m_cfg.prefetchThreads << " I/O threads");
+    for (const auto& reader : m_readers) {
+      if (not reader->isThreadSafe()) {
+        ACTS_INFO("Reader '" << reader->name() << "' is read sequentially");
+      }
+    }
 
-        // add timing info to global information
-        {
-          tbb::queuing_mutex::scoped_lock lock(clocksAlgorithmsMutex);
-          for (size_t i = 0; i < clocksAlgorithms.size(); ++i) {
-            clocksAlgorithms[i] += localClocksAlgorithms[i];
+    EventPrefetcher prefetcher(m_services, m_decorators, m_readers,
+                               eventsRange, m_cfg.prefetchEvents,
+                               m_cfg.prefetchThreads, m_cfg.logLevel);
+    // one long-running task per worker that consumes prefetched events
+    size_t numWorkers = std::max(m_cfg.numThreads, 1);
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(0u, numWorkers, 1u),
+        [&](const tbb::blocked_range<size_t>&) {
+          std::vector<Duration> localClocksAlgorithms(names.size(),
+                                                      Duration::zero());
+          EventPrefetcher::Event prefetched;
+          while (prefetcher.pop(prefetched)) {
+            processEvent(prefetched.number, *prefetched.store,
+                         prefetched.context.get(), localClocksAlgorithms);
+            prefetched.context.reset();
+            prefetched.store.reset();
           }
-        }
-      });
+          mergeClocks(localClocksAlgorithms);
+        });
+    prefetcher.join();
+    exportTrace();
+
+    // preparation and reading happen outside the workers and are accounted
+    // separately
+    for (size_t i = 0; i < prefetcher.prepareDurations().size(); ++i) {
+      clocksAlgorithms[i] += prefetcher.prepareDurations()[i];
+    }
+    size_t ireader = m_services.size() + m_decorators.size();
+    for (size_t i = 0; i < m_readers.size(); ++i) {
+      clocksAlgorithms[ireader + i] += prefetcher.readDurations()[i];
+    }
+    // report the I/O stall times separately
+    size_t numEvents = eventsRange.second - eventsRange.first;
+    for (size_t i = 0; i < m_readers.size(); ++i) {
+      if (not m_readers[i]->isThreadSafe()) {
+        names.push_back("Reader:" + m_readers[i]->name() + ":stall");
+        clocksAlgorithms.push_back(prefetcher.stallDurations()[i]);
+        totalStall += clocksAlgorithms.back();
+        ACTS_INFO("I/O stall time for reader '"
+                  << m_readers[i]->name()
+                  << "': " << perEvent(clocksAlgorithms.back(), numEvents));
+      }
+    }
+    names.push_back("Prefetch:wait");
+    clocksAlgorithms.push_back(prefetcher.waitDuration());
+    totalStall += clocksAlgorithms.back();
+    ACTS_INFO("Time waiting for prefetched events: "
+              << perEvent(clocksAlgorithms.back(), numEvents));
+  } else {
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(eventsRange.first, eventsRange.second),
+        [&](const tbb::blocked_range<size_t>& r) {
+          std::vector<Duration> localClocksAlgorithms(names.size(),
+                                                      Duration::zero());
+
+          for (size_t event = r.begin(); event != r.end(); ++event) {
+            // Use per-event store
+            WhiteBoard eventStore(FW::getDefaultLogger(
+                "EventStore#" + std::to_string(event), m_cfg.logLevel));
+            processEvent(event, eventStore, nullptr, localClocksAlgorithms);
+          }
+          mergeClocks(localClocksAlgorithms);
+        });
+    exportTrace();
+  }
 
   // run end-of-run hooks
   for (auto& wrt : m_writers) {
@@ -331,10 +499,23 @@ int FW::Sequencer::run() {
   Duration totalWall = Clock::now() - clockWallStart;
   Duration totalReal = std::accumulate(
       clocksAlgorithms.begin(), clocksAlgorithms.end(), Duration::zero());
+  totalReal -= totalStall;
   size_t numEvents = eventsRange.second - eventsRange.first;
   ACTS_INFO("Processed " << numEvents << " events in " << asString(totalWall)
                          << " (wall clock)");
   ACTS_INFO("Average time per event: " << perEvent(totalReal, numEvents));
+  double totalWallSeconds = Seconds(totalWall).count();
+  ACTS_INFO("Throughput: " << (numEvents / totalWallSeconds)
+                           << " events/s (wall clock)");
+  // writers include the per-event writes and the end-of-run hooks
+  Duration totalWriters = Duration::zero();
+  for (size_t i = 0; i < names.size(); ++i) {
+    if (names[i].compare(0, 7, "Writer:") == 0) {
+      totalWriters += clocksAlgorithms[i];
+    }
+  }
+  ACTS_INFO("Average time per event in writers: "
+            << perEvent(totalWriters, numEvents));
   ACTS_DEBUG("Average time per algorithm:");
   for (size_t i = 0; i < names.size(); ++i) {
     ACTS_DEBUG("  " << names[i] << ": "
@@ -0,0 +1,34 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ACTFW/Utilities/Logging.hpp"
+
+#include <mutex>
+
+namespace {
+std::mutex s_sinkMutex;
+std::shared_ptr<Acts::Logging::AsyncSink> s_sink;
+}  // namespace
+
+void FW::setLoggingSink(std::shared_ptr<Acts::Logging::AsyncSink> sink) {
+  std::lock_guard<std::mutex> lock(s_sinkMutex);
+  s_sink = std::move(sink);
+}
+
+std::unique_ptr<const Acts::Logger> FW::getDefaultLogger(
+    const std::string& name, Acts::Logging::Level lvl) {
+  std::shared_ptr<Acts::Logging::AsyncSink> sink;
+  {
+    std::lock_guard<std::mutex> lock(s_sinkMutex);
+    sink = s_sink;
+  }
+  if (sink) {
+    return Acts::getAsyncLogger(name, lvl, std::move(sink));
+  }
+  return Acts::getDefaultLogger(name, lvl);
+}
@@ -0,0 +1,76 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <Acts/Geometry/GeometryID.hpp>
+#include <Acts/Material/IMaterialDecorator.hpp>
+#include <Acts/Utilities/Logger.hpp>
+#include <map>
+#include <memory>
+#include <string>
+
+namespace Acts {
+class ISurfaceMaterial;
+}  // namespace Acts
+
+namespace FW {
+
+/// Decorate surfaces with material from a binary material map file.
+///
+/// The file, as written by the `BinaryMaterialWriter`, is mapped read-only
+/// into memory. If the stored records match the in-memory layout of
+/// `Acts::MaterialProperties`, binned surface material references the mapped
+/// records directly without copying; otherwise they are converted once. The
+/// mapping is released once the decorator and all surface material created
+/// by it are gone. Mapped pages are shared between all processes that use
+/// the same file.
+class BinaryMaterialDecorator : public Acts::IMaterialDecorator {
+ public:
+  struct Config {
+    /// The name of the input file.
+    std::string fileName = "material-maps.bin";
+    /// Remove existing surface material without a map entry.
+    bool clearSurfaceMaterial = true;
+    /// Remove existing volume material; the file contains none.
+    bool clearVolumeMaterial = true;
+    /// Reference the stored records directly if their layout allows it.
+    ///
+    /// The records are always converted once if this is disabled or if their
+    /// layout does not match `Acts::MaterialProperties`.
+    bool useRecordsInPlace = true;
+  };
+
+  /// Map the file and prepare the surface material.
+  ///
+  /// @params cfg is the configuration object
+  /// @params lvl is the logging level
+  ///
+  /// @throws std::runtime_error if the file is invalid or can not be mapped
+  BinaryMaterialDecorator(const Config& cfg, Acts::Logging::Level lvl);
+
+  /// Decorate a surface
+  ///
+  /// @param surface the non-cost surface that is decorated
+  void decorate(Acts::Surface& surface) const final;
+
+  /// Decorate a TrackingVolume
+  ///
+  /// @param volume the non-cost volume that is decorated
+  void decorate(Acts::TrackingVolume& volume) const final;
+
+ private:
+  Config m_cfg;
+  std::unique_ptr<const Acts::Logger> m_logger;
+  std::map<Acts::GeometryID, std::shared_ptr<const Acts::ISurfaceMaterial>>
+      m_surfaceMaterialMap;
+
+  const Acts::Logger& logger() const { return *m_logger; }
+};
+
+}  // namespace FW
@@ -0,0 +1,62 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <Acts/Geometry/GeometryID.hpp>
+#include <Acts/Utilities/Logger.hpp>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace Acts {
+class ISurfaceMaterial;
+class IVolumeMaterial;
+
+using SurfaceMaterialMap =
+    std::map<GeometryID, std::shared_ptr<const ISurfaceMaterial>>;
+using VolumeMaterialMap =
+    std::map<GeometryID, std::shared_ptr<const IVolumeMaterial>>;
+using DetectorMaterialMaps = std::pair<SurfaceMaterialMap, VolumeMaterialMap>;
+}  // namespace Acts
+
+namespace FW {
+
+/// Write surface material maps into a binary, memory-mappable file.
+///
+/// Homogeneous and equidistantly binned surface material is supported, see
+/// `BinaryMaterialFormat.hpp` for the file layout. Other surface material
+/// and all volume material is skipped with a warning. The file can be read
+/// without conversion using the `BinaryMaterialDecorator`.
+class BinaryMaterialWriter {
+ public:
+  struct Config {
+    /// The name of the output file.
+    std::string fileName = "material-maps.bin";
+  };
+
+  /// Construct the material writer.
+  ///
+  /// @params cfg is the configuration object
+  /// @params lvl is the logging level
+  BinaryMaterialWriter(const Config& cfg, Acts::Logging::Level lvl);
+
+  /// Write out the material map
+  ///
+  /// @param detMaterial is the SurfaceMaterial and VolumeMaterial maps
+  void write(const Acts::DetectorMaterialMaps& detMaterial);
+
+ private:
+  Config m_cfg;
+  std::unique_ptr<const Acts::Logger> m_logger;
+
+  const Acts::Logger& logger() const { return *m_logger; }
+};
+
+}  // namespace FW
@@ -0,0 +1,60 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <string>
+
+#include "ACTFW/EventData/SimParticle.hpp"
+#include "ACTFW/Framework/WriterT.hpp"
+
+namespace FW {
+
+/// Write out particles as a columnar binary table.
+///
+/// This writes one file per event into the configured output directory. By
+/// default it writes to the current working directory. Files are named
+/// using the following schema
+///
+///     event000000001-<stem>.bin
+///     event000000002-<stem>.bin
+///     ...
+///
+/// and contain the same information as the corresponding csv files, see
+/// `ColumnarTable.hpp` for the file layout. Particles are stored in the order
+/// of the input container, i.e. ordered by particle identifier.
+class BinaryParticleWriter final : public WriterT<SimParticleContainer> {
+ public:
+  struct Config {
+    /// Input particles collection to write.
+    std::string inputParticles;
+    /// Where to place output files.
+    std::string outputDir;
+    /// Output filename stem.
+    std::string outputStem = "particles";
+  };
+
+  /// Construct the particle writer.
+  ///
+  /// @params cfg is the configuration object
+  /// @params lvl is the logging level
+  BinaryParticleWriter(const Config& cfg, Acts::Logging::Level lvl);
+
+ protected:
+  /// Type-specific write implementation.
+  ///
+  /// @param[in] ctx is the algorithm context
+  /// @param[in] particles are the particle to be written
+  ProcessCode writeT(const FW::AlgorithmContext& ctx,
+                     const SimParticleContainer& particles) final override;
+
+ private:
+  Config m_cfg;
+};
+
+}  // namespace FW
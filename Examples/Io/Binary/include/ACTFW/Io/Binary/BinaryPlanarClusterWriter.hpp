@@ -0,0 +1,68 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <string>
+
+#include "ACTFW/EventData/GeometryContainers.hpp"
+#include "ACTFW/Framework/WriterT.hpp"
+#include "Acts/Plugins/Digitization/PlanarModuleCluster.hpp"
+
+namespace FW {
+
+/// Write out a planar cluster collection as columnar binary tables.
+///
+/// This writes three files per event into the configured output directory.
+/// By default it writes to the current working directory. Files are named
+/// using the following schema
+///
+///     event000000001-cells.bin
+///     event000000001-hits.bin
+///     event000000001-truth.bin
+///     event000000002-cells.bin
+///     event000000002-hits.bin
+///     event000000002-truth.bin
+///     ...
+///
+/// The hits are stored in the order of the input container, i.e. sorted by
+/// geometry identifier, with local instead of global positions. Cells and
+/// hit-particle truth information are stored in the same order as the hits
+/// and are associated via per-hit counts instead of explicit hit identifiers.
+class BinaryPlanarClusterWriter final
+    : public WriterT<GeometryIdMultimap<Acts::PlanarModuleCluster>> {
+ public:
+  struct Config {
+    /// Which cluster collection to write.
+    std::string inputClusters;
+    /// Which simulated (truth) hits collection to use.
+    std::string inputSimulatedHits;
+    /// Where to place output files
+    std::string outputDir;
+  };
+
+  /// Construct the cluster writer.
+  ///
+  /// @params cfg is the configuration object
+  /// @params lvl is the logging level
+  BinaryPlanarClusterWriter(const Config& cfg, Acts::Logging::Level lvl);
+
+ protected:
+  /// Type-specific write implementation.
+  ///
+  /// @param[in] ctx is the algorithm context
+  /// @param[in] clusters are the clusters to be written
+  ProcessCode writeT(const AlgorithmContext& ctx,
+                     const GeometryIdMultimap<Acts::PlanarModuleCluster>&
+                         clusters) final override;
+
+ private:
+  Config m_cfg;
+};
+
+}  // namespace FW
@@ -0,0 +1,255 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+/// @file
+/// @brief Read and write named tuple records as a columnar binary table
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <dfe/dfe_io_numpy.hpp>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "ACTFW/Io/Binary/MappedFile.hpp"
+
+namespace FW {
+namespace detail {
+
+/// Fixed-size file header of a columnar table.
+struct ColumnarHeader {
+  char magic[8];
+  uint32_t numColumns;
+  uint32_t reserved;
+  uint64_t numRows;
+};
+/// Fixed-size description of a single column.
+struct ColumnarColumn {
+  char name[28];
+  char dtype[4];
+};
+static_assert(sizeof(ColumnarHeader) == 24u, "Unexpected header padding");
+static_assert(sizeof(ColumnarColumn) == 32u, "Unexpected column padding");
+
+constexpr char kColumnarMagic[8] = {'A', 'C', 'T', 'S', 'C', 'O', 'L', '1'};
+constexpr size_t kColumnarAlignment = 64u;
+
+constexpr size_t alignColumn(size_t offset) {
+  return (offset + kColumnarAlignment - 1u) / kColumnarAlignment *
+         kColumnarAlignment;
+}
+
+/// Fill the column descriptions for the given record type.
+template <typename record_t>
+std::vector<ColumnarColumn> makeColumns() {
+  const auto names = record_t::names();
+  const auto codes = dfe::io_npy_impl::dtypes_codes(record_t().tuple());
+  const char endianness = dfe::io_npy_impl::dtype_endianness_modifier();
+  std::vector<ColumnarColumn> columns(names.size());
+  for (size_t i = 0; i < names.size(); ++i) {
+    std::memset(&columns[i], 0, sizeof(ColumnarColumn));
+    if (sizeof(columns[i].name) <= names[i].size()) {
+      throw std::invalid_argument("Column name '" + names[i] +
+                                  "' is too long");
+    }
+    names[i].copy(columns[i].name, names[i].size());
+    columns[i].dtype[0] = endianness;
+    std::strncpy(columns[i].dtype + 1, codes[i], sizeof(columns[i].dtype) - 1);
+  }
+  return columns;
+}
+
+/// Offset of the first column data after the header and column descriptions.
+constexpr size_t dataOffset(size_t numColumns) {
+  return alignColumn(sizeof(ColumnarHeader) +
+                     numColumns * sizeof(ColumnarColumn));
+}
+
+template <typename record_t, size_t... I>
+void writeColumns(std::ofstream& file, const std::vector<record_t>& records,
+                  std::index_sequence<I...>) {
+  using Tuple = typename record_t::Tuple;
+  std::vector<char> buffer;
+  size_t offset = dataOffset(sizeof...(I));
+  auto writeColumn = [&](auto column) {
+    using Value = std::tuple_element_t<decltype(column)::value, Tuple>;
+    const size_t size = alignColumn(records.size() * sizeof(Value));
+    buffer.assign(size, 0);
+    for (size_t row = 0; row < records.size(); ++row) {
+      const Value& value =
+          records[row].template get<decltype(column)::value>();
+      std::memcpy(buffer.data() + row * sizeof(Value), &value, sizeof(Value));
+    }
+    file.seekp(offset);
+    file.write(buffer.data(), buffer.size());
+    offset += size;
+  };
+  using Vacuum = int[];
+  (void)Vacuum{(writeColumn(std::integral_constant<size_t, I>()), 0)...};
+}
+
+template <typename record_t, size_t... I>
+size_t columnsSize(size_t numRows, std::index_sequence<I...>) {
+  using Tuple = typename record_t::Tuple;
+  size_t size = 0u;
+  using Vacuum = int[];
+  (void)Vacuum{
+      (size += alignColumn(numRows * sizeof(std::tuple_element_t<I, Tuple>)),
+       0)...};
+  return size;
+}
+
+template <typename record_t, size_t... I>
+std::array<size_t, sizeof...(I)> columnsOffsets(size_t numRows,
+                                                std::index_sequence<I...>) {
+  using Tuple = typename record_t::Tuple;
+  std::array<size_t, sizeof...(I)> offsets;
+  size_t offset = dataOffset(sizeof...(I));
+  using Vacuum = int[];
+  (void)Vacuum{(offsets[I] = offset,
+                offset += alignColumn(
+                    numRows * sizeof(std::tuple_element_t<I, Tuple>)),
+                0)...};
+  return offsets;
+}
+
+}  // namespace detail
+
+/// Write records into a columnar binary table file.
+///
+/// @param path is the output file path; existing files are overwritten
+/// @param records are the records to be written in order
+///
+/// The file starts with a fixed header, followed by the name and numpy-like
+/// type code of every record member. The values of each member are stored
+/// contiguously afterwards, i.e. all values of the first member, then all
+/// values of the second member, and so on. Each column starts at a 64 byte
+/// offset so the columns of a mapped file can be used in place, see
+/// `MappedColumnarTable`.
+///
+/// @tparam record_t is a named tuple type, see `DFE_NAMEDTUPLE`
+template <typename record_t>
+inline void writeColumnarTable(const std::string& path,
+                               const std::vector<record_t>& records) {
+  constexpr size_t kNumColumns =
+      std::tuple_size<typename record_t::Tuple>::value;
+
+  std::ofstream file;
+  file.exceptions(std::ofstream::badbit | std::ofstream::failbit);
+  file.open(path, std::ios_base::binary | std::ios_base::out |
+                      std::ios_base::trunc);
+
+  detail::ColumnarHeader header;
+  std::memcpy(header.magic, detail::kColumnarMagic, sizeof(header.magic));
+  header.numColumns = kNumColumns;
+  header.reserved = 0u;
+  header.numRows = records.size();
+  const auto columns = detail::makeColumns<record_t>();
+  file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  file.write(reinterpret_cast<const char*>(columns.data()),
+             columns.size() * sizeof(detail::ColumnarColumn));
+  // pad explicitly since empty tables have no column data to follow
+  const std::vector<char> padding(
+      detail::dataOffset(kNumColumns) - static_cast<size_t>(file.tellp()), 0);
+  file.write(padding.data(), padding.size());
+  detail::writeColumns(file, records, std::make_index_sequence<kNumColumns>());
+}
+
+/// Read-only access to a columnar binary table file mapped into memory.
+///
+/// The file must contain exactly the members of the record type with the
+/// same names, types, and order. Values are accessed directly in the mapped
+/// columns; nothing is copied when the table is opened.
+///
+/// @tparam record_t is a named tuple type, see `DFE_NAMEDTUPLE`
+template <typename record_t>
+class MappedColumnarTable {
+ public:
+  using Tuple = typename record_t::Tuple;
+  static constexpr size_t kNumColumns = std::tuple_size<Tuple>::value;
+
+  /// Map the file and validate its layout.
+  ///
+  /// @param path is the input file path
+  ///
+  /// @throws std::runtime_error if the file is invalid or can not be mapped
+  MappedColumnarTable(const std::string& path);
+
+  /// Number of records in the table.
+  size_t size() const { return m_numRows; }
+  /// All values of the I-th record member.
+  template <size_t I>
+  const std::tuple_element_t<I, Tuple>* column() const {
+    // the column offset is aligned and the mapping starts at a page boundary
+    return reinterpret_cast<const std::tuple_element_t<I, Tuple>*>(
+        m_mapping.get() + m_offsets[I]);
+  }
+  /// Assemble a single record from the mapped columns.
+  record_t record(size_t row) const {
+    record_t rec;
+    fill(rec, row, std::make_index_sequence<kNumColumns>());
+    return rec;
+  }
+
+ private:
+  std::shared_ptr<const char> m_mapping;
+  size_t m_numRows = 0u;
+  std::array<size_t, kNumColumns> m_offsets;
+
+  template <size_t... I>
+  void fill(record_t& rec, size_t row, std::index_sequence<I...>) const {
+    using Vacuum = int[];
+    (void)Vacuum{(rec.template get<I>() = column<I>()[row], 0)...};
+  }
+};
+
+template <typename record_t>
+inline MappedColumnarTable<record_t>::MappedColumnarTable(
+    const std::string& path) {
+  size_t fileSize = 0u;
+  m_mapping = detail::mapFile(path, fileSize);
+
+  // validate the layout before accessing any data
+  detail::ColumnarHeader header;
+  if (fileSize < detail::dataOffset(kNumColumns)) {
+    throw std::runtime_error("Columnar table '" + path + "' is truncated");
+  }
+  std::memcpy(&header, m_mapping.get(), sizeof(header));
+  if (std::memcmp(header.magic, detail::kColumnarMagic,
+                  sizeof(header.magic)) != 0) {
+    throw std::runtime_error("File '" + path + "' is not a columnar table");
+  }
+  const auto expected = detail::makeColumns<record_t>();
+  if ((header.numColumns != kNumColumns) or
+      (std::memcmp(m_mapping.get() + sizeof(header), expected.data(),
+                   kNumColumns * sizeof(detail::ColumnarColumn)) != 0)) {
+    throw std::runtime_error("Columnar table '" + path +
+                             "' has inconsistent columns");
+  }
+  // every row needs at least one byte; also prevents overflows below
+  if (fileSize < header.numRows) {
+    throw std::runtime_error("Columnar table '" + path + "' is truncated");
+  }
+  m_numRows = header.numRows;
+  if (fileSize < detail::dataOffset(kNumColumns) +
+                     detail::columnsSize<record_t>(
+                         m_numRows, std::make_index_sequence<kNumColumns>())) {
+    throw std::runtime_error("Columnar table '" + path + "' is truncated");
+  }
+  m_offsets = detail::columnsOffsets<record_t>(
+      m_numRows, std::make_index_sequence<kNumColumns>());
+}
+
+}  // namespace FW
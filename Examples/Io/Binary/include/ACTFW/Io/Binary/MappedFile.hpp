@@ -0,0 +1,29 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace FW {
+namespace detail {
+
+/// Map the full file read-only into memory.
+///
+/// @param path is the input file path
+/// @param[out] size is set to the file size in bytes
+/// @return the mapping that starts at a page boundary; it is released once
+///         the last reference is gone
+///
+/// @throws std::runtime_error if the file is empty or can not be mapped
+std::shared_ptr<const char> mapFile(const std::string& path, size_t& size);
+
+}  // namespace detail
+}  // namespace FW
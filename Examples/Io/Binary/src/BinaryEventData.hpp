@@ -0,0 +1,80 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+/// @file
+/// @brief Plain structs that each define one row in a columnar event table
+
+#pragma once
+
+#include <cstdint>
+#include <dfe/dfe_namedtuple.hpp>
+
+namespace FW {
+
+struct BinaryParticleData {
+  /// Event-unique particle identifier a.k.a barcode.
+  uint64_t particle_id = 0u;
+  /// Particle type number a.k.a. PDG particle number.
+  int32_t particle_type = 0;
+  /// Production process type.
+  uint32_t process = 0u;
+  /// Production four-position components in mm and ns.
+  float vx = 0.0f, vy = 0.0f, vz = 0.0f, vt = 0.0f;
+  /// Momentum components in GeV.
+  float px = 0.0f, py = 0.0f, pz = 0.0f;
+  /// Mass in GeV.
+  float m = 0.0f;
+  /// Charge in e.
+  float q = 0.0f;
+
+  DFE_NAMEDTUPLE(BinaryParticleData, particle_id, particle_type, process, vx,
+                 vy, vz, vt, px, py, pz, m, q);
+};
+
+/// One cluster. Cells and truth rows are stored consecutively in the same
+/// order as the hits; the counts define which rows belong to which hit.
+struct BinaryHitData {
+  /// Hit surface identifier. The table is sorted by it.
+  uint64_t geometry_id = 0u;
+  /// Local hit position in mm and hit time in ns.
+  float loc0 = 0.0f, loc1 = 0.0f, t = 0.0f;
+  /// Number of associated rows in the cells and truth tables.
+  uint32_t num_cells = 0u;
+  uint32_t num_truths = 0u;
+
+  DFE_NAMEDTUPLE(BinaryHitData, geometry_id, loc0, loc1, t, num_cells,
+                 num_truths);
+};
+
+struct BinaryCellData {
+  /// Digital cell address/ channel identifier.
+  int32_t channel0 = 0, channel1 = 0;
+  /// Measured cell value.
+  float value = 0.0f;
+
+  DFE_NAMEDTUPLE(BinaryCellData, channel0, channel1, value);
+};
+
+struct BinaryTruthHitData {
+  /// Surface identifier and generating particle identifier.
+  uint64_t geometry_id = 0u;
+  uint64_t particle_id = 0u;
+  /// True global hit four-position in mm and ns.
+  float tx = 0.0f, ty = 0.0f, tz = 0.0f, tt = 0.0f;
+  /// True particle four-momentum in GeV before interaction.
+  float tpx = 0.0f, tpy = 0.0f, tpz = 0.0f, te = 0.0f;
+  /// True four-momentum change in GeV due to interaction.
+  float deltapx = 0.0f, deltapy = 0.0f, deltapz = 0.0f, deltae = 0.0f;
+  /// Hit index along the trajectory.
+  int32_t index = -1;
+
+  DFE_NAMEDTUPLE(BinaryTruthHitData, geometry_id, particle_id, tx, ty, tz, tt,
+                 tpx, tpy, tpz, te, deltapx, deltapy, deltapz, deltae, index);
+};
+
+}  // namespace FW
@@ -0,0 +1,143 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ACTFW/Io/Binary/BinaryMaterialDecorator.hpp"
+
+#include <Acts/Geometry/TrackingVolume.hpp>
+#include <Acts/Material/BinnedSurfaceMaterial.hpp>
+#include <Acts/Material/HomogeneousSurfaceMaterial.hpp>
+#include <Acts/Surfaces/Surface.hpp>
+#include <Acts/Utilities/BinUtility.hpp>
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "ACTFW/Io/Binary/MappedFile.hpp"
+#include "BinaryMaterialFormat.hpp"
+
+FW::BinaryMaterialDecorator::BinaryMaterialDecorator(
+    const FW::BinaryMaterialDecorator::Config& cfg, Acts::Logging::Level lvl)
+    : m_cfg(cfg),
+      m_logger(Acts::getDefaultLogger("BinaryMaterialDecorator", lvl)) {
+  if (m_cfg.fileName.empty()) {
+    throw std::invalid_argument("Missing file name");
+  }
+
+  size_t fileSize = 0u;
+  std::shared_ptr<const char> mapping =
+      detail::mapFile(m_cfg.fileName, fileSize);
+
+  // validate the layout before accessing any data
+  detail::MaterialMapHeader header;
+  if (fileSize < sizeof(header)) {
+    throw std::runtime_error("Material map '" + m_cfg.fileName +
+                             "' is truncated");
+  }
+  std::memcpy(&header, mapping.get(), sizeof(header));
+  if (std::memcmp(header.magic, detail::kMaterialMapMagic,
+                  sizeof(header.magic)) != 0) {
+    throw std::runtime_error("File '" + m_cfg.fileName +
+                             "' is not a material map");
+  }
+  if (not detail::isLittleEndian()) {
+    throw std::runtime_error("Material maps require a little-endian platform");
+  }
+  if (header.propertiesSize != sizeof(detail::MaterialMapProperties)) {
+    throw std::runtime_error("Material map '" + m_cfg.fileName +
+                             "' has an incompatible properties record");
+  }
+  const size_t dataOffset = detail::materialMapDataOffset(header.numSurfaces);
+  if (fileSize < dataOffset + header.numProperties *
+                                  sizeof(detail::MaterialMapProperties)) {
+    throw std::runtime_error("Material map '" + m_cfg.fileName +
+                             "' is truncated");
+  }
+
+  // the data offset is aligned and the mapping starts at a page boundary
+  const auto* surfaces = reinterpret_cast<const detail::MaterialMapSurface*>(
+      mapping.get() + sizeof(header));
+  const auto* records = reinterpret_cast<const detail::MaterialMapProperties*>(
+      mapping.get() + dataOffset);
+
+  // use the records in place if possible, otherwise convert them once
+  std::shared_ptr<const Acts::MaterialProperties> properties;
+  if (m_cfg.useRecordsInPlace and detail::isMaterialPropertiesLayout()) {
+    properties = std::shared_ptr<const Acts::MaterialProperties>(
+        mapping, reinterpret_cast<const Acts::MaterialProperties*>(records));
+  } else {
+    ACTS_DEBUG("Convert the material properties records");
+    auto converted = std::make_shared<std::vector<Acts::MaterialProperties>>();
+    converted->reserve(header.numProperties);
+    for (size_t i = 0; i < header.numProperties; ++i) {
+      converted->push_back(detail::decodeMaterialProperties(records[i]));
+    }
+    properties = std::shared_ptr<const Acts::MaterialProperties>(
+        converted, converted->data());
+  }
+  for (size_t i = 0; i < header.numSurfaces; ++i) {
+    const detail::MaterialMapSurface& surface = surfaces[i];
+    const Acts::GeometryID geoId(surface.geometryId);
+
+    Acts::BinUtility binUtility;
+    for (size_t d = 0; d < std::min(surface.numDimensions, 2u); ++d) {
+      const detail::MaterialMapBinning& binning = surface.binning[d];
+      binUtility += Acts::BinUtility(
+          binning.bins, binning.min, binning.max,
+          static_cast<Acts::BinningOption>(binning.option),
+          static_cast<Acts::BinningValue>(binning.value));
+    }
+    const size_t numBins = binUtility.bins(0) * binUtility.bins(1);
+    if ((2u < surface.numDimensions) or
+        (header.numProperties < surface.firstProperties + numBins)) {
+      throw std::runtime_error("Material map '" + m_cfg.fileName +
+                               "' has an invalid entry for surface " +
+                               std::to_string(surface.geometryId));
+    }
+
+    const Acts::MaterialProperties* first =
+        properties.get() + surface.firstProperties;
+    std::shared_ptr<const Acts::ISurfaceMaterial> sMaterial;
+    if (surface.numDimensions == 0u) {
+      sMaterial = std::make_shared<const Acts::HomogeneousSurfaceMaterial>(
+          *first, surface.splitFactor);
+    } else {
+      // share ownership of the properties storage; nothing is copied
+      std::shared_ptr<const Acts::MaterialProperties> shared(properties,
+                                                             first);
+      sMaterial = std::make_shared<const Acts::BinnedSurfaceMaterial>(
+          binUtility, std::move(shared), surface.splitFactor);
+    }
+    m_surfaceMaterialMap.emplace_hint(m_surfaceMaterialMap.end(), geoId,
+                                      std::move(sMaterial));
+  }
+
+  ACTS_INFO("Mapped material for " << m_surfaceMaterialMap.size()
+                                   << " surfaces with " << header.numProperties
+                                   << " bins from '" << m_cfg.fileName << "'");
+}
+
+void FW::BinaryMaterialDecorator::decorate(Acts::Surface& surface) const {
+  // Clear the material if registered to do so
+  if (m_cfg.clearSurfaceMaterial) {
+    surface.assignSurfaceMaterial(nullptr);
+  }
+  // Try to find the surface in the map
+  auto sMaterial = m_surfaceMaterialMap.find(surface.geoID());
+  if (sMaterial != m_surfaceMaterialMap.end()) {
+    surface.assignSurfaceMaterial(sMaterial->second);
+  }
+}
+
+void FW::BinaryMaterialDecorator::decorate(Acts::TrackingVolume& volume) const {
+  // Clear the material if registered to do so
+  if (m_cfg.clearVolumeMaterial) {
+    volume.assignVolumeMaterial(nullptr);
+  }
+}
@@ -0,0 +1,144 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+/// @file
+/// @brief Fixed-size records of the binary material map format
+///
+/// A material map file contains, in order
+///
+/// 1. a `MaterialMapHeader`,
+/// 2. one `MaterialMapSurface` per surface, sorted by geometry identifier,
+/// 3. zero padding up to the next 64 byte boundary,
+/// 4. a flat array of `MaterialMapProperties` records.
+///
+/// The properties of a binned surface are stored contiguously with the bin
+/// along the first dimension running fastest. Homogeneous material uses zero
+/// binning dimensions and a single properties entry. All integers are
+/// little-endian and all floats are little-endian IEEE-754 single precision.
+///
+/// The properties record is defined by this format, not by the in-memory
+/// layout of `Acts::MaterialProperties`. The reader references the records
+/// without copying only if both layouts agree, and converts them otherwise.
+
+#pragma once
+
+#include <Acts/Material/MaterialProperties.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace FW {
+namespace detail {
+
+struct MaterialMapHeader {
+  char magic[8];
+  uint32_t numSurfaces;
+  /// Size of a single `MaterialMapProperties` record.
+  uint32_t propertiesSize;
+  /// Total number of material properties records.
+  uint64_t numProperties;
+};
+/// Equidistant binning along one dimension, see `Acts::BinningData`.
+struct MaterialMapBinning {
+  int32_t value;
+  int32_t option;
+  uint32_t bins;
+  float min;
+  float max;
+};
+struct MaterialMapSurface {
+  uint64_t geometryId;
+  /// Index of the first material properties entry of this surface.
+  uint64_t firstProperties;
+  float splitFactor;
+  /// Number of binning dimensions; zero for homogeneous material.
+  uint32_t numDimensions;
+  MaterialMapBinning binning[2];
+};
+/// Material properties of one bin.
+///
+/// The last two fields are the thickness in units of X0 and L0. They are
+/// derived from the others and stored for the layout of the in-memory
+/// `Acts::MaterialProperties`; the conversion recomputes them.
+struct MaterialMapProperties {
+  float X0;
+  float L0;
+  float Ar;
+  float Z;
+  float rho;
+  float thickness;
+  float thicknessInX0;
+  float thicknessInL0;
+};
+static_assert(sizeof(MaterialMapHeader) == 24u, "Unexpected header padding");
+static_assert(sizeof(MaterialMapBinning) == 20u,
+              "Unexpected binning padding");
+static_assert(sizeof(MaterialMapSurface) == 64u,
+              "Unexpected surface padding");
+static_assert(sizeof(MaterialMapProperties) == 32u,
+              "Unexpected properties padding");
+
+constexpr char kMaterialMapMagic[8] = {'A', 'C', 'T', 'S', 'M', 'A', 'P', '2'};
+constexpr size_t kMaterialMapAlignment = 64u;
+
+/// Offset of the material properties array.
+constexpr size_t materialMapDataOffset(size_t numSurfaces) {
+  return (sizeof(MaterialMapHeader) + numSurfaces * sizeof(MaterialMapSurface) +
+          kMaterialMapAlignment - 1u) /
+         kMaterialMapAlignment * kMaterialMapAlignment;
+}
+
+/// Whether the platform stores integers and floats little-endian.
+inline bool isLittleEndian() {
+  const uint32_t one = 1u;
+  unsigned char lowByte = 0;
+  std::memcpy(&lowByte, &one, 1u);
+  return (lowByte == 1u);
+}
+
+/// Convert material properties into a record.
+inline MaterialMapProperties encodeMaterialProperties(
+    const Acts::MaterialProperties& properties) {
+  const Acts::Material& material = properties.material();
+  MaterialMapProperties record;
+  record.X0 = material.X0();
+  record.L0 = material.L0();
+  record.Ar = material.Ar();
+  record.Z = material.Z();
+  record.rho = material.massDensity();
+  record.thickness = properties.thickness();
+  record.thicknessInX0 = properties.thicknessInX0();
+  record.thicknessInL0 = properties.thicknessInL0();
+  return record;
+}
+
+/// Convert a record into material properties.
+inline Acts::MaterialProperties decodeMaterialProperties(
+    const MaterialMapProperties& record) {
+  return Acts::MaterialProperties(record.X0, record.L0, record.Ar, record.Z,
+                                  record.rho, record.thickness);
+}
+
+/// Whether records can be used as `Acts::MaterialProperties` in place.
+///
+/// The layouts are compared through the bytes of a probe object and its
+/// record on a little-endian platform.
+inline bool isMaterialPropertiesLayout() {
+  if ((sizeof(Acts::MaterialProperties) != sizeof(MaterialMapProperties)) or
+      (not std::is_trivially_copyable_v<Acts::MaterialProperties>) or
+      (not isLittleEndian())) {
+    return false;
+  }
+  const Acts::MaterialProperties probe(1.f, 2.f, 3.f, 4.f, 5.f, 6.f);
+  const MaterialMapProperties record = encodeMaterialProperties(probe);
+  return (std::memcmp(&probe, &record, sizeof(record)) == 0);
+}
+
+}  // namespace detail
+}  // namespace FW
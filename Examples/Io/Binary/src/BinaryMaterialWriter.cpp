@@ -0,0 +1,119 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ACTFW/Io/Binary/BinaryMaterialWriter.hpp"
+
+#include <Acts/Material/BinnedSurfaceMaterial.hpp>
+#include <Acts/Material/HomogeneousSurfaceMaterial.hpp>
+#include <Acts/Material/ISurfaceMaterial.hpp>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+#include "BinaryMaterialFormat.hpp"
+
+FW::BinaryMaterialWriter::BinaryMaterialWriter(
+    const FW::BinaryMaterialWriter::Config& cfg, Acts::Logging::Level lvl)
+    : m_cfg(cfg),
+      m_logger(Acts::getDefaultLogger("BinaryMaterialWriter", lvl)) {
+  if (m_cfg.fileName.empty()) {
+    throw std::invalid_argument("Missing file name");
+  }
+}
+
+void FW::BinaryMaterialWriter::write(
+    const Acts::DetectorMaterialMaps& detMaterial) {
+  // the records are written in the native byte order
+  if (not detail::isLittleEndian()) {
+    throw std::runtime_error("Material maps require a little-endian platform");
+  }
+  std::vector<detail::MaterialMapSurface> surfaces;
+  std::vector<detail::MaterialMapProperties> properties;
+
+  // the surface map is ordered by geometry identifier
+  for (const auto& [geoId, sMaterial] : detMaterial.first) {
+    detail::MaterialMapSurface surface;
+    std::memset(&surface, 0, sizeof(surface));
+    surface.geometryId = geoId.value();
+    surface.firstProperties = properties.size();
+    surface.splitFactor = sMaterial->factor(Acts::forward, Acts::postUpdate);
+
+    auto hsm =
+        dynamic_cast<const Acts::HomogeneousSurfaceMaterial*>(sMaterial.get());
+    auto bsm =
+        dynamic_cast<const Acts::BinnedSurfaceMaterial*>(sMaterial.get());
+    if (hsm != nullptr) {
+      surface.numDimensions = 0u;
+      properties.push_back(
+          detail::encodeMaterialProperties(hsm->materialProperties(0, 0)));
+    } else if (bsm != nullptr) {
+      const auto& binningData = bsm->binUtility().binningData();
+      bool supported = (binningData.size() <= 2u);
+      for (const auto& bData : binningData) {
+        supported = supported and (bData.type == Acts::equidistant) and
+                    (bData.subBinningData == nullptr);
+      }
+      if (not supported) {
+        ACTS_WARNING("Skip surface " << geoId
+                                     << " with unsupported material binning");
+        continue;
+      }
+      surface.numDimensions = binningData.size();
+      for (size_t i = 0; i < binningData.size(); ++i) {
+        surface.binning[i].value = binningData[i].binvalue;
+        surface.binning[i].option = binningData[i].option;
+        surface.binning[i].bins = binningData[i].bins();
+        surface.binning[i].min = binningData[i].min;
+        surface.binning[i].max = binningData[i].max;
+      }
+      const size_t bins0 = bsm->binUtility().bins(0);
+      const size_t bins1 = bsm->binUtility().bins(1);
+      for (size_t bin1 = 0; bin1 < bins1; ++bin1) {
+        for (size_t bin0 = 0; bin0 < bins0; ++bin0) {
+          properties.push_back(detail::encodeMaterialProperties(
+              bsm->materialProperties(bin0, bin1)));
+        }
+      }
+    } else {
+      ACTS_WARNING("Skip surface " << geoId
+                                   << " with unsupported material type");
+      continue;
+    }
+    surfaces.push_back(surface);
+  }
+  if (not detMaterial.second.empty()) {
+    ACTS_WARNING("Skip " << detMaterial.second.size()
+                         << " volume material entries");
+  }
+
+  detail::MaterialMapHeader header;
+  std::memcpy(header.magic, detail::kMaterialMapMagic, sizeof(header.magic));
+  header.numSurfaces = surfaces.size();
+  header.propertiesSize = sizeof(detail::MaterialMapProperties);
+  header.numProperties = properties.size();
+
+  std::ofstream file;
+  file.exceptions(std::ofstream::badbit | std::ofstream::failbit);
+  file.open(m_cfg.fileName, std::ios_base::binary | std::ios_base::out |
+                                std::ios_base::trunc);
+  file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  file.write(reinterpret_cast<const char*>(surfaces.data()),
+             surfaces.size() * sizeof(detail::MaterialMapSurface));
+  const size_t padding = detail::materialMapDataOffset(surfaces.size()) -
+                         sizeof(header) -
+                         surfaces.size() * sizeof(detail::MaterialMapSurface);
+  const char zeros[detail::kMaterialMapAlignment] = {};
+  file.write(zeros, padding);
+  file.write(reinterpret_cast<const char*>(properties.data()),
+             properties.size() * sizeof(detail::MaterialMapProperties));
+
+  ACTS_INFO("Wrote material for " << surfaces.size() << " surfaces with "
+                                  << properties.size() << " bins to '"
+                                  << m_cfg.fileName << "'");
+}
@@ -0,0 +1,86 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ACTFW/Io/Binary/BinaryParticleReader.hpp"
+
+#include <Acts/Utilities/Units.hpp>
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <stdexcept>
+#include <vector>
+
+#include "ACTFW/EventData/SimParticle.hpp"
+#include "ACTFW/Framework/WhiteBoard.hpp"
+#include "ACTFW/Io/Binary/ColumnarTable.hpp"
+#include "ACTFW/Utilities/Paths.hpp"
+#include "BinaryEventData.hpp"
+
+FW::BinaryParticleReader::BinaryParticleReader(
+    const FW::BinaryParticleReader::Config& cfg, Acts::Logging::Level lvl)
+    : m_cfg(cfg),
+      m_eventsRange(
+          determineEventFilesRange(cfg.inputDir, cfg.inputStem + ".bin")),
+      m_logger(Acts::getDefaultLogger("BinaryParticleReader", lvl)) {
+  if (m_cfg.inputStem.empty()) {
+    throw std::invalid_argument("Missing input filename stem");
+  }
+  if (m_cfg.outputParticles.empty()) {
+    throw std::invalid_argument("Missing output collection");
+  }
+}
+
+std::string FW::BinaryParticleReader::name() const {
+  return "BinaryParticleReader";
+}
+
+std::pair<size_t, size_t> FW::BinaryParticleReader::availableEvents() const {
+  return m_eventsRange;
+}
+
+FW::ProcessCode FW::BinaryParticleReader::read(
+    const FW::AlgorithmContext& ctx) {
+  MappedColumnarTable<BinaryParticleData> rows(perEventFilepath(
+      m_cfg.inputDir, m_cfg.inputStem + ".bin", ctx.eventNumber));
+
+  // the writer stores the particles in container order, i.e. strictly
+  // ordered by particle identifier
+  const uint64_t* ids = rows.column<0>();
+  if (std::adjacent_find(ids, ids + rows.size(), std::greater_equal<>()) !=
+      (ids + rows.size())) {
+    ACTS_FATAL("Particles in event " << ctx.eventNumber << " are not sorted");
+    return ProcessCode::ABORT;
+  }
+
+  SimParticleContainer::sequence_type ordered;
+  ordered.reserve(rows.size());
+  for (size_t row = 0; row < rows.size(); ++row) {
+    const BinaryParticleData data = rows.record(row);
+    ActsFatras::Particle particle(ActsFatras::Barcode(data.particle_id),
+                                  Acts::PdgParticle(data.particle_type),
+                                  data.q * Acts::UnitConstants::e,
+                                  data.m * Acts::UnitConstants::GeV);
+    particle.setProcess(static_cast<ActsFatras::ProcessType>(data.process));
+    particle.setPosition4(
+        data.vx * Acts::UnitConstants::mm, data.vy * Acts::UnitConstants::mm,
+        data.vz * Acts::UnitConstants::mm, data.vt * Acts::UnitConstants::ns);
+    // only used for direction; normalization/units do not matter
+    particle.setDirection(data.px, data.py, data.pz);
+    particle.setAbsMomentum(std::hypot(data.px, data.py, data.pz) *
+                            Acts::UnitConstants::GeV);
+    ordered.push_back(std::move(particle));
+  }
+
+  // write ordered particles container to the EventStore
+  SimParticleContainer particles;
+  particles.adopt_sequence(boost::container::ordered_unique_range,
+                           std::move(ordered));
+  ctx.eventStore.add(m_cfg.outputParticles, std::move(particles));
+
+  return ProcessCode::SUCCESS;
+}
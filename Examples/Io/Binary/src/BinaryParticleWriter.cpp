@@ -0,0 +1,56 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ACTFW/Io/Binary/BinaryParticleWriter.hpp"
+
+#include <Acts/Utilities/Units.hpp>
+#include <stdexcept>
+#include <vector>
+
+#include "ACTFW/Framework/WhiteBoard.hpp"
+#include "ACTFW/Io/Binary/ColumnarTable.hpp"
+#include "ACTFW/Utilities/Paths.hpp"
+#include "BinaryEventData.hpp"
+
+FW::BinaryParticleWriter::BinaryParticleWriter(
+    const FW::BinaryParticleWriter::Config& cfg, Acts::Logging::Level lvl)
+    : WriterT(cfg.inputParticles, "BinaryParticleWriter", lvl), m_cfg(cfg) {
+  // inputParticles is already checked by base constructor
+  if (m_cfg.outputStem.empty()) {
+    throw std::invalid_argument("Missing ouput filename stem");
+  }
+}
+
+FW::ProcessCode FW::BinaryParticleWriter::writeT(
+    const FW::AlgorithmContext& ctx, const SimParticleContainer& particles) {
+  std::vector<BinaryParticleData> rows(particles.size());
+
+  auto row = rows.begin();
+  for (const auto& particle : particles) {
+    row->particle_id = particle.particleId().value();
+    row->particle_type = particle.pdg();
+    row->process = static_cast<decltype(row->process)>(particle.process());
+    row->vx = particle.position().x() / Acts::UnitConstants::mm;
+    row->vy = particle.position().y() / Acts::UnitConstants::mm;
+    row->vz = particle.position().z() / Acts::UnitConstants::mm;
+    row->vt = particle.time() / Acts::UnitConstants::ns;
+    const auto p = particle.absMomentum() / Acts::UnitConstants::GeV;
+    row->px = p * particle.unitDirection().x();
+    row->py = p * particle.unitDirection().y();
+    row->pz = p * particle.unitDirection().z();
+    row->m = particle.mass() / Acts::UnitConstants::GeV;
+    row->q = particle.charge() / Acts::UnitConstants::e;
+    ++row;
+  }
+
+  writeColumnarTable(perEventFilepath(m_cfg.outputDir,
+                                      m_cfg.outputStem + ".bin",
+                                      ctx.eventNumber),
+                     rows);
+  return ProcessCode::SUCCESS;
+}
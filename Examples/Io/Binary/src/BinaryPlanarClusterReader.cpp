@@ -0,0 +1,184 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ACTFW/Io/Binary/BinaryPlanarClusterReader.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+#include "ACTFW/EventData/GeometryContainers.hpp"
+#include "ACTFW/EventData/IndexContainers.hpp"
+#include "ACTFW/EventData/SimHit.hpp"
+#include "ACTFW/EventData/SimIdentifier.hpp"
+#include "ACTFW/Framework/WhiteBoard.hpp"
+#include "ACTFW/Io/Binary/ColumnarTable.hpp"
+#include "ACTFW/Utilities/Paths.hpp"
+#include "Acts/Plugins/Digitization/PlanarModuleCluster.hpp"
+#include "Acts/Utilities/Units.hpp"
+#include "BinaryEventData.hpp"
+
+FW::BinaryPlanarClusterReader::BinaryPlanarClusterReader(
+    const FW::BinaryPlanarClusterReader::Config& cfg, Acts::Logging::Level lvl)
+    : m_cfg(cfg),
+      m_eventsRange(determineEventFilesRange(cfg.inputDir, "hits.bin")),
+      m_logger(Acts::getDefaultLogger("BinaryPlanarClusterReader", lvl)) {
+  if (m_cfg.outputClusters.empty()) {
+    throw std::invalid_argument("Missing cluster output collection");
+  }
+  if (m_cfg.outputHitIds.empty()) {
+    throw std::invalid_argument("Missing hit id output collection");
+  }
+  if (m_cfg.outputHitParticlesMap.empty()) {
+    throw std::invalid_argument("Missing hit-particles map output collection");
+  }
+  if (m_cfg.outputSimulatedHits.empty()) {
+    throw std::invalid_argument("Missing simulated hits output collection");
+  }
+  if (not m_cfg.trackingGeometry) {
+    throw std::invalid_argument("Missing tracking geometry");
+  }
+}
+
+std::string FW::BinaryPlanarClusterReader::name() const {
+  return "BinaryPlanarClusterReader";
+}
+
+std::pair<size_t, size_t> FW::BinaryPlanarClusterReader::availableEvents()
+    const {
+  return m_eventsRange;
+}
+
+FW::ProcessCode FW::BinaryPlanarClusterReader::read(
+    const FW::AlgorithmContext& ctx) {
+  MappedColumnarTable<BinaryHitData> hits(
+      perEventFilepath(m_cfg.inputDir, "hits.bin", ctx.eventNumber));
+  MappedColumnarTable<BinaryCellData> cells(
+      perEventFilepath(m_cfg.inputDir, "cells.bin", ctx.eventNumber));
+  MappedColumnarTable<BinaryTruthHitData> truths(
+      perEventFilepath(m_cfg.inputDir, "truth.bin", ctx.eventNumber));
+
+  // the per-hit counts must cover the associated tables exactly
+  const uint32_t* hitNumCells = hits.column<4>();
+  const uint32_t* hitNumTruths = hits.column<5>();
+  size_t numCells = 0u;
+  size_t numTruths = 0u;
+  for (size_t hitIndex = 0; hitIndex < hits.size(); ++hitIndex) {
+    numCells += hitNumCells[hitIndex];
+    numTruths += hitNumTruths[hitIndex];
+  }
+  if ((numCells != cells.size()) or (numTruths != truths.size())) {
+    ACTS_FATAL("Inconsistent cells/truth tables in event " << ctx.eventNumber);
+    return ProcessCode::ABORT;
+  }
+  // the stored ordering is only validated; sorting would invalidate the
+  // simulated hit indices stored in the clusters.
+  const uint64_t* hitGeoIds = hits.column<0>();
+  const uint64_t* truthGeoIds = truths.column<0>();
+  if (not std::is_sorted(hitGeoIds, hitGeoIds + hits.size()) or
+      not std::is_sorted(truthGeoIds, truthGeoIds + truths.size())) {
+    ACTS_FATAL("Hits in event " << ctx.eventNumber
+                                << " are not sorted by geometry id");
+    return ProcessCode::ABORT;
+  }
+
+  // all containers are filled in stored order. hits, and thus the truth
+  // information attached to them, are already sorted by geometry id and the
+  // resulting sequences can be adopted directly.
+  GeometryIdMultimap<Acts::PlanarModuleCluster>::sequence_type clusters;
+  std::vector<uint64_t> hitIds;
+  IndexMultimap<ActsFatras::Barcode>::sequence_type hitParticles;
+  SimHitContainer::sequence_type simHits;
+  clusters.reserve(hits.size());
+  hitIds.reserve(hits.size());
+  hitParticles.reserve(truths.size());
+  simHits.reserve(truths.size());
+
+  size_t cell = 0u;
+  size_t truth = 0u;
+  const Acts::Surface* surface = nullptr;
+  for (size_t hitIndex = 0; hitIndex < hits.size(); ++hitIndex) {
+    const BinaryHitData hit = hits.record(hitIndex);
+    const Acts::GeometryID geoId(hit.geometry_id);
+
+    std::vector<std::size_t> simHitIndices;
+    simHitIndices.reserve(hit.num_truths);
+    for (auto end = truth + hit.num_truths; truth != end; ++truth) {
+      const BinaryTruthHitData data = truths.record(truth);
+      ActsFatras::Hit::Vector4 simPos4{
+          data.tx * Acts::UnitConstants::mm,
+          data.ty * Acts::UnitConstants::mm,
+          data.tz * Acts::UnitConstants::mm,
+          data.tt * Acts::UnitConstants::ns,
+      };
+      ActsFatras::Hit::Vector4 simMom4{
+          data.tpx * Acts::UnitConstants::GeV,
+          data.tpy * Acts::UnitConstants::GeV,
+          data.tpz * Acts::UnitConstants::GeV,
+          data.te * Acts::UnitConstants::GeV,
+      };
+      ActsFatras::Hit::Vector4 simDelta4{
+          data.deltapx * Acts::UnitConstants::GeV,
+          data.deltapy * Acts::UnitConstants::GeV,
+          data.deltapz * Acts::UnitConstants::GeV,
+          data.deltae * Acts::UnitConstants::GeV,
+      };
+      simHitIndices.push_back(simHits.size());
+      simHits.emplace_back(Acts::GeometryID(data.geometry_id),
+                           ActsFatras::Barcode(data.particle_id), simPos4,
+                           simMom4, simMom4 + simDelta4, data.index);
+      hitParticles.emplace_back(hitIndex,
+                                ActsFatras::Barcode(data.particle_id));
+    }
+
+    std::vector<Acts::DigitizationCell> digitizationCells;
+    digitizationCells.reserve(hit.num_cells);
+    for (auto end = cell + hit.num_cells; cell != end; ++cell) {
+      const BinaryCellData data = cells.record(cell);
+      digitizationCells.emplace_back(data.channel0, data.channel1, data.value);
+    }
+
+    // consecutive hits are mostly on the same surface
+    if ((surface == nullptr) or (surface->geoID() != geoId)) {
+      surface = m_cfg.trackingGeometry->findSurface(geoId);
+      if (surface == nullptr) {
+        ACTS_FATAL("Could not retrieve the surface for hit " << hitIndex);
+        return ProcessCode::ABORT;
+      }
+    }
+
+    // the format stores no uncertainty, same as the csv cluster reader
+    Acts::ActsSymMatrixD<3> cov = Acts::ActsSymMatrixD<3>::Identity();
+    Acts::PlanarModuleCluster cluster(
+        surface->getSharedPtr(),
+        Identifier(identifier_type(geoId.value()), std::move(simHitIndices)),
+        std::move(cov), hit.loc0 * Acts::UnitConstants::mm,
+        hit.loc1 * Acts::UnitConstants::mm, hit.t * Acts::UnitConstants::ns,
+        std::move(digitizationCells));
+    clusters.emplace_back(geoId, std::move(cluster));
+    hitIds.push_back(hitIndex);
+  }
+
+  GeometryIdMultimap<Acts::PlanarModuleCluster> clusterContainer;
+  clusterContainer.adopt_sequence(boost::container::ordered_range,
+                                  std::move(clusters));
+  IndexMultimap<ActsFatras::Barcode> hitParticlesMap;
+  hitParticlesMap.adopt_sequence(boost::container::ordered_range,
+                                 std::move(hitParticles));
+  SimHitContainer simHitContainer;
+  simHitContainer.adopt_sequence(boost::container::ordered_range,
+                                 std::move(simHits));
+
+  // write the data to the EventStore
+  ctx.eventStore.add(m_cfg.outputClusters, std::move(clusterContainer));
+  ctx.eventStore.add(m_cfg.outputHitIds, std::move(hitIds));
+  ctx.eventStore.add(m_cfg.outputHitParticlesMap, std::move(hitParticlesMap));
+  ctx.eventStore.add(m_cfg.outputSimulatedHits, std::move(simHitContainer));
+
+  return FW::ProcessCode::SUCCESS;
+}
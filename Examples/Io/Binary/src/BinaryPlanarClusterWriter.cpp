@@ -0,0 +1,105 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ACTFW/Io/Binary/BinaryPlanarClusterWriter.hpp"
+
+#include <stdexcept>
+#include <vector>
+
+#include "ACTFW/EventData/SimHit.hpp"
+#include "ACTFW/EventData/SimIdentifier.hpp"
+#include "ACTFW/Framework/WhiteBoard.hpp"
+#include "ACTFW/Io/Binary/ColumnarTable.hpp"
+#include "ACTFW/Utilities/Paths.hpp"
+#include "Acts/Plugins/Digitization/PlanarModuleCluster.hpp"
+#include "Acts/Utilities/Units.hpp"
+#include "BinaryEventData.hpp"
+
+FW::BinaryPlanarClusterWriter::BinaryPlanarClusterWriter(
+    const FW::BinaryPlanarClusterWriter::Config& cfg, Acts::Logging::Level lvl)
+    : WriterT(cfg.inputClusters, "BinaryPlanarClusterWriter", lvl),
+      m_cfg(cfg) {
+  // inputClusters is already checked by base constructor
+  if (m_cfg.inputSimulatedHits.empty()) {
+    throw std::invalid_argument("Missing simulated hits input collection");
+  }
+}
+
+FW::ProcessCode FW::BinaryPlanarClusterWriter::writeT(
+    const AlgorithmContext& ctx,
+    const FW::GeometryIdMultimap<Acts::PlanarModuleCluster>& clusters) {
+  // retrieve simulated hits
+  const auto& simHits =
+      ctx.eventStore.get<SimHitContainer>(m_cfg.inputSimulatedHits);
+
+  std::vector<BinaryHitData> hits;
+  std::vector<BinaryCellData> cells;
+  std::vector<BinaryTruthHitData> truths;
+  hits.reserve(clusters.size());
+  cells.reserve(clusters.size());
+  truths.reserve(clusters.size());
+
+  for (const auto& entry : clusters) {
+    const Acts::PlanarModuleCluster& cluster = entry.second;
+    const auto& parameters = cluster.parameters();
+
+    BinaryHitData hit;
+    hit.geometry_id = entry.first.value();
+    hit.loc0 = parameters[0] / Acts::UnitConstants::mm;
+    hit.loc1 = parameters[1] / Acts::UnitConstants::mm;
+    hit.t = parameters[2] / Acts::UnitConstants::ns;
+    hit.num_cells = cluster.digitizationCells().size();
+    hit.num_truths = cluster.sourceLink().indices().size();
+    hits.push_back(hit);
+
+    for (const auto& c : cluster.digitizationCells()) {
+      BinaryCellData cell;
+      cell.channel0 = c.channel0;
+      cell.channel1 = c.channel1;
+      cell.value = c.data;
+      cells.push_back(cell);
+    }
+
+    // each hit can have multiple particles, e.g. in a dense environment
+    for (auto idx : cluster.sourceLink().indices()) {
+      auto it = simHits.nth(idx);
+      if (it == simHits.end()) {
+        ACTS_FATAL("Simulation hit with index " << idx << " does not exist");
+        return ProcessCode::ABORT;
+      }
+
+      const auto& simHit = *it;
+      BinaryTruthHitData truth;
+      truth.geometry_id = simHit.geometryId().value();
+      truth.particle_id = simHit.particleId().value();
+      truth.tx = simHit.position().x() / Acts::UnitConstants::mm;
+      truth.ty = simHit.position().y() / Acts::UnitConstants::mm;
+      truth.tz = simHit.position().z() / Acts::UnitConstants::mm;
+      truth.tt = simHit.time() / Acts::UnitConstants::ns;
+      truth.tpx = simHit.momentum4Before().x() / Acts::UnitConstants::GeV;
+      truth.tpy = simHit.momentum4Before().y() / Acts::UnitConstants::GeV;
+      truth.tpz = simHit.momentum4Before().z() / Acts::UnitConstants::GeV;
+      truth.te = simHit.momentum4Before().w() / Acts::UnitConstants::GeV;
+      const auto delta4 = simHit.momentum4After() - simHit.momentum4Before();
+      truth.deltapx = delta4.x() / Acts::UnitConstants::GeV;
+      truth.deltapy = delta4.y() / Acts::UnitConstants::GeV;
+      truth.deltapz = delta4.z() / Acts::UnitConstants::GeV;
+      truth.deltae = delta4.w() / Acts::UnitConstants::GeV;
+      truth.index = simHit.index();
+      truths.push_back(truth);
+    }
+  }
+
+  writeColumnarTable(
+      perEventFilepath(m_cfg.outputDir, "hits.bin", ctx.eventNumber), hits);
+  writeColumnarTable(
+      perEventFilepath(m_cfg.outputDir, "cells.bin", ctx.eventNumber), cells);
+  writeColumnarTable(
+      perEventFilepath(m_cfg.outputDir, "truth.bin", ctx.eventNumber), truths);
+  return FW::ProcessCode::SUCCESS;
+}
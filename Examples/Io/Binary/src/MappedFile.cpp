@@ -0,0 +1,42 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ACTFW/Io/Binary/MappedFile.hpp"
+
+#include <fcntl.h>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+std::shared_ptr<const char> FW::detail::mapFile(const std::string& path,
+                                                size_t& size) {
+  int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw std::runtime_error("Could not open '" + path + "'");
+  }
+  struct stat info;
+  if (::fstat(fd, &info) != 0) {
+    ::close(fd);
+    throw std::runtime_error("Could not stat '" + path + "'");
+  }
+  size = info.st_size;
+  if (size == 0u) {
+    ::close(fd);
+    throw std::runtime_error("File '" + path + "' is empty");
+  }
+  void* data = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+  // the mapping stays valid after closing the descriptor
+  ::close(fd);
+  if (data == MAP_FAILED) {
+    throw std::runtime_error("Could not map '" + path + "'");
+  }
+  return std::shared_ptr<const char>(
+      static_cast<const char*>(data),
+      [size](const char* ptr) { ::munmap(const_cast<char*>(ptr), size); });
+}
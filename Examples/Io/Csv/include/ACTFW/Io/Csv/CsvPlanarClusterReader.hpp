@@ -9,7 +9,6 @@
 
 #include <memory>
 #include <string>
-#include <unordered_map>
 
 #include "ACTFW/Framework/IReader.hpp"
 #include "Acts/Geometry/GeometryID.hpp"
@@ -69,7 +68,6 @@ class CsvPlanarClusterReader final : public IReader {
 
  private:
   Config m_cfg;
-  std::unordered_map<Acts::GeometryID, const Acts::Surface*> m_surfaces;
   std::pair<size_t, size_t> m_eventsRange;
   std::unique_ptr<const Acts::Logger> m_logger;
 
@@ -45,10 +45,6 @@ FW::CsvPlanarClusterReader::CsvPlanarClusterReader(
   if (not m_cfg.trackingGeometry) {
     throw std::invalid_argument("Missing tracking geometry");
   }
-  // fill the geo id to surface map once to speed up lookups later on
-  m_cfg.trackingGeometry->visitSurfaces([this](const Acts::Surface* surface) {
-    this->m_surfaces[surface->geoID()] = surface;
-  });
 }
 
 std::string FW::CsvPlanarClusterReader::CsvPlanarClusterReader::name() const {
@@ -232,12 +228,13 @@ FW::ProcessCode FW::CsvPlanarClusterReader::read(
     }
 
     // identify hit surface
-    auto it = m_surfaces.find(geoId);
-    if (it == m_surfaces.end() or not it->second) {
+    const Acts::Surface* surfacePtr =
+        m_cfg.trackingGeometry->findSurface(geoId);
+    if (surfacePtr == nullptr) {
       ACTS_FATAL("Could not retrieve the surface for hit " << hit);
       return ProcessCode::ABORT;
     }
-    const Acts::Surface& surface = *(it->second);
+    const Acts::Surface& surface = *surfacePtr;
 
     // transform global hit coordinates into local coordinates on the surface
     Acts::Vector3D pos(hit.x * Acts::UnitConstants::mm,
@@ -71,6 +71,9 @@ class RootMaterialTrackReader : public IReader {
   /// @param context The algorithm context
   ProcessCode read(const FW::AlgorithmContext& context) final override;
 
+  /// Reading entries from the input chain is sequential.
+  bool isThreadSafe() const final override { return false; }
+
  private:
   /// Private access to the logging instance
   const Acts::Logger& logger() const { return *m_cfg.logger; }
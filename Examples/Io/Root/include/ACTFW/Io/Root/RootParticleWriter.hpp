@@ -9,11 +9,13 @@
 #pragma once
 
 #include <cstdint>
+#include <memory>
 #include <mutex>
 #include <string>
 
 #include "ACTFW/EventData/SimParticle.hpp"
 #include "ACTFW/Framework/WriterT.hpp"
+#include "ACTFW/Io/Root/RootTreeSegments.hpp"
 
 class TFile;
 class TTree;
@@ -28,6 +30,8 @@ namespace FW {
 /// Safe to use from multiple writer threads. To avoid thread-saftey issues,
 /// the writer must be the sole owner of the underlying file. Thus, the
 /// output file pointer can not be given from the outside.
+///
+/// Optionally fills per-thread tree segments, see RootTreeSegments.
 class RootParticleWriter final : public WriterT<SimParticleContainer> {
  public:
   struct Config {
@@ -39,6 +43,8 @@ class RootParticleWriter final : public WriterT<SimParticleContainer> {
     std::string fileMode = "RECREATE";
     /// Name of the tree within the output file.
     std::string treeName = "particles";
+    /// Fill per-thread tree segments and merge them at the end of the run.
+    bool perThreadSegments = false;
   };
 
   /// Construct the particle writer.
@@ -62,41 +68,57 @@ class RootParticleWriter final : public WriterT<SimParticleContainer> {
                      const SimParticleContainer& particles) final override;
 
  private:
+  /// Branch variables for one output entry.
+  struct Entry {
+    /// Event identifier.
+    uint32_t eventId;
+    /// Event-unique particle identifier a.k.a barcode.
+    uint64_t particleId;
+    /// Particle type a.k.a. PDG particle number
+    int32_t particleType;
+    /// Production process type, i.e. what generated the particle.
+    uint32_t process;
+    /// Production position components in mm.
+    float vx, vy, vz;
+    // Production time in ns.
+    float vt;
+    /// Momentum components in GeV.
+    float px, py, pz;
+    /// Mass in GeV.
+    float m;
+    /// Charge in e.
+    float q;
+    // Derived kinematic quantities
+    /// Direction pseudo-rapidity.
+    float eta;
+    /// Direction angle in the transverse plane.
+    float phi;
+    /// Transverse momentum in GeV.
+    float pt;
+    // Decoded particle identifier; see Barcode definition for details.
+    uint32_t vertexPrimary;
+    uint32_t vertexSecondary;
+    uint32_t particle;
+    uint32_t generation;
+    uint32_t subParticle;
+  };
+
+  /// Create all branches of the tree and bind them to the entry.
+  static void setupBranches(TTree& tree, Entry& entry);
+  /// Fill the entries for the event and call the fill function for each.
+  template <typename fill_t>
+  ProcessCode writeEntries(const AlgorithmContext& ctx,
+                           const SimParticleContainer& particles, Entry& entry,
+                           fill_t&& fill) const;
+
   Config m_cfg;
   std::mutex m_writeMutex;
   TFile* m_outputFile = nullptr;
   TTree* m_outputTree = nullptr;
-  /// Event identifier.
-  uint32_t m_eventId;
-  /// Event-unique particle identifier a.k.a barcode.
-  uint64_t m_particleId;
-  /// Particle type a.k.a. PDG particle number
-  int32_t m_particleType;
-  /// Production process type, i.e. what generated the particle.
-  uint32_t m_process;
-  /// Production position components in mm.
-  float m_vx, m_vy, m_vz;
-  // Production time in ns.
-  float m_vt;
-  /// Momentum components in GeV.
-  float m_px, m_py, m_pz;
-  /// Mass in GeV.
-  float m_m;
-  /// Charge in e.
-  float m_q;
-  // Derived kinematic quantities
-  /// Direction pseudo-rapidity.
-  float m_eta;
-  /// Direction angle in the transverse plane.
-  float m_phi;
-  /// Transverse momentum in GeV.
-  float m_pt;
-  // Decoded particle identifier; see Barcode definition for details.
-  uint32_t m_vertexPrimary;
-  uint32_t m_vertexSecondary;
-  uint32_t m_particle;
-  uint32_t m_generation;
-  uint32_t m_subParticle;
+  /// Entry buffer for the output tree.
+  Entry m_entry;
+  /// Per-thread tree segments if enabled.
+  std::unique_ptr<RootTreeSegments<Entry>> m_segments;
 };
 
 }  // namespace FW
@@ -8,10 +8,12 @@
 
 #pragma once
 
+#include <memory>
 #include <mutex>
 
 #include "ACTFW/EventData/GeometryContainers.hpp"
 #include "ACTFW/Framework/WriterT.hpp"
+#include "ACTFW/Io/Root/RootTreeSegments.hpp"
 #include "Acts/Plugins/Digitization/PlanarModuleCluster.hpp"
 
 class TFile;
@@ -30,6 +32,8 @@ namespace FW {
 /// this is done by setting the Config::rootFile pointer to an existing file
 ///
 /// Safe to use from multiple writer threads - uses a std::mutex lock.
+///
+/// Optionally fills per-thread tree segments, see RootTreeSegments.
 class RootPlanarClusterWriter
     : public WriterT<GeometryIdMultimap<Acts::PlanarModuleCluster>> {
  public:
@@ -42,6 +46,8 @@ class RootPlanarClusterWriter
     std::string fileMode = "RECREATE";  ///< file access mode
     std::string treeName = "clusters";  ///< name of the output tree
     TFile* rootFile = nullptr;          ///< common root file
+    /// Fill per-thread tree segments and merge them at the end of the run.
+    bool perThreadSegments = false;
   };
 
   /// Constructor with
@@ -66,37 +72,54 @@ class RootPlanarClusterWriter
                          clusters) final override;
 
  private:
-  Config m_cfg;                    ///< the configuration object
-  std::mutex m_writeMutex;         ///< protect multi-threaded writes
-  TFile* m_outputFile;             ///< the output file
-  TTree* m_outputTree;             ///< the output tree
-  int m_eventNr;                   ///< the event number of
-  int m_volumeID;                  ///< volume identifier
-  int m_layerID;                   ///< layer identifier
-  int m_surfaceID;                 ///< surface identifier
-  float m_x;                       ///< global x
-  float m_y;                       ///< global y
-  float m_z;                       ///< global z
-  float m_t;                       ///< global t
-  float m_lx;                      ///< local lx
-  float m_ly;                      ///< local ly
-  float m_cov_lx;                  ///< local covariance lx
-  float m_cov_ly;                  ///< local covariance ly
-  std::vector<int> m_cell_IDx;     ///< cell ID in lx
-  std::vector<int> m_cell_IDy;     ///< cell ID in ly
-  std::vector<float> m_cell_lx;    ///< local cell position x
-  std::vector<float> m_cell_ly;    ///< local cell position y
-  std::vector<float> m_cell_data;  ///< local cell position y
+  /// Branch variables for one output entry.
+  struct Entry {
+    int eventNr;                   ///< the event number of
+    int volumeID;                  ///< volume identifier
+    int layerID;                   ///< layer identifier
+    int surfaceID;                 ///< surface identifier
+    float x;                       ///< global x
+    float y;                       ///< global y
+    float z;                       ///< global z
+    float t;                       ///< global t
+    float lx;                      ///< local lx
+    float ly;                      ///< local ly
+    float cov_lx;                  ///< local covariance lx
+    float cov_ly;                  ///< local covariance ly
+    std::vector<int> cell_IDx;     ///< cell ID in lx
+    std::vector<int> cell_IDy;     ///< cell ID in ly
+    std::vector<float> cell_lx;    ///< local cell position x
+    std::vector<float> cell_ly;    ///< local cell position y
+    std::vector<float> cell_data;  ///< local cell position y
+
+    // (optional) the truth position
+    std::vector<float> t_gx;  ///< truth position global x
+    std::vector<float> t_gy;  ///< truth position global y
+    std::vector<float> t_gz;  ///< truth position global z
+    std::vector<float> t_gt;  ///< truth time t
+    std::vector<float> t_lx;  ///< truth position local x
+    std::vector<float> t_ly;  ///< truth position local y
+    std::vector<unsigned long>
+        t_barcode;  ///< associated truth particle barcode
+  };
+
+  /// Create all branches of the tree and bind them to the entry.
+  static void setupBranches(TTree& tree, Entry& entry);
+  /// Fill the entries for the event and call the fill function for each.
+  template <typename fill_t>
+  ProcessCode writeEntries(
+      const AlgorithmContext& ctx,
+      const GeometryIdMultimap<Acts::PlanarModuleCluster>& clusters,
+      Entry& entry, fill_t&& fill) const;
 
-  // (optional) the truth position
-  std::vector<float> m_t_gx;  ///< truth position global x
-  std::vector<float> m_t_gy;  ///< truth position global y
-  std::vector<float> m_t_gz;  ///< truth position global z
-  std::vector<float> m_t_gt;  ///< truth time t
-  std::vector<float> m_t_lx;  ///< truth position local x
-  std::vector<float> m_t_ly;  ///< truth position local y
-  std::vector<unsigned long>
-      m_t_barcode;  ///< associated truth particle barcode
+  Config m_cfg;             ///< the configuration object
+  std::mutex m_writeMutex;  ///< protect multi-threaded writes
+  TFile* m_outputFile;      ///< the output file
+  TTree* m_outputTree;      ///< the output tree
+  /// Entry buffer for the output tree.
+  Entry m_entry;
+  /// Per-thread tree segments if enabled.
+  std::unique_ptr<RootTreeSegments<Entry>> m_segments;
 };
 
 }  // namespace FW
@@ -9,11 +9,13 @@
 #pragma once
 
 #include <cstdint>
+#include <memory>
 #include <mutex>
 #include <string>
 
 #include "ACTFW/EventData/SimHit.hpp"
 #include "ACTFW/Framework/WriterT.hpp"
+#include "ACTFW/Io/Root/RootTreeSegments.hpp"
 
 class TFile;
 class TTree;
@@ -28,6 +30,8 @@ namespace FW {
 /// Safe to use from multiple writer threads. To avoid thread-saftey issues,
 /// the writer must be the sole owner of the underlying file. Thus, the
 /// output file pointer can not be given from the outside.
+///
+/// Optionally fills per-thread tree segments, see RootTreeSegments.
 class RootSimHitWriter final : public WriterT<SimHitContainer> {
  public:
   struct Config {
@@ -39,6 +43,8 @@ class RootSimHitWriter final : public WriterT<SimHitContainer> {
     std::string fileMode = "RECREATE";
     /// Name of the tree within the output file.
     std::string treeName = "hits";
+    /// Fill per-thread tree segments and merge them at the end of the run.
+    bool perThreadSegments = false;
   };
 
   /// Construct the particle writer.
@@ -62,32 +68,48 @@ class RootSimHitWriter final : public WriterT<SimHitContainer> {
                      const SimHitContainer& hits) final override;
 
  private:
+  /// Branch variables for one output entry.
+  struct Entry {
+    /// Event identifier.
+    uint32_t eventId;
+    /// Hit surface identifier.
+    uint64_t geometryId;
+    /// Event-unique particle identifier a.k.a. barcode.
+    uint64_t particleId;
+    /// True global hit position components in mm.
+    float tx, ty, tz;
+    // True global hit time in ns.
+    float tt;
+    /// True particle four-momentum in GeV at hit position before interaction.
+    float tpx, tpy, tpz, te;
+    /// True change in particle four-momentum in GeV due to interactions.
+    float deltapx, deltapy, deltapz, deltae;
+    /// Hit index along the particle trajectory
+    int32_t index;
+    // Decoded hit surface identifier components.
+    uint32_t volumeId;
+    uint32_t boundaryId;
+    uint32_t layerId;
+    uint32_t approachId;
+    uint32_t sensitiveId;
+  };
+
+  /// Create all branches of the tree and bind them to the entry.
+  static void setupBranches(TTree& tree, Entry& entry);
+  /// Fill the entry for each hit and call the fill function afterwards.
+  template <typename fill_t>
+  ProcessCode writeEntries(const AlgorithmContext& ctx,
+                           const SimHitContainer& hits, Entry& entry,
+                           fill_t&& fill) const;
+
   Config m_cfg;
   std::mutex m_writeMutex;
   TFile* m_outputFile = nullptr;
   TTree* m_outputTree = nullptr;
-  /// Event identifier.
-  uint32_t m_eventId;
-  /// Hit surface identifier.
-  uint64_t m_geometryId;
-  /// Event-unique particle identifier a.k.a. barcode.
-  uint64_t m_particleId;
-  /// True global hit position components in mm.
-  float m_tx, m_ty, m_tz;
-  // True global hit time in ns.
-  float m_tt;
-  /// True particle four-momentum in GeV at hit position before interaction.
-  float m_tpx, m_tpy, m_tpz, m_te;
-  /// True change in particle four-momentum in GeV due to interactions.
-  float m_deltapx, m_deltapy, m_deltapz, m_deltae;
-  /// Hit index along the particle trajectory
-  int32_t m_index;
-  // Decoded hit surface identifier components.
-  uint32_t m_volumeId;
-  uint32_t m_boundaryId;
-  uint32_t m_layerId;
-  uint32_t m_approachId;
-  uint32_t m_sensitiveId;
+  /// Entry buffer for the output tree.
+  Entry m_entry;
+  /// Per-thread tree segments if enabled.
+  std::unique_ptr<RootTreeSegments<Entry>> m_segments;
 };
 
 }  // namespace FW
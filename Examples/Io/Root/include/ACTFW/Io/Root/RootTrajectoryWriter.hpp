@@ -8,11 +8,13 @@
 
 #pragma once
 
+#include <memory>
 #include <mutex>
 #include <vector>
 
 #include "ACTFW/EventData/Track.hpp"
 #include "ACTFW/Framework/WriterT.hpp"
+#include "ACTFW/Io/Root/RootTreeSegments.hpp"
 #include "Acts/Utilities/ParameterDefinitions.hpp"
 
 class TFile;
@@ -35,6 +37,8 @@ namespace FW {
 /// file
 ///
 /// Safe to use from multiple writer threads - uses a std::mutex lock.
+///
+/// Optionally fills per-thread tree segments, see RootTreeSegments.
 class RootTrajectoryWriter final : public WriterT<TrajectoryContainer> {
  public:
   /// @brief The nested configuration struct
@@ -46,6 +50,8 @@ class RootTrajectoryWriter final : public WriterT<TrajectoryContainer> {
     std::string outputTreename = "tracks";       ///< name of the output tree
     std::string fileMode = "RECREATE";           ///< file access mode
     TFile* rootFile = nullptr;                   ///< common root file
+    /// Fill per-thread tree segments and merge them at the end of the run.
+    bool perThreadSegments = false;
   };
 
   /// Constructor
@@ -68,182 +74,198 @@ class RootTrajectoryWriter final : public WriterT<TrajectoryContainer> {
                      const TrajectoryContainer& trajectories) final override;
 
  private:
+  /// Branch variables for one output entry.
+  struct Entry {
+    int eventNr{0};              ///< the event number
+    int trajNr{0};               ///< the trajectory number
+
+    unsigned long t_barcode{0};  ///< Truth particle barcode
+    int t_charge{0};             ///< Truth particle charge
+    float t_time{0};             ///< Truth particle time
+    float t_vx{-99.};            ///< Truth particle vertex x
+    float t_vy{-99.};            ///< Truth particle vertex y
+    float t_vz{-99.};            ///< Truth particle vertex z
+    float t_px{-99.};            ///< Truth particle initial momentum px
+    float t_py{-99.};            ///< Truth particle initial momentum py
+    float t_pz{-99.};            ///< Truth particle initial momentum pz
+    float t_theta{-99.};         ///< Truth particle initial momentum theta
+    float t_phi{-99.};           ///< Truth particle initial momentum phi
+    float t_pT{-99.};            ///< Truth particle initial momentum pT
+    float t_eta{-99.};           ///< Truth particle initial momentum eta
+
+    std::vector<float> t_x;  ///< Global truth hit position x
+    std::vector<float> t_y;  ///< Global truth hit position y
+    std::vector<float> t_z;  ///< Global truth hit position z
+    std::vector<float> t_r;  ///< Global truth hit position r
+    std::vector<float>
+        t_dx;  ///< Truth particle direction x at global hit position
+    std::vector<float>
+        t_dy;  ///< Truth particle direction y at global hit position
+    std::vector<float>
+        t_dz;  ///< Truth particle direction z at global hit position
+
+    std::vector<float> t_eLOC0;   ///< truth parameter eLOC_0
+    std::vector<float> t_eLOC1;   ///< truth parameter eLOC_1
+    std::vector<float> t_ePHI;    ///< truth parameter ePHI
+    std::vector<float> t_eTHETA;  ///< truth parameter eTHETA
+    std::vector<float> t_eQOP;    ///< truth parameter eQOP
+    std::vector<float> t_eT;      ///< truth parameter eT
+
+    int nStates{0};                 ///< number of all states
+    int nMeasurements{0};           ///< number of states with measurements
+    std::vector<int> volumeID;      ///< volume identifier
+    std::vector<int> layerID;       ///< layer identifier
+    std::vector<int> moduleID;      ///< surface identifier
+    std::vector<float> lx_hit;      ///< uncalibrated measurement local x
+    std::vector<float> ly_hit;      ///< uncalibrated measurement local y
+    std::vector<float> x_hit;       ///< uncalibrated measurement global x
+    std::vector<float> y_hit;       ///< uncalibrated measurement global y
+    std::vector<float> z_hit;       ///< uncalibrated measurement global z
+    std::vector<float> res_x_hit;   ///< hit residual x
+    std::vector<float> res_y_hit;   ///< hit residual y
+    std::vector<float> err_x_hit;   ///< hit err x
+    std::vector<float> err_y_hit;   ///< hit err y
+    std::vector<float> pull_x_hit;  ///< hit pull x
+    std::vector<float> pull_y_hit;  ///< hit pull y
+    std::vector<int> dim_hit;       ///< dimension of measurement
+
+    bool hasFittedParams;        ///< if the track has fitted parameter
+    float eLOC0_fit{-99.};       ///< fitted parameter eLOC_0
+    float eLOC1_fit{-99.};       ///< fitted parameter eLOC_1
+    float ePHI_fit{-99.};        ///< fitted parameter ePHI
+    float eTHETA_fit{-99.};      ///< fitted parameter eTHETA
+    float eQOP_fit{-99.};        ///< fitted parameter eQOP
+    float eT_fit{-99.};          ///< fitted parameter eT
+    float err_eLOC0_fit{-99.};   ///< fitted parameter eLOC_-99.err
+    float err_eLOC1_fit{-99.};   ///< fitted parameter eLOC_1 err
+    float err_ePHI_fit{-99.};    ///< fitted parameter ePHI err
+    float err_eTHETA_fit{-99.};  ///< fitted parameter eTHETA err
+    float err_eQOP_fit{-99.};    ///< fitted parameter eQOP err
+    float err_eT_fit{-99.};      ///< fitted parameter eT err
+
+    int nPredicted{0};      ///< number of states with predicted parameter
+    std::vector<bool> prt;  ///< predicted status
+    std::vector<float> eLOC0_prt;       ///< predicted parameter eLOC0
+    std::vector<float> eLOC1_prt;       ///< predicted parameter eLOC1
+    std::vector<float> ePHI_prt;        ///< predicted parameter ePHI
+    std::vector<float> eTHETA_prt;      ///< predicted parameter eTHETA
+    std::vector<float> eQOP_prt;        ///< predicted parameter eQOP
+    std::vector<float> eT_prt;          ///< predicted parameter eT
+    std::vector<float> res_eLOC0_prt;   ///< predicted parameter eLOC0 residual
+    std::vector<float> res_eLOC1_prt;   ///< predicted parameter eLOC1 residual
+    std::vector<float> res_ePHI_prt;    ///< predicted parameter ePHI residual
+    std::vector<float> res_eTHETA_prt;  ///< predicted parameter eTHETA residual
+    std::vector<float> res_eQOP_prt;    ///< predicted parameter eQOP residual
+    std::vector<float> res_eT_prt;      ///< predicted parameter eT residual
+    std::vector<float> err_eLOC0_prt;   ///< predicted parameter eLOC0 error
+    std::vector<float> err_eLOC1_prt;   ///< predicted parameter eLOC1 error
+    std::vector<float> err_ePHI_prt;    ///< predicted parameter ePHI error
+    std::vector<float> err_eTHETA_prt;  ///< predicted parameter eTHETA error
+    std::vector<float> err_eQOP_prt;    ///< predicted parameter eQOP error
+    std::vector<float> err_eT_prt;      ///< predicted parameter eT error
+    std::vector<float> pull_eLOC0_prt;  ///< predicted parameter eLOC0 pull
+    std::vector<float> pull_eLOC1_prt;  ///< predicted parameter eLOC1 pull
+    std::vector<float> pull_ePHI_prt;   ///< predicted parameter ePHI pull
+    std::vector<float> pull_eTHETA_prt;  ///< predicted parameter eTHETA pull
+    std::vector<float> pull_eQOP_prt;    ///< predicted parameter eQOP pull
+    std::vector<float> pull_eT_prt;      ///< predicted parameter eT pull
+    std::vector<float> x_prt;            ///< predicted global x
+    std::vector<float> y_prt;            ///< predicted global y
+    std::vector<float> z_prt;            ///< predicted global z
+    std::vector<float> px_prt;           ///< predicted momentum px
+    std::vector<float> py_prt;           ///< predicted momentum py
+    std::vector<float> pz_prt;           ///< predicted momentum pz
+    std::vector<float> eta_prt;          ///< predicted momentum eta
+    std::vector<float> pT_prt;           ///< predicted momentum pT
+
+    int nFiltered{0};              ///< number of states with filtered parameter
+    std::vector<bool> flt;         ///< filtered status
+    std::vector<float> eLOC0_flt;  ///< filtered parameter eLOC0
+    std::vector<float> eLOC1_flt;  ///< filtered parameter eLOC1
+    std::vector<float> ePHI_flt;   ///< filtered parameter ePHI
+    std::vector<float> eTHETA_flt;       ///< filtered parameter eTHETA
+    std::vector<float> eQOP_flt;         ///< filtered parameter eQOP
+    std::vector<float> eT_flt;           ///< filtered parameter eT
+    std::vector<float> res_eLOC0_flt;    ///< filtered parameter eLOC0 residual
+    std::vector<float> res_eLOC1_flt;    ///< filtered parameter eLOC1 residual
+    std::vector<float> res_ePHI_flt;     ///< filtered parameter ePHI residual
+    std::vector<float> res_eTHETA_flt;   ///< filtered parameter eTHETA residual
+    std::vector<float> res_eQOP_flt;     ///< filtered parameter eQOP residual
+    std::vector<float> res_eT_flt;       ///< filtered parameter eT residual
+    std::vector<float> err_eLOC0_flt;    ///< filtered parameter eLOC0 error
+    std::vector<float> err_eLOC1_flt;    ///< filtered parameter eLOC1 error
+    std::vector<float> err_ePHI_flt;     ///< filtered parameter ePHI error
+    std::vector<float> err_eTHETA_flt;   ///< filtered parameter eTHETA error
+    std::vector<float> err_eQOP_flt;     ///< filtered parameter eQOP error
+    std::vector<float> err_eT_flt;       ///< filtered parameter eT error
+    std::vector<float> pull_eLOC0_flt;   ///< filtered parameter eLOC0 pull
+    std::vector<float> pull_eLOC1_flt;   ///< filtered parameter eLOC1 pull
+    std::vector<float> pull_ePHI_flt;    ///< filtered parameter ePHI pull
+    std::vector<float> pull_eTHETA_flt;  ///< filtered parameter eTHETA pull
+    std::vector<float> pull_eQOP_flt;    ///< filtered parameter eQOP pull
+    std::vector<float> pull_eT_flt;      ///< filtered parameter eT pull
+    std::vector<float> x_flt;            ///< filtered global x
+    std::vector<float> y_flt;            ///< filtered global y
+    std::vector<float> z_flt;            ///< filtered global z
+    std::vector<float> px_flt;           ///< filtered momentum px
+    std::vector<float> py_flt;           ///< filtered momentum py
+    std::vector<float> pz_flt;           ///< filtered momentum pz
+    std::vector<float> eta_flt;          ///< filtered momentum eta
+    std::vector<float> pT_flt;           ///< filtered momentum pT
+    std::vector<float> chi2;             ///< chisq from filtering
+
+    int nSmoothed{0};              ///< number of states with smoothed parameter
+    std::vector<bool> smt;         ///< smoothed status
+    std::vector<float> eLOC0_smt;  ///< smoothed parameter eLOC0
+    std::vector<float> eLOC1_smt;  ///< smoothed parameter eLOC1
+    std::vector<float> ePHI_smt;   ///< smoothed parameter ePHI
+    std::vector<float> eTHETA_smt;       ///< smoothed parameter eTHETA
+    std::vector<float> eQOP_smt;         ///< smoothed parameter eQOP
+    std::vector<float> eT_smt;           ///< smoothed parameter eT
+    std::vector<float> res_eLOC0_smt;    ///< smoothed parameter eLOC0 residual
+    std::vector<float> res_eLOC1_smt;    ///< smoothed parameter eLOC1 residual
+    std::vector<float> res_ePHI_smt;     ///< smoothed parameter ePHI residual
+    std::vector<float> res_eTHETA_smt;   ///< smoothed parameter eTHETA residual
+    std::vector<float> res_eQOP_smt;     ///< smoothed parameter eQOP residual
+    std::vector<float> res_eT_smt;       ///< smoothed parameter eT residual
+    std::vector<float> err_eLOC0_smt;    ///< smoothed parameter eLOC0 error
+    std::vector<float> err_eLOC1_smt;    ///< smoothed parameter eLOC1 error
+    std::vector<float> err_ePHI_smt;     ///< smoothed parameter ePHI error
+    std::vector<float> err_eTHETA_smt;   ///< smoothed parameter eTHETA error
+    std::vector<float> err_eQOP_smt;     ///< smoothed parameter eQOP error
+    std::vector<float> err_eT_smt;       ///< smoothed parameter eT error
+    std::vector<float> pull_eLOC0_smt;   ///< smoothed parameter eLOC0 pull
+    std::vector<float> pull_eLOC1_smt;   ///< smoothed parameter eLOC1 pull
+    std::vector<float> pull_ePHI_smt;    ///< smoothed parameter ePHI pull
+    std::vector<float> pull_eTHETA_smt;  ///< smoothed parameter eTHETA pull
+    std::vector<float> pull_eQOP_smt;    ///< smoothed parameter eQOP pull
+    std::vector<float> pull_eT_smt;      ///< smoothed parameter eT pull
+    std::vector<float> x_smt;            ///< smoothed global x
+    std::vector<float> y_smt;            ///< smoothed global y
+    std::vector<float> z_smt;            ///< smoothed global z
+    std::vector<float> px_smt;           ///< smoothed momentum px
+    std::vector<float> py_smt;           ///< smoothed momentum py
+    std::vector<float> pz_smt;           ///< smoothed momentum pz
+    std::vector<float> eta_smt;          ///< smoothed momentum eta
+    std::vector<float> pT_smt;           ///< smoothed momentum pT
+  };
+
+  /// Create all branches of the tree and bind them to the entry.
+  static void setupBranches(TTree& tree, Entry& entry);
+  /// Fill the entries for the event and call the fill function for each.
+  template <typename fill_t>
+  ProcessCode writeEntries(const AlgorithmContext& ctx,
+                           const TrajectoryContainer& trajectories, Entry& entry,
+                           fill_t&& fill) const;
+
   Config m_cfg;             ///< The config class
   std::mutex m_writeMutex;  ///< Mutex used to protect multi-threaded writes
   TFile* m_outputFile{nullptr};  ///< The output file
   TTree* m_outputTree{nullptr};  ///< The output tree
-  int m_eventNr{0};              ///< the event number
-  int m_trajNr{0};               ///< the trajectory number
-
-  unsigned long m_t_barcode{0};  ///< Truth particle barcode
-  int m_t_charge{0};             ///< Truth particle charge
-  float m_t_time{0};             ///< Truth particle time
-  float m_t_vx{-99.};            ///< Truth particle vertex x
-  float m_t_vy{-99.};            ///< Truth particle vertex y
-  float m_t_vz{-99.};            ///< Truth particle vertex z
-  float m_t_px{-99.};            ///< Truth particle initial momentum px
-  float m_t_py{-99.};            ///< Truth particle initial momentum py
-  float m_t_pz{-99.};            ///< Truth particle initial momentum pz
-  float m_t_theta{-99.};         ///< Truth particle initial momentum theta
-  float m_t_phi{-99.};           ///< Truth particle initial momentum phi
-  float m_t_pT{-99.};            ///< Truth particle initial momentum pT
-  float m_t_eta{-99.};           ///< Truth particle initial momentum eta
-
-  std::vector<float> m_t_x;  ///< Global truth hit position x
-  std::vector<float> m_t_y;  ///< Global truth hit position y
-  std::vector<float> m_t_z;  ///< Global truth hit position z
-  std::vector<float> m_t_r;  ///< Global truth hit position r
-  std::vector<float>
-      m_t_dx;  ///< Truth particle direction x at global hit position
-  std::vector<float>
-      m_t_dy;  ///< Truth particle direction y at global hit position
-  std::vector<float>
-      m_t_dz;  ///< Truth particle direction z at global hit position
-
-  std::vector<float> m_t_eLOC0;   ///< truth parameter eLOC_0
-  std::vector<float> m_t_eLOC1;   ///< truth parameter eLOC_1
-  std::vector<float> m_t_ePHI;    ///< truth parameter ePHI
-  std::vector<float> m_t_eTHETA;  ///< truth parameter eTHETA
-  std::vector<float> m_t_eQOP;    ///< truth parameter eQOP
-  std::vector<float> m_t_eT;      ///< truth parameter eT
-
-  int m_nStates{0};                 ///< number of all states
-  int m_nMeasurements{0};           ///< number of states with measurements
-  std::vector<int> m_volumeID;      ///< volume identifier
-  std::vector<int> m_layerID;       ///< layer identifier
-  std::vector<int> m_moduleID;      ///< surface identifier
-  std::vector<float> m_lx_hit;      ///< uncalibrated measurement local x
-  std::vector<float> m_ly_hit;      ///< uncalibrated measurement local y
-  std::vector<float> m_x_hit;       ///< uncalibrated measurement global x
-  std::vector<float> m_y_hit;       ///< uncalibrated measurement global y
-  std::vector<float> m_z_hit;       ///< uncalibrated measurement global z
-  std::vector<float> m_res_x_hit;   ///< hit residual x
-  std::vector<float> m_res_y_hit;   ///< hit residual y
-  std::vector<float> m_err_x_hit;   ///< hit err x
-  std::vector<float> m_err_y_hit;   ///< hit err y
-  std::vector<float> m_pull_x_hit;  ///< hit pull x
-  std::vector<float> m_pull_y_hit;  ///< hit pull y
-  std::vector<int> m_dim_hit;       ///< dimension of measurement
-
-  bool m_hasFittedParams;        ///< if the track has fitted parameter
-  float m_eLOC0_fit{-99.};       ///< fitted parameter eLOC_0
-  float m_eLOC1_fit{-99.};       ///< fitted parameter eLOC_1
-  float m_ePHI_fit{-99.};        ///< fitted parameter ePHI
-  float m_eTHETA_fit{-99.};      ///< fitted parameter eTHETA
-  float m_eQOP_fit{-99.};        ///< fitted parameter eQOP
-  float m_eT_fit{-99.};          ///< fitted parameter eT
-  float m_err_eLOC0_fit{-99.};   ///< fitted parameter eLOC_-99.err
-  float m_err_eLOC1_fit{-99.};   ///< fitted parameter eLOC_1 err
-  float m_err_ePHI_fit{-99.};    ///< fitted parameter ePHI err
-  float m_err_eTHETA_fit{-99.};  ///< fitted parameter eTHETA err
-  float m_err_eQOP_fit{-99.};    ///< fitted parameter eQOP err
-  float m_err_eT_fit{-99.};      ///< fitted parameter eT err
-
-  int m_nPredicted{0};      ///< number of states with predicted parameter
-  std::vector<bool> m_prt;  ///< predicted status
-  std::vector<float> m_eLOC0_prt;       ///< predicted parameter eLOC0
-  std::vector<float> m_eLOC1_prt;       ///< predicted parameter eLOC1
-  std::vector<float> m_ePHI_prt;        ///< predicted parameter ePHI
-  std::vector<float> m_eTHETA_prt;      ///< predicted parameter eTHETA
-  std::vector<float> m_eQOP_prt;        ///< predicted parameter eQOP
-  std::vector<float> m_eT_prt;          ///< predicted parameter eT
-  std::vector<float> m_res_eLOC0_prt;   ///< predicted parameter eLOC0 residual
-  std::vector<float> m_res_eLOC1_prt;   ///< predicted parameter eLOC1 residual
-  std::vector<float> m_res_ePHI_prt;    ///< predicted parameter ePHI residual
-  std::vector<float> m_res_eTHETA_prt;  ///< predicted parameter eTHETA residual
-  std::vector<float> m_res_eQOP_prt;    ///< predicted parameter eQOP residual
-  std::vector<float> m_res_eT_prt;      ///< predicted parameter eT residual
-  std::vector<float> m_err_eLOC0_prt;   ///< predicted parameter eLOC0 error
-  std::vector<float> m_err_eLOC1_prt;   ///< predicted parameter eLOC1 error
-  std::vector<float> m_err_ePHI_prt;    ///< predicted parameter ePHI error
-  std::vector<float> m_err_eTHETA_prt;  ///< predicted parameter eTHETA error
-  std::vector<float> m_err_eQOP_prt;    ///< predicted parameter eQOP error
-  std::vector<float> m_err_eT_prt;      ///< predicted parameter eT error
-  std::vector<float> m_pull_eLOC0_prt;  ///< predicted parameter eLOC0 pull
-  std::vector<float> m_pull_eLOC1_prt;  ///< predicted parameter eLOC1 pull
-  std::vector<float> m_pull_ePHI_prt;   ///< predicted parameter ePHI pull
-  std::vector<float> m_pull_eTHETA_prt;  ///< predicted parameter eTHETA pull
-  std::vector<float> m_pull_eQOP_prt;    ///< predicted parameter eQOP pull
-  std::vector<float> m_pull_eT_prt;      ///< predicted parameter eT pull
-  std::vector<float> m_x_prt;            ///< predicted global x
-  std::vector<float> m_y_prt;            ///< predicted global y
-  std::vector<float> m_z_prt;            ///< predicted global z
-  std::vector<float> m_px_prt;           ///< predicted momentum px
-  std::vector<float> m_py_prt;           ///< predicted momentum py
-  std::vector<float> m_pz_prt;           ///< predicted momentum pz
-  std::vector<float> m_eta_prt;          ///< predicted momentum eta
-  std::vector<float> m_pT_prt;           ///< predicted momentum pT
-
-  int m_nFiltered{0};              ///< number of states with filtered parameter
-  std::vector<bool> m_flt;         ///< filtered status
-  std::vector<float> m_eLOC0_flt;  ///< filtered parameter eLOC0
-  std::vector<float> m_eLOC1_flt;  ///< filtered parameter eLOC1
-  std::vector<float> m_ePHI_flt;   ///< filtered parameter ePHI
-  std::vector<float> m_eTHETA_flt;       ///< filtered parameter eTHETA
-  std::vector<float> m_eQOP_flt;         ///< filtered parameter eQOP
-  std::vector<float> m_eT_flt;           ///< filtered parameter eT
-  std::vector<float> m_res_eLOC0_flt;    ///< filtered parameter eLOC0 residual
-  std::vector<float> m_res_eLOC1_flt;    ///< filtered parameter eLOC1 residual
-  std::vector<float> m_res_ePHI_flt;     ///< filtered parameter ePHI residual
-  std::vector<float> m_res_eTHETA_flt;   ///< filtered parameter eTHETA residual
-  std::vector<float> m_res_eQOP_flt;     ///< filtered parameter eQOP residual
-  std::vector<float> m_res_eT_flt;       ///< filtered parameter eT residual
-  std::vector<float> m_err_eLOC0_flt;    ///< filtered parameter eLOC0 error
-  std::vector<float> m_err_eLOC1_flt;    ///< filtered parameter eLOC1 error
-  std::vector<float> m_err_ePHI_flt;     ///< filtered parameter ePHI error
-  std::vector<float> m_err_eTHETA_flt;   ///< filtered parameter eTHETA error
-  std::vector<float> m_err_eQOP_flt;     ///< filtered parameter eQOP error
-  std::vector<float> m_err_eT_flt;       ///< filtered parameter eT error
-  std::vector<float> m_pull_eLOC0_flt;   ///< filtered parameter eLOC0 pull
-  std::vector<float> m_pull_eLOC1_flt;   ///< filtered parameter eLOC1 pull
-  std::vector<float> m_pull_ePHI_flt;    ///< filtered parameter ePHI pull
-  std::vector<float> m_pull_eTHETA_flt;  ///< filtered parameter eTHETA pull
-  std::vector<float> m_pull_eQOP_flt;    ///< filtered parameter eQOP pull
-  std::vector<float> m_pull_eT_flt;      ///< filtered parameter eT pull
-  std::vector<float> m_x_flt;            ///< filtered global x
-  std::vector<float> m_y_flt;            ///< filtered global y
-  std::vector<float> m_z_flt;            ///< filtered global z
-  std::vector<float> m_px_flt;           ///< filtered momentum px
-  std::vector<float> m_py_flt;           ///< filtered momentum py
-  std::vector<float> m_pz_flt;           ///< filtered momentum pz
-  std::vector<float> m_eta_flt;          ///< filtered momentum eta
-  std::vector<float> m_pT_flt;           ///< filtered momentum pT
-  std::vector<float> m_chi2;             ///< chisq from filtering
-
-  int m_nSmoothed{0};              ///< number of states with smoothed parameter
-  std::vector<bool> m_smt;         ///< smoothed status
-  std::vector<float> m_eLOC0_smt;  ///< smoothed parameter eLOC0
-  std::vector<float> m_eLOC1_smt;  ///< smoothed parameter eLOC1
-  std::vector<float> m_ePHI_smt;   ///< smoothed parameter ePHI
-  std::vector<float> m_eTHETA_smt;       ///< smoothed parameter eTHETA
-  std::vector<float> m_eQOP_smt;         ///< smoothed parameter eQOP
-  std::vector<float> m_eT_smt;           ///< smoothed parameter eT
-  std::vector<float> m_res_eLOC0_smt;    ///< smoothed parameter eLOC0 residual
-  std::vector<float> m_res_eLOC1_smt;    ///< smoothed parameter eLOC1 residual
-  std::vector<float> m_res_ePHI_smt;     ///< smoothed parameter ePHI residual
-  std::vector<float> m_res_eTHETA_smt;   ///< smoothed parameter eTHETA residual
-  std::vector<float> m_res_eQOP_smt;     ///< smoothed parameter eQOP residual
-  std::vector<float> m_res_eT_smt;       ///< smoothed parameter eT residual
-  std::vector<float> m_err_eLOC0_smt;    ///< smoothed parameter eLOC0 error
-  std::vector<float> m_err_eLOC1_smt;    ///< smoothed parameter eLOC1 error
-  std::vector<float> m_err_ePHI_smt;     ///< smoothed parameter ePHI error
-  std::vector<float> m_err_eTHETA_smt;   ///< smoothed parameter eTHETA error
-  std::vector<float> m_err_eQOP_smt;     ///< smoothed parameter eQOP error
-  std::vector<float> m_err_eT_smt;       ///< smoothed parameter eT error
-  std::vector<float> m_pull_eLOC0_smt;   ///< smoothed parameter eLOC0 pull
-  std::vector<float> m_pull_eLOC1_smt;   ///< smoothed parameter eLOC1 pull
-  std::vector<float> m_pull_ePHI_smt;    ///< smoothed parameter ePHI pull
-  std::vector<float> m_pull_eTHETA_smt;  ///< smoothed parameter eTHETA pull
-  std::vector<float> m_pull_eQOP_smt;    ///< smoothed parameter eQOP pull
-  std::vector<float> m_pull_eT_smt;      ///< smoothed parameter eT pull
-  std::vector<float> m_x_smt;            ///< smoothed global x
-  std::vector<float> m_y_smt;            ///< smoothed global y
-  std::vector<float> m_z_smt;            ///< smoothed global z
-  std::vector<float> m_px_smt;           ///< smoothed momentum px
-  std::vector<float> m_py_smt;           ///< smoothed momentum py
-  std::vector<float> m_pz_smt;           ///< smoothed momentum pz
-  std::vector<float> m_eta_smt;          ///< smoothed momentum eta
-  std::vector<float> m_pT_smt;           ///< smoothed momentum pT
+  /// Entry buffer for the output tree.
+  Entry m_entry;
+  /// Per-thread tree segments if enabled.
+  std::unique_ptr<RootTreeSegments<Entry>> m_segments;
 };
 
 }  // namespace FW
@@ -0,0 +1,133 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+class TFile;
+class TTree;
+
+namespace FW {
+namespace detail {
+
+/// Type-erased storage and bookkeeping for per-thread tree segments.
+class RootTreeSegmentsBase {
+ public:
+  /// Remove all segment files that have not been merged.
+  ~RootTreeSegmentsBase();
+
+  /// The number of segments, i.e. the number of threads that filled entries.
+  size_t size() const;
+
+ protected:
+  /// One tree segment filled exclusively by a single thread.
+  struct Segment {
+    std::string path;
+    TFile* file = nullptr;
+    TTree* tree = nullptr;
+    /// Entry buffer bound to the tree branches.
+    std::shared_ptr<void> entry;
+    /// Consecutive entries of one event as (event, first entry, count).
+    std::vector<std::array<uint64_t, 3>> events;
+  };
+  /// Create a new entry buffer and bind it to the branches of the tree.
+  using MakeEntry = std::function<std::shared_ptr<void>(TTree&)>;
+  /// Copy the segment entry buffer to the output entry buffer.
+  using CopyEntry = std::function<void(const void*)>;
+
+  /// @param path is the path of the merged output; segments are stored next
+  ///        to it with an additional suffix
+  /// @param treeName is the name of the segment trees
+  RootTreeSegmentsBase(std::string path, std::string treeName);
+
+  /// Return the segment for the calling thread and create it if necessary.
+  Segment& localSegment(const MakeEntry& makeEntry);
+  /// Fill the entry buffer of the segment as an entry of the given event.
+  static void fillSegment(Segment& segment, uint64_t event);
+  /// Merge all segments in event order into the output tree.
+  ///
+  /// @return number of merged entries
+  uint64_t mergeSegments(TTree& output, const CopyEntry& copyEntry);
+
+ private:
+  /// Close all segment files and remove them from disk.
+  void closeSegments();
+
+  std::string m_path;
+  std::string m_treeName;
+  /// Unique identifier to find the segments in the thread-local cache.
+  ///
+  /// A new one is assigned whenever the segments are closed, i.e. the
+  /// instance can be filled and merged again for another run.
+  uint64_t m_id;
+  mutable std::mutex m_mutex;
+  std::vector<std::unique_ptr<Segment>> m_segments;
+};
+
+}  // namespace detail
+
+/// Per-thread output tree segments that are merged in event order.
+///
+/// The ROOT writers lock their output tree for the whole event by default.
+/// With per-thread segments, each thread instead gets its own entry buffer
+/// and its own tree stored in a separate segment file next to the final
+/// output, named `<output>.<tree>.segment<instance>-<thread>`. The segment
+/// of the calling thread is found via a thread-local cache and a lock is
+/// only needed the first time a thread writes. After the event loop, `merge`
+/// appends all segment entries to the output tree sorted by event number and
+/// removes the segment files, i.e. the output is identical to a
+/// single-threaded run. Afterwards, new segments are created if the instance
+/// is filled again.
+///
+/// @tparam entry_t is a copy-assignable struct containing the branch variables
+template <typename entry_t>
+class RootTreeSegments : public detail::RootTreeSegmentsBase {
+ public:
+  /// Create all branches of the tree and bind them to the entry buffer.
+  using BranchSetup = std::function<void(TTree&, entry_t&)>;
+
+  /// @param path is the path of the merged output file
+  /// @param treeName is the name of the output tree
+  /// @param setup creates the branches for each segment tree
+  RootTreeSegments(std::string path, std::string treeName, BranchSetup setup)
+      : RootTreeSegmentsBase(std::move(path), std::move(treeName)),
+        m_setup(std::move(setup)) {}
+
+  /// The entry buffer of the calling thread.
+  entry_t& entry() { return *static_cast<entry_t*>(local().entry.get()); }
+  /// Fill the entry buffer of the calling thread as an entry of the event.
+  void fill(uint64_t event) { fillSegment(local(), event); }
+  /// Merge all segments into the output tree bound to the output entry.
+  ///
+  /// @return number of merged entries
+  uint64_t merge(TTree& output, entry_t& outputEntry) {
+    return mergeSegments(output, [&](const void* entry) {
+      outputEntry = *static_cast<const entry_t*>(entry);
+    });
+  }
+
+ private:
+  Segment& local() {
+    return localSegment([this](TTree& tree) {
+      auto entry = std::make_shared<entry_t>();
+      m_setup(tree, *entry);
+      return std::shared_ptr<void>(std::move(entry));
+    });
+  }
+
+  BranchSetup m_setup;
+};
+
+}  // namespace FW
@@ -55,6 +55,9 @@ class RootVertexAndTracksReader final : public IReader {
   /// @param context The algorithm context
   ProcessCode read(const FW::AlgorithmContext& context) final override;
 
+  /// Reading entries from the input chain is sequential.
+  bool isThreadSafe() const final override { return false; }
+
  private:
   /// The config class
   Config m_cfg;
@@ -38,28 +38,35 @@ FW::RootParticleWriter::RootParticleWriter(
     throw std::bad_alloc();
   }
 
-  // setup the branches
-  m_outputTree->Branch("event_id", &m_eventId);
-  m_outputTree->Branch("particle_id", &m_particleId, "particle_id/l");
-  m_outputTree->Branch("particle_type", &m_particleType);
-  m_outputTree->Branch("process", &m_process);
-  m_outputTree->Branch("vx", &m_vx);
-  m_outputTree->Branch("vy", &m_vy);
-  m_outputTree->Branch("vz", &m_vz);
-  m_outputTree->Branch("vt", &m_vt);
-  m_outputTree->Branch("px", &m_px);
-  m_outputTree->Branch("py", &m_py);
-  m_outputTree->Branch("pz", &m_pz);
-  m_outputTree->Branch("m", &m_m);
-  m_outputTree->Branch("q", &m_q);
-  m_outputTree->Branch("eta", &m_eta);
-  m_outputTree->Branch("phi", &m_phi);
-  m_outputTree->Branch("pt", &m_pt);
-  m_outputTree->Branch("vertex_primary", &m_vertexPrimary);
-  m_outputTree->Branch("vertex_secondary", &m_vertexSecondary);
-  m_outputTree->Branch("particle", &m_particle);
-  m_outputTree->Branch("generation", &m_generation);
-  m_outputTree->Branch("sub_particle", &m_subParticle);
+  setupBranches(*m_outputTree, m_entry);
+  if (m_cfg.perThreadSegments) {
+    m_segments = std::make_unique<RootTreeSegments<Entry>>(
+        m_cfg.filePath, m_cfg.treeName, &RootParticleWriter::setupBranches);
+  }
+}
+
+void FW::RootParticleWriter::setupBranches(TTree& tree, Entry& entry) {
+  tree.Branch("event_id", &entry.eventId);
+  tree.Branch("particle_id", &entry.particleId, "particle_id/l");
+  tree.Branch("particle_type", &entry.particleType);
+  tree.Branch("process", &entry.process);
+  tree.Branch("vx", &entry.vx);
+  tree.Branch("vy", &entry.vy);
+  tree.Branch("vz", &entry.vz);
+  tree.Branch("vt", &entry.vt);
+  tree.Branch("px", &entry.px);
+  tree.Branch("py", &entry.py);
+  tree.Branch("pz", &entry.pz);
+  tree.Branch("m", &entry.m);
+  tree.Branch("q", &entry.q);
+  tree.Branch("eta", &entry.eta);
+  tree.Branch("phi", &entry.phi);
+  tree.Branch("pt", &entry.pt);
+  tree.Branch("vertex_primary", &entry.vertexPrimary);
+  tree.Branch("vertex_secondary", &entry.vertexSecondary);
+  tree.Branch("particle", &entry.particle);
+  tree.Branch("generation", &entry.generation);
+  tree.Branch("sub_particle", &entry.subParticle);
 }
 
 FW::RootParticleWriter::~RootParticleWriter() {
@@ -71,6 +78,12 @@ FW::RootParticleWriter::~RootParticleWriter() {
 FW::ProcessCode FW::RootParticleWriter::endRun() {
   if (m_outputFile) {
     m_outputFile->cd();
+    if (m_segments) {
+      auto numSegments = m_segments->size();
+      auto numEntries = m_segments->merge(*m_outputTree, m_entry);
+      ACTS_DEBUG("Merged " << numEntries << " particles from " << numSegments
+                           << " per-thread segments");
+    }
     m_outputTree->Write();
     ACTS_INFO("Wrote particles to tree '" << m_cfg.treeName << "' in '"
                                           << m_cfg.filePath << "'");
@@ -85,38 +98,50 @@ FW::ProcessCode FW::RootParticleWriter::writeT(
     return ProcessCode::ABORT;
   }
 
+  if (m_segments) {
+    // each thread fills its own segment and no locking is needed
+    return writeEntries(ctx, particles, m_segments->entry(),
+                        [&]() { m_segments->fill(ctx.eventNumber); });
+  }
   // ensure exclusive access to tree/file while writing
   std::lock_guard<std::mutex> lock(m_writeMutex);
+  return writeEntries(ctx, particles, m_entry,
+                      [&]() { m_outputTree->Fill(); });
+}
 
-  m_eventId = ctx.eventNumber;
+template <typename fill_t>
+FW::ProcessCode FW::RootParticleWriter::writeEntries(
+    const AlgorithmContext& ctx, const SimParticleContainer& particles,
+    Entry& entry, fill_t&& fill) const {
+  entry.eventId = ctx.eventNumber;
   for (const auto& particle : particles) {
-    m_particleId = particle.particleId().value();
-    m_particleType = particle.pdg();
-    m_process = static_cast<decltype(m_process)>(particle.process());
+    entry.particleId = particle.particleId().value();
+    entry.particleType = particle.pdg();
+    entry.process = static_cast<decltype(entry.process)>(particle.process());
     // position
-    m_vx = particle.position4().x() / Acts::UnitConstants::mm;
-    m_vy = particle.position4().y() / Acts::UnitConstants::mm;
-    m_vz = particle.position4().z() / Acts::UnitConstants::mm;
-    m_vt = particle.position4().w() / Acts::UnitConstants::ns;
+    entry.vx = particle.position4().x() / Acts::UnitConstants::mm;
+    entry.vy = particle.position4().y() / Acts::UnitConstants::mm;
+    entry.vz = particle.position4().z() / Acts::UnitConstants::mm;
+    entry.vt = particle.position4().w() / Acts::UnitConstants::ns;
     // momentum
     const auto p = particle.absMomentum() / Acts::UnitConstants::GeV;
-    m_px = p * particle.unitDirection().x();
-    m_py = p * particle.unitDirection().y();
-    m_pz = p * particle.unitDirection().z();
+    entry.px = p * particle.unitDirection().x();
+    entry.py = p * particle.unitDirection().y();
+    entry.pz = p * particle.unitDirection().z();
     // particle constants
-    m_m = particle.mass() / Acts::UnitConstants::GeV;
-    m_q = particle.charge() / Acts::UnitConstants::e;
+    entry.m = particle.mass() / Acts::UnitConstants::GeV;
+    entry.q = particle.charge() / Acts::UnitConstants::e;
     // derived kinematic quantities
-    m_eta = Acts::VectorHelpers::eta(particle.unitDirection());
-    m_phi = Acts::VectorHelpers::phi(particle.unitDirection());
-    m_pt = p * Acts::VectorHelpers::perp(particle.unitDirection());
+    entry.eta = Acts::VectorHelpers::eta(particle.unitDirection());
+    entry.phi = Acts::VectorHelpers::phi(particle.unitDirection());
+    entry.pt = p * Acts::VectorHelpers::perp(particle.unitDirection());
     // decoded barcode components
-    m_vertexPrimary = particle.particleId().vertexPrimary();
-    m_vertexSecondary = particle.particleId().vertexSecondary();
-    m_particle = particle.particleId().particle();
-    m_generation = particle.particleId().generation();
-    m_subParticle = particle.particleId().subParticle();
-    m_outputTree->Fill();
+    entry.vertexPrimary = particle.particleId().vertexPrimary();
+    entry.vertexSecondary = particle.particleId().vertexSecondary();
+    entry.particle = particle.particleId().particle();
+    entry.generation = particle.particleId().generation();
+    entry.subParticle = particle.particleId().subParticle();
+    fill();
   }
 
   return ProcessCode::SUCCESS;
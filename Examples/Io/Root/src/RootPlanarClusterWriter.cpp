@@ -49,31 +49,40 @@ FW::RootPlanarClusterWriter::RootPlanarClusterWriter(
   if (m_outputTree == nullptr)
     throw std::bad_alloc();
 
-  // Set the branches
-  m_outputTree->Branch("event_nr", &m_eventNr);
-  m_outputTree->Branch("volume_id", &m_volumeID);
-  m_outputTree->Branch("layer_id", &m_layerID);
-  m_outputTree->Branch("surface_id", &m_surfaceID);
-  m_outputTree->Branch("g_x", &m_x);
-  m_outputTree->Branch("g_y", &m_y);
-  m_outputTree->Branch("g_z", &m_z);
-  m_outputTree->Branch("g_t", &m_t);
-  m_outputTree->Branch("l_x", &m_lx);
-  m_outputTree->Branch("l_y", &m_ly);
-  m_outputTree->Branch("cov_l_x", &m_cov_lx);
-  m_outputTree->Branch("cov_l_y", &m_cov_ly);
-  m_outputTree->Branch("cell_ID_x", &m_cell_IDx);
-  m_outputTree->Branch("cell_ID_y", &m_cell_IDy);
-  m_outputTree->Branch("cell_l_x", &m_cell_lx);
-  m_outputTree->Branch("cell_l_y", &m_cell_ly);
-  m_outputTree->Branch("cell_data", &m_cell_data);
-  m_outputTree->Branch("truth_g_x", &m_t_gx);
-  m_outputTree->Branch("truth_g_y", &m_t_gy);
-  m_outputTree->Branch("truth_g_z", &m_t_gz);
-  m_outputTree->Branch("truth_g_t", &m_t_gt);
-  m_outputTree->Branch("truth_l_x", &m_t_lx);
-  m_outputTree->Branch("truth_l_y", &m_t_ly);
-  m_outputTree->Branch("truth_barcode", &m_t_barcode, "truth_barcode/l");
+  setupBranches(*m_outputTree, m_entry);
+  if (m_cfg.perThreadSegments) {
+    // segments are stored next to the file that also contains the tree
+    m_segments = std::make_unique<RootTreeSegments<Entry>>(
+        m_outputFile->GetName(), m_cfg.treeName,
+        &RootPlanarClusterWriter::setupBranches);
+  }
+}
+
+void FW::RootPlanarClusterWriter::setupBranches(TTree& tree, Entry& entry) {
+  tree.Branch("event_nr", &entry.eventNr);
+  tree.Branch("volume_id", &entry.volumeID);
+  tree.Branch("layer_id", &entry.layerID);
+  tree.Branch("surface_id", &entry.surfaceID);
+  tree.Branch("g_x", &entry.x);
+  tree.Branch("g_y", &entry.y);
+  tree.Branch("g_z", &entry.z);
+  tree.Branch("g_t", &entry.t);
+  tree.Branch("l_x", &entry.lx);
+  tree.Branch("l_y", &entry.ly);
+  tree.Branch("cov_l_x", &entry.cov_lx);
+  tree.Branch("cov_l_y", &entry.cov_ly);
+  tree.Branch("cell_ID_x", &entry.cell_IDx);
+  tree.Branch("cell_ID_y", &entry.cell_IDy);
+  tree.Branch("cell_l_x", &entry.cell_lx);
+  tree.Branch("cell_l_y", &entry.cell_ly);
+  tree.Branch("cell_data", &entry.cell_data);
+  tree.Branch("truth_g_x", &entry.t_gx);
+  tree.Branch("truth_g_y", &entry.t_gy);
+  tree.Branch("truth_g_z", &entry.t_gz);
+  tree.Branch("truth_g_t", &entry.t_gt);
+  tree.Branch("truth_l_x", &entry.t_lx);
+  tree.Branch("truth_l_y", &entry.t_ly);
+  tree.Branch("truth_barcode", &entry.t_barcode, "truth_barcode/l");
 }
 
 FW::RootPlanarClusterWriter::~RootPlanarClusterWriter() {
@@ -86,6 +95,12 @@ FW::RootPlanarClusterWriter::~RootPlanarClusterWriter() {
 FW::ProcessCode FW::RootPlanarClusterWriter::endRun() {
   // Write the tree
   m_outputFile->cd();
+  if (m_segments) {
+    auto numSegments = m_segments->size();
+    auto numEntries = m_segments->merge(*m_outputTree, m_entry);
+    ACTS_DEBUG("Merged " << numEntries << " clusters from " << numSegments
+                         << " per-thread segments");
+  }
   m_outputTree->Write();
   ACTS_INFO("Wrote particles to tree '" << m_cfg.treeName << "' in '"
                                         << m_cfg.filePath << "'");
@@ -95,19 +110,30 @@ FW::ProcessCode FW::RootPlanarClusterWriter::endRun() {
 FW::ProcessCode FW::RootPlanarClusterWriter::writeT(
     const AlgorithmContext& ctx,
     const FW::GeometryIdMultimap<Acts::PlanarModuleCluster>& clusters) {
+  if (m_segments) {
+    // each thread fills its own segment and no locking is needed
+    return writeEntries(ctx, clusters, m_segments->entry(),
+                        [&]() { m_segments->fill(ctx.eventNumber); });
+  }
+  // Exclusive access to the tree while writing
+  std::lock_guard<std::mutex> lock(m_writeMutex);
+  return writeEntries(ctx, clusters, m_entry, [&]() { m_outputTree->Fill(); });
+}
+
+template <typename fill_t>
+FW::ProcessCode FW::RootPlanarClusterWriter::writeEntries(
+    const AlgorithmContext& ctx,
+    const FW::GeometryIdMultimap<Acts::PlanarModuleCluster>& clusters,
+    Entry& entry, fill_t&& fill) const {
   // retrieve simulated hits
   const auto& simHits =
       ctx.eventStore.get<SimHitContainer>(m_cfg.inputSimulatedHits);
 
-  // Exclusive access to the tree while writing
-  std::lock_guard<std::mutex> lock(m_writeMutex);
   // Get the event number
-  m_eventNr = ctx.eventNumber;
+  entry.eventNr = ctx.eventNumber;
 
   // Loop over the planar clusters in this event
-  for (const auto& entry : clusters) {
-    Acts::GeometryID geoId = entry.first;
-    const Acts::PlanarModuleCluster& cluster = entry.second;
+  for (const auto& [geoId, cluster] : clusters) {
     // local cluster information: position, @todo coveraiance
     auto parameters = cluster.parameters();
     Acts::Vector2D local(parameters[Acts::ParDef::eLOC_0],
@@ -121,26 +147,26 @@ FW::ProcessCode FW::RootPlanarClusterWriter::writeT(
     // transform local into global position information
     clusterSurface.localToGlobal(ctx.geoContext, local, mom, pos);
     // identification
-    m_volumeID = geoId.volume();
-    m_layerID = geoId.layer();
-    m_surfaceID = geoId.sensitive();
-    m_x = pos.x();
-    m_y = pos.y();
-    m_z = pos.z();
-    m_t = parameters[2] / Acts::UnitConstants::ns;
-    m_lx = local.x();
-    m_ly = local.y();
-    m_cov_lx = 0.;  // @todo fill in
-    m_cov_ly = 0.;  // @todo fill in
+    entry.volumeID = geoId.volume();
+    entry.layerID = geoId.layer();
+    entry.surfaceID = geoId.sensitive();
+    entry.x = pos.x();
+    entry.y = pos.y();
+    entry.z = pos.z();
+    entry.t = parameters[2] / Acts::UnitConstants::ns;
+    entry.lx = local.x();
+    entry.ly = local.y();
+    entry.cov_lx = 0.;  // @todo fill in
+    entry.cov_ly = 0.;  // @todo fill in
     // get the cells and run through them
     const auto& cells = cluster.digitizationCells();
     auto detectorElement = dynamic_cast<const Acts::IdentifiedDetectorElement*>(
         clusterSurface.associatedDetectorElement());
     for (auto& cell : cells) {
       // cell identification
-      m_cell_IDx.push_back(cell.channel0);
-      m_cell_IDy.push_back(cell.channel1);
-      m_cell_data.push_back(cell.data);
+      entry.cell_IDx.push_back(cell.channel0);
+      entry.cell_IDy.push_back(cell.channel1);
+      entry.cell_data.push_back(cell.data);
       // for more we need the digitization module
       if (detectorElement && detectorElement->digitizationModule()) {
         auto digitationModule = detectorElement->digitizationModule();
@@ -148,8 +174,8 @@ FW::ProcessCode FW::RootPlanarClusterWriter::writeT(
             digitationModule->segmentation();
         // get the cell positions
         auto cellLocalPosition = segmentation.cellPosition(cell);
-        m_cell_lx.push_back(cellLocalPosition.x());
-        m_cell_ly.push_back(cellLocalPosition.y());
+        entry.cell_lx.push_back(cellLocalPosition.x());
+        entry.cell_ly.push_back(cellLocalPosition.y());
       }
     }
     // write hit-particle truth association
@@ -167,29 +193,29 @@ FW::ProcessCode FW::RootPlanarClusterWriter::writeT(
       clusterSurface.globalToLocal(ctx.geoContext, simHit.position(),
                                    simHit.unitDirection(), lPosition);
       // fill the variables
-      m_t_gx.push_back(simHit.position().x());
-      m_t_gy.push_back(simHit.position().y());
-      m_t_gz.push_back(simHit.position().z());
-      m_t_gt.push_back(simHit.time());
-      m_t_lx.push_back(lPosition.x());
-      m_t_ly.push_back(lPosition.y());
-      m_t_barcode.push_back(simHit.particleId().value());
+      entry.t_gx.push_back(simHit.position().x());
+      entry.t_gy.push_back(simHit.position().y());
+      entry.t_gz.push_back(simHit.position().z());
+      entry.t_gt.push_back(simHit.time());
+      entry.t_lx.push_back(lPosition.x());
+      entry.t_ly.push_back(lPosition.y());
+      entry.t_barcode.push_back(simHit.particleId().value());
     }
     // fill the tree
-    m_outputTree->Fill();
+    fill();
     // now reset
-    m_cell_IDx.clear();
-    m_cell_IDy.clear();
-    m_cell_lx.clear();
-    m_cell_ly.clear();
-    m_cell_data.clear();
-    m_t_gx.clear();
-    m_t_gy.clear();
-    m_t_gz.clear();
-    m_t_gt.clear();
-    m_t_lx.clear();
-    m_t_ly.clear();
-    m_t_barcode.clear();
+    entry.cell_IDx.clear();
+    entry.cell_IDy.clear();
+    entry.cell_lx.clear();
+    entry.cell_ly.clear();
+    entry.cell_data.clear();
+    entry.t_gx.clear();
+    entry.t_gy.clear();
+    entry.t_gz.clear();
+    entry.t_gt.clear();
+    entry.t_lx.clear();
+    entry.t_ly.clear();
+    entry.t_barcode.clear();
   }
   return FW::ProcessCode::SUCCESS;
 }
@@ -37,28 +37,35 @@ FW::RootSimHitWriter::RootSimHitWriter(const FW::RootSimHitWriter::Config& cfg,
     throw std::bad_alloc();
   }
 
-  // setup the branches
-  m_outputTree->Branch("event_id", &m_eventId);
-  m_outputTree->Branch("geometry_id", &m_geometryId, "geometry_id/l");
-  m_outputTree->Branch("particle_id", &m_particleId, "particle_id/l");
-  m_outputTree->Branch("tx", &m_tx);
-  m_outputTree->Branch("ty", &m_ty);
-  m_outputTree->Branch("tz", &m_tz);
-  m_outputTree->Branch("tt", &m_tt);
-  m_outputTree->Branch("tpx", &m_tpx);
-  m_outputTree->Branch("tpy", &m_tpy);
-  m_outputTree->Branch("tpz", &m_tpz);
-  m_outputTree->Branch("te", &m_te);
-  m_outputTree->Branch("deltapx", &m_deltapx);
-  m_outputTree->Branch("deltapy", &m_deltapy);
-  m_outputTree->Branch("deltapz", &m_deltapz);
-  m_outputTree->Branch("deltae", &m_deltae);
-  m_outputTree->Branch("index", &m_index);
-  m_outputTree->Branch("volume_id", &m_volumeId);
-  m_outputTree->Branch("boundary_id", &m_boundaryId);
-  m_outputTree->Branch("layer_id", &m_layerId);
-  m_outputTree->Branch("approach_id", &m_approachId);
-  m_outputTree->Branch("sensitive_id", &m_sensitiveId);
+  setupBranches(*m_outputTree, m_entry);
+  if (m_cfg.perThreadSegments) {
+    m_segments = std::make_unique<RootTreeSegments<Entry>>(
+        m_cfg.filePath, m_cfg.treeName, &RootSimHitWriter::setupBranches);
+  }
+}
+
+void FW::RootSimHitWriter::setupBranches(TTree& tree, Entry& entry) {
+  tree.Branch("event_id", &entry.eventId);
+  tree.Branch("geometry_id", &entry.geometryId, "geometry_id/l");
+  tree.Branch("particle_id", &entry.particleId, "particle_id/l");
+  tree.Branch("tx", &entry.tx);
+  tree.Branch("ty", &entry.ty);
+  tree.Branch("tz", &entry.tz);
+  tree.Branch("tt", &entry.tt);
+  tree.Branch("tpx", &entry.tpx);
+  tree.Branch("tpy", &entry.tpy);
+  tree.Branch("tpz", &entry.tpz);
+  tree.Branch("te", &entry.te);
+  tree.Branch("deltapx", &entry.deltapx);
+  tree.Branch("deltapy", &entry.deltapy);
+  tree.Branch("deltapz", &entry.deltapz);
+  tree.Branch("deltae", &entry.deltae);
+  tree.Branch("index", &entry.index);
+  tree.Branch("volume_id", &entry.volumeId);
+  tree.Branch("boundary_id", &entry.boundaryId);
+  tree.Branch("layer_id", &entry.layerId);
+  tree.Branch("approach_id", &entry.approachId);
+  tree.Branch("sensitive_id", &entry.sensitiveId);
 }
 
 FW::RootSimHitWriter::~RootSimHitWriter() {
@@ -70,6 +77,12 @@ FW::RootSimHitWriter::~RootSimHitWriter() {
 FW::ProcessCode FW::RootSimHitWriter::endRun() {
   if (m_outputFile) {
     m_outputFile->cd();
+    if (m_segments) {
+      auto numSegments = m_segments->size();
+      auto numEntries = m_segments->merge(*m_outputTree, m_entry);
+      ACTS_DEBUG("Merged " << numEntries << " hits from " << numSegments
+                           << " per-thread segments");
+    }
     m_outputTree->Write();
     ACTS_VERBOSE("Wrote hits to tree '" << m_cfg.treeName << "' in '"
                                         << m_cfg.filePath << "'");
@@ -84,40 +97,51 @@ FW::ProcessCode FW::RootSimHitWriter::writeT(const AlgorithmContext& ctx,
     return ProcessCode::ABORT;
   }
 
+  if (m_segments) {
+    // each thread fills its own segment and no locking is needed
+    return writeEntries(ctx, hits, m_segments->entry(),
+                        [&]() { m_segments->fill(ctx.eventNumber); });
+  }
   // ensure exclusive access to tree/file while writing
   std::lock_guard<std::mutex> lock(m_writeMutex);
+  return writeEntries(ctx, hits, m_entry, [&]() { m_outputTree->Fill(); });
+}
 
+template <typename fill_t>
+FW::ProcessCode FW::RootSimHitWriter::writeEntries(
+    const AlgorithmContext& ctx, const SimHitContainer& hits, Entry& entry,
+    fill_t&& fill) const {
   // Get the event number
-  m_eventId = ctx.eventNumber;
+  entry.eventId = ctx.eventNumber;
   for (const auto& hit : hits) {
-    m_particleId = hit.particleId().value();
-    m_geometryId = hit.geometryId().value();
+    entry.particleId = hit.particleId().value();
+    entry.geometryId = hit.geometryId().value();
     // write hit position
-    m_tx = hit.position4().x() / Acts::UnitConstants::mm;
-    m_ty = hit.position4().y() / Acts::UnitConstants::mm;
-    m_tz = hit.position4().z() / Acts::UnitConstants::mm;
-    m_tt = hit.position4().w() / Acts::UnitConstants::ns;
+    entry.tx = hit.position4().x() / Acts::UnitConstants::mm;
+    entry.ty = hit.position4().y() / Acts::UnitConstants::mm;
+    entry.tz = hit.position4().z() / Acts::UnitConstants::mm;
+    entry.tt = hit.position4().w() / Acts::UnitConstants::ns;
     // write four-momentum before interaction
-    m_tpx = hit.momentum4Before().x() / Acts::UnitConstants::GeV;
-    m_tpy = hit.momentum4Before().y() / Acts::UnitConstants::GeV;
-    m_tpz = hit.momentum4Before().z() / Acts::UnitConstants::GeV;
-    m_te = hit.momentum4Before().w() / Acts::UnitConstants::GeV;
+    entry.tpx = hit.momentum4Before().x() / Acts::UnitConstants::GeV;
+    entry.tpy = hit.momentum4Before().y() / Acts::UnitConstants::GeV;
+    entry.tpz = hit.momentum4Before().z() / Acts::UnitConstants::GeV;
+    entry.te = hit.momentum4Before().w() / Acts::UnitConstants::GeV;
     // write four-momentum change due to interaction
     const auto delta4 = hit.momentum4After() - hit.momentum4Before();
-    m_deltapx = delta4.x() / Acts::UnitConstants::GeV;
-    m_deltapy = delta4.y() / Acts::UnitConstants::GeV;
-    m_deltapz = delta4.z() / Acts::UnitConstants::GeV;
-    m_deltae = delta4.w() / Acts::UnitConstants::GeV;
+    entry.deltapx = delta4.x() / Acts::UnitConstants::GeV;
+    entry.deltapy = delta4.y() / Acts::UnitConstants::GeV;
+    entry.deltapz = delta4.z() / Acts::UnitConstants::GeV;
+    entry.deltae = delta4.w() / Acts::UnitConstants::GeV;
     // write hit index along trajectory
-    m_index = hit.index();
+    entry.index = hit.index();
     // decoded geometry for simplicity
-    m_volumeId = hit.geometryId().volume();
-    m_boundaryId = hit.geometryId().boundary();
-    m_layerId = hit.geometryId().layer();
-    m_approachId = hit.geometryId().approach();
-    m_sensitiveId = hit.geometryId().sensitive();
+    entry.volumeId = hit.geometryId().volume();
+    entry.boundaryId = hit.geometryId().boundary();
+    entry.layerId = hit.geometryId().layer();
+    entry.approachId = hit.geometryId().approach();
+    entry.sensitiveId = hit.geometryId().sensitive();
     // Fill the tree
-    m_outputTree->Fill();
+    fill();
   }
   return FW::ProcessCode::SUCCESS;
 }
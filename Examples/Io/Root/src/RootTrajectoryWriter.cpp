@@ -55,178 +55,188 @@ FW::RootTrajectoryWriter::RootTrajectoryWriter(
   m_outputFile->cd();
   m_outputTree =
       new TTree(m_cfg.outputTreename.c_str(), m_cfg.outputTreename.c_str());
-  if (m_outputTree == nullptr)
+  if (m_outputTree == nullptr) {
     throw std::bad_alloc();
-  else {
-    // I/O parameters
-    m_outputTree->Branch("event_nr", &m_eventNr);
-    m_outputTree->Branch("traj_nr", &m_trajNr);
-    m_outputTree->Branch("t_barcode", &m_t_barcode, "t_barcode/l");
-    m_outputTree->Branch("t_charge", &m_t_charge);
-    m_outputTree->Branch("t_time", &m_t_time);
-    m_outputTree->Branch("t_vx", &m_t_vx);
-    m_outputTree->Branch("t_vy", &m_t_vy);
-    m_outputTree->Branch("t_vz", &m_t_vz);
-    m_outputTree->Branch("t_px", &m_t_px);
-    m_outputTree->Branch("t_py", &m_t_py);
-    m_outputTree->Branch("t_pz", &m_t_pz);
-    m_outputTree->Branch("t_theta", &m_t_theta);
-    m_outputTree->Branch("t_phi", &m_t_phi);
-    m_outputTree->Branch("t_eta", &m_t_eta);
-    m_outputTree->Branch("t_pT", &m_t_pT);
-
-    m_outputTree->Branch("t_x", &m_t_x);
-    m_outputTree->Branch("t_y", &m_t_y);
-    m_outputTree->Branch("t_z", &m_t_z);
-    m_outputTree->Branch("t_r", &m_t_r);
-    m_outputTree->Branch("t_dx", &m_t_dx);
-    m_outputTree->Branch("t_dy", &m_t_dy);
-    m_outputTree->Branch("t_dz", &m_t_dz);
-    m_outputTree->Branch("t_eLOC0", &m_t_eLOC0);
-    m_outputTree->Branch("t_eLOC1", &m_t_eLOC1);
-    m_outputTree->Branch("t_ePHI", &m_t_ePHI);
-    m_outputTree->Branch("t_eTHETA", &m_t_eTHETA);
-    m_outputTree->Branch("t_eQOP", &m_t_eQOP);
-    m_outputTree->Branch("t_eT", &m_t_eT);
-
-    m_outputTree->Branch("nStates", &m_nStates);
-    m_outputTree->Branch("nMeasurements", &m_nMeasurements);
-    m_outputTree->Branch("volume_id", &m_volumeID);
-    m_outputTree->Branch("layer_id", &m_layerID);
-    m_outputTree->Branch("module_id", &m_moduleID);
-    m_outputTree->Branch("l_x_hit", &m_lx_hit);
-    m_outputTree->Branch("l_y_hit", &m_ly_hit);
-    m_outputTree->Branch("g_x_hit", &m_x_hit);
-    m_outputTree->Branch("g_y_hit", &m_y_hit);
-    m_outputTree->Branch("g_z_hit", &m_z_hit);
-    m_outputTree->Branch("res_x_hit", &m_res_x_hit);
-    m_outputTree->Branch("res_y_hit", &m_res_y_hit);
-    m_outputTree->Branch("err_x_hit", &m_err_x_hit);
-    m_outputTree->Branch("err_y_hit", &m_err_y_hit);
-    m_outputTree->Branch("pull_x_hit", &m_pull_x_hit);
-    m_outputTree->Branch("pull_y_hit", &m_pull_y_hit);
-    m_outputTree->Branch("dim_hit", &m_dim_hit);
-
-    m_outputTree->Branch("hasFittedParams", &m_hasFittedParams);
-    m_outputTree->Branch("eLOC0_fit", &m_eLOC0_fit);
-    m_outputTree->Branch("eLOC1_fit", &m_eLOC1_fit);
-    m_outputTree->Branch("ePHI_fit", &m_ePHI_fit);
-    m_outputTree->Branch("eTHETA_fit", &m_eTHETA_fit);
-    m_outputTree->Branch("eQOP_fit", &m_eQOP_fit);
-    m_outputTree->Branch("eT_fit", &m_eT_fit);
-    m_outputTree->Branch("err_eLOC0_fit", &m_err_eLOC0_fit);
-    m_outputTree->Branch("err_eLOC1_fit", &m_err_eLOC1_fit);
-    m_outputTree->Branch("err_ePHI_fit", &m_err_ePHI_fit);
-    m_outputTree->Branch("err_eTHETA_fit", &m_err_eTHETA_fit);
-    m_outputTree->Branch("err_eQOP_fit", &m_err_eQOP_fit);
-    m_outputTree->Branch("err_eT_fit", &m_err_eT_fit);
-
-    m_outputTree->Branch("nPredicted", &m_nPredicted);
-    m_outputTree->Branch("predicted", &m_prt);
-    m_outputTree->Branch("eLOC0_prt", &m_eLOC0_prt);
-    m_outputTree->Branch("eLOC1_prt", &m_eLOC1_prt);
-    m_outputTree->Branch("ePHI_prt", &m_ePHI_prt);
-    m_outputTree->Branch("eTHETA_prt", &m_eTHETA_prt);
-    m_outputTree->Branch("eQOP_prt", &m_eQOP_prt);
-    m_outputTree->Branch("eT_prt", &m_eT_prt);
-    m_outputTree->Branch("res_eLOC0_prt", &m_res_eLOC0_prt);
-    m_outputTree->Branch("res_eLOC1_prt", &m_res_eLOC1_prt);
-    m_outputTree->Branch("res_ePHI_prt", &m_res_ePHI_prt);
-    m_outputTree->Branch("res_eTHETA_prt", &m_res_eTHETA_prt);
-    m_outputTree->Branch("res_eQOP_prt", &m_res_eQOP_prt);
-    m_outputTree->Branch("res_eT_prt", &m_res_eT_prt);
-    m_outputTree->Branch("err_eLOC0_prt", &m_err_eLOC0_prt);
-    m_outputTree->Branch("err_eLOC1_prt", &m_err_eLOC1_prt);
-    m_outputTree->Branch("err_ePHI_prt", &m_err_ePHI_prt);
-    m_outputTree->Branch("err_eTHETA_prt", &m_err_eTHETA_prt);
-    m_outputTree->Branch("err_eQOP_prt", &m_err_eQOP_prt);
-    m_outputTree->Branch("err_eT_prt", &m_err_eT_prt);
-    m_outputTree->Branch("pull_eLOC0_prt", &m_pull_eLOC0_prt);
-    m_outputTree->Branch("pull_eLOC1_prt", &m_pull_eLOC1_prt);
-    m_outputTree->Branch("pull_ePHI_prt", &m_pull_ePHI_prt);
-    m_outputTree->Branch("pull_eTHETA_prt", &m_pull_eTHETA_prt);
-    m_outputTree->Branch("pull_eQOP_prt", &m_pull_eQOP_prt);
-    m_outputTree->Branch("pull_eT_prt", &m_pull_eT_prt);
-    m_outputTree->Branch("g_x_prt", &m_x_prt);
-    m_outputTree->Branch("g_y_prt", &m_y_prt);
-    m_outputTree->Branch("g_z_prt", &m_z_prt);
-    m_outputTree->Branch("px_prt", &m_px_prt);
-    m_outputTree->Branch("py_prt", &m_py_prt);
-    m_outputTree->Branch("pz_prt", &m_pz_prt);
-    m_outputTree->Branch("eta_prt", &m_eta_prt);
-    m_outputTree->Branch("pT_prt", &m_pT_prt);
-
-    m_outputTree->Branch("nFiltered", &m_nFiltered);
-    m_outputTree->Branch("filtered", &m_flt);
-    m_outputTree->Branch("eLOC0_flt", &m_eLOC0_flt);
-    m_outputTree->Branch("eLOC1_flt", &m_eLOC1_flt);
-    m_outputTree->Branch("ePHI_flt", &m_ePHI_flt);
-    m_outputTree->Branch("eTHETA_flt", &m_eTHETA_flt);
-    m_outputTree->Branch("eQOP_flt", &m_eQOP_flt);
-    m_outputTree->Branch("eT_flt", &m_eT_flt);
-    m_outputTree->Branch("res_eLOC0_flt", &m_res_eLOC0_flt);
-    m_outputTree->Branch("res_eLOC1_flt", &m_res_eLOC1_flt);
-    m_outputTree->Branch("res_ePHI_flt", &m_res_ePHI_flt);
-    m_outputTree->Branch("res_eTHETA_flt", &m_res_eTHETA_flt);
-    m_outputTree->Branch("res_eQOP_flt", &m_res_eQOP_flt);
-    m_outputTree->Branch("res_eT_flt", &m_res_eT_flt);
-    m_outputTree->Branch("err_eLOC0_flt", &m_err_eLOC0_flt);
-    m_outputTree->Branch("err_eLOC1_flt", &m_err_eLOC1_flt);
-    m_outputTree->Branch("err_ePHI_flt", &m_err_ePHI_flt);
-    m_outputTree->Branch("err_eTHETA_flt", &m_err_eTHETA_flt);
-    m_outputTree->Branch("err_eQOP_flt", &m_err_eQOP_flt);
-    m_outputTree->Branch("err_eT_flt", &m_err_eT_flt);
-    m_outputTree->Branch("pull_eLOC0_flt", &m_pull_eLOC0_flt);
-    m_outputTree->Branch("pull_eLOC1_flt", &m_pull_eLOC1_flt);
-    m_outputTree->Branch("pull_ePHI_flt", &m_pull_ePHI_flt);
-    m_outputTree->Branch("pull_eTHETA_flt", &m_pull_eTHETA_flt);
-    m_outputTree->Branch("pull_eQOP_flt", &m_pull_eQOP_flt);
-    m_outputTree->Branch("pull_eT_flt", &m_pull_eT_flt);
-    m_outputTree->Branch("g_x_flt", &m_x_flt);
-    m_outputTree->Branch("g_y_flt", &m_y_flt);
-    m_outputTree->Branch("g_z_flt", &m_z_flt);
-    m_outputTree->Branch("px_flt", &m_px_flt);
-    m_outputTree->Branch("py_flt", &m_py_flt);
-    m_outputTree->Branch("pz_flt", &m_pz_flt);
-    m_outputTree->Branch("eta_flt", &m_eta_flt);
-    m_outputTree->Branch("pT_flt", &m_pT_flt);
-    m_outputTree->Branch("chi2", &m_chi2);
-
-    m_outputTree->Branch("nSmoothed", &m_nSmoothed);
-    m_outputTree->Branch("smoothed", &m_smt);
-    m_outputTree->Branch("eLOC0_smt", &m_eLOC0_smt);
-    m_outputTree->Branch("eLOC1_smt", &m_eLOC1_smt);
-    m_outputTree->Branch("ePHI_smt", &m_ePHI_smt);
-    m_outputTree->Branch("eTHETA_smt", &m_eTHETA_smt);
-    m_outputTree->Branch("eQOP_smt", &m_eQOP_smt);
-    m_outputTree->Branch("eT_smt", &m_eT_smt);
-    m_outputTree->Branch("res_eLOC0_smt", &m_res_eLOC0_smt);
-    m_outputTree->Branch("res_eLOC1_smt", &m_res_eLOC1_smt);
-    m_outputTree->Branch("res_ePHI_smt", &m_res_ePHI_smt);
-    m_outputTree->Branch("res_eTHETA_smt", &m_res_eTHETA_smt);
-    m_outputTree->Branch("res_eQOP_smt", &m_res_eQOP_smt);
-    m_outputTree->Branch("res_eT_smt", &m_res_eT_smt);
-    m_outputTree->Branch("err_eLOC0_smt", &m_err_eLOC0_smt);
-    m_outputTree->Branch("err_eLOC1_smt", &m_err_eLOC1_smt);
-    m_outputTree->Branch("err_ePHI_smt", &m_err_ePHI_smt);
-    m_outputTree->Branch("err_eTHETA_smt", &m_err_eTHETA_smt);
-    m_outputTree->Branch("err_eQOP_smt", &m_err_eQOP_smt);
-    m_outputTree->Branch("err_eT_smt", &m_err_eT_smt);
-    m_outputTree->Branch("pull_eLOC0_smt", &m_pull_eLOC0_smt);
-    m_outputTree->Branch("pull_eLOC1_smt", &m_pull_eLOC1_smt);
-    m_outputTree->Branch("pull_ePHI_smt", &m_pull_ePHI_smt);
-    m_outputTree->Branch("pull_eTHETA_smt", &m_pull_eTHETA_smt);
-    m_outputTree->Branch("pull_eQOP_smt", &m_pull_eQOP_smt);
-    m_outputTree->Branch("pull_eT_smt", &m_pull_eT_smt);
-    m_outputTree->Branch("g_x_smt", &m_x_smt);
-    m_outputTree->Branch("g_y_smt", &m_y_smt);
-    m_outputTree->Branch("g_z_smt", &m_z_smt);
-    m_outputTree->Branch("px_smt", &m_px_smt);
-    m_outputTree->Branch("py_smt", &m_py_smt);
-    m_outputTree->Branch("pz_smt", &m_pz_smt);
-    m_outputTree->Branch("eta_smt", &m_eta_smt);
-    m_outputTree->Branch("pT_smt", &m_pT_smt);
   }
+
+  setupBranches(*m_outputTree, m_entry);
+  if (m_cfg.perThreadSegments) {
+    // segments are stored next to the file that also contains the tree
+    m_segments = std::make_unique<RootTreeSegments<Entry>>(
+        m_outputFile->GetName(), m_cfg.outputTreename,
+        &RootTrajectoryWriter::setupBranches);
+  }
+}
+
+void FW::RootTrajectoryWriter::setupBranches(TTree& tree, Entry& entry) {
+  // I/O parameters
+  tree.Branch("event_nr", &entry.eventNr);
+  tree.Branch("traj_nr", &entry.trajNr);
+  tree.Branch("t_barcode", &entry.t_barcode, "t_barcode/l");
+  tree.Branch("t_charge", &entry.t_charge);
+  tree.Branch("t_time", &entry.t_time);
+  tree.Branch("t_vx", &entry.t_vx);
+  tree.Branch("t_vy", &entry.t_vy);
+  tree.Branch("t_vz", &entry.t_vz);
+  tree.Branch("t_px", &entry.t_px);
+  tree.Branch("t_py", &entry.t_py);
+  tree.Branch("t_pz", &entry.t_pz);
+  tree.Branch("t_theta", &entry.t_theta);
+  tree.Branch("t_phi", &entry.t_phi);
+  tree.Branch("t_eta", &entry.t_eta);
+  tree.Branch("t_pT", &entry.t_pT);
+
+  tree.Branch("t_x", &entry.t_x);
+  tree.Branch("t_y", &entry.t_y);
+  tree.Branch("t_z", &entry.t_z);
+  tree.Branch("t_r", &entry.t_r);
+  tree.Branch("t_dx", &entry.t_dx);
+  tree.Branch("t_dy", &entry.t_dy);
+  tree.Branch("t_dz", &entry.t_dz);
+  tree.Branch("t_eLOC0", &entry.t_eLOC0);
+  tree.Branch("t_eLOC1", &entry.t_eLOC1);
+  tree.Branch("t_ePHI", &entry.t_ePHI);
+  tree.Branch("t_eTHETA", &entry.t_eTHETA);
+  tree.Branch("t_eQOP", &entry.t_eQOP);
+  tree.Branch("t_eT", &entry.t_eT);
+
+  tree.Branch("nStates", &entry.nStates);
+  tree.Branch("nMeasurements", &entry.nMeasurements);
+  tree.Branch("volume_id", &entry.volumeID);
+  tree.Branch("layer_id", &entry.layerID);
+  tree.Branch("module_id", &entry.moduleID);
+  tree.Branch("l_x_hit", &entry.lx_hit);
+  tree.Branch("l_y_hit", &entry.ly_hit);
+  tree.Branch("g_x_hit", &entry.x_hit);
+  tree.Branch("g_y_hit", &entry.y_hit);
+  tree.Branch("g_z_hit", &entry.z_hit);
+  tree.Branch("res_x_hit", &entry.res_x_hit);
+  tree.Branch("res_y_hit", &entry.res_y_hit);
+  tree.Branch("err_x_hit", &entry.err_x_hit);
+  tree.Branch("err_y_hit", &entry.err_y_hit);
+  tree.Branch("pull_x_hit", &entry.pull_x_hit);
+  tree.Branch("pull_y_hit", &entry.pull_y_hit);
+  tree.Branch("dim_hit", &entry.dim_hit);
+
+  tree.Branch("hasFittedParams", &entry.hasFittedParams);
+  tree.Branch("eLOC0_fit", &entry.eLOC0_fit);
+  tree.Branch("eLOC1_fit", &entry.eLOC1_fit);
+  tree.Branch("ePHI_fit", &entry.ePHI_fit);
+  tree.Branch("eTHETA_fit", &entry.eTHETA_fit);
+  tree.Branch("eQOP_fit", &entry.eQOP_fit);
+  tree.Branch("eT_fit", &entry.eT_fit);
+  tree.Branch("err_eLOC0_fit", &entry.err_eLOC0_fit);
+  tree.Branch("err_eLOC1_fit", &entry.err_eLOC1_fit);
+  tree.Branch("err_ePHI_fit", &entry.err_ePHI_fit);
+  tree.Branch("err_eTHETA_fit", &entry.err_eTHETA_fit);
+  tree.Branch("err_eQOP_fit", &entry.err_eQOP_fit);
+  tree.Branch("err_eT_fit", &entry.err_eT_fit);
+
+  tree.Branch("nPredicted", &entry.nPredicted);
+  tree.Branch("predicted", &entry.prt);
+  tree.Branch("eLOC0_prt", &entry.eLOC0_prt);
+  tree.Branch("eLOC1_prt", &entry.eLOC1_prt);
+  tree.Branch("ePHI_prt", &entry.ePHI_prt);
+  tree.Branch("eTHETA_prt", &entry.eTHETA_prt);
+  tree.Branch("eQOP_prt", &entry.eQOP_prt);
+  tree.Branch("eT_prt", &entry.eT_prt);
+  tree.Branch("res_eLOC0_prt", &entry.res_eLOC0_prt);
+  tree.Branch("res_eLOC1_prt", &entry.res_eLOC1_prt);
+  tree.Branch("res_ePHI_prt", &entry.res_ePHI_prt);
+  tree.Branch("res_eTHETA_prt", &entry.res_eTHETA_prt);
+  tree.Branch("res_eQOP_prt", &entry.res_eQOP_prt);
+  tree.Branch("res_eT_prt", &entry.res_eT_prt);
+  tree.Branch("err_eLOC0_prt", &entry.err_eLOC0_prt);
+  tree.Branch("err_eLOC1_prt", &entry.err_eLOC1_prt);
+  tree.Branch("err_ePHI_prt", &entry.err_ePHI_prt);
+  tree.Branch("err_eTHETA_prt", &entry.err_eTHETA_prt);
+  tree.Branch("err_eQOP_prt", &entry.err_eQOP_prt);
+  tree.Branch("err_eT_prt", &entry.err_eT_prt);
+  tree.Branch("pull_eLOC0_prt", &entry.pull_eLOC0_prt);
+  tree.Branch("pull_eLOC1_prt", &entry.pull_eLOC1_prt);
+  tree.Branch("pull_ePHI_prt", &entry.pull_ePHI_prt);
+  tree.Branch("pull_eTHETA_prt", &entry.pull_eTHETA_prt);
+  tree.Branch("pull_eQOP_prt", &entry.pull_eQOP_prt);
+  tree.Branch("pull_eT_prt", &entry.pull_eT_prt);
+  tree.Branch("g_x_prt", &entry.x_prt);
+  tree.Branch("g_y_prt", &entry.y_prt);
+  tree.Branch("g_z_prt", &entry.z_prt);
+  tree.Branch("px_prt", &entry.px_prt);
+  tree.Branch("py_prt", &entry.py_prt);
+  tree.Branch("pz_prt", &entry.pz_prt);
+  tree.Branch("eta_prt", &entry.eta_prt);
+  tree.Branch("pT_prt", &entry.pT_prt);
+
+  tree.Branch("nFiltered", &entry.nFiltered);
+  tree.Branch("filtered", &entry.flt);
+  tree.Branch("eLOC0_flt", &entry.eLOC0_flt);
+  tree.Branch("eLOC1_flt", &entry.eLOC1_flt);
+  tree.Branch("ePHI_flt", &entry.ePHI_flt);
+  tree.Branch("eTHETA_flt", &entry.eTHETA_flt);
+  tree.Branch("eQOP_flt", &entry.eQOP_flt);
+  tree.Branch("eT_flt", &entry.eT_flt);
+  tree.Branch("res_eLOC0_flt", &entry.res_eLOC0_flt);
+  tree.Branch("res_eLOC1_flt", &entry.res_eLOC1_flt);
+  tree.Branch("res_ePHI_flt", &entry.res_ePHI_flt);
+  tree.Branch("res_eTHETA_flt", &entry.res_eTHETA_flt);
+  tree.Branch("res_eQOP_flt", &entry.res_eQOP_flt);
+  tree.Branch("res_eT_flt", &entry.res_eT_flt);
+  tree.Branch("err_eLOC0_flt", &entry.err_eLOC0_flt);
+  tree.Branch("err_eLOC1_flt", &entry.err_eLOC1_flt);
+  tree.Branch("err_ePHI_flt", &entry.err_ePHI_flt);
+  tree.Branch("err_eTHETA_flt", &entry.err_eTHETA_flt);
+  tree.Branch("err_eQOP_flt", &entry.err_eQOP_flt);
+  tree.Branch("err_eT_flt", &entry.err_eT_flt);
+  tree.Branch("pull_eLOC0_flt", &entry.pull_eLOC0_flt);
+  tree.Branch("pull_eLOC1_flt", &entry.pull_eLOC1_flt);
+  tree.Branch("pull_ePHI_flt", &entry.pull_ePHI_flt);
+  tree.Branch("pull_eTHETA_flt", &entry.pull_eTHETA_flt);
+  tree.Branch("pull_eQOP_flt", &entry.pull_eQOP_flt);
+  tree.Branch("pull_eT_flt", &entry.pull_eT_flt);
+  tree.Branch("g_x_flt", &entry.x_flt);
+  tree.Branch("g_y_flt", &entry.y_flt);
+  tree.Branch("g_z_flt", &entry.z_flt);
+  tree.Branch("px_flt", &entry.px_flt);
+  tree.Branch("py_flt", &entry.py_flt);
+  tree.Branch("pz_flt", &entry.pz_flt);
+  tree.Branch("eta_flt", &entry.eta_flt);
+  tree.Branch("pT_flt", &entry.pT_flt);
+  tree.Branch("chi2", &entry.chi2);
+
+  tree.Branch("nSmoothed", &entry.nSmoothed);
+  tree.Branch("smoothed", &entry.smt);
+  tree.Branch("eLOC0_smt", &entry.eLOC0_smt);
+  tree.Branch("eLOC1_smt", &entry.eLOC1_smt);
+  tree.Branch("ePHI_smt", &entry.ePHI_smt);
+  tree.Branch("eTHETA_smt", &entry.eTHETA_smt);
+  tree.Branch("eQOP_smt", &entry.eQOP_smt);
+  tree.Branch("eT_smt", &entry.eT_smt);
+  tree.Branch("res_eLOC0_smt", &entry.res_eLOC0_smt);
+  tree.Branch("res_eLOC1_smt", &entry.res_eLOC1_smt);
+  tree.Branch("res_ePHI_smt", &entry.res_ePHI_smt);
+  tree.Branch("res_eTHETA_smt", &entry.res_eTHETA_smt);
+  tree.Branch("res_eQOP_smt", &entry.res_eQOP_smt);
+  tree.Branch("res_eT_smt", &entry.res_eT_smt);
+  tree.Branch("err_eLOC0_smt", &entry.err_eLOC0_smt);
+  tree.Branch("err_eLOC1_smt", &entry.err_eLOC1_smt);
+  tree.Branch("err_ePHI_smt", &entry.err_ePHI_smt);
+  tree.Branch("err_eTHETA_smt", &entry.err_eTHETA_smt);
+  tree.Branch("err_eQOP_smt", &entry.err_eQOP_smt);
+  tree.Branch("err_eT_smt", &entry.err_eT_smt);
+  tree.Branch("pull_eLOC0_smt", &entry.pull_eLOC0_smt);
+  tree.Branch("pull_eLOC1_smt", &entry.pull_eLOC1_smt);
+  tree.Branch("pull_ePHI_smt", &entry.pull_ePHI_smt);
+  tree.Branch("pull_eTHETA_smt", &entry.pull_eTHETA_smt);
+  tree.Branch("pull_eQOP_smt", &entry.pull_eQOP_smt);
+  tree.Branch("pull_eT_smt", &entry.pull_eT_smt);
+  tree.Branch("g_x_smt", &entry.x_smt);
+  tree.Branch("g_y_smt", &entry.y_smt);
+  tree.Branch("g_z_smt", &entry.z_smt);
+  tree.Branch("px_smt", &entry.px_smt);
+  tree.Branch("py_smt", &entry.py_smt);
+  tree.Branch("pz_smt", &entry.pz_smt);
+  tree.Branch("eta_smt", &entry.eta_smt);
+  tree.Branch("pT_smt", &entry.pT_smt);
 }
 
 FW::RootTrajectoryWriter::~RootTrajectoryWriter() {
@@ -238,6 +248,12 @@ FW::RootTrajectoryWriter::~RootTrajectoryWriter() {
 FW::ProcessCode FW::RootTrajectoryWriter::endRun() {
   if (m_outputFile) {
     m_outputFile->cd();
+    if (m_segments) {
+      auto numSegments = m_segments->size();
+      auto numEntries = m_segments->merge(*m_outputTree, m_entry);
+      ACTS_DEBUG("Merged " << numEntries << " trajectories from "
+                           << numSegments << " per-thread segments");
+    }
     m_outputTree->Write();
     ACTS_INFO("Write trajectories to tree '"
               << m_cfg.outputTreename << "' in '"
@@ -251,22 +267,34 @@ FW::ProcessCode FW::RootTrajectoryWriter::writeT(
   if (m_outputFile == nullptr)
     return ProcessCode::SUCCESS;
 
+  if (m_segments) {
+    // each thread fills its own segment and no locking is needed
+    return writeEntries(ctx, trajectories, m_segments->entry(),
+                        [&]() { m_segments->fill(ctx.eventNumber); });
+  }
+  // Exclusive access to the tree while writing
+  std::lock_guard<std::mutex> lock(m_writeMutex);
+  return writeEntries(ctx, trajectories, m_entry,
+                      [&]() { m_outputTree->Fill(); });
+}
+
+template <typename fill_t>
+FW::ProcessCode FW::RootTrajectoryWriter::writeEntries(
+    const AlgorithmContext& ctx, const TrajectoryContainer& trajectories,
+    Entry& entry, fill_t&& fill) const {
   auto& gctx = ctx.geoContext;
 
   // read truth particles from input collection
   const auto& particles =
       ctx.eventStore.get<SimParticleContainer>(m_cfg.inputParticles);
 
-  // Exclusive access to the tree while writing
-  std::lock_guard<std::mutex> lock(m_writeMutex);
-
   // Get the event number
-  m_eventNr = ctx.eventNumber;
+  entry.eventNr = ctx.eventNumber;
 
   // Loop over the trajectories
   int iTraj = 0;
   for (const auto& traj : trajectories) {
-    m_trajNr = iTraj;
+    entry.trajNr = iTraj;
 
     // The trajectory entry indices and the multiTrajectory
     const auto& [trackTips, mj] = traj.trajectory();
@@ -286,67 +314,70 @@ FW::ProcessCode FW::RootTrajectoryWriter::writeT(
     // Collect the trajectory summary info
     auto trajState =
         Acts::MultiTrajectoryHelpers::trajectoryState(mj, trackTip);
-    m_nMeasurements = trajState.nMeasurements;
-    m_nStates = trajState.nStates;
+    entry.nMeasurements = trajState.nMeasurements;
+    entry.nStates = trajState.nStates;
 
     // Get the majority truth particle to this track
     const auto particleHitCount = traj.identifyMajorityParticle(trackTip);
     if (not particleHitCount.empty()) {
       // Get the barcode of the majority truth particle
-      m_t_barcode = particleHitCount.front().particleId.value();
+      entry.t_barcode = particleHitCount.front().particleId.value();
       // Find the truth particle via the barcode
-      auto ip = particles.find(m_t_barcode);
+      auto ip = particles.find(entry.t_barcode);
       if (ip != particles.end()) {
         const auto& particle = *ip;
-        ACTS_DEBUG("Find the truth particle with barcode = " << m_t_barcode);
+        ACTS_DEBUG("Find the truth particle with barcode = "
+                   << entry.t_barcode);
         // Get the truth particle info at vertex
         const auto p = particle.absMomentum();
-        m_t_charge = particle.charge();
-        m_t_time = particle.time();
-        m_t_vx = particle.position().x();
-        m_t_vy = particle.position().y();
-        m_t_vz = particle.position().z();
-        m_t_px = p * particle.unitDirection().x();
-        m_t_py = p * particle.unitDirection().y();
-        m_t_pz = p * particle.unitDirection().z();
-        m_t_theta = theta(particle.unitDirection());
-        m_t_phi = phi(particle.unitDirection());
-        m_t_eta = eta(particle.unitDirection());
-        m_t_pT = p * perp(particle.unitDirection());
+        entry.t_charge = particle.charge();
+        entry.t_time = particle.time();
+        entry.t_vx = particle.position().x();
+        entry.t_vy = particle.position().y();
+        entry.t_vz = particle.position().z();
+        entry.t_px = p * particle.unitDirection().x();
+        entry.t_py = p * particle.unitDirection().y();
+        entry.t_pz = p * particle.unitDirection().z();
+        entry.t_theta = theta(particle.unitDirection());
+        entry.t_phi = phi(particle.unitDirection());
+        entry.t_eta = eta(particle.unitDirection());
+        entry.t_pT = p * perp(particle.unitDirection());
       } else {
-        ACTS_WARNING("Truth particle with barcode = " << m_t_barcode
+        ACTS_WARNING("Truth particle with barcode = " << entry.t_barcode
                                                       << " not found!");
       }
     }
 
     // Get the fitted track parameter
-    m_hasFittedParams = false;
+    entry.hasFittedParams = false;
     if (traj.hasTrackParameters(trackTip)) {
-      m_hasFittedParams = true;
+      entry.hasFittedParams = true;
       const auto& boundParam = traj.trackParameters(trackTip);
       const auto& parameter = boundParam.parameters();
       const auto& covariance = *boundParam.covariance();
-      m_eLOC0_fit = parameter[Acts::ParDef::eLOC_0];
-      m_eLOC1_fit = parameter[Acts::ParDef::eLOC_1];
-      m_ePHI_fit = parameter[Acts::ParDef::ePHI];
-      m_eTHETA_fit = parameter[Acts::ParDef::eTHETA];
-      m_eQOP_fit = parameter[Acts::ParDef::eQOP];
-      m_eT_fit = parameter[Acts::ParDef::eT];
-      m_err_eLOC0_fit =
+      entry.eLOC0_fit = parameter[Acts::ParDef::eLOC_0];
+      entry.eLOC1_fit = parameter[Acts::ParDef::eLOC_1];
+      entry.ePHI_fit = parameter[Acts::ParDef::ePHI];
+      entry.eTHETA_fit = parameter[Acts::ParDef::eTHETA];
+      entry.eQOP_fit = parameter[Acts::ParDef::eQOP];
+      entry.eT_fit = parameter[Acts::ParDef::eT];
+      entry.err_eLOC0_fit =
           sqrt(covariance(Acts::ParDef::eLOC_0, Acts::ParDef::eLOC_0));
-      m_err_eLOC1_fit =
+      entry.err_eLOC1_fit =
           sqrt(covariance(Acts::ParDef::eLOC_1, Acts::ParDef::eLOC_1));
-      m_err_ePHI_fit = sqrt(covariance(Acts::ParDef::ePHI, Acts::ParDef::ePHI));
-      m_err_eTHETA_fit =
+      entry.err_ePHI_fit =
+          sqrt(covariance(Acts::ParDef::ePHI, Acts::ParDef::ePHI));
+      entry.err_eTHETA_fit =
           sqrt(covariance(Acts::ParDef::eTHETA, Acts::ParDef::eTHETA));
-      m_err_eQOP_fit = sqrt(covariance(Acts::ParDef::eQOP, Acts::ParDef::eQOP));
-      m_err_eT_fit = sqrt(covariance(Acts::ParDef::eT, Acts::ParDef::eT));
+      entry.err_eQOP_fit =
+          sqrt(covariance(Acts::ParDef::eQOP, Acts::ParDef::eQOP));
+      entry.err_eT_fit = sqrt(covariance(Acts::ParDef::eT, Acts::ParDef::eT));
     }
 
     // Get the trackStates on the trajectory
-    m_nPredicted = 0;
-    m_nFiltered = 0;
-    m_nSmoothed = 0;
+    entry.nPredicted = 0;
+    entry.nFiltered = 0;
+    entry.nSmoothed = 0;
     mj.visitBackwards(trackTip, [&](const auto& state) {
       // we only fill the track states with non-outlier measurement
       auto typeFlags = state.typeFlags();
@@ -356,9 +387,9 @@ FW::ProcessCode FW::RootTrajectoryWriter::writeT(
 
       // get the geometry ID
       auto geoID = state.referenceSurface().geoID();
-      m_volumeID.push_back(geoID.volume());
-      m_layerID.push_back(geoID.layer());
-      m_moduleID.push_back(geoID.sensitive());
+      entry.volumeID.push_back(geoID.volume());
+      entry.layerID.push_back(geoID.layer());
+      entry.moduleID.push_back(geoID.sensitive());
 
       auto meas = std::get<Measurement>(*state.uncalibrated());
 
@@ -376,11 +407,11 @@ FW::ProcessCode FW::RootTrajectoryWriter::writeT(
       // float resY = sqrt(cov(Acts::ParDef::eLOC_1, Acts::ParDef::eLOC_1));
 
       // push the measurement info
-      m_lx_hit.push_back(local.x());
-      m_ly_hit.push_back(local.y());
-      m_x_hit.push_back(global.x());
-      m_y_hit.push_back(global.y());
-      m_z_hit.push_back(global.z());
+      entry.lx_hit.push_back(local.x());
+      entry.ly_hit.push_back(local.y());
+      entry.x_hit.push_back(global.x());
+      entry.y_hit.push_back(global.y());
+      entry.z_hit.push_back(global.z());
 
       // get the truth hit corresponding to this trackState
       const auto& truthHit = state.uncalibrated().truthHit();
@@ -390,13 +421,13 @@ FW::ProcessCode FW::RootTrajectoryWriter::writeT(
           gctx, truthHit.position(), truthHit.unitDirection(), truthlocal);
 
       // push the truth hit info
-      m_t_x.push_back(truthHit.position().x());
-      m_t_y.push_back(truthHit.position().y());
-      m_t_z.push_back(truthHit.position().z());
-      m_t_r.push_back(perp(truthHit.position()));
-      m_t_dx.push_back(truthHit.unitDirection().x());
-      m_t_dy.push_back(truthHit.unitDirection().y());
-      m_t_dz.push_back(truthHit.unitDirection().z());
+      entry.t_x.push_back(truthHit.position().x());
+      entry.t_y.push_back(truthHit.position().y());
+      entry.t_z.push_back(truthHit.position().z());
+      entry.t_r.push_back(perp(truthHit.position()));
+      entry.t_dx.push_back(truthHit.unitDirection().x());
+      entry.t_dy.push_back(truthHit.unitDirection().y());
+      entry.t_dz.push_back(truthHit.unitDirection().z());
 
       // get the truth track parameter at this track State
       float truthLOC0 = 0, truthLOC1 = 0, truthPHI = 0, truthTHETA = 0,
@@ -406,22 +437,22 @@ FW::ProcessCode FW::RootTrajectoryWriter::writeT(
       truthPHI = phi(truthHit.unitDirection());
       truthTHETA = theta(truthHit.unitDirection());
       truthQOP =
-          m_t_charge / truthHit.momentum4Before().template head<3>().norm();
+          entry.t_charge / truthHit.momentum4Before().template head<3>().norm();
       truthTIME = truthHit.time();
 
       // push the truth track parameter at this track State
-      m_t_eLOC0.push_back(truthLOC0);
-      m_t_eLOC1.push_back(truthLOC1);
-      m_t_ePHI.push_back(truthPHI);
-      m_t_eTHETA.push_back(truthTHETA);
-      m_t_eQOP.push_back(truthQOP);
-      m_t_eT.push_back(truthTIME);
+      entry.t_eLOC0.push_back(truthLOC0);
+      entry.t_eLOC1.push_back(truthLOC1);
+      entry.t_ePHI.push_back(truthPHI);
+      entry.t_eTHETA.push_back(truthTHETA);
+      entry.t_eQOP.push_back(truthQOP);
+      entry.t_eT.push_back(truthTIME);
 
       // get the predicted parameter
       bool predicted = false;
       if (state.hasPredicted()) {
         predicted = true;
-        m_nPredicted++;
+        entry.nPredicted++;
         Acts::BoundParameters parameter(
             gctx, state.predictedCovariance(), state.predicted(),
             state.referenceSurface().getSharedPtr());
@@ -430,492 +461,495 @@ FW::ProcessCode FW::RootTrajectoryWriter::writeT(
         auto H = meas.projector();
         auto resCov = cov + H * covariance * H.transpose();
         auto residual = meas.residual(parameter);
-        m_res_x_hit.push_back(residual(Acts::ParDef::eLOC_0));
-        m_res_y_hit.push_back(residual(Acts::ParDef::eLOC_1));
-        m_err_x_hit.push_back(
+        entry.res_x_hit.push_back(residual(Acts::ParDef::eLOC_0));
+        entry.res_y_hit.push_back(residual(Acts::ParDef::eLOC_1));
+        entry.err_x_hit.push_back(
             sqrt(resCov(Acts::ParDef::eLOC_0, Acts::ParDef::eLOC_0)));
-        m_err_y_hit.push_back(
+        entry.err_y_hit.push_back(
             sqrt(resCov(Acts::ParDef::eLOC_1, Acts::ParDef::eLOC_1)));
-        m_pull_x_hit.push_back(
+        entry.pull_x_hit.push_back(
             residual(Acts::ParDef::eLOC_0) /
             sqrt(resCov(Acts::ParDef::eLOC_0, Acts::ParDef::eLOC_0)));
-        m_pull_y_hit.push_back(
+        entry.pull_y_hit.push_back(
             residual(Acts::ParDef::eLOC_1) /
             sqrt(resCov(Acts::ParDef::eLOC_1, Acts::ParDef::eLOC_1)));
-        m_dim_hit.push_back(state.calibratedSize());
+        entry.dim_hit.push_back(state.calibratedSize());
 
         // predicted parameter
-        m_eLOC0_prt.push_back(parameter.parameters()[Acts::ParDef::eLOC_0]);
-        m_eLOC1_prt.push_back(parameter.parameters()[Acts::ParDef::eLOC_1]);
-        m_ePHI_prt.push_back(parameter.parameters()[Acts::ParDef::ePHI]);
-        m_eTHETA_prt.push_back(parameter.parameters()[Acts::ParDef::eTHETA]);
-        m_eQOP_prt.push_back(parameter.parameters()[Acts::ParDef::eQOP]);
-        m_eT_prt.push_back(parameter.parameters()[Acts::ParDef::eT]);
+        entry.eLOC0_prt.push_back(parameter.parameters()[Acts::ParDef::eLOC_0]);
+        entry.eLOC1_prt.push_back(parameter.parameters()[Acts::ParDef::eLOC_1]);
+        entry.ePHI_prt.push_back(parameter.parameters()[Acts::ParDef::ePHI]);
+        entry.eTHETA_prt.push_back(
+            parameter.parameters()[Acts::ParDef::eTHETA]);
+        entry.eQOP_prt.push_back(parameter.parameters()[Acts::ParDef::eQOP]);
+        entry.eT_prt.push_back(parameter.parameters()[Acts::ParDef::eT]);
 
         // predicted residual
-        m_res_eLOC0_prt.push_back(parameter.parameters()[Acts::ParDef::eLOC_0] -
-                                  truthLOC0);
-        m_res_eLOC1_prt.push_back(parameter.parameters()[Acts::ParDef::eLOC_1] -
-                                  truthLOC1);
-        m_res_ePHI_prt.push_back(parameter.parameters()[Acts::ParDef::ePHI] -
-                                 truthPHI);
-        m_res_eTHETA_prt.push_back(
+        entry.res_eLOC0_prt.push_back(
+            parameter.parameters()[Acts::ParDef::eLOC_0] - truthLOC0);
+        entry.res_eLOC1_prt.push_back(
+            parameter.parameters()[Acts::ParDef::eLOC_1] - truthLOC1);
+        entry.res_ePHI_prt.push_back(
+            parameter.parameters()[Acts::ParDef::ePHI] - truthPHI);
+        entry.res_eTHETA_prt.push_back(
             parameter.parameters()[Acts::ParDef::eTHETA] - truthTHETA);
-        m_res_eQOP_prt.push_back(parameter.parameters()[Acts::ParDef::eQOP] -
-                                 truthQOP);
-        m_res_eT_prt.push_back(parameter.parameters()[Acts::ParDef::eT] -
-                               truthTIME);
+        entry.res_eQOP_prt.push_back(
+            parameter.parameters()[Acts::ParDef::eQOP] - truthQOP);
+        entry.res_eT_prt.push_back(
+            parameter.parameters()[Acts::ParDef::eT] - truthTIME);
 
         // predicted parameter error
-        m_err_eLOC0_prt.push_back(
+        entry.err_eLOC0_prt.push_back(
             sqrt(covariance(Acts::ParDef::eLOC_0, Acts::ParDef::eLOC_0)));
-        m_err_eLOC1_prt.push_back(
+        entry.err_eLOC1_prt.push_back(
             sqrt(covariance(Acts::ParDef::eLOC_1, Acts::ParDef::eLOC_1)));
-        m_err_ePHI_prt.push_back(
+        entry.err_ePHI_prt.push_back(
             sqrt(covariance(Acts::ParDef::ePHI, Acts::ParDef::ePHI)));
-        m_err_eTHETA_prt.push_back(
+        entry.err_eTHETA_prt.push_back(
             sqrt(covariance(Acts::ParDef::eTHETA, Acts::ParDef::eTHETA)));
-        m_err_eQOP_prt.push_back(
+        entry.err_eQOP_prt.push_back(
             sqrt(covariance(Acts::ParDef::eQOP, Acts::ParDef::eQOP)));
-        m_err_eT_prt.push_back(
+        entry.err_eT_prt.push_back(
             sqrt(covariance(Acts::ParDef::eT, Acts::ParDef::eT)));
 
         // predicted parameter pull
-        m_pull_eLOC0_prt.push_back(
+        entry.pull_eLOC0_prt.push_back(
             (parameter.parameters()[Acts::ParDef::eLOC_0] - truthLOC0) /
             sqrt(covariance(Acts::ParDef::eLOC_0, Acts::ParDef::eLOC_0)));
-        m_pull_eLOC1_prt.push_back(
+        entry.pull_eLOC1_prt.push_back(
             (parameter.parameters()[Acts::ParDef::eLOC_1] - truthLOC1) /
             sqrt(covariance(Acts::ParDef::eLOC_1, Acts::ParDef::eLOC_1)));
-        m_pull_ePHI_prt.push_back(
+        entry.pull_ePHI_prt.push_back(
             (parameter.parameters()[Acts::ParDef::ePHI] - truthPHI) /
             sqrt(covariance(Acts::ParDef::ePHI, Acts::ParDef::ePHI)));
-        m_pull_eTHETA_prt.push_back(
+        entry.pull_eTHETA_prt.push_back(
             (parameter.parameters()[Acts::ParDef::eTHETA] - truthTHETA) /
             sqrt(covariance(Acts::ParDef::eTHETA, Acts::ParDef::eTHETA)));
-        m_pull_eQOP_prt.push_back(
+        entry.pull_eQOP_prt.push_back(
             (parameter.parameters()[Acts::ParDef::eQOP] - truthQOP) /
             sqrt(covariance(Acts::ParDef::eQOP, Acts::ParDef::eQOP)));
-        m_pull_eT_prt.push_back(
+        entry.pull_eT_prt.push_back(
             (parameter.parameters()[Acts::ParDef::eT] - truthTIME) /
             sqrt(covariance(Acts::ParDef::eT, Acts::ParDef::eT)));
 
         // further predicted parameter info
-        m_x_prt.push_back(parameter.position().x());
-        m_y_prt.push_back(parameter.position().y());
-        m_z_prt.push_back(parameter.position().z());
-        m_px_prt.push_back(parameter.momentum().x());
-        m_py_prt.push_back(parameter.momentum().y());
-        m_pz_prt.push_back(parameter.momentum().z());
-        m_pT_prt.push_back(parameter.pT());
-        m_eta_prt.push_back(eta(parameter.position()));
+        entry.x_prt.push_back(parameter.position().x());
+        entry.y_prt.push_back(parameter.position().y());
+        entry.z_prt.push_back(parameter.position().z());
+        entry.px_prt.push_back(parameter.momentum().x());
+        entry.py_prt.push_back(parameter.momentum().y());
+        entry.pz_prt.push_back(parameter.momentum().z());
+        entry.pT_prt.push_back(parameter.pT());
+        entry.eta_prt.push_back(eta(parameter.position()));
       } else {
         // push default values if no predicted parameter
-        m_res_x_hit.push_back(-99.);
-        m_res_y_hit.push_back(-99.);
-        m_err_x_hit.push_back(-99.);
-        m_err_y_hit.push_back(-99.);
-        m_pull_x_hit.push_back(-99.);
-        m_pull_y_hit.push_back(-99.);
-        m_dim_hit.push_back(-99.);
-        m_eLOC0_prt.push_back(-99.);
-        m_eLOC1_prt.push_back(-99.);
-        m_ePHI_prt.push_back(-99.);
-        m_eTHETA_prt.push_back(-99.);
-        m_eQOP_prt.push_back(-99.);
-        m_eT_prt.push_back(-99.);
-        m_res_eLOC0_prt.push_back(-99.);
-        m_res_eLOC1_prt.push_back(-99.);
-        m_res_ePHI_prt.push_back(-99.);
-        m_res_eTHETA_prt.push_back(-99.);
-        m_res_eQOP_prt.push_back(-99.);
-        m_res_eT_prt.push_back(-99.);
-        m_err_eLOC0_prt.push_back(-99);
-        m_err_eLOC1_prt.push_back(-99);
-        m_err_ePHI_prt.push_back(-99);
-        m_err_eTHETA_prt.push_back(-99);
-        m_err_eQOP_prt.push_back(-99);
-        m_err_eT_prt.push_back(-99);
-        m_pull_eLOC0_prt.push_back(-99.);
-        m_pull_eLOC1_prt.push_back(-99.);
-        m_pull_ePHI_prt.push_back(-99.);
-        m_pull_eTHETA_prt.push_back(-99.);
-        m_pull_eQOP_prt.push_back(-99.);
-        m_pull_eT_prt.push_back(-99.);
-        m_x_prt.push_back(-99.);
-        m_y_prt.push_back(-99.);
-        m_z_prt.push_back(-99.);
-        m_px_prt.push_back(-99.);
-        m_py_prt.push_back(-99.);
-        m_pz_prt.push_back(-99.);
-        m_pT_prt.push_back(-99.);
-        m_eta_prt.push_back(-99.);
+        entry.res_x_hit.push_back(-99.);
+        entry.res_y_hit.push_back(-99.);
+        entry.err_x_hit.push_back(-99.);
+        entry.err_y_hit.push_back(-99.);
+        entry.pull_x_hit.push_back(-99.);
+        entry.pull_y_hit.push_back(-99.);
+        entry.dim_hit.push_back(-99.);
+        entry.eLOC0_prt.push_back(-99.);
+        entry.eLOC1_prt.push_back(-99.);
+        entry.ePHI_prt.push_back(-99.);
+        entry.eTHETA_prt.push_back(-99.);
+        entry.eQOP_prt.push_back(-99.);
+        entry.eT_prt.push_back(-99.);
+        entry.res_eLOC0_prt.push_back(-99.);
+        entry.res_eLOC1_prt.push_back(-99.);
+        entry.res_ePHI_prt.push_back(-99.);
+        entry.res_eTHETA_prt.push_back(-99.);
+        entry.res_eQOP_prt.push_back(-99.);
+        entry.res_eT_prt.push_back(-99.);
+        entry.err_eLOC0_prt.push_back(-99);
+        entry.err_eLOC1_prt.push_back(-99);
+        entry.err_ePHI_prt.push_back(-99);
+        entry.err_eTHETA_prt.push_back(-99);
+        entry.err_eQOP_prt.push_back(-99);
+        entry.err_eT_prt.push_back(-99);
+        entry.pull_eLOC0_prt.push_back(-99.);
+        entry.pull_eLOC1_prt.push_back(-99.);
+        entry.pull_ePHI_prt.push_back(-99.);
+        entry.pull_eTHETA_prt.push_back(-99.);
+        entry.pull_eQOP_prt.push_back(-99.);
+        entry.pull_eT_prt.push_back(-99.);
+        entry.x_prt.push_back(-99.);
+        entry.y_prt.push_back(-99.);
+        entry.z_prt.push_back(-99.);
+        entry.px_prt.push_back(-99.);
+        entry.py_prt.push_back(-99.);
+        entry.pz_prt.push_back(-99.);
+        entry.pT_prt.push_back(-99.);
+        entry.eta_prt.push_back(-99.);
       }
 
       // get the filtered parameter
       bool filtered = false;
       if (state.hasFiltered()) {
         filtered = true;
-        m_nFiltered++;
+        entry.nFiltered++;
         Acts::BoundParameters parameter(
             gctx, state.filteredCovariance(), state.filtered(),
             state.referenceSurface().getSharedPtr());
         auto covariance = state.filteredCovariance();
         // filtered parameter
-        m_eLOC0_flt.push_back(parameter.parameters()[Acts::ParDef::eLOC_0]);
-        m_eLOC1_flt.push_back(parameter.parameters()[Acts::ParDef::eLOC_1]);
-        m_ePHI_flt.push_back(parameter.parameters()[Acts::ParDef::ePHI]);
-        m_eTHETA_flt.push_back(parameter.parameters()[Acts::ParDef::eTHETA]);
-        m_eQOP_flt.push_back(parameter.parameters()[Acts::ParDef::eQOP]);
-        m_eT_flt.push_back(parameter.parameters()[Acts::ParDef::eT]);
+        entry.eLOC0_flt.push_back(parameter.parameters()[Acts::ParDef::eLOC_0]);
+        entry.eLOC1_flt.push_back(parameter.parameters()[Acts::ParDef::eLOC_1]);
+        entry.ePHI_flt.push_back(parameter.parameters()[Acts::ParDef::ePHI]);
+        entry.eTHETA_flt.push_back(
+            parameter.parameters()[Acts::ParDef::eTHETA]);
+        entry.eQOP_flt.push_back(parameter.parameters()[Acts::ParDef::eQOP]);
+        entry.eT_flt.push_back(parameter.parameters()[Acts::ParDef::eT]);
 
         // filtered residual
-        m_res_eLOC0_flt.push_back(parameter.parameters()[Acts::ParDef::eLOC_0] -
-                                  truthLOC0);
-        m_res_eLOC1_flt.push_back(parameter.parameters()[Acts::ParDef::eLOC_1] -
-                                  truthLOC1);
-        m_res_ePHI_flt.push_back(parameter.parameters()[Acts::ParDef::ePHI] -
-                                 truthPHI);
-        m_res_eTHETA_flt.push_back(
+        entry.res_eLOC0_flt.push_back(
+            parameter.parameters()[Acts::ParDef::eLOC_0] - truthLOC0);
+        entry.res_eLOC1_flt.push_back(
+            parameter.parameters()[Acts::ParDef::eLOC_1] - truthLOC1);
+        entry.res_ePHI_flt.push_back(
+            parameter.parameters()[Acts::ParDef::ePHI] - truthPHI);
+        entry.res_eTHETA_flt.push_back(
             parameter.parameters()[Acts::ParDef::eTHETA] - truthTHETA);
-        m_res_eQOP_flt.push_back(parameter.parameters()[Acts::ParDef::eQOP] -
-                                 truthQOP);
-        m_res_eT_flt.push_back(parameter.parameters()[Acts::ParDef::eT] -
-                               truthTIME);
+        entry.res_eQOP_flt.push_back(
+            parameter.parameters()[Acts::ParDef::eQOP] - truthQOP);
+        entry.res_eT_flt.push_back(
+            parameter.parameters()[Acts::ParDef::eT] - truthTIME);
 
         // filtered parameter error
-        m_err_eLOC0_flt.push_back(
+        entry.err_eLOC0_flt.push_back(
             sqrt(covariance(Acts::ParDef::eLOC_0, Acts::ParDef::eLOC_0)));
-        m_err_eLOC1_flt.push_back(
+        entry.err_eLOC1_flt.push_back(
             sqrt(covariance(Acts::ParDef::eLOC_1, Acts::ParDef::eLOC_1)));
-        m_err_ePHI_flt.push_back(
+        entry.err_ePHI_flt.push_back(
             sqrt(covariance(Acts::ParDef::ePHI, Acts::ParDef::ePHI)));
-        m_err_eTHETA_flt.push_back(
+        entry.err_eTHETA_flt.push_back(
             sqrt(covariance(Acts::ParDef::eTHETA, Acts::ParDef::eTHETA)));
-        m_err_eQOP_flt.push_back(
+        entry.err_eQOP_flt.push_back(
             sqrt(covariance(Acts::ParDef::eQOP, Acts::ParDef::eQOP)));
-        m_err_eT_flt.push_back(
+        entry.err_eT_flt.push_back(
             sqrt(covariance(Acts::ParDef::eT, Acts::ParDef::eT)));
 
         // filtered parameter pull
-        m_pull_eLOC0_flt.push_back(
+        entry.pull_eLOC0_flt.push_back(
             (parameter.parameters()[Acts::ParDef::eLOC_0] - truthLOC0) /
             sqrt(covariance(Acts::ParDef::eLOC_0, Acts::ParDef::eLOC_0)));
-        m_pull_eLOC1_flt.push_back(
+        entry.pull_eLOC1_flt.push_back(
             (parameter.parameters()[Acts::ParDef::eLOC_1] - truthLOC1) /
             sqrt(covariance(Acts::ParDef::eLOC_1, Acts::ParDef::eLOC_1)));
-        m_pull_ePHI_flt.push_back(
+        entry.pull_ePHI_flt.push_back(
             (parameter.parameters()[Acts::ParDef::ePHI] - truthPHI) /
             sqrt(covariance(Acts::ParDef::ePHI, Acts::ParDef::ePHI)));
-        m_pull_eTHETA_flt.push_back(
+        entry.pull_eTHETA_flt.push_back(
             (parameter.parameters()[Acts::ParDef::eTHETA] - truthTHETA) /
             sqrt(covariance(Acts::ParDef::eTHETA, Acts::ParDef::eTHETA)));
-        m_pull_eQOP_flt.push_back(
+        entry.pull_eQOP_flt.push_back(
             (parameter.parameters()[Acts::ParDef::eQOP] - truthQOP) /
             sqrt(covariance(Acts::ParDef::eQOP, Acts::ParDef::eQOP)));
-        m_pull_eT_flt.push_back(
+        entry.pull_eT_flt.push_back(
             (parameter.parameters()[Acts::ParDef::eT] - truthTIME) /
             sqrt(covariance(Acts::ParDef::eT, Acts::ParDef::eT)));
 
         // more filtered parameter info
-        m_x_flt.push_back(parameter.position().x());
-        m_y_flt.push_back(parameter.position().y());
-        m_z_flt.push_back(parameter.position().z());
-        m_px_flt.push_back(parameter.momentum().x());
-        m_py_flt.push_back(parameter.momentum().y());
-        m_pz_flt.push_back(parameter.momentum().z());
-        m_pT_flt.push_back(parameter.pT());
-        m_eta_flt.push_back(eta(parameter.position()));
-        m_chi2.push_back(state.chi2());
+        entry.x_flt.push_back(parameter.position().x());
+        entry.y_flt.push_back(parameter.position().y());
+        entry.z_flt.push_back(parameter.position().z());
+        entry.px_flt.push_back(parameter.momentum().x());
+        entry.py_flt.push_back(parameter.momentum().y());
+        entry.pz_flt.push_back(parameter.momentum().z());
+        entry.pT_flt.push_back(parameter.pT());
+        entry.eta_flt.push_back(eta(parameter.position()));
+        entry.chi2.push_back(state.chi2());
       } else {
         // push default values if no filtered parameter
-        m_eLOC0_flt.push_back(-99.);
-        m_eLOC1_flt.push_back(-99.);
-        m_ePHI_flt.push_back(-99.);
-        m_eTHETA_flt.push_back(-99.);
-        m_eQOP_flt.push_back(-99.);
-        m_eT_flt.push_back(-99.);
-        m_res_eLOC0_flt.push_back(-99.);
-        m_res_eLOC1_flt.push_back(-99.);
-        m_res_ePHI_flt.push_back(-99.);
-        m_res_eTHETA_flt.push_back(-99.);
-        m_res_eQOP_flt.push_back(-99.);
-        m_res_eT_flt.push_back(-99.);
-        m_err_eLOC0_flt.push_back(-99);
-        m_err_eLOC1_flt.push_back(-99);
-        m_err_ePHI_flt.push_back(-99);
-        m_err_eTHETA_flt.push_back(-99);
-        m_err_eQOP_flt.push_back(-99);
-        m_err_eT_flt.push_back(-99);
-        m_pull_eLOC0_flt.push_back(-99.);
-        m_pull_eLOC1_flt.push_back(-99.);
-        m_pull_ePHI_flt.push_back(-99.);
-        m_pull_eTHETA_flt.push_back(-99.);
-        m_pull_eQOP_flt.push_back(-99.);
-        m_pull_eT_flt.push_back(-99.);
-        m_x_flt.push_back(-99.);
-        m_y_flt.push_back(-99.);
-        m_z_flt.push_back(-99.);
-        m_py_flt.push_back(-99.);
-        m_pz_flt.push_back(-99.);
-        m_pT_flt.push_back(-99.);
-        m_eta_flt.push_back(-99.);
-        m_chi2.push_back(-99.0);
+        entry.eLOC0_flt.push_back(-99.);
+        entry.eLOC1_flt.push_back(-99.);
+        entry.ePHI_flt.push_back(-99.);
+        entry.eTHETA_flt.push_back(-99.);
+        entry.eQOP_flt.push_back(-99.);
+        entry.eT_flt.push_back(-99.);
+        entry.res_eLOC0_flt.push_back(-99.);
+        entry.res_eLOC1_flt.push_back(-99.);
+        entry.res_ePHI_flt.push_back(-99.);
+        entry.res_eTHETA_flt.push_back(-99.);
+        entry.res_eQOP_flt.push_back(-99.);
+        entry.res_eT_flt.push_back(-99.);
+        entry.err_eLOC0_flt.push_back(-99);
+        entry.err_eLOC1_flt.push_back(-99);
+        entry.err_ePHI_flt.push_back(-99);
+        entry.err_eTHETA_flt.push_back(-99);
+        entry.err_eQOP_flt.push_back(-99);
+        entry.err_eT_flt.push_back(-99);
+        entry.pull_eLOC0_flt.push_back(-99.);
+        entry.pull_eLOC1_flt.push_back(-99.);
+        entry.pull_ePHI_flt.push_back(-99.);
+        entry.pull_eTHETA_flt.push_back(-99.);
+        entry.pull_eQOP_flt.push_back(-99.);
+        entry.pull_eT_flt.push_back(-99.);
+        entry.x_flt.push_back(-99.);
+        entry.y_flt.push_back(-99.);
+        entry.z_flt.push_back(-99.);
+        entry.py_flt.push_back(-99.);
+        entry.pz_flt.push_back(-99.);
+        entry.pT_flt.push_back(-99.);
+        entry.eta_flt.push_back(-99.);
+        entry.chi2.push_back(-99.0);
       }
 
       // get the smoothed parameter
       bool smoothed = false;
       if (state.hasSmoothed()) {
         smoothed = true;
-        m_nSmoothed++;
+        entry.nSmoothed++;
         Acts::BoundParameters parameter(
             gctx, state.smoothedCovariance(), state.smoothed(),
             state.referenceSurface().getSharedPtr());
         auto covariance = state.smoothedCovariance();
 
         // smoothed parameter
-        m_eLOC0_smt.push_back(parameter.parameters()[Acts::ParDef::eLOC_0]);
-        m_eLOC1_smt.push_back(parameter.parameters()[Acts::ParDef::eLOC_1]);
-        m_ePHI_smt.push_back(parameter.parameters()[Acts::ParDef::ePHI]);
-        m_eTHETA_smt.push_back(parameter.parameters()[Acts::ParDef::eTHETA]);
-        m_eQOP_smt.push_back(parameter.parameters()[Acts::ParDef::eQOP]);
-        m_eT_smt.push_back(parameter.parameters()[Acts::ParDef::eT]);
+        entry.eLOC0_smt.push_back(parameter.parameters()[Acts::ParDef::eLOC_0]);
+        entry.eLOC1_smt.push_back(parameter.parameters()[Acts::ParDef::eLOC_1]);
+        entry.ePHI_smt.push_back(parameter.parameters()[Acts::ParDef::ePHI]);
+        entry.eTHETA_smt.push_back(
+            parameter.parameters()[Acts::ParDef::eTHETA]);
+        entry.eQOP_smt.push_back(parameter.parameters()[Acts::ParDef::eQOP]);
+        entry.eT_smt.push_back(parameter.parameters()[Acts::ParDef::eT]);
 
         // smoothed residual
-        m_res_eLOC0_smt.push_back(parameter.parameters()[Acts::ParDef::eLOC_0] -
-                                  truthLOC0);
-        m_res_eLOC1_smt.push_back(parameter.parameters()[Acts::ParDef::eLOC_1] -
-                                  truthLOC1);
-        m_res_ePHI_smt.push_back(parameter.parameters()[Acts::ParDef::ePHI] -
-                                 truthPHI);
-        m_res_eTHETA_smt.push_back(
+        entry.res_eLOC0_smt.push_back(
+            parameter.parameters()[Acts::ParDef::eLOC_0] - truthLOC0);
+        entry.res_eLOC1_smt.push_back(
+            parameter.parameters()[Acts::ParDef::eLOC_1] - truthLOC1);
+        entry.res_ePHI_smt.push_back(
+            parameter.parameters()[Acts::ParDef::ePHI] - truthPHI);
+        entry.res_eTHETA_smt.push_back(
             parameter.parameters()[Acts::ParDef::eTHETA] - truthTHETA);
-        m_res_eQOP_smt.push_back(parameter.parameters()[Acts::ParDef::eQOP] -
-                                 truthQOP);
-        m_res_eT_smt.push_back(parameter.parameters()[Acts::ParDef::eT] -
-                               truthTIME);
+        entry.res_eQOP_smt.push_back(
+            parameter.parameters()[Acts::ParDef::eQOP] - truthQOP);
+        entry.res_eT_smt.push_back(
+            parameter.parameters()[Acts::ParDef::eT] - truthTIME);
 
         // smoothed parameter error
-        m_err_eLOC0_smt.push_back(
+        entry.err_eLOC0_smt.push_back(
             sqrt(covariance(Acts::ParDef::eLOC_0, Acts::ParDef::eLOC_0)));
-        m_err_eLOC1_smt.push_back(
+        entry.err_eLOC1_smt.push_back(
             sqrt(covariance(Acts::ParDef::eLOC_1, Acts::ParDef::eLOC_1)));
-        m_err_ePHI_smt.push_back(
+        entry.err_ePHI_smt.push_back(
             sqrt(covariance(Acts::ParDef::ePHI, Acts::ParDef::ePHI)));
-        m_err_eTHETA_smt.push_back(
+        entry.err_eTHETA_smt.push_back(
             sqrt(covariance(Acts::ParDef::eTHETA, Acts::ParDef::eTHETA)));
-        m_err_eQOP_smt.push_back(
+        entry.err_eQOP_smt.push_back(
             sqrt(covariance(Acts::ParDef::eQOP, Acts::ParDef::eQOP)));
-        m_err_eT_smt.push_back(
+        entry.err_eT_smt.push_back(
             sqrt(covariance(Acts::ParDef::eT, Acts::ParDef::eT)));
 
         // smoothed parameter pull
-        m_pull_eLOC0_smt.push_back(
+        entry.pull_eLOC0_smt.push_back(
             (parameter.parameters()[Acts::ParDef::eLOC_0] - truthLOC0) /
             sqrt(covariance(Acts::ParDef::eLOC_0, Acts::ParDef::eLOC_0)));
-        m_pull_eLOC1_smt.push_back(
+        entry.pull_eLOC1_smt.push_back(
             (parameter.parameters()[Acts::ParDef::eLOC_1] - truthLOC1) /
             sqrt(covariance(Acts::ParDef::eLOC_1, Acts::ParDef::eLOC_1)));
-        m_pull_ePHI_smt.push_back(
+        entry.pull_ePHI_smt.push_back(
             (parameter.parameters()[Acts::ParDef::ePHI] - truthPHI) /
             sqrt(covariance(Acts::ParDef::ePHI, Acts::ParDef::ePHI)));
-        m_pull_eTHETA_smt.push_back(
+        entry.pull_eTHETA_smt.push_back(
             (parameter.parameters()[Acts::ParDef::eTHETA] - truthTHETA) /
             sqrt(covariance(Acts::ParDef::eTHETA, Acts::ParDef::eTHETA)));
-        m_pull_eQOP_smt.push_back(
+        entry.pull_eQOP_smt.push_back(
             (parameter.parameters()[Acts::ParDef::eQOP] - truthQOP) /
             sqrt(covariance(Acts::ParDef::eQOP, Acts::ParDef::eQOP)));
-        m_pull_eT_smt.push_back(
+        entry.pull_eT_smt.push_back(
             (parameter.parameters()[Acts::ParDef::eT] - truthTIME) /
             sqrt(covariance(Acts::ParDef::eT, Acts::ParDef::eT)));
 
         // further smoothed parameter info
-        m_x_smt.push_back(parameter.position().x());
-        m_y_smt.push_back(parameter.position().y());
-        m_z_smt.push_back(parameter.position().z());
-        m_px_smt.push_back(parameter.momentum().x());
-        m_py_smt.push_back(parameter.momentum().y());
-        m_pz_smt.push_back(parameter.momentum().z());
-        m_pT_smt.push_back(parameter.pT());
-        m_eta_smt.push_back(eta(parameter.position()));
+        entry.x_smt.push_back(parameter.position().x());
+        entry.y_smt.push_back(parameter.position().y());
+        entry.z_smt.push_back(parameter.position().z());
+        entry.px_smt.push_back(parameter.momentum().x());
+        entry.py_smt.push_back(parameter.momentum().y());
+        entry.pz_smt.push_back(parameter.momentum().z());
+        entry.pT_smt.push_back(parameter.pT());
+        entry.eta_smt.push_back(eta(parameter.position()));
       } else {
         // push default values if no smoothed parameter
-        m_eLOC0_smt.push_back(-99.);
-        m_eLOC1_smt.push_back(-99.);
-        m_ePHI_smt.push_back(-99.);
-        m_eTHETA_smt.push_back(-99.);
-        m_eQOP_smt.push_back(-99.);
-        m_eT_smt.push_back(-99.);
-        m_res_eLOC0_smt.push_back(-99.);
-        m_res_eLOC1_smt.push_back(-99.);
-        m_res_ePHI_smt.push_back(-99.);
-        m_res_eTHETA_smt.push_back(-99.);
-        m_res_eQOP_smt.push_back(-99.);
-        m_res_eT_smt.push_back(-99.);
-        m_err_eLOC0_smt.push_back(-99);
-        m_err_eLOC1_smt.push_back(-99);
-        m_err_ePHI_smt.push_back(-99);
-        m_err_eTHETA_smt.push_back(-99);
-        m_err_eQOP_smt.push_back(-99);
-        m_err_eT_smt.push_back(-99);
-        m_pull_eLOC0_smt.push_back(-99.);
-        m_pull_eLOC1_smt.push_back(-99.);
-        m_pull_ePHI_smt.push_back(-99.);
-        m_pull_eTHETA_smt.push_back(-99.);
-        m_pull_eQOP_smt.push_back(-99.);
-        m_pull_eT_smt.push_back(-99.);
-        m_x_smt.push_back(-99.);
-        m_y_smt.push_back(-99.);
-        m_z_smt.push_back(-99.);
-        m_px_smt.push_back(-99.);
-        m_py_smt.push_back(-99.);
-        m_pz_smt.push_back(-99.);
-        m_pT_smt.push_back(-99.);
-        m_eta_smt.push_back(-99.);
+        entry.eLOC0_smt.push_back(-99.);
+        entry.eLOC1_smt.push_back(-99.);
+        entry.ePHI_smt.push_back(-99.);
+        entry.eTHETA_smt.push_back(-99.);
+        entry.eQOP_smt.push_back(-99.);
+        entry.eT_smt.push_back(-99.);
+        entry.res_eLOC0_smt.push_back(-99.);
+        entry.res_eLOC1_smt.push_back(-99.);
+        entry.res_ePHI_smt.push_back(-99.);
+        entry.res_eTHETA_smt.push_back(-99.);
+        entry.res_eQOP_smt.push_back(-99.);
+        entry.res_eT_smt.push_back(-99.);
+        entry.err_eLOC0_smt.push_back(-99);
+        entry.err_eLOC1_smt.push_back(-99);
+        entry.err_ePHI_smt.push_back(-99);
+        entry.err_eTHETA_smt.push_back(-99);
+        entry.err_eQOP_smt.push_back(-99);
+        entry.err_eT_smt.push_back(-99);
+        entry.pull_eLOC0_smt.push_back(-99.);
+        entry.pull_eLOC1_smt.push_back(-99.);
+        entry.pull_ePHI_smt.push_back(-99.);
+        entry.pull_eTHETA_smt.push_back(-99.);
+        entry.pull_eQOP_smt.push_back(-99.);
+        entry.pull_eT_smt.push_back(-99.);
+        entry.x_smt.push_back(-99.);
+        entry.y_smt.push_back(-99.);
+        entry.z_smt.push_back(-99.);
+        entry.px_smt.push_back(-99.);
+        entry.py_smt.push_back(-99.);
+        entry.pz_smt.push_back(-99.);
+        entry.pT_smt.push_back(-99.);
+        entry.eta_smt.push_back(-99.);
       }
 
-      m_prt.push_back(predicted);
-      m_flt.push_back(filtered);
-      m_smt.push_back(smoothed);
+      entry.prt.push_back(predicted);
+      entry.flt.push_back(filtered);
+      entry.smt.push_back(smoothed);
       return true;
     });  // all states
 
     // fill the variables for one track to tree
-    m_outputTree->Fill();
+    fill();
 
     // now reset
-    m_t_x.clear();
-    m_t_y.clear();
-    m_t_z.clear();
-    m_t_r.clear();
-    m_t_dx.clear();
-    m_t_dy.clear();
-    m_t_dz.clear();
-    m_t_eLOC0.clear();
-    m_t_eLOC1.clear();
-    m_t_ePHI.clear();
-    m_t_eTHETA.clear();
-    m_t_eQOP.clear();
-    m_t_eT.clear();
-
-    m_volumeID.clear();
-    m_layerID.clear();
-    m_moduleID.clear();
-    m_lx_hit.clear();
-    m_ly_hit.clear();
-    m_x_hit.clear();
-    m_y_hit.clear();
-    m_z_hit.clear();
-    m_res_x_hit.clear();
-    m_res_y_hit.clear();
-    m_err_x_hit.clear();
-    m_err_y_hit.clear();
-    m_pull_x_hit.clear();
-    m_pull_y_hit.clear();
-    m_dim_hit.clear();
-
-    m_prt.clear();
-    m_eLOC0_prt.clear();
-    m_eLOC1_prt.clear();
-    m_ePHI_prt.clear();
-    m_eTHETA_prt.clear();
-    m_eQOP_prt.clear();
-    m_eT_prt.clear();
-    m_res_eLOC0_prt.clear();
-    m_res_eLOC1_prt.clear();
-    m_res_ePHI_prt.clear();
-    m_res_eTHETA_prt.clear();
-    m_res_eQOP_prt.clear();
-    m_res_eT_prt.clear();
-    m_err_eLOC0_prt.clear();
-    m_err_eLOC1_prt.clear();
-    m_err_ePHI_prt.clear();
-    m_err_eTHETA_prt.clear();
-    m_err_eQOP_prt.clear();
-    m_err_eT_prt.clear();
-    m_pull_eLOC0_prt.clear();
-    m_pull_eLOC1_prt.clear();
-    m_pull_ePHI_prt.clear();
-    m_pull_eTHETA_prt.clear();
-    m_pull_eQOP_prt.clear();
-    m_pull_eT_prt.clear();
-    m_x_prt.clear();
-    m_y_prt.clear();
-    m_z_prt.clear();
-    m_px_prt.clear();
-    m_py_prt.clear();
-    m_pz_prt.clear();
-    m_eta_prt.clear();
-    m_pT_prt.clear();
-
-    m_flt.clear();
-    m_eLOC0_flt.clear();
-    m_eLOC1_flt.clear();
-    m_ePHI_flt.clear();
-    m_eTHETA_flt.clear();
-    m_eQOP_flt.clear();
-    m_eT_flt.clear();
-    m_res_eLOC0_flt.clear();
-    m_res_eLOC1_flt.clear();
-    m_res_ePHI_flt.clear();
-    m_res_eTHETA_flt.clear();
-    m_res_eQOP_flt.clear();
-    m_res_eT_flt.clear();
-    m_err_eLOC0_flt.clear();
-    m_err_eLOC1_flt.clear();
-    m_err_ePHI_flt.clear();
-    m_err_eTHETA_flt.clear();
-    m_err_eQOP_flt.clear();
-    m_err_eT_flt.clear();
-    m_pull_eLOC0_flt.clear();
-    m_pull_eLOC1_flt.clear();
-    m_pull_ePHI_flt.clear();
-    m_pull_eTHETA_flt.clear();
-    m_pull_eQOP_flt.clear();
-    m_pull_eT_flt.clear();
-    m_x_flt.clear();
-    m_y_flt.clear();
-    m_z_flt.clear();
-    m_px_flt.clear();
-    m_py_flt.clear();
-    m_pz_flt.clear();
-    m_eta_flt.clear();
-    m_pT_flt.clear();
-    m_chi2.clear();
-
-    m_smt.clear();
-    m_eLOC0_smt.clear();
-    m_eLOC1_smt.clear();
-    m_ePHI_smt.clear();
-    m_eTHETA_smt.clear();
-    m_eQOP_smt.clear();
-    m_eT_smt.clear();
-    m_res_eLOC0_smt.clear();
-    m_res_eLOC1_smt.clear();
-    m_res_ePHI_smt.clear();
-    m_res_eTHETA_smt.clear();
-    m_res_eQOP_smt.clear();
-    m_res_eT_smt.clear();
-    m_err_eLOC0_smt.clear();
-    m_err_eLOC1_smt.clear();
-    m_err_ePHI_smt.clear();
-    m_err_eTHETA_smt.clear();
-    m_err_eQOP_smt.clear();
-    m_err_eT_smt.clear();
-    m_pull_eLOC0_smt.clear();
-    m_pull_eLOC1_smt.clear();
-    m_pull_ePHI_smt.clear();
-    m_pull_eTHETA_smt.clear();
-    m_pull_eQOP_smt.clear();
-    m_pull_eT_smt.clear();
-    m_x_smt.clear();
-    m_y_smt.clear();
-    m_z_smt.clear();
-    m_px_smt.clear();
-    m_py_smt.clear();
-    m_pz_smt.clear();
-    m_eta_smt.clear();
-    m_pT_smt.clear();
+    entry.t_x.clear();
+    entry.t_y.clear();
+    entry.t_z.clear();
+    entry.t_r.clear();
+    entry.t_dx.clear();
+    entry.t_dy.clear();
+    entry.t_dz.clear();
+    entry.t_eLOC0.clear();
+    entry.t_eLOC1.clear();
+    entry.t_ePHI.clear();
+    entry.t_eTHETA.clear();
+    entry.t_eQOP.clear();
+    entry.t_eT.clear();
+
+    entry.volumeID.clear();
+    entry.layerID.clear();
+    entry.moduleID.clear();
+    entry.lx_hit.clear();
+    entry.ly_hit.clear();
+    entry.x_hit.clear();
+    entry.y_hit.clear();
+    entry.z_hit.clear();
+    entry.res_x_hit.clear();
+    entry.res_y_hit.clear();
+    entry.err_x_hit.clear();
+    entry.err_y_hit.clear();
+    entry.pull_x_hit.clear();
+    entry.pull_y_hit.clear();
+    entry.dim_hit.clear();
+
+    entry.prt.clear();
+    entry.eLOC0_prt.clear();
+    entry.eLOC1_prt.clear();
+    entry.ePHI_prt.clear();
+    entry.eTHETA_prt.clear();
+    entry.eQOP_prt.clear();
+    entry.eT_prt.clear();
+    entry.res_eLOC0_prt.clear();
+    entry.res_eLOC1_prt.clear();
+    entry.res_ePHI_prt.clear();
+    entry.res_eTHETA_prt.clear();
+    entry.res_eQOP_prt.clear();
+    entry.res_eT_prt.clear();
+    entry.err_eLOC0_prt.clear();
+    entry.err_eLOC1_prt.clear();
+    entry.err_ePHI_prt.clear();
+    entry.err_eTHETA_prt.clear();
+    entry.err_eQOP_prt.clear();
+    entry.err_eT_prt.clear();
+    entry.pull_eLOC0_prt.clear();
+    entry.pull_eLOC1_prt.clear();
+    entry.pull_ePHI_prt.clear();
+    entry.pull_eTHETA_prt.clear();
+    entry.pull_eQOP_prt.clear();
+    entry.pull_eT_prt.clear();
+    entry.x_prt.clear();
+    entry.y_prt.clear();
+    entry.z_prt.clear();
+    entry.px_prt.clear();
+    entry.py_prt.clear();
+    entry.pz_prt.clear();
+    entry.eta_prt.clear();
+    entry.pT_prt.clear();
+
+    entry.flt.clear();
+    entry.eLOC0_flt.clear();
+    entry.eLOC1_flt.clear();
+    entry.ePHI_flt.clear();
+    entry.eTHETA_flt.clear();
+    entry.eQOP_flt.clear();
+    entry.eT_flt.clear();
+    entry.res_eLOC0_flt.clear();
+    entry.res_eLOC1_flt.clear();
+    entry.res_ePHI_flt.clear();
+    entry.res_eTHETA_flt.clear();
+    entry.res_eQOP_flt.clear();
+    entry.res_eT_flt.clear();
+    entry.err_eLOC0_flt.clear();
+    entry.err_eLOC1_flt.clear();
+    entry.err_ePHI_flt.clear();
+    entry.err_eTHETA_flt.clear();
+    entry.err_eQOP_flt.clear();
+    entry.err_eT_flt.clear();
+    entry.pull_eLOC0_flt.clear();
+    entry.pull_eLOC1_flt.clear();
+    entry.pull_ePHI_flt.clear();
+    entry.pull_eTHETA_flt.clear();
+    entry.pull_eQOP_flt.clear();
+    entry.pull_eT_flt.clear();
+    entry.x_flt.clear();
+    entry.y_flt.clear();
+    entry.z_flt.clear();
+    entry.px_flt.clear();
+    entry.py_flt.clear();
+    entry.pz_flt.clear();
+    entry.eta_flt.clear();
+    entry.pT_flt.clear();
+    entry.chi2.clear();
+
+    entry.smt.clear();
+    entry.eLOC0_smt.clear();
+    entry.eLOC1_smt.clear();
+    entry.ePHI_smt.clear();
+    entry.eTHETA_smt.clear();
+    entry.eQOP_smt.clear();
+    entry.eT_smt.clear();
+    entry.res_eLOC0_smt.clear();
+    entry.res_eLOC1_smt.clear();
+    entry.res_ePHI_smt.clear();
+    entry.res_eTHETA_smt.clear();
+    entry.res_eQOP_smt.clear();
+    entry.res_eT_smt.clear();
+    entry.err_eLOC0_smt.clear();
+    entry.err_eLOC1_smt.clear();
+    entry.err_ePHI_smt.clear();
+    entry.err_eTHETA_smt.clear();
+    entry.err_eQOP_smt.clear();
+    entry.err_eT_smt.clear();
+    entry.pull_eLOC0_smt.clear();
+    entry.pull_eLOC1_smt.clear();
+    entry.pull_ePHI_smt.clear();
+    entry.pull_eTHETA_smt.clear();
+    entry.pull_eQOP_smt.clear();
+    entry.pull_eT_smt.clear();
+    entry.x_smt.clear();
+    entry.y_smt.clear();
+    entry.z_smt.clear();
+    entry.px_smt.clear();
+    entry.py_smt.clear();
+    entry.pz_smt.clear();
+    entry.eta_smt.clear();
+    entry.pT_smt.clear();
 
     iTraj++;
   }  // all trajectories
@@ -0,0 +1,129 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ACTFW/Io/Root/RootTreeSegments.hpp"
+
+#include <TFile.h>
+#include <TTree.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <ios>
+#include <tuple>
+#include <unordered_map>
+
+namespace {
+std::atomic<uint64_t> s_nextId{0u};
+}  // namespace
+
+FW::detail::RootTreeSegmentsBase::RootTreeSegmentsBase(std::string path,
+                                                       std::string treeName)
+    : m_path(std::move(path)),
+      m_treeName(std::move(treeName)),
+      m_id(s_nextId++) {}
+
+FW::detail::RootTreeSegmentsBase::~RootTreeSegmentsBase() {
+  closeSegments();
+}
+
+size_t FW::detail::RootTreeSegmentsBase::size() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_segments.size();
+}
+
+FW::detail::RootTreeSegmentsBase::Segment&
+FW::detail::RootTreeSegmentsBase::localSegment(const MakeEntry& makeEntry) {
+  // identifiers are never reused; stale entries of destroyed instances or of
+  // closed segments are never found again and only waste a few bytes
+  thread_local std::unordered_map<uint64_t, Segment*> t_segments;
+
+  auto it = t_segments.find(m_id);
+  if (it != t_segments.end()) {
+    return *it->second;
+  }
+
+  // a thread only ends up here once per instance and a lock is acceptable
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto segment = std::make_unique<Segment>();
+  // the tree name and the instance identifier keep the segments of writers
+  // sharing the same output file apart
+  segment->path = m_path + "." + m_treeName + ".segment" +
+                  std::to_string(m_id) + "-" +
+                  std::to_string(m_segments.size());
+  // the file is only ever accessed from this thread until the merge
+  segment->file = TFile::Open(segment->path.c_str(), "RECREATE");
+  if (segment->file == nullptr) {
+    throw std::ios_base::failure("Could not open '" + segment->path + "'");
+  }
+  segment->file->cd();
+  segment->tree = new TTree(m_treeName.c_str(), m_treeName.c_str());
+  segment->tree->SetDirectory(segment->file);
+  segment->entry = makeEntry(*segment->tree);
+  Segment* ptr = segment.get();
+  m_segments.push_back(std::move(segment));
+  t_segments.emplace(m_id, ptr);
+  return *ptr;
+}
+
+void FW::detail::RootTreeSegmentsBase::fillSegment(Segment& segment,
+                                                   uint64_t event) {
+  uint64_t entry = segment.tree->GetEntries();
+  segment.tree->Fill();
+  // extend the range if the previous entry belongs to the same event
+  if (not segment.events.empty()) {
+    auto& last = segment.events.back();
+    if ((last[0] == event) and (last[1] + last[2] == entry)) {
+      last[2] += 1u;
+      return;
+    }
+  }
+  segment.events.push_back({event, entry, 1u});
+}
+
+uint64_t FW::detail::RootTreeSegmentsBase::mergeSegments(
+    TTree& output, const CopyEntry& copyEntry) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  // every event is processed by a single thread, ordering the ranges by event
+  // and then by entry restores the sequential output order
+  std::vector<std::tuple<uint64_t, uint64_t, uint64_t, Segment*>> ranges;
+  for (auto& segment : m_segments) {
+    for (const auto& range : segment->events) {
+      ranges.emplace_back(range[0], range[1], range[2], segment.get());
+    }
+  }
+  std::sort(ranges.begin(), ranges.end());
+
+  uint64_t numEntries = 0u;
+  for (const auto& [event, first, count, segment] : ranges) {
+    for (uint64_t i = first; i < (first + count); ++i) {
+      // reads into the segment entry buffer bound to the segment branches
+      segment->tree->GetEntry(i);
+      copyEntry(segment->entry.get());
+      output.Fill();
+    }
+    numEntries += count;
+  }
+  closeSegments();
+  return numEntries;
+}
+
+void FW::detail::RootTreeSegmentsBase::closeSegments() {
+  for (auto& segment : m_segments) {
+    if (segment and segment->file) {
+      // closing the file also deletes the attached tree
+      segment->file->Close();
+      delete segment->file;
+      std::remove(segment->path.c_str());
+    }
+  }
+  m_segments.clear();
+  // the segments of a later run must not be found via the stale entries in
+  // the thread-local caches
+  m_id = s_nextId++;
+}
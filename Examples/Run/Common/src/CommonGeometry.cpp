@@ -6,15 +6,21 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
+#include <Acts/Geometry/GeometryContext.hpp>
+#include <Acts/Geometry/TrackingGeometry.hpp>
+#include <Acts/Geometry/TrackingGeometrySnapshot.hpp>
 #include <Acts/Material/IMaterialDecorator.hpp>
 #include <Acts/Plugins/Json/JsonGeometryConverter.hpp>
 #include <Acts/Plugins/Json/JsonMaterialDecorator.hpp>
 #include <Acts/Utilities/Logger.hpp>
 #include <boost/program_options.hpp>
+#include <fstream>
+#include <stdexcept>
 #include <string>
 
 #include "ACTFW/Detector/IBaseDetector.hpp"
 #include "ACTFW/Geometry/MaterialWiper.hpp"
+#include "ACTFW/Io/Binary/BinaryMaterialDecorator.hpp"
 #include "ACTFW/Io/Root/RootMaterialDecorator.hpp"
 
 namespace FW {
@@ -33,6 +39,22 @@ std::pair<std::shared_ptr<const Acts::TrackingGeometry>,
           std::vector<std::shared_ptr<FW::IContextDecorator>>>
 build(const boost::program_options::variables_map& vm,
       IBaseDetector& detector) {
+  // A snapshot replaces the detector building, the material is part of it.
+  // Snapshots are only written for detectors without context decorators,
+  // i.e. there is nothing to decorate for a loaded geometry.
+  auto snapshotInput = vm["geo-snapshot-input"].template as<std::string>();
+  if (not snapshotInput.empty()) {
+    std::ifstream snapshot(snapshotInput,
+                           std::ios_base::binary | std::ios_base::in);
+    if (not snapshot) {
+      throw std::invalid_argument("Could not open geometry snapshot '" +
+                                  snapshotInput + "'");
+    }
+    std::shared_ptr<const Acts::TrackingGeometry> tGeometry =
+        Acts::readTrackingGeometrySnapshot(snapshot);
+    return {tGeometry, {}};
+  }
+
   // Material decoration
   std::shared_ptr<const Acts::IMaterialDecorator> matDeco = nullptr;
   auto matType = vm["mat-input-type"].template as<std::string>();
@@ -41,7 +63,7 @@ build(const boost::program_options::variables_map& vm,
   } else if (matType == "file") {
     // Retrieve the filename
     auto fileName = vm["mat-input-file"].template as<std::string>();
-    // json or root based decorator
+    // json, root or binary based decorator
     if (fileName.find(".json") != std::string::npos) {
       // Set up the converter first
       Acts::JsonGeometryConverter::Config jsonGeoConvConfig;
@@ -54,11 +76,33 @@ build(const boost::program_options::variables_map& vm,
       rootMatDecConfig.fileName = fileName;
       matDeco =
           std::make_shared<const FW::RootMaterialDecorator>(rootMatDecConfig);
+    } else if (fileName.find(".bin") != std::string::npos) {
+      // Set up the memory-mapped binary decorator
+      FW::BinaryMaterialDecorator::Config binMatDecConfig;
+      binMatDecConfig.fileName = fileName;
+      matDeco = std::make_shared<const FW::BinaryMaterialDecorator>(
+          binMatDecConfig, Acts::Logging::INFO);
     }
   }
 
   /// Return the geometry and context decorators
-  return detector.finalize(vm, matDeco);
+  auto geometry = detector.finalize(vm, matDeco);
+
+  auto snapshotOutput = vm["geo-snapshot-output"].template as<std::string>();
+  if (not snapshotOutput.empty()) {
+    if (not geometry.second.empty()) {
+      throw std::invalid_argument(
+          "Geometry snapshots can not be written for detectors with context "
+          "decorators, e.g. alignment");
+    }
+    std::ofstream snapshot;
+    snapshot.exceptions(std::ofstream::badbit | std::ofstream::failbit);
+    snapshot.open(snapshotOutput, std::ios_base::binary | std::ios_base::out |
+                                      std::ios_base::trunc);
+    Acts::writeTrackingGeometrySnapshot(Acts::GeometryContext(),
+                                        *geometry.first, snapshot);
+  }
+  return geometry;
 }
 
 }  // namespace Geometry
@@ -40,7 +40,16 @@ void FW::Options::addSequencerOptions(
       "skip", value<size_t>()->default_value(0),
       "The number of events to skip")(
       "jobs,j", value<int>()->default_value(-1),
-      "Number of parallel jobs, negative for automatic.");
+      "Number of parallel jobs, negative for automatic.")(
+      "prefetch-events", value<size_t>()->default_value(0),
+      "Number of events to read ahead on dedicated I/O threads, 0 to "
+      "disable.")("prefetch-threads", value<size_t>()->default_value(1),
+                  "Number of dedicated I/O threads for prefetching.")(
+      "trace", bool_switch(),
+      "Write a Chrome trace and per-event timings to the output directory.")(
+      "log-async", bool_switch(),
+      "Write the log messages on a dedicated thread. Messages of different "
+      "threads may appear in a different order.");
 }
 
 void FW::Options::addRandomNumbersOptions(
@@ -58,7 +67,15 @@ void FW::Options::addGeometryOptions(
       "geo-volume-loglevel", value<size_t>()->default_value(3),
       "The output log level for the volume building.")(
       "geo-detector-volume", value<read_strings>()->default_value({{}}),
-      "Sub detectors for the output writing");
+      "Sub detectors for the output writing")(
+      "geo-snapshot-input", value<std::string>()->default_value(""),
+      "Load the tracking geometry from this snapshot file instead of building "
+      "the detector. Sensitive surfaces only keep their thickness, i.e. jobs "
+      "using detector specific information such as digitization modules "
+      "still need to build the detector.")(
+      "geo-snapshot-output", value<std::string>()->default_value(""),
+      "Write a snapshot of the built tracking geometry to this file. Not "
+      "possible for detectors with context decorators, e.g. alignment.");
 }
 
 void FW::Options::addMaterialOptions(
@@ -67,7 +84,8 @@ void FW::Options::addMaterialOptions(
       "mat-input-type", value<std::string>()->default_value("build"),
       "The way material is loaded: 'none', 'build', 'proto', 'file'.")(
       "mat-input-file", value<std::string>()->default_value(""),
-      "Name of the material map input file, supported: '.json' or '.root'.")(
+      "Name of the material map input file, supported: '.json', '.root' or "
+      "'.bin'.")(
       "mat-output-file", value<std::string>()->default_value(""),
       "Name of the material map output file (without extension).")(
       "mat-output-sensitives", value<bool>()->default_value(true),
@@ -95,8 +113,12 @@ void FW::Options::addOutputOptions(
                     "Output directory location.")(
       "output-root", value<bool>()->default_value(false),
       "Switch on to write '.root' output file(s).")(
+      "output-root-segments", value<bool>()->default_value(false),
+      "Fill per-thread '.root' segments and merge them at the end of the run.")(
       "output-csv", value<bool>()->default_value(false),
       "Switch on to write '.csv' output file(s).")(
+      "output-binary", value<bool>()->default_value(false),
+      "Switch on to write columnar '.bin' output file(s).")(
       "output-obj", value<bool>()->default_value(false),
       "Switch on to write '.obj' ouput file(s).")(
       "output-json", value<bool>()->default_value(false),
@@ -115,9 +137,11 @@ void FW::Options::addInputOptions(
                                        value<bool>()->default_value(false),
                                        "Switch on to read '.root' file(s).")(
       "input-csv", value<bool>()->default_value(false),
-      "Switch on to read '.csv' file(s).")("input-obj",
-                                           value<bool>()->default_value(false),
-                                           "Switch on to read '.obj' file(s).")(
+      "Switch on to read '.csv' file(s).")(
+      "input-binary", value<bool>()->default_value(false),
+      "Switch on to read columnar '.bin' file(s).")(
+      "input-obj", value<bool>()->default_value(false),
+      "Switch on to read '.obj' file(s).")(
       "input-json", value<bool>()->default_value(false),
       "Switch on to read '.json' file(s).");
 }
@@ -177,6 +201,10 @@ FW::Sequencer::Config FW::Options::readSequencerConfig(
   }
   cfg.logLevel = readLogLevel(vm);
   cfg.numThreads = vm["jobs"].as<int>();
+  cfg.prefetchEvents = vm["prefetch-events"].as<size_t>();
+  cfg.prefetchThreads = vm["prefetch-threads"].as<size_t>();
+  cfg.outputTrace = vm["trace"].as<bool>();
+  cfg.asyncLogging = vm["log-async"].as<bool>();
   if (not vm["output-dir"].empty()) {
     cfg.outputDir = vm["output-dir"].as<std::string>();
   }
@@ -20,6 +20,7 @@
 #include "ACTFW/Detector/IBaseDetector.hpp"
 #include "ACTFW/Framework/Sequencer.hpp"
 #include "ACTFW/Geometry/CommonGeometry.hpp"
+#include "ACTFW/Io/Binary/BinaryMaterialWriter.hpp"
 #include "ACTFW/Io/Root/RootMaterialTrackReader.hpp"
 #include "ACTFW/Io/Root/RootMaterialTrackWriter.hpp"
 #include "ACTFW/Io/Root/RootMaterialWriter.hpp"
@@ -175,6 +176,17 @@ int materialMappingExample(int argc, char* argv[],
         std::make_shared<JsonWriter>(std::move(jmwImpl)));
   }
 
+  if (!materialFileName.empty() and vm["output-binary"].template as<bool>()) {
+    // The writer of the memory-mappable material map
+    FW::BinaryMaterialWriter::Config bmwConfig;
+    bmwConfig.fileName = materialFileName + ".bin";
+    FW::BinaryMaterialWriter bmwImpl(bmwConfig, logLevel);
+    // Fullfill the IMaterialWriter interface
+    using BinaryWriter = FW::MaterialWriterT<FW::BinaryMaterialWriter>;
+    mmAlgConfig.materialWriters.push_back(
+        std::make_shared<BinaryWriter>(std::move(bmwImpl)));
+  }
+
   // Create the material mapping
   auto mmAlg = std::make_shared<FW::MaterialMapping>(mmAlgConfig);
 
@@ -73,6 +73,7 @@ int main(int argc, char* argv[]) {
     RootParticleWriter::Config rootWriterCfg;
     rootWriterCfg.inputParticles = flatten.outputParticles;
     rootWriterCfg.filePath = joinPaths(outputDir, "particles.root");
+    rootWriterCfg.perThreadSegments = vm["output-root-segments"].as<bool>();
     sequencer.addWriter(
         std::make_shared<RootParticleWriter>(rootWriterCfg, logLevel));
   }
@@ -9,10 +9,14 @@
 #include "FatrasDigitizationBase.hpp"
 
 #include <boost/program_options.hpp>
+#include <stdexcept>
+#include <string>
 
 #include "ACTFW/Digitization/DigitizationAlgorithm.hpp"
+#include "ACTFW/Digitization/DigitizationOptions.hpp"
 #include "ACTFW/Framework/RandomNumbers.hpp"
 #include "ACTFW/Framework/Sequencer.hpp"
+#include "ACTFW/Io/Binary/BinaryPlanarClusterWriter.hpp"
 #include "ACTFW/Io/Csv/CsvPlanarClusterWriter.hpp"
 #include "ACTFW/Io/Root/RootPlanarClusterWriter.hpp"
 #include "ACTFW/Options/CommonOptions.hpp"
@@ -26,6 +30,15 @@ void FW::setupDigitization(
   // Read the standard options
   auto logLevel = FW::Options::readLogLevel(vars);
 
+  // The digitization modules are detector specific, they are not part of a
+  // geometry snapshot
+  if (vars.count("geo-snapshot-input") != 0u and
+      not vars["geo-snapshot-input"].template as<std::string>().empty()) {
+    throw std::invalid_argument(
+        "Digitization requires the detector geometry, it can not run on a "
+        "geometry snapshot");
+  }
+
   // Configure the digitizer
   FW::DigitizationAlgorithm::Config digi;
   digi.inputSimulatedHits = "hits";
@@ -34,6 +47,7 @@ void FW::setupDigitization(
       Acts::getDefaultLogger("PlanarModuleStepper", logLevel));
   digi.randomNumbers = randomNumbers;
   digi.trackingGeometry = trackingGeometry;
+  FW::Options::readDigitizationConfig(vars, digi);
   sequencer.addAlgorithm(
       std::make_shared<FW::DigitizationAlgorithm>(digi, logLevel));
 
@@ -51,6 +65,16 @@ void FW::setupDigitization(
         clusterWriterCsv, logLevel));
   }
 
+  // Write digitisation output as columnar binary files
+  if (vars["output-binary"].template as<bool>()) {
+    FW::BinaryPlanarClusterWriter::Config clusterWriterBinary;
+    clusterWriterBinary.inputClusters = digi.outputClusters;
+    clusterWriterBinary.inputSimulatedHits = digi.inputSimulatedHits;
+    clusterWriterBinary.outputDir = outputDir;
+    sequencer.addWriter(std::make_shared<FW::BinaryPlanarClusterWriter>(
+        clusterWriterBinary, logLevel));
+  }
+
   // Write digitsation output as ROOT files
   if (vars["output-root"].template as<bool>()) {
     // clusters as root
@@ -59,6 +83,8 @@ void FW::setupDigitization(
     clusterWriterRoot.inputSimulatedHits = digi.inputSimulatedHits;
     clusterWriterRoot.filePath =
         FW::joinPaths(outputDir, digi.outputClusters + ".root");
+    clusterWriterRoot.perThreadSegments =
+        vars["output-root-segments"].template as<bool>();
     sequencer.addWriter(std::make_shared<FW::RootPlanarClusterWriter>(
         clusterWriterRoot, logLevel));
   }
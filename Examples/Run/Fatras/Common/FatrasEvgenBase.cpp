@@ -68,6 +68,8 @@ void FW::setupEvgenInput(
     FW::RootParticleWriter::Config pWriterRootConfig;
     pWriterRootConfig.inputParticles = flatten.outputParticles;
     pWriterRootConfig.filePath = FW::joinPaths(outputDir, "particles.root");
+    pWriterRootConfig.perThreadSegments =
+        vm["output-root-segments"].template as<bool>();
     sequencer.addWriter(
         std::make_shared<FW::RootParticleWriter>(pWriterRootConfig, logLevel));
   }
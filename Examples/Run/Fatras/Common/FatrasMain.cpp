@@ -12,6 +12,7 @@
 #include <memory>
 
 #include "ACTFW/Detector/IBaseDetector.hpp"
+#include "ACTFW/Digitization/DigitizationOptions.hpp"
 #include "ACTFW/Fatras/FatrasOptions.hpp"
 #include "ACTFW/Framework/RandomNumbers.hpp"
 #include "ACTFW/Framework/Sequencer.hpp"
@@ -43,6 +44,7 @@ int FW::fatrasMain(int argc, char* argv[],
   FW::Options::addBFieldOptions(desc);
   FW::ParticleSelector::addOptions(desc);
   FW::Options::addFatrasOptions(desc);
+  FW::Options::addDigitizationOptions(desc);
   FW::Options::addOutputOptions(desc);
   desc.add_options()("evg-input-type",
                      value<std::string>()->default_value("pythia8"),
@@ -18,6 +18,7 @@
 #include "ACTFW/Framework/Sequencer.hpp"
 #include "ACTFW/Generators/FlattenEvent.hpp"
 #include "ACTFW/Generators/ParticleSelector.hpp"
+#include "ACTFW/Io/Binary/BinaryParticleWriter.hpp"
 #include "ACTFW/Io/Csv/CsvParticleWriter.hpp"
 #include "ACTFW/Io/Root/RootParticleWriter.hpp"
 #include "ACTFW/Io/Root/RootSimHitWriter.hpp"
@@ -171,13 +172,33 @@ void setupSimulationAlgorithms(
         std::make_shared<FW::CsvParticleWriter>(writeFinal, logLevel));
   }
 
+  // Write simulation information as columnar binary files
+  if (variables["output-binary"].template as<bool>()) {
+    FW::BinaryParticleWriter::Config writeInitial;
+    writeInitial.inputParticles = fatras.outputParticlesInitial;
+    writeInitial.outputDir = outputDir;
+    writeInitial.outputStem = fatras.outputParticlesInitial;
+    sequencer.addWriter(
+        std::make_shared<FW::BinaryParticleWriter>(writeInitial, logLevel));
+    FW::BinaryParticleWriter::Config writeFinal;
+    writeFinal.inputParticles = fatras.outputParticlesFinal;
+    writeFinal.outputDir = outputDir;
+    writeFinal.outputStem = fatras.outputParticlesFinal;
+    sequencer.addWriter(
+        std::make_shared<FW::BinaryParticleWriter>(writeFinal, logLevel));
+  }
+
   // Write simulation information as ROOT files
   if (variables["output-root"].template as<bool>()) {
+    const bool perThreadSegments =
+        variables["output-root-segments"].template as<bool>();
+
     // write initial simulated particles
     FW::RootParticleWriter::Config writeInitial;
     writeInitial.inputParticles = fatras.outputParticlesInitial;
     writeInitial.filePath =
         FW::joinPaths(outputDir, fatras.outputParticlesInitial + ".root");
+    writeInitial.perThreadSegments = perThreadSegments;
     sequencer.addWriter(
         std::make_shared<FW::RootParticleWriter>(writeInitial, logLevel));
 
@@ -186,6 +207,7 @@ void setupSimulationAlgorithms(
     writeFinal.inputParticles = fatras.outputParticlesFinal;
     writeFinal.filePath =
         FW::joinPaths(outputDir, fatras.outputParticlesFinal + ".root");
+    writeFinal.perThreadSegments = perThreadSegments;
     sequencer.addWriter(
         std::make_shared<FW::RootParticleWriter>(writeFinal, logLevel));
 
@@ -193,6 +215,7 @@ void setupSimulationAlgorithms(
     FW::RootSimHitWriter::Config writeHits;
     writeHits.inputSimulatedHits = fatras.outputHits;
     writeHits.filePath = FW::joinPaths(outputDir, fatras.outputHits + ".root");
+    writeHits.perThreadSegments = perThreadSegments;
     sequencer.addWriter(
         std::make_shared<FW::RootSimHitWriter>(writeHits, logLevel));
   }
@@ -0,0 +1,212 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+/// @file
+/// @brief Compare the read throughput of the CSV and columnar binary formats
+
+#include <algorithm>
+#include <boost/program_options.hpp>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "ACTFW/EventData/GeometryContainers.hpp"
+#include "ACTFW/EventData/SimHit.hpp"
+#include "ACTFW/EventData/SimIdentifier.hpp"
+#include "ACTFW/Framework/WhiteBoard.hpp"
+#include "ACTFW/GenericDetector/GenericDetector.hpp"
+#include "ACTFW/Geometry/CommonGeometry.hpp"
+#include "ACTFW/Io/Binary/BinaryPlanarClusterReader.hpp"
+#include "ACTFW/Io/Binary/BinaryPlanarClusterWriter.hpp"
+#include "ACTFW/Io/Csv/CsvPlanarClusterReader.hpp"
+#include "ACTFW/Io/Csv/CsvPlanarClusterWriter.hpp"
+#include "ACTFW/Options/CommonOptions.hpp"
+#include "ACTFW/Utilities/Options.hpp"
+#include "ACTFW/Utilities/Paths.hpp"
+#include "Acts/Plugins/Digitization/PlanarModuleCluster.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Utilities/Units.hpp"
+
+using namespace Acts::UnitLiterals;
+
+namespace {
+
+/// Fill the event store with random clusters on the sensitive surfaces.
+void generateEvent(const std::vector<const Acts::Surface*>& surfaces,
+                   size_t numHits, std::mt19937& rng,
+                   FW::AlgorithmContext& ctx) {
+  std::uniform_int_distribution<size_t> surfaceDist(0u, surfaces.size() - 1u);
+  std::uniform_real_distribution<double> localDist(-5_mm, 5_mm);
+  std::uniform_int_distribution<size_t> channelDist(0u, 1000u);
+
+  // hits must be generated in geometry order to create the clusters in order
+  std::vector<const Acts::Surface*> hitSurfaces(numHits);
+  for (auto& surface : hitSurfaces) {
+    surface = surfaces[surfaceDist(rng)];
+  }
+  std::sort(hitSurfaces.begin(), hitSurfaces.end(),
+            [](const Acts::Surface* lhs, const Acts::Surface* rhs) {
+              return lhs->geoID() < rhs->geoID();
+            });
+
+  FW::SimHitContainer::sequence_type simHits;
+  FW::GeometryIdMultimap<Acts::PlanarModuleCluster>::sequence_type clusters;
+  simHits.reserve(numHits);
+  clusters.reserve(numHits);
+  for (const Acts::Surface* surface : hitSurfaces) {
+    const Acts::GeometryID geoId = surface->geoID();
+    const Acts::Vector2D local(localDist(rng), localDist(rng));
+    const Acts::Vector3D mom = surface->normal(ctx.geoContext, local);
+    Acts::Vector3D pos;
+    surface->localToGlobal(ctx.geoContext, local, mom, pos);
+    const ActsFatras::Hit::Vector4 pos4(pos.x(), pos.y(), pos.z(), 1_ns);
+    const ActsFatras::Hit::Vector4 mom4(mom.x(), mom.y(), mom.z(), 1.0);
+
+    const size_t channel0 = channelDist(rng);
+    const size_t channel1 = channelDist(rng);
+    std::vector<Acts::DigitizationCell> cells = {
+        {channel0, channel1, 1.0f},
+        {channel0 + 1u, channel1, 0.5f},
+    };
+    std::vector<size_t> simHitIndices = {simHits.size()};
+    simHits.emplace_back(geoId, ActsFatras::Barcode().setParticle(1u), pos4,
+                         mom4, mom4, 0);
+    clusters.emplace_back(
+        geoId,
+        Acts::PlanarModuleCluster(
+            surface->getSharedPtr(),
+            Identifier(identifier_type(geoId.value()),
+                       std::move(simHitIndices)),
+            Acts::ActsSymMatrixD<3>::Identity(), local[0], local[1], 1_ns,
+            std::move(cells)));
+  }
+
+  FW::SimHitContainer simHitContainer;
+  simHitContainer.adopt_sequence(boost::container::ordered_range,
+                                 std::move(simHits));
+  FW::GeometryIdMultimap<Acts::PlanarModuleCluster> clusterContainer;
+  clusterContainer.adopt_sequence(boost::container::ordered_range,
+                                  std::move(clusters));
+  ctx.eventStore.add("hits", std::move(simHitContainer));
+  ctx.eventStore.add("clusters", std::move(clusterContainer));
+}
+
+/// Read all events with the given reader and return the elapsed time.
+template <typename reader_t>
+std::chrono::duration<double> readEvents(
+    const typename reader_t::Config& cfg, size_t numEvents,
+    Acts::Logging::Level logLevel) {
+  reader_t reader(cfg, logLevel);
+  std::chrono::duration<double> elapsed(0);
+  for (size_t event = 0; event < numEvents; ++event) {
+    FW::WhiteBoard store;
+    FW::AlgorithmContext ctx(0, event, store);
+    const auto start = std::chrono::steady_clock::now();
+    if (reader.read(ctx) != FW::ProcessCode::SUCCESS) {
+      throw std::runtime_error("Failed to read event with " + reader.name());
+    }
+    elapsed += std::chrono::steady_clock::now() - start;
+  }
+  return elapsed;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  GenericDetector detector;
+
+  // setup and parse options
+  auto desc = FW::Options::makeDefaultOptions();
+  FW::Options::addGeometryOptions(desc);
+  FW::Options::addMaterialOptions(desc);
+  FW::Options::addOutputOptions(desc);
+  detector.addOptions(desc);
+  desc.add_options()(
+      "bench-events",
+      boost::program_options::value<size_t>()->default_value(10),
+      "Number of events to write and read.")(
+      "bench-hits",
+      boost::program_options::value<size_t>()->default_value(100000),
+      "Number of hits per event.");
+
+  auto vm = FW::Options::parse(desc, argc, argv);
+  if (vm.empty()) {
+    return EXIT_FAILURE;
+  }
+
+  auto logLevel = FW::Options::readLogLevel(vm);
+  auto outputDir =
+      FW::ensureWritableDirectory(vm["output-dir"].as<std::string>());
+  const auto numEvents = vm["bench-events"].as<size_t>();
+  const auto numHits = vm["bench-hits"].as<size_t>();
+
+  // Setup detector geometry
+  auto geometry = FW::Geometry::build(vm, detector);
+  auto trackingGeometry = geometry.first;
+  std::vector<const Acts::Surface*> surfaces;
+  trackingGeometry->visitSurfaces([&](const Acts::Surface* surface) {
+    if (surface->associatedDetectorElement() != nullptr) {
+      surfaces.push_back(surface);
+    }
+  });
+
+  // Write identical events in both formats
+  FW::CsvPlanarClusterWriter::Config csvWriterCfg;
+  csvWriterCfg.inputClusters = "clusters";
+  csvWriterCfg.inputSimulatedHits = "hits";
+  csvWriterCfg.outputDir = outputDir;
+  FW::CsvPlanarClusterWriter csvWriter(csvWriterCfg, logLevel);
+  FW::BinaryPlanarClusterWriter::Config binaryWriterCfg;
+  binaryWriterCfg.inputClusters = "clusters";
+  binaryWriterCfg.inputSimulatedHits = "hits";
+  binaryWriterCfg.outputDir = outputDir;
+  FW::BinaryPlanarClusterWriter binaryWriter(binaryWriterCfg, logLevel);
+  std::mt19937 rng(42u);
+  for (size_t event = 0; event < numEvents; ++event) {
+    FW::WhiteBoard store;
+    FW::AlgorithmContext ctx(0, event, store);
+    generateEvent(surfaces, numHits, rng, ctx);
+    if ((csvWriter.write(ctx) != FW::ProcessCode::SUCCESS) or
+        (binaryWriter.write(ctx) != FW::ProcessCode::SUCCESS)) {
+      std::cerr << "error: failed to write event " << event << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // Read the events back
+  FW::CsvPlanarClusterReader::Config csvReaderCfg;
+  csvReaderCfg.inputDir = outputDir;
+  csvReaderCfg.outputClusters = "clusters";
+  csvReaderCfg.outputHitIds = "hit_ids";
+  csvReaderCfg.outputHitParticlesMap = "hit_particles_map";
+  csvReaderCfg.outputSimulatedHits = "hits";
+  csvReaderCfg.trackingGeometry = trackingGeometry;
+  FW::BinaryPlanarClusterReader::Config binaryReaderCfg;
+  binaryReaderCfg.inputDir = outputDir;
+  binaryReaderCfg.outputClusters = "clusters";
+  binaryReaderCfg.outputHitIds = "hit_ids";
+  binaryReaderCfg.outputHitParticlesMap = "hit_particles_map";
+  binaryReaderCfg.outputSimulatedHits = "hits";
+  binaryReaderCfg.trackingGeometry = trackingGeometry;
+  const auto csvTime = readEvents<FW::CsvPlanarClusterReader>(
+      csvReaderCfg, numEvents, logLevel);
+  const auto binaryTime = readEvents<FW::BinaryPlanarClusterReader>(
+      binaryReaderCfg, numEvents, logLevel);
+
+  const double numTotal = numEvents * numHits;
+  std::cout << "Read " << numEvents << " events with " << numHits
+            << " hits each" << std::endl;
+  std::cout << "CSV hits per second:    " << numTotal / csvTime.count()
+            << std::endl;
+  std::cout << "Binary hits per second: " << numTotal / binaryTime.count()
+            << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -8,6 +8,7 @@
 
 /// @brief compute energy loss tables using the Acts implementation
 
+#include <cmath>
 #include <cstddef>
 #include <cstdlib>
 #include <iomanip>
@@ -18,6 +19,7 @@
 #include "Acts/Material/MaterialProperties.hpp"
 #include "Acts/Utilities/PdgParticle.hpp"
 #include "Acts/Utilities/Units.hpp"
+#include "ActsFatras/Physics/Tabulated/InteractionTable.hpp"
 #include "ActsFatras/Utilities/ParticleData.hpp"
 
 using namespace Acts::UnitLiterals;
@@ -38,6 +40,9 @@ static void printHeader(std::ostream& os, const Acts::MaterialProperties& slab,
   os << "# delta_ion is the energy loss due to ionisation and excitation\n";
   os << "# delta_rad is the energy loss due to radiative effects\n";
   os << "# sigma is the width of the enery loss distribution\n";
+  os << "# mpv is the most probable ionisation energy loss\n";
+  os << "# *_tab are the values interpolated from the Fatras tables\n";
+  os << "# theta0 is the multiple scattering width in mrad\n";
   // column names
   os << std::left;
   os << std::setw(width) << "momentum" << separator;
@@ -46,11 +51,18 @@ static void printHeader(std::ostream& os, const Acts::MaterialProperties& slab,
   os << std::setw(width) << "delta" << separator;
   os << std::setw(width) << "delta_ion" << separator;
   os << std::setw(width) << "delta_rad" << separator;
-  os << std::setw(width) << "sigma" << '\n';
+  os << std::setw(width) << "sigma" << separator;
+  os << std::setw(width) << "mpv" << separator;
+  os << std::setw(width) << "mpv_tab" << separator;
+  os << std::setw(width) << "sigma_tab" << separator;
+  os << std::setw(width) << "theta0" << separator;
+  os << std::setw(width) << "theta0_tab" << '\n';
 }
 
 static void printLine(std::ostream& os, float mass, float momentum, float delta,
-                      float deltaIon, float deltaRad, float sigma) {
+                      float deltaIon, float deltaRad, float sigma,
+                      float deltaMpv, float theta0,
+                      const ActsFatras::InteractionTable::Values& tabulated) {
   const auto energy = std::sqrt(mass * mass + momentum * momentum);
   const auto beta = momentum / energy;
   const auto betaGamma = momentum / mass;
@@ -61,7 +73,12 @@ static void printLine(std::ostream& os, float mass, float momentum, float delta,
   os << std::setw(width) << delta / 1_MeV << separator;
   os << std::setw(width) << deltaIon / 1_MeV << separator;
   os << std::setw(width) << deltaRad / 1_MeV << separator;
-  os << std::setw(width) << sigma / 1_MeV << '\n';
+  os << std::setw(width) << sigma / 1_MeV << separator;
+  os << std::setw(width) << deltaMpv / 1_MeV << separator;
+  os << std::setw(width) << tabulated.energyLoss / 1_MeV << separator;
+  os << std::setw(width) << tabulated.energyLossSigma / 1_MeV << separator;
+  os << std::setw(width) << theta0 / 1_mrad << separator;
+  os << std::setw(width) << tabulated.theta0 / 1_mrad << '\n';
 }
 
 int main(int argc, char const* argv[]) {
@@ -85,12 +102,23 @@ int main(int argc, char const* argv[]) {
   const auto pmin = atof(argv[3]) * 1_GeV;
   const auto pmax = atof(argv[4]) * 1_GeV;
   const auto deltap = (pmax - pmin) / atoi(argv[5]);
+  if (charge == 0 or not std::isfinite(charge)) {
+    std::cerr << "error: energy loss requires a charged particle\n";
+    return EXIT_FAILURE;
+  }
 
   // use fixed material (beryllium) for now
   // TODO make material configurable by command line
   const Acts::Material material(35.28_cm, 42.10_cm, 9.012, 4, 1.848_g / 1_cm3);
   const Acts::MaterialProperties slab(material, thickness);
 
+  // tabulated values for validation of the Fatras interaction tables
+  ActsFatras::InteractionTable::Config tableCfg;
+  tableCfg.pdg = pdg;
+  tableCfg.mass = mass;
+  tableCfg.charge = charge;
+  const ActsFatras::InteractionTable table(material, tableCfg);
+
   printHeader(std::cout, slab, pdg, mass, charge);
   // scan momentum
   for (auto p = pmin; p < pmax; p += deltap) {
@@ -105,7 +133,20 @@ int main(int argc, char const* argv[]) {
     const auto sigma =
         Acts::computeEnergyLossLandauSigma(slab, pdg, mass, qOverP, charge);
 
-    printLine(std::cout, mass, p, delta, deltaIon, deltaRad, sigma);
+    const auto deltaMpv =
+        Acts::computeEnergyLossLandau(slab, pdg, mass, qOverP, charge);
+    const auto theta0 =
+        Acts::computeMultipleScatteringTheta0(slab, pdg, mass, qOverP, charge);
+    // values outside the tabulated range are reported as NaN
+    ActsFatras::InteractionTable::Values tabulated;
+    if (not table.lookup(slab.thicknessInX0(), p / mass, tabulated)) {
+      tabulated.theta0 = NAN;
+      tabulated.energyLoss = NAN;
+      tabulated.energyLossSigma = NAN;
+    }
+
+    printLine(std::cout, mass, p, delta, deltaIon, deltaRad, sigma, deltaMpv,
+              theta0, tabulated);
   }
 
   return EXIT_SUCCESS;
@@ -15,6 +15,8 @@
 #include "ACTFW/Framework/WhiteBoard.hpp"
 #include "ACTFW/GenericDetector/GenericDetector.hpp"
 #include "ACTFW/Geometry/CommonGeometry.hpp"
+#include "ACTFW/Io/Binary/BinaryParticleReader.hpp"
+#include "ACTFW/Io/Binary/BinaryPlanarClusterReader.hpp"
 #include "ACTFW/Io/Csv/CsvOptionsReader.hpp"
 #include "ACTFW/Io/Csv/CsvParticleReader.hpp"
 #include "ACTFW/Io/Csv/CsvPlanarClusterReader.hpp"
@@ -44,6 +46,8 @@ int main(int argc, char* argv[]) {
   Options::addOutputOptions(desc);
   detector.addOptions(desc);
   Options::addBFieldOptions(desc);
+  desc.add_options()("fit-parallel", boost::program_options::bool_switch(),
+                     "Fit the tracks within each event in parallel.");
 
   auto vm = Options::parse(desc, argc, argv);
   if (vm.empty()) {
@@ -69,21 +73,45 @@ int main(int argc, char* argv[]) {
   // Setup the magnetic field
   auto magneticField = Options::readBField(vm);
 
-  // Read particles (initial states) and clusters from CSV files
+  // Read particles (initial states) and clusters from CSV or binary files
+  const bool inputBinary = vm["input-binary"].as<bool>();
   auto particleReader = Options::readCsvParticleReaderConfig(vm);
   particleReader.inputStem = "particles_initial";
   particleReader.outputParticles = "particles_initial";
-  sequencer.addReader(
-      std::make_shared<CsvParticleReader>(particleReader, logLevel));
-  // Read clusters from CSV files
+  if (inputBinary) {
+    BinaryParticleReader::Config binaryParticleReader;
+    binaryParticleReader.inputDir = particleReader.inputDir;
+    binaryParticleReader.inputStem = particleReader.inputStem;
+    binaryParticleReader.outputParticles = particleReader.outputParticles;
+    sequencer.addReader(std::make_shared<BinaryParticleReader>(
+        binaryParticleReader, logLevel));
+  } else {
+    sequencer.addReader(
+        std::make_shared<CsvParticleReader>(particleReader, logLevel));
+  }
+  // Read clusters from CSV or binary files
   auto clusterReaderCfg = Options::readCsvPlanarClusterReaderConfig(vm);
   clusterReaderCfg.trackingGeometry = trackingGeometry;
   clusterReaderCfg.outputClusters = "clusters";
   clusterReaderCfg.outputHitIds = "hit_ids";
   clusterReaderCfg.outputHitParticlesMap = "hit_particles_map";
   clusterReaderCfg.outputSimulatedHits = "hits";
-  sequencer.addReader(
-      std::make_shared<CsvPlanarClusterReader>(clusterReaderCfg, logLevel));
+  if (inputBinary) {
+    BinaryPlanarClusterReader::Config binaryClusterReader;
+    binaryClusterReader.inputDir = clusterReaderCfg.inputDir;
+    binaryClusterReader.outputClusters = clusterReaderCfg.outputClusters;
+    binaryClusterReader.outputHitIds = clusterReaderCfg.outputHitIds;
+    binaryClusterReader.outputHitParticlesMap =
+        clusterReaderCfg.outputHitParticlesMap;
+    binaryClusterReader.outputSimulatedHits =
+        clusterReaderCfg.outputSimulatedHits;
+    binaryClusterReader.trackingGeometry = trackingGeometry;
+    sequencer.addReader(std::make_shared<BinaryPlanarClusterReader>(
+        binaryClusterReader, logLevel));
+  } else {
+    sequencer.addReader(
+        std::make_shared<CsvPlanarClusterReader>(clusterReaderCfg, logLevel));
+  }
 
   // TODO pre-select particles
 
@@ -137,6 +165,7 @@ int main(int argc, char* argv[]) {
   fitter.outputTrajectories = "trajectories";
   fitter.fit = FittingAlgorithm::makeFitterFunction(trackingGeometry,
                                                     magneticField, logLevel);
+  fitter.parallelFits = vm["fit-parallel"].as<bool>();
   sequencer.addAlgorithm(std::make_shared<FittingAlgorithm>(fitter, logLevel));
 
   // write tracks from fitting
@@ -146,6 +175,7 @@ int main(int argc, char* argv[]) {
   trackWriter.outputDir = outputDir;
   trackWriter.outputFilename = "tracks.root";
   trackWriter.outputTreename = "tracks";
+  trackWriter.perThreadSegments = vm["output-root-segments"].as<bool>();
   sequencer.addWriter(
       std::make_shared<RootTrajectoryWriter>(trackWriter, logLevel));
 
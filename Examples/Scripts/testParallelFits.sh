@@ -0,0 +1,63 @@
+#!/bin/bash
+#
+# This script tests whether the tracks fitted within an event in parallel are
+# identical to the ones fitted serially. For example,
+# "./testParallelFits.sh ActsRecTruthTracks \"-n 10 --input-dir sim\"" runs
+# the truth tracking with serial fits in single-threaded mode and with
+# parallel fits in multi-threaded mode and compares the fitted trajectories
+# aside from threading-induced event reordering.
+#
+set -uo pipefail
+
+# Check whether the user did specify the name of the example to be run
+ARGC=$#
+if [[ $ARGC -lt 2 ]]; then
+  echo ""
+  echo " Usage: "$0" <example> <flags> [<output>]"
+  echo ""
+  echo " <example> is the executable name (e.g. ActsRecTruthTracks)"
+  echo " <flags> is a string containing CLI flags (e.g. \"-n 10\")"
+  echo " <output> is the trajectory output name without the trailing '.root'"
+  echo "          (default \"tracks\")"
+  echo ""
+  exit 42
+fi
+
+# Compute the example command line and the output file name
+executable="$1 $2 --output-root true"
+echo ${executable}
+output="${3:-tracks}.root"
+
+# Drop any remaining output file from previous runs of the example
+rm -f $output SERIAL$output PARALLEL$output
+
+# Run the example with serial fits in single-threaded mode
+eval "${executable} -j 1"
+result=$?
+if [[ result -ne 0 ]]; then
+  echo "Run with serial fits failed!"
+  exit $result
+fi
+mv $output SERIAL$output
+
+# Run the example with parallel fits in multi-threaded mode. The event loop
+# limits the number of threads, so a single-threaded run would fit serially.
+eval "${executable} --fit-parallel"
+result=$?
+if [[ result -ne 0 ]]; then
+  echo "Run with parallel fits failed!"
+  exit $result
+fi
+mv $output PARALLEL$output
+
+# Check whether the fitted trajectories are identical
+cmd="root -b -q -l -x -e '.x compareRootFiles.C(\"SERIAL$output\", \"PARALLEL$output\")'"
+eval $cmd
+result=$?
+if [[ result -ne 0 ]]; then
+  echo "Trajectories of serial and parallel fits differ!"
+  exit $result
+fi
+
+# Clean up
+rm SERIAL$output PARALLEL$output
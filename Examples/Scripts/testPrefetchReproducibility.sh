@@ -0,0 +1,58 @@
+#!/bin/bash
+#
+# This script tests whether the output of a certain ACTS framework example is
+# identical with and without event prefetching. For example,
+# "./testPrefetchReproducibility.sh ActsGenParticleGun" will run the particle
+# gun with and without prefetching and compare the written particles. The
+# readers, e.g. the event generators, must see the same context in both modes,
+# otherwise the random numbers and thus the generated events differ.
+#
+set -uo pipefail
+
+# Check whether the user did specify the name of the example to be run
+ARGC=$#
+if [[ $ARGC -lt 1 ]]; then
+  echo ""
+  echo " Usage: "$0" <example> [<flags>]"
+  echo ""
+  echo " <example> is the executable name (e.g. ActsGenParticleGun)"
+  echo " <flags> is a string containing CLI flags (default \"-n 20\")"
+  echo ""
+  exit 42
+fi
+
+# Compute the example command line with csv output
+flags="${2:--n 20}"
+executable="$1 ${flags} --output-csv true"
+echo ${executable}
+
+# Drop any remaining output from previous runs of the example
+rm -rf prefetch-off prefetch-on
+
+# Run the example without prefetching
+eval "${executable} --output-dir prefetch-off"
+result=$?
+if [[ result -ne 0 ]]; then
+  echo "Run without prefetching failed!"
+  exit $result
+fi
+
+# Run the example with prefetching on multiple I/O threads
+eval "${executable} --output-dir prefetch-on --prefetch-events 4 --prefetch-threads 2"
+result=$?
+if [[ result -ne 0 ]]; then
+  echo "Run with prefetching failed!"
+  exit $result
+fi
+
+# The outputs are written per event and must be identical; the timing
+# measurements of the sequencer naturally differ
+diff -r -x 'timing*.tsv' -x trace.json prefetch-off prefetch-on
+result=$?
+if [[ result -ne 0 ]]; then
+  echo "Outputs with and without prefetching differ!"
+  exit $result
+fi
+
+# Clean up
+rm -rf prefetch-off prefetch-on
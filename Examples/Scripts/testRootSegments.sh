@@ -0,0 +1,84 @@
+#!/bin/bash
+#
+# This script tests whether the ROOT output of a certain ACTS framework example
+# written with per-thread tree segments is identical to the output of a
+# single-threaded run. For example,
+# "./testRootSegments.sh ActsSimFatrasGeneric \"-n 20\" hits particles_final"
+# will run the Fatras example once multi-threaded with merged tree segments and
+# once single-threaded with the default writers and compare the output files.
+#
+set -uo pipefail
+
+# Check whether the user did specify the name of the example to be run
+ARGC=$#
+if [[ $ARGC -lt 3 ]]; then
+  echo ""
+  echo " Usage: "$0" <example> <flags> <output1> [<output2> ...]"
+  echo ""
+  echo " <example> is the executable name (e.g. ActsSimFatrasGeneric)"
+  echo " <flags> is a string containing CLI flags (e.g. \"-n 20\")"
+  echo " <outputN> is the output name (which is the output file name without the trailing '.root')"
+  echo ""
+  exit 42
+fi
+
+# Compute the name of the example executable
+executable="$1 $2 --output-root true"
+echo ${executable}
+
+# Compute the output file names
+for ((i = 3; i <= $ARGC; i++)); do
+  eval output=\$${i}.root
+  eval outputs[$i]=$output
+done
+
+# Drop any remaining output file from previous runs of the example
+for output in "${outputs[@]}"; do
+  rm -f $output ST$output SEG$output $output.*.segment*
+done
+
+# Run the example in multi-threaded mode with per-thread tree segments
+eval "${executable} --output-root-segments true"
+result=$?
+if [[ result -ne 0 ]]; then
+  echo "Run with tree segments failed!"
+  exit $result
+fi
+
+# The segments must have been merged and removed, back up the results
+for output in "${outputs[@]}"; do
+  if ls $output.*.segment* 1>/dev/null 2>&1; then
+    echo "Tree segments of $output were not removed!"
+    exit 1
+  fi
+  mv $output SEG$output
+done
+
+# Run the example in single-threaded mode without tree segments
+eval "${executable} -j 1"
+result=$?
+if [[ result -ne 0 ]]; then
+  echo "Single-threaded run failed!"
+  exit $result
+fi
+
+# Back up the single-threaded results
+for output in "${outputs[@]}"; do
+  mv $output ST$output
+done
+
+# Check whether the results were identical
+for output in "${outputs[@]}"; do
+  # Compare the active results files
+  cmd="root -b -q -l -x -e '.x compareRootFiles.C(\"ST$output\", \"SEG$output\")'"
+  eval $cmd
+  result=$?
+
+  # If the results were different, abort and return the output status code
+  if [[ result -ne 0 ]]; then
+    exit $result
+  fi
+
+  # Otherwise clean up and continue
+  rm ST$output SEG$output
+done
@@ -9,6 +9,8 @@
 #pragma once
 
 #include <cassert>
+#include <cstddef>
+#include <vector>
 
 #include "Acts/Material/ISurfaceMaterial.hpp"
 #include "Acts/Surfaces/Surface.hpp"
@@ -47,6 +49,11 @@ struct InteractorResult {
   std::vector<Particle> generatedParticles;
   /// Hits created by the propagated particle.
   std::vector<Hit> hits;
+  /// Number of hits created by the propagated particle.
+  ///
+  /// Also counts the hits that are stored in external output buffers and are
+  /// thus not part of the result hits container.
+  std::size_t numHits = 0u;
 };
 
 /// Fatras interactor plugin for the Acts propagator.
@@ -85,6 +92,14 @@ struct Interactor {
   hit_surface_selector_t selectHitSurface;
   /// Initial particle state.
   Particle particle;
+  /// Optional output buffer for generated particles.
+  ///
+  /// If set, generated particles are appended to the buffer instead of being
+  /// stored in the result. This allows the caller to reuse the same storage
+  /// for many particles and avoids per-particle allocations.
+  std::vector<Particle> *generatedParticlesBuffer = nullptr;
+  /// Optional output buffer for hits; same behaviour as for particles.
+  std::vector<Hit> *hitsBuffer = nullptr;
 
   /// Simulate the interaction with a single surface.
   ///
@@ -144,8 +159,9 @@ struct Interactor {
             normal.norm() / normal.dot(before.unitDirection());
         slab.scaleThickness(cosIncidenceInv);
         // physics list returns if the particle was killed.
-        result.isAlive =
-            not physics(*generator, slab, after, result.generatedParticles);
+        auto &generated = generatedParticlesBuffer ? *generatedParticlesBuffer
+                                                   : result.generatedParticles;
+        result.isAlive = not physics(*generator, slab, after, generated);
         // add the accumulated material; assumes the full material was passsed
         // event if the particle was killed.
         result.pathInX0 += slab.thicknessInX0();
@@ -165,11 +181,13 @@ struct Interactor {
     // store results of this interaction step, including potential hits
     result.particle = after;
     if (selectHitSurface(surface)) {
-      result.hits.emplace_back(
+      auto &hits = hitsBuffer ? *hitsBuffer : result.hits;
+      hits.emplace_back(
           surface.geoID(), before.particleId(),
           // the interaction could potentially modify the particle position
           Hit::Scalar(0.5) * (before.position4() + after.position4()),
-          before.momentum4(), after.momentum4(), result.hits.size());
+          before.momentum4(), after.momentum4(), result.numHits);
+      result.numHits += 1u;
     }
 
     // continue the propagation with the modified parameters
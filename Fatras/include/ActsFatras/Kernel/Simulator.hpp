@@ -12,6 +12,7 @@
 #include <cassert>
 #include <iterator>
 #include <memory>
+#include <type_traits>
 #include <vector>
 
 #include "Acts/EventData/ChargePolicy.hpp"
@@ -71,6 +72,41 @@ struct ParticleSimulator {
       const Acts::GeometryContext &geoCtx,
       const Acts::MagneticFieldContext &magCtx, generator_t &generator,
       const Particle &particle) const {
+    return simulateImpl(geoCtx, magCtx, generator, particle, nullptr, nullptr);
+  }
+
+  /// Simulate a single particle and append outputs to external buffers.
+  ///
+  /// @param geoCtx is the geometry context to access surface geometries
+  /// @param magCtx is the magnetic field context to access field values
+  /// @param generator is the random number generator
+  /// @param particle is the initial particle state
+  /// @param generatedParticles is the buffer for generated particles
+  /// @param hits is the buffer for generated hits
+  /// @returns the result of the corresponding Interactor propagator action.
+  ///
+  /// Generated particles and hits are appended to the buffers and are not
+  /// part of the returned result. If the simulation fails, the buffers might
+  /// contain partial outputs from the failed particle.
+  ///
+  /// @tparam generator_t is the type of the random number generator
+  template <typename generator_t>
+  Acts::Result<InteractorResult> simulate(
+      const Acts::GeometryContext &geoCtx,
+      const Acts::MagneticFieldContext &magCtx, generator_t &generator,
+      const Particle &particle, std::vector<Particle> &generatedParticles,
+      std::vector<Hit> &hits) const {
+    return simulateImpl(geoCtx, magCtx, generator, particle,
+                        &generatedParticles, &hits);
+  }
+
+ private:
+  template <typename generator_t>
+  Acts::Result<InteractorResult> simulateImpl(
+      const Acts::GeometryContext &geoCtx,
+      const Acts::MagneticFieldContext &magCtx, generator_t &generator,
+      const Particle &particle, std::vector<Particle> *generatedParticles,
+      std::vector<Hit> *hits) const {
     assert(localLogger and "Missing local logger");
 
     // propagator-related additional types
@@ -92,6 +128,8 @@ struct ParticleSimulator {
     interactor.physics = physics;
     interactor.selectHitSurface = selectHitSurface;
     interactor.particle = particle;
+    interactor.generatedParticlesBuffer = generatedParticles;
+    interactor.hitsBuffer = hits;
 
     // run with a start parameter type depending on the particle charge.
     // TODO make track parameters consistently constructible regardless
@@ -198,61 +236,23 @@ struct Simulator {
         (simulatedParticlesInitial.size() == simulatedParticlesFinal.size()) and
         "Inconsistent initial sizes of the simulated particle containers");
 
-    using ParticleSimulatorResult = Acts::Result<InteractorResult>;
-
     std::vector<FailedParticle> failedParticles;
 
+    // all particles use the same random number generator
+    auto generatorFor = [&](const Particle &) -> generator_t & {
+      return generator;
+    };
     for (const Particle &inputParticle : inputParticles) {
       // only consider simulatable particles
       if (not selectParticle(inputParticle)) {
         continue;
       }
-      // required to allow correct particle id numbering for secondaries later
-      if ((inputParticle.particleId().generation() != 0u) or
-          (inputParticle.particleId().subParticle() != 0u)) {
-        return detail::SimulatorError::eInvalidInputParticleId;
-      }
-
-      // Do a *depth-first* simulation of the particle and its secondaries,
-      // i.e. we simulate all secondaries, tertiaries, ... before simulating
-      // the next primary particle. Use the end of the output container as
-      // a queue to store particles that should be simulated.
-      //
-      // WARNING the initial particle state output container will be modified
-      //         during iteration. New secondaries are added to and failed
-      //         particles might be removed. to avoid issues, access must always
-      //         occur via indices.
-      auto iinitial = simulatedParticlesInitial.size();
-      simulatedParticlesInitial.push_back(inputParticle);
-      for (; iinitial < simulatedParticlesInitial.size(); ++iinitial) {
-        const auto &initialParticle = simulatedParticlesInitial[iinitial];
-
-        // only simulatable particles are pushed to the container.
-        // they must therefore be either charged or neutral.
-        ParticleSimulatorResult result = ParticleSimulatorResult::success({});
-        if (selectCharged(initialParticle)) {
-          result = charged.simulate(geoCtx, magCtx, generator, initialParticle);
-        } else {
-          result = neutral.simulate(geoCtx, magCtx, generator, initialParticle);
-        }
-
-        if (not result.ok()) {
-          // remove particle from output container since it was not simulated.
-          simulatedParticlesInitial.erase(
-              std::next(simulatedParticlesInitial.begin(), iinitial));
-          // record the particle as failed
-          failedParticles.push_back({initialParticle, result.error()});
-          continue;
-        }
-
-        copyOutputs(result.value(), simulatedParticlesInitial,
-                    simulatedParticlesFinal, hits);
-        // since physics processes are independent, there can be particle id
-        // collisions within the generated secondaries. they can be resolved by
-        // renumbering within each sub-particle generation. this must happen
-        // before the particle is simulated since the particle id is used to
-        // associate generated hits back to the particle.
-        renumberTailParticleIds(simulatedParticlesInitial, iinitial);
+      auto ret = simulateParticleTree(
+          geoCtx, magCtx, generatorFor, inputParticle,
+          simulatedParticlesInitial, simulatedParticlesFinal, hits,
+          failedParticles);
+      if (not ret.ok()) {
+        return ret.error();
       }
     }
 
@@ -263,7 +263,165 @@ struct Simulator {
     return failedParticles;
   }
 
+  /// Simulate a single primary particle and its generated secondaries.
+  ///
+  /// @param geoCtx is the geometry context to access surface geometries
+  /// @param magCtx is the magnetic field context to access field values
+  /// @param makeGenerator creates the random number generator for a particle
+  /// @param primary is the primary particle that should be simulated
+  /// @param simulatedParticlesInitial contains initial particle states
+  /// @param simulatedParticlesFinal contains final particle states
+  /// @param hits contains all generated hits
+  /// @param failedParticles contains all particles that failed to simulate
+  /// @retval Acts::Result::Error if there is a fundamental issue
+  /// @retval Acts::Result::Success otherwise
+  ///
+  /// In contrast to the full event simulation, every simulated particle draws
+  /// from its own random number generator that is created by calling
+  /// `makeGenerator(particle)` before the particle is simulated. The particle
+  /// ids, and thus the generator streams if they are derived from the ids, are
+  /// uniquely defined by the primary particle. If the generator only depends
+  /// on the particle, the results are independent of the order in which the
+  /// primary particles are simulated. Different primary particles can thus be
+  /// simulated concurrently into separate output containers.
+  ///
+  /// Primary particles that do not pass the selection are ignored. The same
+  /// requirements on the input particle ids as for the full event simulation
+  /// apply.
+  ///
+  /// @tparam generator_factory_t is a callable that creates a generator
+  /// @tparam output_particles_t is a SequenceContainer for particles
+  /// @tparam hits_t is a SequenceContainer for hits
+  template <typename generator_factory_t, typename output_particles_t,
+            typename hits_t>
+  Acts::Result<void> simulatePrimary(
+      const Acts::GeometryContext &geoCtx,
+      const Acts::MagneticFieldContext &magCtx,
+      const generator_factory_t &makeGenerator, const Particle &primary,
+      output_particles_t &simulatedParticlesInitial,
+      output_particles_t &simulatedParticlesFinal, hits_t &hits,
+      std::vector<FailedParticle> &failedParticles) const {
+    // only consider simulatable particles
+    if (not selectParticle(primary)) {
+      return Acts::Result<void>::success();
+    }
+
+    // the generator is replaced for every simulated particle
+    auto generator = makeGenerator(primary);
+    auto generatorFor = [&](const Particle &particle) -> decltype(generator) & {
+      generator = makeGenerator(particle);
+      return generator;
+    };
+    return simulateParticleTree(geoCtx, magCtx, generatorFor, primary,
+                                simulatedParticlesInitial,
+                                simulatedParticlesFinal, hits, failedParticles);
+  }
+
  private:
+  /// Simulate a selected input particle and all its generated secondaries.
+  ///
+  /// @tparam generator_for_t callable that returns the generator for a particle
+  /// @tparam output_particles_t is a SequenceContainer for particles
+  /// @tparam hits_t is a SequenceContainer for hits
+  template <typename generator_for_t, typename output_particles_t,
+            typename hits_t>
+  Acts::Result<void> simulateParticleTree(
+      const Acts::GeometryContext &geoCtx,
+      const Acts::MagneticFieldContext &magCtx, generator_for_t &generatorFor,
+      const Particle &inputParticle,
+      output_particles_t &simulatedParticlesInitial,
+      output_particles_t &simulatedParticlesFinal, hits_t &hits,
+      std::vector<FailedParticle> &failedParticles) const {
+    using ParticleSimulatorResult = Acts::Result<InteractorResult>;
+
+    // required to allow correct particle id numbering for secondaries later
+    if ((inputParticle.particleId().generation() != 0u) or
+        (inputParticle.particleId().subParticle() != 0u)) {
+      return detail::SimulatorError::eInvalidInputParticleId;
+    }
+
+    // Do a *depth-first* simulation of the particle and its secondaries,
+    // i.e. we simulate all secondaries, tertiaries, ... before simulating
+    // the next primary particle. Use the end of the output container as
+    // a queue to store particles that should be simulated.
+    //
+    // WARNING the initial particle state output container will be modified
+    //         during iteration. New secondaries are appended while a particle
+    //         is simulated. to avoid issues, access must always occur via
+    //         indices.
+    //
+    // Generated particles and hits are appended directly to the output
+    // containers if they can be used as buffers by the particle simulators
+    // and are moved from local scratch buffers otherwise. Failed particles
+    // are not erased immediately, but are marked with a tombstone and
+    // removed in a single pass once the whole particle tree is simulated.
+    std::vector<Particle> generatedScratch;
+    std::vector<Hit> hitsScratch;
+    std::vector<Particle> &generatedBuffer =
+        bufferFor(simulatedParticlesInitial, generatedScratch);
+    std::vector<Hit> &hitsBuffer = bufferFor(hits, hitsScratch);
+    std::vector<std::size_t> tombstones;
+
+    auto iinitial = simulatedParticlesInitial.size();
+    simulatedParticlesInitial.push_back(inputParticle);
+    for (; iinitial < simulatedParticlesInitial.size(); ++iinitial) {
+      // local copy since the container can grow during the simulation
+      const Particle initialParticle = simulatedParticlesInitial[iinitial];
+      auto &generator = generatorFor(initialParticle);
+      const auto nGenerated = generatedBuffer.size();
+      const auto nHits = hitsBuffer.size();
+
+      // only simulatable particles are pushed to the container.
+      // they must therefore be either charged or neutral.
+      ParticleSimulatorResult result = ParticleSimulatorResult::success({});
+      if (selectCharged(initialParticle)) {
+        result = charged.simulate(geoCtx, magCtx, generator, initialParticle,
+                                  generatedBuffer, hitsBuffer);
+      } else {
+        result = neutral.simulate(geoCtx, magCtx, generator, initialParticle,
+                                  generatedBuffer, hitsBuffer);
+      }
+
+      if (not result.ok()) {
+        // record the particle as failed
+        failedParticles.push_back({initialParticle, result.error()});
+        // drop partial outputs of the failed particle
+        generatedBuffer.erase(std::next(generatedBuffer.begin(), nGenerated),
+                              generatedBuffer.end());
+        hitsBuffer.erase(std::next(hitsBuffer.begin(), nHits),
+                         hitsBuffer.end());
+        // keep a placeholder final state until the tombstones are removed
+        simulatedParticlesFinal.push_back(initialParticle);
+        tombstones.push_back(iinitial);
+        continue;
+      }
+
+      // store final particle state at the end of the simulation
+      simulatedParticlesFinal.push_back(result.value().particle);
+      // only keep generated secondaries that should be simulated
+      generatedBuffer.erase(
+          std::remove_if(std::next(generatedBuffer.begin(), nGenerated),
+                         generatedBuffer.end(),
+                         [this](const Particle &particle) {
+                           return not selectParticle(particle);
+                         }),
+          generatedBuffer.end());
+      flushBuffer(generatedBuffer, simulatedParticlesInitial);
+      flushBuffer(hitsBuffer, hits);
+      // since physics processes are independent, there can be particle id
+      // collisions within the generated secondaries. they can be resolved by
+      // renumbering within each sub-particle generation. this must happen
+      // before the particle is simulated since the particle id is used to
+      // associate generated hits back to the particle.
+      renumberTailParticleIds(simulatedParticlesInitial, iinitial);
+    }
+
+    // remove failed particles from the regular output
+    removeTombstones(tombstones, simulatedParticlesInitial,
+                     simulatedParticlesFinal);
+    return Acts::Result<void>::success();
+  }
+
   /// Select if the particle should be simulated at all.
   ///
   /// This also enforces mutual-exclusivity of the two charge selections. If
@@ -277,23 +435,59 @@ struct Simulator {
     return isValidCharged xor isValidNeutral;
   }
 
-  /// Copy Interactor results to output containers.
+  /// Select the buffer to which the particle simulators append outputs.
   ///
-  /// @tparam particles_t is a SequenceContainer for particles
-  /// @tparam hits_t is a SequenceContainer for hits
-  template <typename particles_t, typename hits_t>
-  void copyOutputs(const InteractorResult &result,
-                   particles_t &particlesInitial, particles_t &particlesFinal,
-                   hits_t &hits) const {
-    // initial particle state was already pushed to the container before
-    // store final particle state at the end of the simulation
-    particlesFinal.push_back(result.particle);
-    // move generated secondaries that should be simulated to the output
-    std::copy_if(
-        result.generatedParticles.begin(), result.generatedParticles.end(),
-        std::back_inserter(particlesInitial),
-        [this](const Particle &particle) { return selectParticle(particle); });
-    std::copy(result.hits.begin(), result.hits.end(), std::back_inserter(hits));
+  /// @returns the output container itself if possible or the scratch buffer
+  template <typename T, typename container_t>
+  static std::vector<T> &bufferFor(container_t &container,
+                                   std::vector<T> &scratch) {
+    if constexpr (std::is_same_v<container_t, std::vector<T>>) {
+      return container;
+    } else {
+      return scratch;
+    }
+  }
+
+  /// Move buffered outputs to the output container if they are separate.
+  template <typename T, typename container_t>
+  static void flushBuffer(std::vector<T> &buffer, container_t &container) {
+    if constexpr (not std::is_same_v<container_t, std::vector<T>>) {
+      std::move(buffer.begin(), buffer.end(), std::back_inserter(container));
+      buffer.clear();
+    }
+  }
+
+  /// Remove particles marked as failed from the particle containers.
+  ///
+  /// @param tombstones ordered indices of the failed particles
+  /// @param particlesInitial is a SequenceContainer for particles
+  /// @param particlesFinal is a SequenceContainer for particles
+  ///
+  /// The initial and final particle containers must be aligned, i.e. the same
+  /// index refers to the same particle. The order of the remaining particles
+  /// is preserved.
+  template <typename particles_t>
+  static void removeTombstones(const std::vector<std::size_t> &tombstones,
+                               particles_t &particlesInitial,
+                               particles_t &particlesFinal) {
+    if (tombstones.empty()) {
+      return;
+    }
+    auto itombstone = tombstones.begin();
+    auto iout = *itombstone;
+    for (auto i = iout; i < particlesInitial.size(); ++i) {
+      if ((itombstone != tombstones.end()) and (*itombstone == i)) {
+        ++itombstone;
+        continue;
+      }
+      particlesInitial[iout] = std::move(particlesInitial[i]);
+      particlesFinal[iout] = std::move(particlesFinal[i]);
+      ++iout;
+    }
+    particlesInitial.erase(std::next(particlesInitial.begin(), iout),
+                           particlesInitial.end());
+    particlesFinal.erase(std::next(particlesFinal.begin(), iout),
+                         particlesFinal.end());
   }
 
   /// Renumber particle ids in the tail of the container.
@@ -8,11 +8,14 @@
 
 #pragma once
 
+#include <memory>
+
 #include "ActsFatras/Kernel/PhysicsList.hpp"
 #include "ActsFatras/Kernel/Process.hpp"
 #include "ActsFatras/Physics/EnergyLoss/BetheBloch.hpp"
 #include "ActsFatras/Physics/EnergyLoss/BetheHeitler.hpp"
 #include "ActsFatras/Physics/Scattering/Highland.hpp"
+#include "ActsFatras/Physics/Tabulated/TabulatedInteractions.hpp"
 #include "ActsFatras/Selectors/KinematicCasts.hpp"
 #include "ActsFatras/Selectors/PdgSelectors.hpp"
 #include "ActsFatras/Selectors/SelectorHelpers.hpp"
@@ -39,6 +42,9 @@ using StandardBetheBloch =
 using StandardBetheHeitler =
     Process<BetheHeitler, AsInputSelector<SelectElectronLike>, SelectPMin,
             EveryParticle>;
+/// Tabulated scattering and ionisation energy loss with a lower p cut.
+using StandardTabulatedInteractions =
+    Process<TabulatedInteractions, EveryInput, SelectPMin, EveryParticle>;
 }  // namespace detail
 
 /// Electro-magnetic interactions for charged particles.
@@ -63,4 +69,20 @@ using ChargedElectroMagneticPhysicsList =
 ChargedElectroMagneticPhysicsList makeChargedElectroMagneticPhysicsList(
     double minimumAbsMomentum);
 
+/// Electro-magnetic interactions for charged particles using tables.
+///
+/// Equivalent to the standard electro-magnetic physics list but scattering
+/// and ionisation energy loss are computed from precomputed tables.
+using TabulatedElectroMagneticPhysicsList =
+    PhysicsList<detail::StandardTabulatedInteractions,
+                detail::StandardBetheHeitler>;
+
+/// Construct the tabulated electro-magnetic physics list for charged particles.
+///
+/// @param minimumAbsMomentum lower p cut on output particles
+/// @param tables precomputed interaction tables
+TabulatedElectroMagneticPhysicsList makeTabulatedElectroMagneticPhysicsList(
+    double minimumAbsMomentum,
+    std::shared_ptr<const InteractionTables> tables);
+
 }  // namespace ActsFatras
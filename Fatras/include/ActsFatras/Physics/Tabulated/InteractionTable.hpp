@@ -0,0 +1,174 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "Acts/Material/Material.hpp"
+#include "Acts/Utilities/PdgParticle.hpp"
+
+namespace ActsFatras {
+
+/// Precomputed interaction parameters for one material and particle type.
+///
+/// Stores the multiple scattering width theta0, the most probable energy loss
+/// and the energy loss width on a grid in the particle beta*gamma and the
+/// material thickness in radiation lengths. Both axes are logarithmic. The
+/// values are computed once with the analytic descriptions and interpolated
+/// bilinearly afterwards. A single lookup provides all three quantities and
+/// replaces the separate evaluation of the analytic parametrizations, each of
+/// which requires multiple logarithms, square roots and divisions.
+///
+/// The stored values are reduced by their leading thickness dependence, i.e.
+/// theta0/sqrt(x/X0) and energy loss/(x/X0). The reduced quantities are
+/// exactly linear in the logarithm of the thickness and the thickness axis can
+/// be coarse without loss of precision.
+class InteractionTable {
+ public:
+  /// Grid configuration and particle identity.
+  struct Config {
+    /// Particle type. Must be charged.
+    Acts::PdgParticle pdg = Acts::PdgParticle::eInvalid;
+    /// Particle mass.
+    float mass = 0.0f;
+    /// Particle charge.
+    float charge = 0.0f;
+    /// Tabulated beta*gamma range and number of grid points.
+    float betaGammaMin = 0.1f;
+    float betaGammaMax = 1e5f;
+    std::size_t betaGammaBins = 512u;
+    /// Tabulated thickness range in radiation lengths and number of points.
+    float thicknessInX0Min = 1e-5f;
+    float thicknessInX0Max = 1.0f;
+    std::size_t thicknessBins = 8u;
+  };
+  /// Interaction parameters for a single material passage.
+  struct Values {
+    /// Planar multiple scattering width.
+    float theta0 = 0.0f;
+    /// Most probable energy loss.
+    float energyLoss = 0.0f;
+    /// Gaussian-equivalent width of the energy loss distribution.
+    float energyLossSigma = 0.0f;
+  };
+
+  /// Compute the table for the given material.
+  ///
+  /// @param material is the material for which the table is computed
+  /// @param cfg is the grid configuration and particle identity
+  InteractionTable(const Acts::Material& material, const Config& cfg);
+
+  /// The tabulated material.
+  const Acts::Material& material() const { return m_material; }
+  /// The tabulated particle type.
+  Acts::PdgParticle pdg() const { return m_pdg; }
+
+  /// Lookup the interaction parameters for a material passage.
+  ///
+  /// @param[in]  thicknessInX0 is the passed material in radiation lengths
+  /// @param[in]  betaGamma is the particle beta*gamma before the interaction
+  /// @param[out] values are the interpolated interaction parameters
+  /// @return false if the inputs are outside the tabulated range
+  bool lookup(float thicknessInX0, float betaGamma, Values& values) const {
+    const float u = (std::log(betaGamma) - m_logBetaGammaMin) * m_invDeltaBG;
+    const float v =
+        (std::log(thicknessInX0) - m_logThicknessMin) * m_invDeltaThickness;
+    // negated comparisons also reject NaN inputs
+    if (not((0.0f <= u) and (u <= m_maxBetaGammaIndex) and (0.0f <= v) and
+            (v <= m_maxThicknessIndex))) {
+      return false;
+    }
+    // clamp lower indices such that the upper grid point is always valid
+    const std::size_t i =
+        std::min(static_cast<std::size_t>(u), m_betaGammaBins - 2u);
+    const std::size_t j =
+        std::min(static_cast<std::size_t>(v), m_thicknessBins - 2u);
+    const float fu = u - i;
+    const float fv = v - j;
+    const float w00 = (1.0f - fu) * (1.0f - fv);
+    const float w01 = (1.0f - fu) * fv;
+    const float w10 = fu * (1.0f - fv);
+    const float w11 = fu * fv;
+    const Values& n00 = m_nodes[i * m_thicknessBins + j];
+    const Values& n01 = m_nodes[i * m_thicknessBins + j + 1u];
+    const Values& n10 = m_nodes[(i + 1u) * m_thicknessBins + j];
+    const Values& n11 = m_nodes[(i + 1u) * m_thicknessBins + j + 1u];
+    // restore the leading thickness dependence
+    const float sqrtThickness = std::sqrt(thicknessInX0);
+    values.theta0 = sqrtThickness * (w00 * n00.theta0 + w01 * n01.theta0 +
+                                     w10 * n10.theta0 + w11 * n11.theta0);
+    values.energyLoss =
+        thicknessInX0 * (w00 * n00.energyLoss + w01 * n01.energyLoss +
+                         w10 * n10.energyLoss + w11 * n11.energyLoss);
+    values.energyLossSigma =
+        thicknessInX0 *
+        (w00 * n00.energyLossSigma + w01 * n01.energyLossSigma +
+         w10 * n10.energyLossSigma + w11 * n11.energyLossSigma);
+    return true;
+  }
+
+ private:
+  Acts::Material m_material;
+  Acts::PdgParticle m_pdg;
+  std::size_t m_betaGammaBins;
+  std::size_t m_thicknessBins;
+  float m_logBetaGammaMin;
+  float m_invDeltaBG;
+  float m_maxBetaGammaIndex;
+  float m_logThicknessMin;
+  float m_invDeltaThickness;
+  float m_maxThicknessIndex;
+  /// Reduced values for all grid points with the thickness as inner index.
+  std::vector<Values> m_nodes;
+};
+
+/// A set of interaction tables for different materials and particle types.
+class InteractionTables {
+ public:
+  /// Compute tables for all combinations of materials and particle types.
+  ///
+  /// @param materials are the materials that should be tabulated
+  /// @param pdgs are the particle types that should be tabulated
+  /// @param cfg is the grid configuration; the particle identity is ignored
+  ///
+  /// The particle masses and charges are taken from the particle data.
+  InteractionTables(const std::vector<Acts::Material>& materials,
+                    const std::vector<Acts::PdgParticle>& pdgs,
+                    const InteractionTable::Config& cfg =
+                        InteractionTable::Config());
+  InteractionTables() = default;
+
+  /// Add a single table.
+  void add(InteractionTable table) { m_tables.push_back(std::move(table)); }
+
+  /// Find the table for the material and particle type.
+  ///
+  /// @return nullptr if no matching table is available
+  const InteractionTable* find(const Acts::Material& material,
+                               Acts::PdgParticle pdg) const {
+    for (const auto& table : m_tables) {
+      if ((table.pdg() == pdg) and (table.material() == material)) {
+        return &table;
+      }
+    }
+    return nullptr;
+  }
+
+  /// The number of tables.
+  std::size_t size() const { return m_tables.size(); }
+
+ private:
+  std::vector<InteractionTable> m_tables;
+};
+
+}  // namespace ActsFatras
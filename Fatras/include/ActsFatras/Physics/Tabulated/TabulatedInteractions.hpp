@@ -0,0 +1,107 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <memory>
+
+#include "Acts/Material/Interactions.hpp"
+#include "Acts/Material/MaterialProperties.hpp"
+#include "Acts/Utilities/Definitions.hpp"
+#include "Acts/Utilities/UnitVectors.hpp"
+#include "ActsFatras/EventData/Particle.hpp"
+#include "ActsFatras/Physics/Tabulated/InteractionTable.hpp"
+#include "ActsFatras/Utilities/RandomVariatesBatch.hpp"
+
+namespace ActsFatras {
+
+/// Simulate Highland scattering and Bethe-Bloch energy loss from tables.
+///
+/// Combines `HighlandScattering` and `BetheBloch` in a single process that
+/// uses precomputed interaction tables for the distribution parameters and
+/// batched random variates. Scattering is applied before the energy loss as in
+/// the standard physics list. Materials or particle states that are not
+/// covered by the tables fall back to the analytic computations.
+///
+/// @note The random variates are drawn in a different order than for the
+///       separate analytic processes and the simulated particles are only
+///       statistically equivalent.
+/// @note The random variates batch is modified during the simulation. Every
+///       simulated particle must use its own copy of the process, which is
+///       already the case when it is used within the `ParticleSimulator`.
+struct TabulatedInteractions {
+  /// Precomputed tables. Only the analytic computations are used if unset.
+  std::shared_ptr<const InteractionTables> tables;
+  /// Scaling for most probable value
+  double scaleFactorMPV = 1.;
+  /// Scaling for Sigma
+  double scaleFactorSigma = 1.;
+  /// Random variates shared by consecutive interactions of the same particle.
+  mutable RandomVariatesBatch<8u> variates;
+
+  /// Simulate scattering and energy loss and update the particle parameters.
+  ///
+  /// @param[in]     generator is the random number generator
+  /// @param[in]     slab      defines the passed material
+  /// @param[in,out] particle  is the particle being updated
+  /// @return Empty secondaries containers.
+  ///
+  /// @tparam generator_t is a RandomNumberEngine
+  template <typename generator_t>
+  std::array<Particle, 0> operator()(generator_t &generator,
+                                     const Acts::MaterialProperties &slab,
+                                     Particle &particle) const {
+    const InteractionTable::Values values = computeValues(slab, particle);
+    const auto &random = variates.next(generator);
+
+    // scattering, see `detail::Scattering` and `detail::Highland`
+    const double psi = M_PI * (2.0 * random.uniform - 1.0);
+    const double theta = M_SQRT2 * values.theta0 * random.normal;
+    Acts::Vector3D direction = particle.unitDirection();
+    Acts::RotationMatrix3D rotation(
+        Acts::AngleAxis3D(psi, direction) *
+        Acts::AngleAxis3D(theta, Acts::makeCurvilinearUnitU(direction)));
+    direction.applyOnTheLeft(rotation);
+    particle.setDirection(direction);
+
+    // energy loss, see `BetheBloch`
+    const double loss = scaleFactorMPV * values.energyLoss +
+                        scaleFactorSigma * values.energyLossSigma *
+                            random.landau;
+    particle.correctEnergy(-loss);
+
+    return {};
+  }
+
+  /// Compute the distribution parameters from the tables if possible.
+  InteractionTable::Values computeValues(const Acts::MaterialProperties &slab,
+                                         const Particle &particle) const {
+    InteractionTable::Values values;
+    const InteractionTable *table =
+        tables ? tables->find(slab.material(), particle.pdg()) : nullptr;
+    if (table and table->lookup(slab.thicknessInX0(),
+                                particle.absMomentum() / particle.mass(),
+                                values)) {
+      return values;
+    }
+    const auto pdg = particle.pdg();
+    const auto m = particle.mass();
+    const auto qOverP = particle.charge() / particle.absMomentum();
+    const auto q = particle.charge();
+    values.theta0 =
+        Acts::computeMultipleScatteringTheta0(slab, pdg, m, qOverP, q);
+    values.energyLoss = Acts::computeEnergyLossLandau(slab, pdg, m, qOverP, q);
+    values.energyLossSigma =
+        Acts::computeEnergyLossLandauSigma(slab, pdg, m, qOverP, q);
+    return values;
+  }
+};
+
+}  // namespace ActsFatras
@@ -0,0 +1,123 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <limits>
+
+namespace ActsFatras {
+
+/// Counter-based random number engine using the Philox4x32-10 bijection.
+///
+/// Implements the standard library uniform random bit generator interface.
+///
+/// Each output block is computed directly from a key and a counter, see
+/// Salmon et al., "Parallel random numbers: as easy as 1, 2, 3", SC11. The key
+/// is given by the seed. The counter combines a user-defined 64bit stream
+/// identifier, e.g. a particle barcode, with the index of the output block
+/// within the stream. Streams for different identifiers are independent and
+/// can be created in any order on any thread without a central service.
+class PhiloxRandomEngine {
+ public:
+  /// The type of the generated values.
+  using result_type = uint32_t;
+
+  /// Construct the engine for a given seed and stream identifier.
+  constexpr PhiloxRandomEngine(uint64_t seed = 0u, uint64_t stream = 0u)
+      : m_key{{static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32)}},
+        m_counter{{0u, 0u, static_cast<uint32_t>(stream),
+                   static_cast<uint32_t>(stream >> 32)}} {}
+  // Explicitlely defaulted construction and assignment
+  PhiloxRandomEngine(const PhiloxRandomEngine &) = default;
+  PhiloxRandomEngine(PhiloxRandomEngine &&) = default;
+  PhiloxRandomEngine &operator=(const PhiloxRandomEngine &) = default;
+  PhiloxRandomEngine &operator=(PhiloxRandomEngine &&) = default;
+
+  static constexpr result_type min() { return 0u; }
+  static constexpr result_type max() {
+    return std::numeric_limits<result_type>::max();
+  }
+
+  /// Generate the next random value in the stream.
+  result_type operator()() {
+    if (m_next == kBlockSize) {
+      m_block = bijection(m_counter, m_key);
+      nextCounter();
+      m_next = 0u;
+    }
+    return m_block[m_next++];
+  }
+
+  /// Advance the stream by the given number of values.
+  void discard(unsigned long long n) {
+    for (; (0u < n) and (m_next < kBlockSize); --n) {
+      ++m_next;
+    }
+    // skip full blocks without computing them
+    for (; kBlockSize < n; n -= kBlockSize) {
+      nextCounter();
+    }
+    for (; 0u < n; --n) {
+      operator()();
+    }
+  }
+
+  /// Compute one output block for the given counter and key.
+  ///
+  /// This is the full Philox4x32 bijection with ten rounds.
+  static constexpr std::array<uint32_t, 4> bijection(
+      std::array<uint32_t, 4> ctr, std::array<uint32_t, 2> key) {
+    constexpr uint64_t kMul0 = 0xD2511F53u;
+    constexpr uint64_t kMul1 = 0xCD9E8D57u;
+    constexpr uint32_t kWeyl0 = 0x9E3779B9u;
+    constexpr uint32_t kWeyl1 = 0xBB67AE85u;
+
+    for (unsigned int round = 0u; round < 10u; ++round) {
+      const uint64_t prod0 = kMul0 * ctr[0];
+      const uint64_t prod1 = kMul1 * ctr[2];
+      ctr = {{static_cast<uint32_t>(prod1 >> 32) ^ ctr[1] ^ key[0],
+              static_cast<uint32_t>(prod1),
+              static_cast<uint32_t>(prod0 >> 32) ^ ctr[3] ^ key[1],
+              static_cast<uint32_t>(prod0)}};
+      key[0] += kWeyl0;
+      key[1] += kWeyl1;
+    }
+    return ctr;
+  }
+
+  /// Engines are equal if they generate the same subsequent values.
+  friend bool operator==(const PhiloxRandomEngine &lhs,
+                         const PhiloxRandomEngine &rhs) {
+    return (lhs.m_key == rhs.m_key) and (lhs.m_counter == rhs.m_counter) and
+           (lhs.m_next == rhs.m_next) and
+           ((lhs.m_next == kBlockSize) or (lhs.m_block == rhs.m_block));
+  }
+  friend bool operator!=(const PhiloxRandomEngine &lhs,
+                         const PhiloxRandomEngine &rhs) {
+    return not(lhs == rhs);
+  }
+
+ private:
+  static constexpr unsigned int kBlockSize = 4u;
+
+  /// Increment the block index, i.e. the lower 64bit of the counter.
+  constexpr void nextCounter() {
+    if (++m_counter[0] == 0u) {
+      ++m_counter[1];
+    }
+  }
+
+  std::array<uint32_t, 2> m_key;
+  std::array<uint32_t, 4> m_counter;
+  std::array<uint32_t, 4> m_block = {{0u, 0u, 0u, 0u}};
+  unsigned int m_next = kBlockSize;
+};
+
+}  // namespace ActsFatras
@@ -0,0 +1,86 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <random>
+
+#include "ActsFatras/Utilities/LandauDistribution.hpp"
+
+namespace ActsFatras {
+
+/// Standard random variates for repeated interactions generated in batches.
+///
+/// Each entry contains the random numbers needed for one material interaction,
+/// i.e. a uniform variate in [0,1), a standard normal variate, and a standard
+/// Landau variate. A new batch is generated once all entries are consumed.
+/// Generating many variates at once keeps the transformations in tight loops
+/// that the compiler can optimize instead of interleaving them with the
+/// interaction computations.
+///
+/// @tparam kSize is the number of entries per batch, must be even
+template <std::size_t kSize>
+class RandomVariatesBatch {
+  static_assert((0u < kSize) and (kSize % 2u == 0u),
+                "Batch size must be even and non-zero");
+
+ public:
+  /// Random variates for a single interaction.
+  struct Variates {
+    double uniform = 0.0;
+    double normal = 0.0;
+    double landau = 0.0;
+  };
+
+  /// Return the next entry and generate a new batch if necessary.
+  template <typename generator_t>
+  const Variates &next(generator_t &generator) {
+    if (m_next == kSize) {
+      fill(generator);
+      m_next = 0u;
+    }
+    return m_variates[m_next++];
+  }
+
+  /// Discard all remaining entries of the current batch.
+  void reset() { m_next = kSize; }
+
+ private:
+  template <typename generator_t>
+  void fill(generator_t &generator) {
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    LandauDistribution landau(0.0, 1.0);
+
+    std::array<double, 2u * kSize> u;
+    for (auto &x : u) {
+      x = uniform(generator);
+    }
+    for (std::size_t i = 0; i < kSize; ++i) {
+      m_variates[i].uniform = u[i];
+    }
+    // Box-Muller transform generates pairs of independent normal variates
+    for (std::size_t i = 0; i < kSize; i += 2u) {
+      // 1 - u is in (0,1] and avoids the divergence at zero
+      const double r = std::sqrt(-2.0 * std::log(1.0 - u[kSize + i]));
+      const double phi = 2.0 * M_PI * u[kSize + i + 1u];
+      m_variates[i].normal = r * std::cos(phi);
+      m_variates[i + 1u].normal = r * std::sin(phi);
+    }
+    for (auto &variates : m_variates) {
+      variates.landau = landau(generator);
+    }
+  }
+
+  std::array<Variates, kSize> m_variates;
+  std::size_t m_next = kSize;
+};
+
+}  // namespace ActsFatras
@@ -0,0 +1,90 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ActsFatras/Physics/Tabulated/InteractionTable.hpp"
+
+#include <cmath>
+#include <stdexcept>
+
+#include "Acts/Material/Interactions.hpp"
+#include "Acts/Material/MaterialProperties.hpp"
+#include "ActsFatras/Utilities/ParticleData.hpp"
+
+ActsFatras::InteractionTable::InteractionTable(const Acts::Material& material,
+                                               const Config& cfg)
+    : m_material(material),
+      m_pdg(cfg.pdg),
+      m_betaGammaBins(cfg.betaGammaBins),
+      m_thicknessBins(cfg.thicknessBins),
+      m_logBetaGammaMin(std::log(cfg.betaGammaMin)),
+      m_logThicknessMin(std::log(cfg.thicknessInX0Min)) {
+  if (not material) {
+    throw std::invalid_argument("Interaction tables require a valid material");
+  }
+  if ((cfg.charge == 0.0f) or not std::isfinite(cfg.charge) or
+      not(0.0f < cfg.mass)) {
+    throw std::invalid_argument(
+        "Interaction tables require a massive charged particle");
+  }
+  if ((cfg.betaGammaBins < 2u) or (cfg.thicknessBins < 2u) or
+      not(0.0f < cfg.betaGammaMin) or not(cfg.betaGammaMin < cfg.betaGammaMax) or
+      not(0.0f < cfg.thicknessInX0Min) or
+      not(cfg.thicknessInX0Min < cfg.thicknessInX0Max)) {
+    throw std::invalid_argument("Invalid interaction table grid");
+  }
+
+  const float deltaBG =
+      (std::log(cfg.betaGammaMax) - m_logBetaGammaMin) / (m_betaGammaBins - 1u);
+  const float deltaThickness =
+      (std::log(cfg.thicknessInX0Max) - m_logThicknessMin) /
+      (m_thicknessBins - 1u);
+  m_invDeltaBG = 1.0f / deltaBG;
+  m_invDeltaThickness = 1.0f / deltaThickness;
+  m_maxBetaGammaIndex = m_betaGammaBins - 1u;
+  m_maxThicknessIndex = m_thicknessBins - 1u;
+
+  m_nodes.resize(m_betaGammaBins * m_thicknessBins);
+  for (std::size_t i = 0; i < m_betaGammaBins; ++i) {
+    const float betaGamma = std::exp(m_logBetaGammaMin + i * deltaBG);
+    const float qOverP = cfg.charge / (cfg.mass * betaGamma);
+    for (std::size_t j = 0; j < m_thicknessBins; ++j) {
+      const float thicknessInX0 =
+          std::exp(m_logThicknessMin + j * deltaThickness);
+      const Acts::MaterialProperties slab(material,
+                                          thicknessInX0 * material.X0());
+      // the analytic computations are the reference for the tabulated values
+      const float theta0 = Acts::computeMultipleScatteringTheta0(
+          slab, cfg.pdg, cfg.mass, qOverP, cfg.charge);
+      const float energyLoss = Acts::computeEnergyLossLandau(
+          slab, cfg.pdg, cfg.mass, qOverP, cfg.charge);
+      const float energyLossSigma = Acts::computeEnergyLossLandauSigma(
+          slab, cfg.pdg, cfg.mass, qOverP, cfg.charge);
+      // remove the leading thickness dependence
+      Values& node = m_nodes[i * m_thicknessBins + j];
+      node.theta0 = theta0 / std::sqrt(thicknessInX0);
+      node.energyLoss = energyLoss / thicknessInX0;
+      node.energyLossSigma = energyLossSigma / thicknessInX0;
+    }
+  }
+}
+
+ActsFatras::InteractionTables::InteractionTables(
+    const std::vector<Acts::Material>& materials,
+    const std::vector<Acts::PdgParticle>& pdgs,
+    const InteractionTable::Config& cfg) {
+  m_tables.reserve(materials.size() * pdgs.size());
+  for (const auto& material : materials) {
+    for (auto pdg : pdgs) {
+      InteractionTable::Config tableCfg = cfg;
+      tableCfg.pdg = pdg;
+      tableCfg.mass = findMass(pdg);
+      tableCfg.charge = findCharge(pdg);
+      m_tables.emplace_back(material, tableCfg);
+    }
+  }
+}
@@ -17,3 +17,16 @@ ActsFatras::makeChargedElectroMagneticPhysicsList(double minimumAbsMomentum) {
       minimumAbsMomentum;
   return pl;
 }
+
+ActsFatras::TabulatedElectroMagneticPhysicsList
+ActsFatras::makeTabulatedElectroMagneticPhysicsList(
+    double minimumAbsMomentum,
+    std::shared_ptr<const InteractionTables> tables) {
+  TabulatedElectroMagneticPhysicsList pl;
+  auto& interactions = pl.get<detail::StandardTabulatedInteractions>();
+  interactions.physics.tables = std::move(tables);
+  interactions.selectOutputParticle.valMin = minimumAbsMomentum;
+  pl.get<detail::StandardBetheHeitler>().selectOutputParticle.valMin =
+      minimumAbsMomentum;
+  return pl;
+}
@@ -9,12 +9,63 @@
 #pragma once
 
 #include <boost/config.hpp>
+#include <cstddef>
+#include <limits>
 #include <unordered_map>
 #include <vector>
 #include "Acts/Plugins/Digitization/DigitizationCell.hpp"
 
 namespace Acts {
 
+/// Cluster label for cells that are not assigned to any cluster.
+constexpr size_t kNoCluster = std::numeric_limits<size_t>::max();
+
+/// @brief label clusters
+/// This function does connected component labelling of digitization cells
+/// given in any order. The cells are sorted by their channels and scanned
+/// row-by-row, where each cell is only compared to the preceding cell in its
+/// row and the adjacent cells in the previous row. Connected cells are joined
+/// using a union-find structure. Neither hash maps nor recursion are used and
+/// arbitrarily large clusters can be handled. Multiple cells at the same
+/// position always belong to the same cluster; their merged content, see
+/// Acts::DigitizationCell::addCell, is used for the energy cut. The function
+/// is templated on the digitization cell type to allow users to use their own
+/// implementation of Acts::DigitizationCell.
+/// @tparam cell_t the digitization cell
+/// @param [in] cells all cells on the module in arbitrary order
+/// @param [out] labels the cluster index for each input cell, or
+/// Acts::kNoCluster for cells that fail the energy cut. The clusters are
+/// numbered in the channel order of their first cell.
+/// @param [in] commonCorner flag indicating if also cells sharing a common
+/// corner should be merged into one cluster, i.e. 8-cell instead of 4-cell
+/// connectivity
+/// @param [in] energyCut possible energy cut to be applied
+/// @param [in] analogueReadout flag indicating analogue readout when merging
+/// cells at the same position
+/// @return the number of clusters
+template <typename cell_t>
+size_t labelClusters(const std::vector<cell_t>& cells,
+                     std::vector<size_t>& labels, bool commonCorner = true,
+                     double energyCut = 0., bool analogueReadout = false);
+
+/// @brief create clusters
+/// This function groups the given cells into clusters using
+/// Acts::labelClusters. Cells at the same position are merged into a single
+/// cell.
+/// @tparam cell_t the digitization cell
+/// @param [in] cells all cells on the module in arbitrary order
+/// @param [in] commonCorner flag indicating if also cells sharing a common
+/// corner should be merged into one cluster
+/// @param [in] energyCut possible energy cut to be applied
+/// @param [in] analogueReadout flag indicating analogue readout when merging
+/// cells at the same position
+/// @return vector (the different clusters) of vector of digitization cells (the
+/// cells which belong to each cluster)
+template <typename cell_t>
+std::vector<std::vector<cell_t>> createClusters(
+    const std::vector<cell_t>& cells, bool commonCorner = true,
+    double energyCut = 0., bool analogueReadout = false);
+
 /// @brief create clusters
 /// This function recieves digitization cells and bundles the neighbouring to
 /// create clusters later and does cell merging. Furthermore an energy
@@ -29,6 +80,7 @@ namespace Acts {
 /// @param [in] energyCut possible energy cut to be applied
 /// @return vector (the different clusters) of vector of digitization cells (the
 /// cells which belong to each cluster)
+/// @note All cells are marked as used afterwards.
 template <typename cell_t>
 std::vector<std::vector<cell_t>> createClusters(
     std::unordered_map<size_t, std::pair<cell_t, bool>>& cellMap, size_t nBins0,
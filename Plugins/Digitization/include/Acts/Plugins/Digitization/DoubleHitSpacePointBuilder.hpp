@@ -8,6 +8,9 @@
 
 #pragma once
 
+#include <utility>
+#include <vector>
+
 #include "Acts/Geometry/GeometryContext.hpp"
 #include "Acts/Plugins/Digitization/CartesianSegmentation.hpp"
 #include "Acts/Plugins/Digitization/SpacePointBuilder.hpp"
@@ -59,12 +62,32 @@ class SpacePointBuilder<SpacePoint<Cluster>> {
   /// @param clusterPairs storage of the cluster pairs
   /// @note The structure of @p clustersFront and @p clustersBack is meant to be
   /// clusters[Independent clusters on a single surface]
+  /// @note The global cluster positions are computed once per cluster and the
+  /// back clusters are sorted along a shared coordinate. Only back clusters
+  /// within the distance cut along this coordinate are compared.
   void makeClusterPairs(const GeometryContext& gctx,
                         const std::vector<const Cluster*>& clustersFront,
                         const std::vector<const Cluster*>& clustersBack,
                         std::vector<std::pair<const Cluster*, const Cluster*>>&
                             clusterPairs) const;
 
+  /// @brief Searches possible combinations of two clusters for many pairs of
+  /// surfaces
+  ///
+  /// @param gctx The current geometry context object, e.g. alignment
+  /// @param clustersPerSurfacePair front and back clusters for each pair of
+  /// surfaces
+  /// @param clusterPairs storage of the cluster pairs
+  /// @note This is equivalent to calling makeClusterPairs for each pair of
+  /// surfaces separately but reuses the internal buffers.
+  void makeClusterPairs(
+      const GeometryContext& gctx,
+      const std::vector<std::pair<std::vector<const Cluster*>,
+                                  std::vector<const Cluster*>>>&
+          clustersPerSurfacePair,
+      std::vector<std::pair<const Cluster*, const Cluster*>>& clusterPairs)
+      const;
+
   /// @brief Calculates the space points out of a given collection of clusters
   /// on several strip detectors and stores the data
   ///
@@ -72,6 +95,8 @@ class SpacePointBuilder<SpacePoint<Cluster>> {
   /// @param clusterPairs pairs of clusters that are space point candidates
   /// @param spacePoints storage of the results
   /// @note If no configuration is set, the default values will be used
+  /// @note The strip ends are computed once per cluster even if the cluster
+  /// is part of multiple pairs
   void calculateSpacePoints(
       const GeometryContext& gctx,
       const std::vector<std::pair<const Cluster*, const Cluster*>>&
@@ -79,9 +104,60 @@ class SpacePointBuilder<SpacePoint<Cluster>> {
       std::vector<SpacePoint<Cluster>>& spacePoints) const;
 
  private:
+  /// Cluster quantities that are computed once for the pair search
+  struct ClusterCandidate {
+    const Cluster* cluster = nullptr;
+    /// Global position
+    Vector3D position = Vector3D::Zero();
+    /// Direction from the vertex to the global position
+    double theta = 0.;
+    double phi = 0.;
+    /// Position along the shared coordinate
+    double key = 0.;
+    /// Index within the input clusters
+    size_t index = 0;
+  };
+
   /// Config
   DoubleHitSpacePointConfig m_cfg;
 
+  /// @brief Computes the candidate quantities for the given clusters
+  /// @param gctx The current geometry context object, e.g. alignment
+  /// @param clusters input clusters on a single surface
+  /// @param axis direction of the shared coordinate
+  /// @param candidates storage of the candidates
+  void fillCandidates(const GeometryContext& gctx,
+                      const std::vector<const Cluster*>& clusters,
+                      const Vector3D& axis,
+                      std::vector<ClusterCandidate>& candidates) const;
+
+  /// @brief Searches the best back cluster for each front cluster
+  /// @param front candidates on the front surface in input order
+  /// @param back candidates on the back surface sorted by the shared
+  /// coordinate
+  /// @param clusterPairs storage of the cluster pairs
+  void pairCandidates(
+      const std::vector<ClusterCandidate>& front,
+      const std::vector<ClusterCandidate>& back,
+      std::vector<std::pair<const Cluster*, const Cluster*>>& clusterPairs)
+      const;
+
+  /// @brief Pairs the clusters of a single pair of surfaces
+  /// @param gctx The current geometry context object, e.g. alignment
+  /// @param clustersFront clusters on the front surface
+  /// @param clustersBack clusters on the back surface
+  /// @param front candidate buffer for the front surface
+  /// @param back candidate buffer for the back surface
+  /// @param clusterPairs storage of the cluster pairs
+  void pairSurfaces(
+      const GeometryContext& gctx,
+      const std::vector<const Cluster*>& clustersFront,
+      const std::vector<const Cluster*>& clustersBack,
+      std::vector<ClusterCandidate>& front,
+      std::vector<ClusterCandidate>& back,
+      std::vector<std::pair<const Cluster*, const Cluster*>>& clusterPairs)
+      const;
+
   /// @brief Getter method for the local coordinates of a cluster
   /// on its corresponding surface
   /// @param cluster object related to the cluster that holds the necessary
@@ -23,6 +23,11 @@ class DigitizationModule;
 /// Module for fast, geometric digitization
 /// this is a planar module stepper that calculates the step length
 /// in given segmentations and retrunes digitisation steps
+///
+/// For modules with an equidistant cartesian segmentation, the cells are
+/// traversed analytically in the projected readout coordinates without
+/// intersecting the segmentation surfaces. Other segmentations fall back to
+/// the intersection of the segmentation surfaces.
 
 class PlanarModuleStepper {
  public:
@@ -62,6 +67,32 @@ class PlanarModuleStepper {
                                           const Vector2D& moduleIntersection,
                                           const Vector3D& trackDirection) const;
 
+  /// Calculate the steps caused by this track into an existing container
+  ///
+  /// @param gctx The current geometry context object, e.g. alignment
+  /// @param dmodule is the digitization module
+  /// @param startPoint is the starting position of the stepping
+  /// @param endPoint is the end postion of the stepping
+  /// @param steps is the output container, the steps are appended
+  ///
+  /// Reusing the output container avoids all allocations for cartesian
+  /// segmentations.
+  void cellSteps(const GeometryContext& gctx, const DigitizationModule& dmodule,
+                 const Vector3D& startPoint, const Vector3D& endPoint,
+                 std::vector<DigitizationStep>& steps) const;
+
+  /// Calculate the steps caused by this track into an existing container
+  ///
+  /// @param gctx The current geometry context object, e.g. alignment
+  /// @param dmodule is the digitization module
+  /// @param moduleIntersection is the 2d intersection at the module surface
+  /// @param trackDirection is the track direction at the instersection
+  /// @param steps is the output container, the steps are appended
+  void cellSteps(const GeometryContext& gctx, const DigitizationModule& dmodule,
+                 const Vector2D& moduleIntersection,
+                 const Vector3D& trackDirection,
+                 std::vector<DigitizationStep>& steps) const;
+
   /// Set logging instance
   ///
   /// @param logger is the logging instance to be set
@@ -11,30 +11,174 @@
 #include <utility>
 #include <vector>
 
+namespace Acts {
+namespace detail {
+
+/// Find the root of the set and compress the path along the way.
+inline size_t findRoot(std::vector<size_t>& parents, size_t i) {
+  while (parents[i] != i) {
+    // path halving
+    parents[i] = parents[parents[i]];
+    i = parents[i];
+  }
+  return i;
+}
+
+/// Join the two sets; the smaller root index becomes the common root.
+inline void joinSets(std::vector<size_t>& parents, size_t a, size_t b) {
+  a = findRoot(parents, a);
+  b = findRoot(parents, b);
+  if (a < b) {
+    parents[b] = a;
+  } else if (b < a) {
+    parents[a] = b;
+  }
+}
+
+/// Label the cells and provide the cell order sorted by position.
+template <typename cell_t>
+size_t labelSortedClusters(const std::vector<cell_t>& cells,
+                           std::vector<size_t>& order,
+                           std::vector<size_t>& labels, bool commonCorner,
+                           double energyCut, bool analogueReadout) {
+  labels.assign(cells.size(), kNoCluster);
+  // sort the cells by row, i.e. channel1, and by channel0 within each row
+  order.resize(cells.size());
+  for (size_t i = 0; i < order.size(); ++i) {
+    order[i] = i;
+  }
+  auto position = [&](size_t i) {
+    return std::make_pair(cells[i].channel1, cells[i].channel0);
+  };
+  std::sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) {
+    return position(lhs) < position(rhs);
+  });
+
+  // merge cells at the same position and apply the energy cut. positions are
+  // stored as the range of sorted cells that share them.
+  std::vector<std::pair<size_t, size_t>> ranges;
+  ranges.reserve(cells.size());
+  for (size_t begin = 0; begin < order.size();) {
+    size_t end = begin + 1;
+    cell_t merged = cells[order[begin]];
+    for (; (end < order.size()) and
+           (position(order[end]) == position(order[begin]));
+         ++end) {
+      merged.addCell(cells[order[end]], analogueReadout);
+    }
+    if (energyCut <= merged.depositedEnergy()) {
+      ranges.emplace_back(begin, end);
+    }
+    begin = end;
+  }
+
+  // scan row-by-row; positions are connected to the previous position in the
+  // same row and to the overlapping positions in the previous row.
+  const size_t reach = commonCorner ? 1u : 0u;
+  std::vector<size_t> parents(ranges.size());
+  size_t prevRowBegin = 0;
+  size_t prevRowEnd = 0;
+  size_t rowBegin = 0;
+  for (size_t i = 0; i < ranges.size(); ++i) {
+    parents[i] = i;
+    const cell_t& cell = cells[order[ranges[i].first]];
+    // start a new row
+    if ((i == 0) or (cells[order[ranges[i - 1].first]].channel1 !=
+                     cell.channel1)) {
+      const bool adjacentRow =
+          (0 < i) and
+          (cells[order[ranges[i - 1].first]].channel1 + 1 == cell.channel1);
+      prevRowBegin = adjacentRow ? rowBegin : i;
+      prevRowEnd = i;
+      rowBegin = i;
+    } else if (cells[order[ranges[i - 1].first]].channel0 + 1 ==
+               cell.channel0) {
+      detail::joinSets(parents, i - 1, i);
+    }
+    // skip previous row positions that are left of the neighbourhood
+    while ((prevRowBegin < prevRowEnd) and
+           (cells[order[ranges[prevRowBegin].first]].channel0 + reach <
+            cell.channel0)) {
+      ++prevRowBegin;
+    }
+    for (size_t j = prevRowBegin;
+         (j < prevRowEnd) and
+         (cells[order[ranges[j].first]].channel0 <= cell.channel0 + reach);
+         ++j) {
+      detail::joinSets(parents, j, i);
+    }
+  }
+
+  // assign consecutive labels ordered by the first position of each cluster
+  size_t nClusters = 0;
+  std::vector<size_t> clusterOfRoot(ranges.size(), kNoCluster);
+  for (size_t i = 0; i < ranges.size(); ++i) {
+    const size_t root = detail::findRoot(parents, i);
+    if (clusterOfRoot[root] == kNoCluster) {
+      clusterOfRoot[root] = nClusters++;
+    }
+    for (size_t k = ranges[i].first; k < ranges[i].second; ++k) {
+      labels[order[k]] = clusterOfRoot[root];
+    }
+  }
+  return nClusters;
+}
+
+}  // namespace detail
+}  // namespace Acts
+
+template <typename cell_t>
+size_t Acts::labelClusters(const std::vector<cell_t>& cells,
+                           std::vector<size_t>& labels, bool commonCorner,
+                           double energyCut, bool analogueReadout) {
+  std::vector<size_t> order;
+  return detail::labelSortedClusters(cells, order, labels, commonCorner,
+                                     energyCut, analogueReadout);
+}
+
+template <typename cell_t>
+std::vector<std::vector<cell_t>> Acts::createClusters(
+    const std::vector<cell_t>& cells, bool commonCorner, double energyCut,
+    bool analogueReadout) {
+  std::vector<size_t> order;
+  std::vector<size_t> labels;
+  const size_t nClusters = detail::labelSortedClusters(
+      cells, order, labels, commonCorner, energyCut, analogueReadout);
+  std::vector<std::vector<cell_t>> mergedCells(nClusters);
+  for (size_t i : order) {
+    if (labels[i] == kNoCluster) {
+      continue;
+    }
+    auto& cluster = mergedCells[labels[i]];
+    // cells at the same position are consecutive and merged into one cell
+    if (not cluster.empty() and
+        (cluster.back().channel0 == cells[i].channel0) and
+        (cluster.back().channel1 == cells[i].channel1)) {
+      cluster.back().addCell(cells[i], analogueReadout);
+    } else {
+      cluster.push_back(cells[i]);
+    }
+  }
+  return mergedCells;
+}
+
 template <typename cell_t>
 std::vector<std::vector<cell_t>> Acts::createClusters(
     std::unordered_map<size_t, std::pair<cell_t, bool>>& cellMap, size_t nBins0,
     bool commonCorner, double energyCut) {
-  // the output
-  std::vector<std::vector<cell_t>> mergedCells;
-  // now go through cells and label
+  // the channels define the neighbourhood, the grid size is not needed
+  (void)nBins0;
+  std::vector<cell_t> cells;
+  cells.reserve(cellMap.size());
   for (auto& cell : cellMap) {
     // check if the cell was already used
-    if (!(cell.second.second) &&
-        (cell.second.first.depositedEnergy() >= energyCut)) {
-      // create new cluster
-      mergedCells.push_back(std::vector<cell_t>());
-      // add current cell to current cluster
-      mergedCells.back().push_back(cell.second.first);
+    if (not cell.second.second) {
+      cells.push_back(cell.second.first);
       // set cell to be used already
       cell.second.second = true;
-      // fill all cells belonging to that cluster
-      fillCluster(mergedCells, cellMap, cell.first, nBins0, commonCorner,
-                  energyCut);
     }
   }
-  // return the grouped together cells
-  return mergedCells;
+  return createClusters(cells, commonCorner, energyCut);
 }
 
 template <typename cell_t>
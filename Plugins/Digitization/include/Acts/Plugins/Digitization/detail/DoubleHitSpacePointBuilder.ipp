@@ -6,7 +6,9 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
+#include <algorithm>
 #include <cmath>
+#include <functional>
 #include <limits>
 #include "Acts/Utilities/Helpers.hpp"
 
@@ -335,50 +337,124 @@ Acts::Vector3D Acts::SpacePointBuilder<Acts::SpacePoint<Cluster>>::globalCoords(
 }
 
 template <typename Cluster>
-void Acts::SpacePointBuilder<Acts::SpacePoint<Cluster>>::makeClusterPairs(
+void Acts::SpacePointBuilder<Acts::SpacePoint<Cluster>>::fillCandidates(
+    const GeometryContext& gctx, const std::vector<const Cluster*>& clusters,
+    const Vector3D& axis, std::vector<ClusterCandidate>& candidates) const {
+  candidates.resize(clusters.size());
+  for (size_t i = 0; i < clusters.size(); ++i) {
+    ClusterCandidate& candidate = candidates[i];
+    candidate.cluster = clusters[i];
+    candidate.position = globalCoords(gctx, *clusters[i]);
+    candidate.theta = VectorHelpers::theta(candidate.position - m_cfg.vertex);
+    candidate.phi = VectorHelpers::phi(candidate.position - m_cfg.vertex);
+    candidate.key = axis.dot(candidate.position);
+    candidate.index = i;
+  }
+}
+
+template <typename Cluster>
+void Acts::SpacePointBuilder<Acts::SpacePoint<Cluster>>::pairCandidates(
+    const std::vector<ClusterCandidate>& front,
+    const std::vector<ClusterCandidate>& back,
+    std::vector<std::pair<const Cluster*, const Cluster*>>& clusterPairs)
+    const {
+  const double maxDist2 = m_cfg.diffDist * m_cfg.diffDist;
+
+  for (const auto& cf : front) {
+    // the distance along the shared coordinate can not exceed the distance
+    // between the clusters; only back clusters within the window can pass.
+    auto cb = std::lower_bound(back.begin(), back.end(),
+                               cf.key - m_cfg.diffDist,
+                               [](const ClusterCandidate& c, double key) {
+                                 return c.key < key;
+                               });
+    // Set the closest distance to the maximum of double
+    double diffMin = std::numeric_limits<double>::max();
+    const ClusterCandidate* best = nullptr;
+    for (; (cb != back.end()) and (cb->key <= cf.key + m_cfg.diffDist);
+         ++cb) {
+      // see detail::differenceOfClustersChecked
+      if ((cf.position - cb->position).squaredNorm() > maxDist2) {
+        continue;
+      }
+      const double diffTheta2 = (cf.theta - cb->theta) * (cf.theta - cb->theta);
+      if (diffTheta2 > m_cfg.diffTheta2) {
+        continue;
+      }
+      const double diffPhi2 = (cf.phi - cb->phi) * (cf.phi - cb->phi);
+      if (diffPhi2 > m_cfg.diffPhi2) {
+        continue;
+      }
+      // Store the closest cluster; ties are resolved by the input order
+      const double currentDiff = diffTheta2 + diffPhi2;
+      if ((currentDiff < diffMin) or
+          ((currentDiff == diffMin) and (best != nullptr) and
+           (cb->index < best->index))) {
+        diffMin = currentDiff;
+        best = &(*cb);
+      }
+    }
+    // Store the best (=closest) result
+    if (best != nullptr) {
+      clusterPairs.emplace_back(cf.cluster, best->cluster);
+    }
+  }
+}
+
+template <typename Cluster>
+void Acts::SpacePointBuilder<Acts::SpacePoint<Cluster>>::pairSurfaces(
     const GeometryContext& gctx,
     const std::vector<const Cluster*>& clustersFront,
     const std::vector<const Cluster*>& clustersBack,
+    std::vector<ClusterCandidate>& front, std::vector<ClusterCandidate>& back,
     std::vector<std::pair<const Cluster*, const Cluster*>>& clusterPairs)
     const {
-  // Return if no clusters are given in a vector
+  // Skip if no clusters are given in a vector
   if (clustersFront.empty() || clustersBack.empty()) {
     return;
   }
+  // the local x axis of the front surface is the shared coordinate. for
+  // strip pairs, this is across the strips where both clusters are close.
+  const Vector3D axis = clustersFront.front()
+                            ->referenceSurface()
+                            .transform(gctx)
+                            .matrix()
+                            .template block<3, 1>(0, 0);
+  fillCandidates(gctx, clustersFront, axis, front);
+  fillCandidates(gctx, clustersBack, axis, back);
+  std::sort(back.begin(), back.end(),
+            [](const ClusterCandidate& lhs, const ClusterCandidate& rhs) {
+              return lhs.key < rhs.key;
+            });
+  pairCandidates(front, back, clusterPairs);
+}
 
-  // Declare helper variables
-  double currentDiff;
-  double diffMin;
-  unsigned int clusterMinDist;
+template <typename Cluster>
+void Acts::SpacePointBuilder<Acts::SpacePoint<Cluster>>::makeClusterPairs(
+    const GeometryContext& gctx,
+    const std::vector<const Cluster*>& clustersFront,
+    const std::vector<const Cluster*>& clustersBack,
+    std::vector<std::pair<const Cluster*, const Cluster*>>& clusterPairs)
+    const {
+  std::vector<ClusterCandidate> front;
+  std::vector<ClusterCandidate> back;
+  pairSurfaces(gctx, clustersFront, clustersBack, front, back, clusterPairs);
+}
 
-  // Walk through all clusters on both surfaces
-  for (unsigned int iClustersFront = 0; iClustersFront < clustersFront.size();
-       iClustersFront++) {
-    // Set the closest distance to the maximum of double
-    diffMin = std::numeric_limits<double>::max();
-    // Set the corresponding index to an element not in the list of clusters
-    clusterMinDist = clustersBack.size();
-    for (unsigned int iClustersBack = 0; iClustersBack < clustersBack.size();
-         iClustersBack++) {
-      // Calculate the distances between the hits
-      currentDiff = detail::differenceOfClustersChecked(
-          globalCoords(gctx, *(clustersFront[iClustersFront])),
-          globalCoords(gctx, *(clustersBack[iClustersBack])), m_cfg.vertex,
-          m_cfg.diffDist, m_cfg.diffPhi2, m_cfg.diffTheta2);
-      // Store the closest clusters (distance and index) calculated so far
-      if (currentDiff < diffMin && currentDiff >= 0.) {
-        diffMin = currentDiff;
-        clusterMinDist = iClustersBack;
-      }
-    }
+template <typename Cluster>
+void Acts::SpacePointBuilder<Acts::SpacePoint<Cluster>>::makeClusterPairs(
+    const GeometryContext& gctx,
+    const std::vector<std::pair<std::vector<const Cluster*>,
+                                std::vector<const Cluster*>>>&
+        clustersPerSurfacePair,
+    std::vector<std::pair<const Cluster*, const Cluster*>>& clusterPairs)
+    const {
+  // buffers are reused for all pairs of surfaces
+  std::vector<ClusterCandidate> front;
+  std::vector<ClusterCandidate> back;
 
-    // Store the best (=closest) result
-    if (clusterMinDist < clustersBack.size()) {
-      std::pair<const Cluster*, const Cluster*> clusterPair;
-      clusterPair = std::make_pair(clustersFront[iClustersFront],
-                                   clustersBack[clusterMinDist]);
-      clusterPairs.push_back(clusterPair);
-    }
+  for (const auto& [clustersFront, clustersBack] : clustersPerSurfacePair) {
+    pairSurfaces(gctx, clustersFront, clustersBack, front, back, clusterPairs);
   }
 }
 
@@ -415,11 +491,31 @@ void Acts::SpacePointBuilder<Acts::SpacePoint<Cluster>>::calculateSpacePoints(
 
   detail::SpacePointParameters spaPoPa;
 
+  // Calculate the ends of the SDEs once for each cluster
+  std::vector<const Cluster*> clusters;
+  clusters.reserve(2 * clusterPairs.size());
+  for (const auto& cp : clusterPairs) {
+    clusters.push_back(cp.first);
+    clusters.push_back(cp.second);
+  }
+  std::sort(clusters.begin(), clusters.end(), std::less<const Cluster*>());
+  clusters.erase(std::unique(clusters.begin(), clusters.end()),
+                 clusters.end());
+  std::vector<std::pair<Vector3D, Vector3D>> clusterEnds;
+  clusterEnds.reserve(clusters.size());
+  for (const Cluster* cluster : clusters) {
+    clusterEnds.push_back(endsOfStrip(gctx, *cluster));
+  }
+  auto findEnds = [&](const Cluster* cluster) -> const auto& {
+    auto it = std::lower_bound(clusters.begin(), clusters.end(), cluster,
+                               std::less<const Cluster*>());
+    return clusterEnds[it - clusters.begin()];
+  };
+
   // Walk over every found candidate pair
   for (const auto& cp : clusterPairs) {
-    // Calculate the ends of the SDEs
-    const auto& ends1 = endsOfStrip(gctx, *(cp.first));
-    const auto& ends2 = endsOfStrip(gctx, *(cp.second));
+    const auto& ends1 = findEnds(cp.first);
+    const auto& ends2 = findEnds(cp.second);
 
     spaPoPa.q = ends1.first - ends1.second;
     spaPoPa.r = ends2.first - ends2.second;
@@ -11,11 +11,210 @@
 ///////////////////////////////////////////////////////////////////
 
 #include "Acts/Plugins/Digitization/PlanarModuleStepper.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+
+#include "Acts/Plugins/Digitization/CartesianSegmentation.hpp"
 #include "Acts/Plugins/Digitization/DigitizationModule.hpp"
 #include "Acts/Surfaces/Surface.hpp"
 #include "Acts/Utilities/Definitions.hpp"
 #include "Acts/Utilities/Intersection.hpp"
 
+namespace {
+
+/// Equidistant cell grid in the projected readout coordinates.
+struct CellGrid {
+  const Acts::Segmentation* segmentation = nullptr;
+  std::array<double, 2> min = {0., 0.};
+  std::array<double, 2> pitch = {0., 0.};
+  std::array<size_t, 2> bins = {1u, 1u};
+  /// module bounding box half lengths
+  double halfX = 0.;
+  double halfY = 0.;
+  /// module geometry and drift parameters
+  double halfThickness = 0.;
+  double readoutDirection = 1.;
+  double lorentzAngle = 0.;
+  double tanLorentzAngle = 0.;
+  double cosLorentzAngle = 1.;
+
+  /// Position projected onto the readout surface along the lorentz drift.
+  Acts::Vector2D project(const Acts::Vector3D& position) const {
+    double driftInZ = halfThickness - readoutDirection * position.z();
+    return Acts::Vector2D(
+        position.x() + readoutDirection * driftInZ * tanLorentzAngle,
+        position.y());
+  }
+};
+
+/// Setup the cell grid if the module segmentation supports it.
+///
+/// @return false if the segmentation is not an equidistant cartesian grid
+bool makeCellGrid(const Acts::DigitizationModule& dmodule, CellGrid& grid) {
+  const auto* cSegmentation =
+      dynamic_cast<const Acts::CartesianSegmentation*>(&dmodule.segmentation());
+  if (cSegmentation == nullptr) {
+    return false;
+  }
+  const Acts::BinUtility& binUtility = cSegmentation->binUtility();
+  if ((binUtility.dimensions() != 2u) or binUtility.transform()) {
+    return false;
+  }
+  const auto boundingBox = cSegmentation->moduleBounds().boundingBox();
+  grid.halfX = boundingBox.halfLengthX();
+  grid.halfY = boundingBox.halfLengthY();
+  // cell boundaries as for the segmentation surfaces
+  const std::array<double, 2> halfLengths = {grid.halfX, grid.halfY};
+  for (size_t i = 0; i < 2u; ++i) {
+    const Acts::BinningData& bData = binUtility.binningData()[i];
+    if ((bData.type != Acts::equidistant) or bData.subBinningData) {
+      return false;
+    }
+    grid.bins[i] = bData.bins();
+    grid.min[i] = -halfLengths[i];
+    grid.pitch[i] = 2. * halfLengths[i] / grid.bins[i];
+  }
+  grid.segmentation = cSegmentation;
+  grid.halfThickness = dmodule.halfThickness();
+  grid.readoutDirection = dmodule.readoutDirection();
+  grid.lorentzAngle = dmodule.lorentzAngle();
+  grid.tanLorentzAngle = std::tan(grid.lorentzAngle);
+  grid.cosLorentzAngle = std::cos(grid.lorentzAngle);
+  return true;
+}
+
+/// Traverse the cells between start and end point.
+///
+/// 2D digital differential analyzer, see Amanatides and Woo, "A Fast Voxel
+/// Traversal Algorithm for Ray Tracing", Eurographics 1987. The projected
+/// readout coordinates are linear along the step and the crossings with the
+/// cell boundaries are computed directly from the grid. The resulting steps
+/// are equivalent to the steps between the intersections with the
+/// segmentation surfaces.
+void traverseCells(const CellGrid& grid, const Acts::Vector3D& startPoint,
+                   const Acts::Vector3D& endPoint,
+                   std::vector<Acts::DigitizationStep>& steps) {
+  constexpr double kInf = std::numeric_limits<double>::infinity();
+
+  const Acts::Vector3D delta3 = endPoint - startPoint;
+  const Acts::Vector2D start = grid.project(startPoint);
+  const Acts::Vector2D delta = grid.project(endPoint) - start;
+
+  // current cell, direction, and the next crossing as a fraction of the step
+  std::array<size_t, 2> cell = {0u, 0u};
+  std::array<int, 2> direction = {0, 0};
+  std::array<double, 2> next = {kInf, kInf};
+  // the boundary crossed when leaving the current cell along the direction
+  auto nextCrossing = [&](size_t i) {
+    size_t line = (0 < direction[i]) ? (cell[i] + 1u) : cell[i];
+    // module boundaries are not crossed, the outer cells extend to infinity
+    if ((direction[i] == 0) or (line == 0u) or (grid.bins[i] <= line)) {
+      return kInf;
+    }
+    return (grid.min[i] + line * grid.pitch[i] - start[i]) / delta[i];
+  };
+  for (size_t i = 0; i < 2u; ++i) {
+    direction[i] = (0 < delta[i]) ? 1 : ((delta[i] < 0) ? -1 : 0);
+    double u = std::floor((start[i] - grid.min[i]) / grid.pitch[i]);
+    // starting on a cell boundary, the direction defines the cell
+    if ((direction[i] < 0) and (u * grid.pitch[i] + grid.min[i] == start[i])) {
+      u -= 1.;
+    }
+    u = std::clamp(u, 0., static_cast<double>(grid.bins[i] - 1u));
+    cell[i] = static_cast<size_t>(u);
+    next[i] = nextCrossing(i);
+  }
+
+  double last = 0.;
+  Acts::Vector3D lastPosition = startPoint;
+  while (true) {
+    const double current = std::min({next[0], next[1], 1.});
+    const Acts::Vector3D position =
+        (current < 1.) ? Acts::Vector3D(startPoint + current * delta3)
+                       : endPoint;
+    // coinciding crossings and the end point do not create empty steps
+    if (last < current) {
+      // see CartesianSegmentation::digitizationStep
+      const Acts::Vector3D center = 0.5 * (lastPosition + position);
+      const double driftInZ =
+          grid.halfThickness - grid.readoutDirection * center.z();
+      const Acts::DigitizationCell dCell(cell[0], cell[1]);
+      steps.emplace_back((position - lastPosition).norm(),
+                         driftInZ / grid.cosLorentzAngle, dCell, lastPosition,
+                         position, grid.project(center),
+                         grid.segmentation->cellPosition(dCell));
+    }
+    if (1. <= current) {
+      break;
+    }
+    // crossing a corner changes both cells at once
+    for (size_t i = 0; i < 2u; ++i) {
+      if (next[i] == current) {
+        cell[i] += direction[i];
+        next[i] = nextCrossing(i);
+      }
+    }
+    last = current;
+    lastPosition = position;
+  }
+}
+
+/// Clip the track line with the sensitive volume of the module.
+///
+/// The volume is bounded by the readout and counter readout planes, the
+/// module edges in y, and the module edges in x. Depending on the lorentz
+/// angle and the readout direction, the x edges are either straight or
+/// follow the lorentz drift. See CartesianSegmentation for the definition of
+/// the equivalent boundary surfaces.
+///
+/// @return false if the track does not pass the volume
+bool clipTrack(const CellGrid& grid, const Acts::Vector3D& position,
+               const Acts::Vector3D& direction, Acts::Vector3D& entry,
+               Acts::Vector3D& exit) {
+  double tMin = -std::numeric_limits<double>::infinity();
+  double tMax = std::numeric_limits<double>::infinity();
+  // restrict to the half space f0 + t * f1 <= 0
+  auto clip = [&](double f0, double f1) {
+    if (f1 == 0.) {
+      return (f0 <= 0.);
+    }
+    const double t = -f0 / f1;
+    if (0. < f1) {
+      tMax = std::min(tMax, t);
+    } else {
+      tMin = std::max(tMin, t);
+    }
+    return true;
+  };
+  const double rl = grid.readoutDirection * grid.lorentzAngle;
+  const bool straightLow = (grid.lorentzAngle == 0.) or (0. < rl);
+  const bool straightHigh = (grid.lorentzAngle == 0.) or (rl < 0.);
+  // x changes by -tan(alpha) per z along the drift to the readout surface
+  const double px0 = grid.project(position).x();
+  const double px1 = direction.x() - direction.z() * grid.tanLorentzAngle;
+  const bool passes =
+      clip(position.z() - grid.halfThickness, direction.z()) and
+      clip(-position.z() - grid.halfThickness, -direction.z()) and
+      clip(position.y() - grid.halfY, direction.y()) and
+      clip(-position.y() - grid.halfY, -direction.y()) and
+      (straightLow ? clip(-position.x() - grid.halfX, -direction.x())
+                   : clip(-px0 - grid.halfX, -px1)) and
+      (straightHigh ? clip(position.x() - grid.halfX, direction.x())
+                    : clip(px0 - grid.halfX, px1));
+  if (not passes or not(tMin < tMax) or not std::isfinite(tMin) or
+      not std::isfinite(tMax)) {
+    return false;
+  }
+  entry = position + tMin * direction;
+  exit = position + tMax * direction;
+  return true;
+}
+
+}  // namespace
+
 Acts::PlanarModuleStepper::PlanarModuleStepper(
     std::unique_ptr<const Logger> mlogger)
     : m_logger(std::move(mlogger)) {}
@@ -23,8 +222,28 @@ Acts::PlanarModuleStepper::PlanarModuleStepper(
 std::vector<Acts::DigitizationStep> Acts::PlanarModuleStepper::cellSteps(
     const GeometryContext& gctx, const DigitizationModule& dmodule,
     const Vector3D& startPoint, const Vector3D& endPoint) const {
-  // create the return vector
   std::vector<DigitizationStep> cSteps;
+  cellSteps(gctx, dmodule, startPoint, endPoint, cSteps);
+  return cSteps;
+}
+
+std::vector<Acts::DigitizationStep> Acts::PlanarModuleStepper::cellSteps(
+    const GeometryContext& gctx, const Acts::DigitizationModule& dmodule,
+    const Vector2D& moduleIntersection, const Vector3D& trackDirection) const {
+  std::vector<DigitizationStep> cSteps;
+  cellSteps(gctx, dmodule, moduleIntersection, trackDirection, cSteps);
+  return cSteps;
+}
+
+void Acts::PlanarModuleStepper::cellSteps(
+    const GeometryContext& gctx, const DigitizationModule& dmodule,
+    const Vector3D& startPoint, const Vector3D& endPoint,
+    std::vector<DigitizationStep>& cSteps) const {
+  CellGrid grid;
+  if (makeCellGrid(dmodule, grid)) {
+    traverseCells(grid, startPoint, endPoint, cSteps);
+    return;
+  }
 
   // get the test surfaces for bin intersections
   auto& stepSurfaces = dmodule.stepSurfaces(startPoint, endPoint);
@@ -58,26 +277,35 @@ std::vector<Acts::DigitizationStep> Acts::PlanarModuleStepper::cellSteps(
 
   Vector3D lastPosition = startPoint;
   // reserve the right amount
-  cSteps.reserve(stepIntersections.size());
+  cSteps.reserve(cSteps.size() + stepIntersections.size());
   for (auto& sIntersection : stepIntersections) {
     // create the new digitization step
     cSteps.push_back(
         dmodule.digitizationStep(lastPosition, sIntersection.position));
     lastPosition = sIntersection.position;
   }
-  // return all the steps
-  return cSteps;
 }
 
 // calculate the steps caused by this track - fast simulation interface
-std::vector<Acts::DigitizationStep> Acts::PlanarModuleStepper::cellSteps(
+void Acts::PlanarModuleStepper::cellSteps(
     const GeometryContext& gctx, const Acts::DigitizationModule& dmodule,
-    const Vector2D& moduleIntersection, const Vector3D& trackDirection) const {
+    const Vector2D& moduleIntersection, const Vector3D& trackDirection,
+    std::vector<DigitizationStep>& cSteps) const {
+  Vector3D intersection3D(moduleIntersection.x(), moduleIntersection.y(), 0.);
+
+  CellGrid grid;
+  if (makeCellGrid(dmodule, grid)) {
+    Vector3D entry, exit;
+    if (clipTrack(grid, intersection3D, trackDirection, entry, exit)) {
+      traverseCells(grid, entry, exit, cSteps);
+    }
+    return;
+  }
+
   // first, intersect the boundary surfaces
-  auto boundarySurfaces = dmodule.boundarySurfaces();
+  const auto& boundarySurfaces = dmodule.boundarySurfaces();
   // intersect them - fast exit for cases where
   // readout and counter readout are hit
-  Vector3D intersection3D(moduleIntersection.x(), moduleIntersection.y(), 0.);
   size_t attempts = 0;
   // the collected intersections
   std::vector<Acts::Intersection> boundaryIntersections;
@@ -112,10 +340,9 @@ std::vector<Acts::DigitizationStep> Acts::PlanarModuleStepper::cellSteps(
     std::sort(boundaryIntersections.begin(), boundaryIntersections.end());
   }
   // if for some reason the intersection does not work
-  if (boundaryIntersections.empty()) {
-    return std::vector<Acts::DigitizationStep>();
+  if (boundaryIntersections.size() < 2) {
+    return;
   }
-  // return
-  return cellSteps(gctx, dmodule, boundaryIntersections[0].position,
-                   boundaryIntersections[1].position);
+  cellSteps(gctx, dmodule, boundaryIntersections[0].position,
+            boundaryIntersections[1].position, cSteps);
 }
@@ -640,14 +640,17 @@ json Acts::JsonGeometryConverter::surfaceMaterialToJson(
         // convert the data
         // get the material matrix
         if (m_cfg.writeData) {
-          auto& mpMatrix = bsMaterial->fullMaterial();
+          // shared material has no full matrix, use the bin access
+          const size_t bins0 = bsMaterial->binUtility().bins(0);
+          const size_t bins1 = bsMaterial->binUtility().bins(1);
           std::vector<std::vector<std::vector<float>>> mmat;
-          mmat.reserve(mpMatrix.size());
-          for (auto& mpVector : mpMatrix) {
+          mmat.reserve(bins1);
+          for (size_t bin1 = 0; bin1 < bins1; ++bin1) {
             std::vector<std::vector<float>> mvec;
-            mvec.reserve(mpVector.size());
-            for (auto& mp : mpVector) {
-              mvec.push_back(convertMaterialProperties(mp));
+            mvec.reserve(bins0);
+            for (size_t bin0 = 0; bin0 < bins0; ++bin0) {
+              mvec.push_back(convertMaterialProperties(
+                  bsMaterial->materialProperties(bin0, bin1)));
             }
             mmat.push_back(std::move(mvec));
           }
@@ -8,8 +8,12 @@
 
 #pragma once
 
+#include <array>
 #include <climits>
+#include <cstdint>
+#include <map>
 #include <tuple>
+#include <vector>
 #include "Acts/Geometry/GeometryContext.hpp"
 #include "Acts/Geometry/ILayerBuilder.hpp"
 #include "Acts/Geometry/LayerCreator.hpp"
@@ -102,11 +106,28 @@ class TGeoLayerBuilder : public ILayerBuilder {
     /// Special debug output, is very verbose and hence needs
     /// an additional switch to log level
     bool nodeSearchDebug = false;
+    /// Number of threads for the parsing and the surface conversion,
+    /// geometry trees with divisions are parsed sequentially
+    size_t numThreads = 1;
+    /// TGeo node selection cache file, empty disables it
+    ///
+    /// The cache holds the selected nodes and their transforms only, the
+    /// surfaces and layers are always built. Cached selections skip the
+    /// parsing of the geometry tree. They are
+    /// keyed by the geometry key and the layer configuration, but not by
+    /// the content of the tree, hence a geometry key is required.
+    std::string cacheFile = "";
+    /// Identification of the geometry content for the cache key, e.g. a
+    /// checksum of the input file; it must change with the geometry
+    std::string geometryKey = "";
   };
 
   /// Constructor
   /// @param config is the configuration struct
   /// @param logger the local logging instance
+  ///
+  /// @throws std::invalid_argument if a cache file is given without a
+  ///         geometry key
   TGeoLayerBuilder(const Config& config,
                    std::unique_ptr<const Logger> logger =
                        getDefaultLogger("TGeoLayerBuilder", Logging::INFO));
@@ -137,6 +158,9 @@ class TGeoLayerBuilder : public ILayerBuilder {
 
   /// Set the configuration object
   /// @param config is the configuration struct
+  ///
+  /// @throws std::invalid_argument if a cache file is given without a
+  ///         geometry key
   void setConfiguration(const Config& config);
 
   /// Get the configuration object
@@ -165,6 +189,26 @@ class TGeoLayerBuilder : public ILayerBuilder {
   /// @todo make clear where the TGeoDetectorElement lives
   std::vector<std::shared_ptr<const TGeoDetectorElement>> m_elementStore;
 
+  /// A selected node as stored in the cache
+  struct CachedNode {
+    /// The daughter indices leading from the top volume to the node
+    std::vector<int> path;
+    /// The transform to global: rotation matrix and translation
+    std::array<double, 12> transform;
+  };
+
+  /// Cached node selections by key
+  std::map<uint64_t, std::vector<CachedNode>> m_cache;
+
+  /// Whether the cache file has been read
+  bool m_cacheLoaded = false;
+
+  /// Private helper method : read the cache file
+  void loadCache();
+
+  /// Private helper method : write the cache file
+  void saveCache() const;
+
   /// Private helper method : build layers
   ///
   /// @param gcts the geometry context of this call
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
 #include <vector>
 #include "Acts/Utilities/BinningType.hpp"
@@ -28,6 +29,9 @@ using namespace UnitLiterals;
 ///
 /// It also buils up the global transform for the conversion
 /// into an ACTS Surface
+///
+/// Independent subtrees without divisions can be parsed in parallel, the
+/// selected nodes are always returned in the order of the sequential parsing.
 struct TGeoParser {
   using ParseRange = std::pair<double, double>;
 
@@ -36,6 +40,8 @@ struct TGeoParser {
     const TGeoNode* node = nullptr;
     // The transform to global
     std::unique_ptr<TGeoMatrix> transform = nullptr;
+    // The daughter indices leading from the top volume to the node
+    std::vector<int> path = {};
   };
 
   /// @brief Nested state struct
@@ -52,6 +58,8 @@ struct TGeoParser {
     bool onBranch = false;
     // The currently collected nodes
     std::vector<SelectedNode> selectedNodes = {};
+    // The daughter indices leading to the current node
+    std::vector<int> path = {};
   };
 
   /// @brief Nested configuration struct
@@ -68,14 +76,32 @@ struct TGeoParser {
     double unit = 1_cm;
     /// Parse restrictions, several can apply
     std::vector<std::pair<BinningValue, ParseRange> > parseRanges = {};
+    /// Number of threads for the parsing of independent subtrees
+    size_t numThreads = 1;
   };
 
   /// The parsing module, it takes the top Volume and recursively steps down
+  ///
+  /// A volume name match applies to the subtree of the volume only. With
+  /// more than one thread, the daughters of the first volume with several
+  /// daughters are split into contiguous chunks which are parsed in parallel.
+  /// This requires ROOT thread safety, which is enabled if needed. Trees
+  /// with division nodes are always parsed sequentially.
+  ///
   /// @param state [out] The parseing state configuration, passed through
   /// @param options [in] The parsing options as requiremed
   /// @param gmatrix The current built-up transform to global at this depth
   static void select(State& state, const Options& options,
                      const TGeoMatrix& gmatrix = TGeoIdentity("ID"));
+
+  /// Find a node from its daughter indices
+  ///
+  /// @param top The volume the path starts from
+  /// @param path The daughter indices as recorded during the selection
+  ///
+  /// @return the node or nullptr if the path does not exist
+  static const TGeoNode* findNode(const TGeoVolume& top,
+                                  const std::vector<int>& path);
 };
 
 }  // namespace Acts
\ No newline at end of file
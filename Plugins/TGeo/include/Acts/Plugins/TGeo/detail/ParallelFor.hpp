@@ -0,0 +1,57 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <future>
+#include <vector>
+
+#include "TROOT.h"
+
+namespace Acts {
+namespace detail {
+
+/// Call a function for all indices in [0, n) using several threads.
+///
+/// The indices are split into contiguous chunks, one per thread. ROOT
+/// thread safety is enabled before any thread is started. Exceptions are
+/// rethrown once all threads are finished.
+///
+/// @param n is the number of indices
+/// @param numThreads is the maximum number of threads, 1 runs sequentially
+/// @param func is called with each index exactly once
+template <typename function_t>
+void parallelFor(size_t n, size_t numThreads, function_t&& func) {
+  const size_t nChunks = std::min(std::max<size_t>(numThreads, 1u), n);
+  if (nChunks <= 1u) {
+    for (size_t i = 0; i < n; ++i) {
+      func(i);
+    }
+    return;
+  }
+  ROOT::EnableThreadSafety();
+  std::vector<std::future<void>> chunks;
+  for (size_t ic = 0; ic < nChunks; ++ic) {
+    const size_t begin = ic * n / nChunks;
+    const size_t end = (ic + 1) * n / nChunks;
+    chunks.push_back(std::async(std::launch::async, [&func, begin, end]() {
+      for (size_t i = begin; i < end; ++i) {
+        func(i);
+      }
+    }));
+  }
+  // pending futures of std::async wait for their thread on destruction
+  for (auto& chunk : chunks) {
+    chunk.get();
+  }
+}
+
+}  // namespace detail
+}  // namespace Acts
@@ -7,15 +7,64 @@
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 #include <stdio.h>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <type_traits>
 
 #include "Acts/Geometry/ProtoLayer.hpp"
 #include "Acts/Plugins/TGeo/TGeoDetectorElement.hpp"
 #include "Acts/Plugins/TGeo/TGeoLayerBuilder.hpp"
 #include "Acts/Plugins/TGeo/TGeoParser.hpp"
 #include "Acts/Plugins/TGeo/TGeoPrimitivesHelper.hpp"
+#include "Acts/Plugins/TGeo/detail/ParallelFor.hpp"
 #include "TGeoManager.h"
 #include "TGeoMatrix.h"
 
+namespace {
+
+/// 64bit FNV-1a hash of the inputs that determine the node selection
+class CacheKey {
+ public:
+  void addBytes(const void* data, size_t size) {
+    const auto* bytes = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < size; ++i) {
+      m_value = (m_value ^ bytes[i]) * 1099511628211ull;
+    }
+  }
+  template <typename value_t>
+  void addValue(value_t value) {
+    static_assert(std::is_arithmetic_v<value_t>, "Only plain numbers");
+    addBytes(&value, sizeof(value));
+  }
+  void addString(const std::string& str) {
+    addValue(str.size());
+    addBytes(str.data(), str.size());
+  }
+  uint64_t value() const { return m_value; }
+
+ private:
+  uint64_t m_value = 14695981039346656037ull;
+};
+
+constexpr char kCacheMagic[8] = {'A', 'C', 'T', 'S', 'T', 'G', 'C', '1'};
+/// Protection against corrupted files
+constexpr uint32_t kCacheMaxDepth = 1024u;
+
+template <typename value_t>
+bool readValue(std::istream& in, value_t& value) {
+  return static_cast<bool>(
+      in.read(reinterpret_cast<char*>(&value), sizeof(value_t)));
+}
+
+template <typename value_t>
+void writeValue(std::ostream& out, const value_t& value) {
+  out.write(reinterpret_cast<const char*>(&value), sizeof(value_t));
+}
+
+}  // namespace
+
 Acts::TGeoLayerBuilder::TGeoLayerBuilder(
     const Acts::TGeoLayerBuilder::Config& config,
     std::unique_ptr<const Logger> logger)
@@ -27,9 +76,90 @@ Acts::TGeoLayerBuilder::~TGeoLayerBuilder() = default;
 
 void Acts::TGeoLayerBuilder::setConfiguration(
     const Acts::TGeoLayerBuilder::Config& config) {
+  // The key of the cache does not cover the content of the geometry tree
+  if (not config.cacheFile.empty() and config.geometryKey.empty()) {
+    throw std::invalid_argument(
+        "TGeoLayerBuilder: the node cache requires a geometry key");
+  }
   m_cfg = config;
 }
 
+void Acts::TGeoLayerBuilder::loadCache() {
+  m_cacheLoaded = true;
+  if (m_cfg.cacheFile.empty()) {
+    return;
+  }
+  std::ifstream file(m_cfg.cacheFile, std::ios::in | std::ios::binary);
+  if (not file) {
+    ACTS_DEBUG("No node cache found in '" << m_cfg.cacheFile << "'.");
+    return;
+  }
+  char magic[sizeof(kCacheMagic)];
+  uint64_t nEntries = 0;
+  bool valid = static_cast<bool>(file.read(magic, sizeof(magic))) and
+               (std::memcmp(magic, kCacheMagic, sizeof(magic)) == 0) and
+               readValue(file, nEntries);
+  std::map<uint64_t, std::vector<CachedNode>> cache;
+  for (uint64_t ie = 0; valid and ie < nEntries; ++ie) {
+    uint64_t key = 0;
+    uint64_t nNodes = 0;
+    valid = readValue(file, key) and readValue(file, nNodes);
+    auto& nodes = cache[key];
+    for (uint64_t in = 0; valid and in < nNodes; ++in) {
+      CachedNode node;
+      uint32_t depth = 0;
+      valid = readValue(file, depth) and (depth <= kCacheMaxDepth);
+      for (uint32_t id = 0; valid and id < depth; ++id) {
+        int32_t index = 0;
+        valid = readValue(file, index);
+        node.path.push_back(index);
+      }
+      for (auto& value : node.transform) {
+        valid = valid and readValue(file, value);
+      }
+      nodes.push_back(std::move(node));
+    }
+  }
+  if (not valid) {
+    ACTS_WARNING("Ignore invalid node cache '" << m_cfg.cacheFile << "'.");
+    return;
+  }
+  ACTS_DEBUG("Read " << cache.size() << " node selection(s) from '"
+                     << m_cfg.cacheFile << "'.");
+  m_cache = std::move(cache);
+}
+
+void Acts::TGeoLayerBuilder::saveCache() const {
+  // concurrent jobs must never see a partially written file
+  const std::string tmpFile = m_cfg.cacheFile + ".tmp";
+  {
+    std::ofstream file(tmpFile, std::ios::out | std::ios::binary |
+                                    std::ios::trunc);
+    file.write(kCacheMagic, sizeof(kCacheMagic));
+    writeValue<uint64_t>(file, m_cache.size());
+    for (const auto& [key, nodes] : m_cache) {
+      writeValue<uint64_t>(file, key);
+      writeValue<uint64_t>(file, nodes.size());
+      for (const auto& node : nodes) {
+        writeValue<uint32_t>(file, node.path.size());
+        for (int index : node.path) {
+          writeValue<int32_t>(file, index);
+        }
+        for (double value : node.transform) {
+          writeValue(file, value);
+        }
+      }
+    }
+    if (not file) {
+      ACTS_WARNING("Could not write node cache '" << tmpFile << "'.");
+      return;
+    }
+  }
+  if (std::rename(tmpFile.c_str(), m_cfg.cacheFile.c_str()) != 0) {
+    ACTS_WARNING("Could not write node cache '" << m_cfg.cacheFile << "'.");
+  }
+}
+
 void Acts::TGeoLayerBuilder::setLogger(
     std::unique_ptr<const Logger> newLogger) {
   m_logger = std::move(newLogger);
@@ -128,6 +258,11 @@ void Acts::TGeoLayerBuilder::buildLayers(const GeometryContext& gctx,
     }
   };
 
+  if (not m_cacheLoaded) {
+    loadCache();
+  }
+  bool cacheModified = false;
+
   for (auto layerCfg : layerConfigs) {
     ACTS_DEBUG("- layer configuration found for layer " << layerCfg.layerName
                                                         << " with sensors ");
@@ -153,29 +288,100 @@ void Acts::TGeoLayerBuilder::buildLayers(const GeometryContext& gctx,
     // Step down from the top volume each time to collect the logical tree
     TGeoVolume* tvolume = gGeoManager->GetTopVolume();
     if (tvolume != nullptr) {
-      TGeoParser::Options tgpOptions;
-      tgpOptions.volumeNames = {layerCfg.layerName};
-      tgpOptions.targetNames = layerCfg.sensorNames;
-      tgpOptions.parseRanges = layerCfg.parseRanges;
-      tgpOptions.unit = m_cfg.unit;
+      // The key covers all inputs which determine the selection
+      CacheKey key;
+      key.addString(m_cfg.geometryKey);
+      key.addString(tvolume->GetName());
+      key.addValue(tvolume->GetNdaughters());
+      key.addValue(m_cfg.unit);
+      key.addString(layerCfg.layerName);
+      key.addValue(layerCfg.sensorNames.size());
+      for (const auto& sensor : layerCfg.sensorNames) {
+        key.addString(sensor);
+      }
+      for (const auto& pRange : layerCfg.parseRanges) {
+        key.addValue(static_cast<int>(pRange.first));
+        key.addValue(pRange.second.first);
+        key.addValue(pRange.second.second);
+      }
 
-      TGeoParser::State tgpState;
-      tgpState.volume = tvolume;
+      std::vector<TGeoParser::SelectedNode> selectedNodes;
+      bool fromCache = false;
+      auto cached = m_cache.find(key.value());
+      if (cached != m_cache.end()) {
+        fromCache = true;
+        for (const auto& cnode : cached->second) {
+          const TGeoNode* node = TGeoParser::findNode(*tvolume, cnode.path);
+          if (node == nullptr or
+              not TGeoPrimitivesHelper::match(layerCfg.sensorNames,
+                                              node->GetName())) {
+            ACTS_WARNING("- cached node not valid, parsing the geometry.");
+            fromCache = false;
+            selectedNodes.clear();
+            break;
+          }
+          auto transform = std::make_unique<TGeoHMatrix>();
+          transform->SetRotation(cnode.transform.data());
+          transform->SetTranslation(cnode.transform.data() + 9);
+          selectedNodes.push_back({node, std::move(transform), cnode.path});
+        }
+      }
 
-      TGeoParser::select(tgpState, tgpOptions);
+      if (not fromCache) {
+        TGeoParser::Options tgpOptions;
+        tgpOptions.volumeNames = {layerCfg.layerName};
+        tgpOptions.targetNames = layerCfg.sensorNames;
+        tgpOptions.parseRanges = layerCfg.parseRanges;
+        tgpOptions.unit = m_cfg.unit;
+        tgpOptions.numThreads = m_cfg.numThreads;
+
+        TGeoParser::State tgpState;
+        tgpState.volume = tvolume;
+
+        TGeoParser::select(tgpState, tgpOptions);
+        selectedNodes = std::move(tgpState.selectedNodes);
+
+        if (not m_cfg.cacheFile.empty()) {
+          auto& cnodes = m_cache[key.value()];
+          cnodes.clear();
+          for (const auto& snode : selectedNodes) {
+            CachedNode cnode;
+            cnode.path = snode.path;
+            const Double_t* rotation = snode.transform->GetRotationMatrix();
+            const Double_t* translation = snode.transform->GetTranslation();
+            std::copy(rotation, rotation + 9, cnode.transform.begin());
+            std::copy(translation, translation + 3,
+                      cnode.transform.begin() + 9);
+            cnodes.push_back(std::move(cnode));
+          }
+          cacheModified = true;
+        }
+      }
 
       ACTS_DEBUG("- number of selsected nodes found : "
-                 << tgpState.selectedNodes.size());
+                 << selectedNodes.size() << (fromCache ? " (cached)" : ""));
 
-      for (auto& snode : tgpState.selectedNodes) {
-        auto identifier =
+      // The identifier provider is not required to be thread-safe
+      std::vector<Identifier> identifiers;
+      identifiers.reserve(selectedNodes.size());
+      for (auto& snode : selectedNodes) {
+        identifiers.push_back(
             m_cfg.identifierProvider != nullptr
                 ? m_cfg.identifierProvider->identify(gctx, *snode.node)
-                : Identifier();
+                : Identifier());
+      }
 
-        auto tgElement = std::make_shared<const Acts::TGeoDetectorElement>(
-            identifier, *snode.node, *snode.transform, layerCfg.localAxes,
-            m_cfg.unit);
+      std::vector<std::shared_ptr<const TGeoDetectorElement>> elements(
+          selectedNodes.size());
+      detail::parallelFor(selectedNodes.size(), m_cfg.numThreads,
+                          [&](size_t is) {
+                            elements[is] =
+                                std::make_shared<const TGeoDetectorElement>(
+                                    identifiers[is], *selectedNodes[is].node,
+                                    *selectedNodes[is].transform,
+                                    layerCfg.localAxes, m_cfg.unit);
+                          });
+      for (auto& tgElement : elements) {
         m_elementStore.push_back(tgElement);
         layerSurfaces.push_back(tgElement->surface().getSharedPtr());
       }
@@ -199,5 +405,9 @@ void Acts::TGeoLayerBuilder::buildLayers(const GeometryContext& gctx,
       }
     }
   }
+
+  if (cacheModified) {
+    saveCache();
+  }
   return;
 }
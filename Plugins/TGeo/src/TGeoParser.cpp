@@ -12,82 +12,151 @@
 #include "TGeoBBox.h"
 #include "TGeoNode.h"
 #include "TGeoVolume.h"
+#include "TROOT.h"
 
-#include <iostream>
+#include <algorithm>
+#include <future>
+#include <iterator>
+#include <unordered_set>
+
+namespace {
+
+/// Check that all corners of the node bounding box are within the ranges.
+bool withinParseRanges(const TGeoNode& node, const Acts::Transform3D& etrf,
+                       const Acts::TGeoParser::Options& options) {
+  auto shape = dynamic_cast<const TGeoBBox*>(node.GetVolume()->GetShape());
+  // It uses the bounding box of TGeoBBox
+  // @TODO this should be replace by a proper TGeo to Acts::VolumeBounds
+  // and vertices converision which would make a more appropriate parsomg
+  const double dx = options.unit * shape->GetDX();
+  const double dy = options.unit * shape->GetDY();
+  const double dz = options.unit * shape->GetDZ();
+  for (unsigned int corner = 0; corner < 8u; ++corner) {
+    const Acts::Vector3D local((corner & 1u) ? dx : -dx,
+                               (corner & 2u) ? dy : -dy,
+                               (corner & 4u) ? dz : -dz);
+    const Acts::Vector3D edge = etrf * local;
+    for (const auto& check : options.parseRanges) {
+      double val = Acts::VectorHelpers::cast(edge, check.first);
+      if (val < check.second.first or val > check.second.second) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+/// Check whether the volume tree contains division nodes.
+///
+/// The matrix of a division node is computed by the pattern finder of its
+/// mother volume, which keeps per-thread state that is not set up here.
+bool hasDivisions(const TGeoVolume& volume,
+                  std::unordered_set<const TGeoVolume*>& visited) {
+  if (not visited.insert(&volume).second) {
+    return false;
+  }
+  for (int id = 0; id < volume.GetNdaughters(); ++id) {
+    const TGeoNode* node = volume.GetNode(id);
+    if (node->IsOffset() or hasDivisions(*node->GetVolume(), visited)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace
 
 void Acts::TGeoParser::select(Acts::TGeoParser::State& state,
                               const Acts::TGeoParser::Options& options,
                               const TGeoMatrix& gmatrix) {
   // Volume is present
   if (state.volume != nullptr) {
-    std::string volumeName = state.volume->GetName();
-    // If we have a match
+    TGeoVolume* volume = state.volume;
+    // If we have a match, it applies to this subtree
+    const bool onBranch = state.onBranch;
     state.onBranch =
-        state.onBranch or
-        TGeoPrimitivesHelper::match(options.volumeNames, volumeName.c_str());
-    // Loop over the daughters and collect them
-    auto daugthers = state.volume->GetNodes();
+        onBranch or
+        TGeoPrimitivesHelper::match(options.volumeNames, volume->GetName());
+    const int nDaughters = volume->GetNdaughters();
     // Daughter node iteration
-    TIter iObj(daugthers);
-    while (TObject* obj = iObj()) {
-      TGeoNode* node = dynamic_cast<TGeoNode*>(obj);
-      if (node != nullptr) {
+    auto selectDaughters = [&](const Options& daughterOptions) {
+      for (int id = 0; id < nDaughters; ++id) {
         state.volume = nullptr;
-        state.node = node;
-        select(state, options, gmatrix);
+        state.node = volume->GetNode(id);
+        state.path.push_back(id);
+        select(state, daughterOptions, gmatrix);
+        state.path.pop_back();
+      }
+    };
+    if (1u < options.numThreads and 1 < nDaughters) {
+      Options serialOptions = options;
+      serialOptions.numThreads = 1;
+      std::unordered_set<const TGeoVolume*> visited;
+      if (hasDivisions(*volume, visited)) {
+        // Division nodes can not be positioned concurrently
+        selectDaughters(serialOptions);
+      } else {
+        // ROOT objects are created concurrently below
+        ROOT::EnableThreadSafety();
+        // Contiguous chunks keep the order of the sequential parsing
+        const int nChunks = std::min<int>(options.numThreads, nDaughters);
+        std::vector<std::future<std::vector<SelectedNode>>> chunks;
+        for (int ic = 0; ic < nChunks; ++ic) {
+          const int begin = ic * nDaughters / nChunks;
+          const int end = (ic + 1) * nDaughters / nChunks;
+          chunks.push_back(std::async(std::launch::async, [&, begin, end]() {
+            State chunkState;
+            chunkState.onBranch = state.onBranch;
+            chunkState.path = state.path;
+            for (int id = begin; id < end; ++id) {
+              chunkState.volume = nullptr;
+              chunkState.node = volume->GetNode(id);
+              chunkState.path.push_back(id);
+              select(chunkState, serialOptions, gmatrix);
+              chunkState.path.pop_back();
+            }
+            return std::move(chunkState.selectedNodes);
+          }));
+        }
+        for (auto& chunk : chunks) {
+          auto selectedNodes = chunk.get();
+          std::move(selectedNodes.begin(), selectedNodes.end(),
+                    std::back_inserter(state.selectedNodes));
+        }
       }
+    } else {
+      selectDaughters(options);
     }
+    state.volume = nullptr;
+    state.onBranch = onBranch;
   } else if (state.node != nullptr) {
     // The node name for checking
-    std::string nodeName = state.node->GetName();
+    const char* nodeName = state.node->GetName();
     // Get the matrix of the current node for positioning
-    const TGeoMatrix* nmatrix = state.node->GetMatrix();
-    TGeoHMatrix transform = TGeoCombiTrans(gmatrix) * TGeoCombiTrans(*nmatrix);
-    std::string suffix = "_transform";
-    transform.SetName((nodeName + suffix).c_str());
+    TGeoHMatrix transform(gmatrix);
+    transform.Multiply(state.node->GetMatrix());
     // Check if you had found the target node
     if (state.onBranch and
-        TGeoPrimitivesHelper::match(options.targetNames, nodeName.c_str())) {
-      // Get the placement and orientation in respect to its mother
-      const Double_t* rotation = transform.GetRotationMatrix();
-      const Double_t* translation = transform.GetTranslation();
-
-      // Create a eigen transform
-      Vector3D t(options.unit * translation[0], options.unit * translation[1],
-                 options.unit * translation[2]);
-      Vector3D cx(rotation[0], rotation[3], rotation[6]);
-      Vector3D cy(rotation[1], rotation[4], rotation[7]);
-      Vector3D cz(rotation[2], rotation[5], rotation[8]);
-      auto etrf = TGeoPrimitivesHelper::makeTransform(cx, cy, cz, t);
-
+        TGeoPrimitivesHelper::match(options.targetNames, nodeName)) {
       bool accept = true;
       if (not options.parseRanges.empty()) {
-        auto shape =
-            dynamic_cast<TGeoBBox*>(state.node->GetVolume()->GetShape());
-        // It uses the bounding box of TGeoBBox
-        // @TODO this should be replace by a proper TGeo to Acts::VolumeBounds
-        // and vertices converision which would make a more appropriate parsomg
-        double dx = options.unit * shape->GetDX();
-        double dy = options.unit * shape->GetDY();
-        double dz = options.unit * shape->GetDZ();
-        for (auto x : std::vector<double>{-dx, dx}) {
-          for (auto y : std::vector<double>{-dy, dy}) {
-            for (auto z : std::vector<double>{-dz, dz}) {
-              Vector3D edge = etrf * Vector3D(x, y, z);
-              for (auto& check : options.parseRanges) {
-                double val = VectorHelpers::cast(edge, check.first);
-                if (val < check.second.first or val > check.second.second) {
-                  accept = false;
-                  break;
-                }
-              }
-            }
-          }
-        }
+        // Get the placement and orientation in respect to its mother
+        const Double_t* rotation = transform.GetRotationMatrix();
+        const Double_t* translation = transform.GetTranslation();
+
+        // Create a eigen transform
+        Vector3D t(options.unit * translation[0], options.unit * translation[1],
+                   options.unit * translation[2]);
+        Vector3D cx(rotation[0], rotation[3], rotation[6]);
+        Vector3D cy(rotation[1], rotation[4], rotation[7]);
+        Vector3D cz(rotation[2], rotation[5], rotation[8]);
+        auto etrf = TGeoPrimitivesHelper::makeTransform(cx, cy, cz, t);
+
+        accept = withinParseRanges(*state.node, etrf, options);
       }
       if (accept) {
         state.selectedNodes.push_back(
-            {state.node, std::make_unique<TGeoHMatrix>(transform)});
+            {state.node, std::make_unique<TGeoHMatrix>(transform), state.path});
       }
       state.node = nullptr;
     } else {
@@ -99,4 +168,18 @@ void Acts::TGeoParser::select(Acts::TGeoParser::State& state,
     }
   }
   return;
-}
\ No newline at end of file
+}
+
+const TGeoNode* Acts::TGeoParser::findNode(const TGeoVolume& top,
+                                           const std::vector<int>& path) {
+  const TGeoVolume* volume = &top;
+  const TGeoNode* node = nullptr;
+  for (int id : path) {
+    if (volume == nullptr or id < 0 or volume->GetNdaughters() <= id) {
+      return nullptr;
+    }
+    node = volume->GetNode(id);
+    volume = node->GetVolume();
+  }
+  return node;
+}
@@ -1,6 +1,6 @@
 // This file is part of the Acts project.
 //
-// Copyright (C) 2017-2018 CERN for the benefit of the Acts project
+// Copyright (C) 2017-2020 CERN for the benefit of the Acts project
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -10,10 +10,25 @@
 #include <chrono>
 #include <functional>
 #include <iostream>
+#include <memory>
 #include <random>
+#include <string>
+#include <utility>
 #include <vector>
 
+#include "Acts/Surfaces/AnnulusBounds.hpp"
 #include "Acts/Surfaces/BoundaryCheck.hpp"
+#include "Acts/Surfaces/ConeBounds.hpp"
+#include "Acts/Surfaces/ConvexPolygonBounds.hpp"
+#include "Acts/Surfaces/CylinderBounds.hpp"
+#include "Acts/Surfaces/DiamondBounds.hpp"
+#include "Acts/Surfaces/DiscTrapezoidBounds.hpp"
+#include "Acts/Surfaces/EllipseBounds.hpp"
+#include "Acts/Surfaces/InfiniteBounds.hpp"
+#include "Acts/Surfaces/LineBounds.hpp"
+#include "Acts/Surfaces/RadialBounds.hpp"
+#include "Acts/Surfaces/RectangleBounds.hpp"
+#include "Acts/Surfaces/TrapezoidBounds.hpp"
 #include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
 #include "Acts/Utilities/Definitions.hpp"
 #include "Acts/Utilities/Units.hpp"
@@ -127,5 +142,116 @@ int main(int /*argc*/, char** /*argv[]*/) {
                   Mode::SlowOutside);
   run_all_benches(BoundaryCheck(cov, 3.0), "Cov. tolerance", Mode::SlowOutside);
 
+  // === BOUNDS BENCHMARKS ===
+
+  // Number of random points per bounds type, and runs per benchmark
+  constexpr size_t NPOINTS = 1'000;
+  constexpr size_t NRUNS = 1'000;
+  const auto warmup = std::chrono::milliseconds(200);
+
+  // Every bounds type with a window of local positions around it, which
+  // contains points inside, close to and far away from the bounds
+  struct BoundsCase {
+    std::string name;
+    std::shared_ptr<const SurfaceBounds> bounds;
+    Vector2D lower;
+    Vector2D upper;
+  };
+  const std::vector<BoundsCase> bounds_cases = {
+      {"Annulus",
+       std::make_shared<AnnulusBounds>(7.2, 12.0, 0.74195, 1.33970,
+                                       Vector2D(-2., 2.)),
+       {5., 0.5},
+       {14., 1.6}},
+      {"Cone",
+       std::make_shared<ConeBounds>(0.5, 1., 10., 1.),
+       {-6., 0.},
+       {6., 11.}},
+      {"ConvexPolygon<3>",
+       std::make_shared<ConvexPolygonBounds<3>>(
+           ConvexPolygonBounds<3>::vertex_array{
+               {{-2., -1.}, {2., -1.}, {0., 3.}}}),
+       {-3., -2.},
+       {3., 4.}},
+      {"ConvexPolygon<dynamic>",
+       std::make_shared<ConvexPolygonBounds<PolygonDynamic>>(
+           std::vector<Vector2D>{{-2., -2.},
+                                 {2., -2.},
+                                 {3., 0.},
+                                 {2., 2.},
+                                 {-2., 2.},
+                                 {-3., 0.}}),
+       {-4., -3.},
+       {4., 3.}},
+      {"Cylinder",
+       std::make_shared<CylinderBounds>(10., 20., 1.),
+       {-15., -25.},
+       {15., 25.}},
+      {"Diamond",
+       std::make_shared<DiamondBounds>(1., 3., 2., 2., 3.),
+       {-4., -3.},
+       {4., 4.}},
+      {"Disc",
+       std::make_shared<RadialBounds>(5., 20., 0.5),
+       {0., -1.},
+       {25., 1.}},
+      {"DiscTrapezoid",
+       std::make_shared<DiscTrapezoidBounds>(2., 5., 10., 30.),
+       {5., -0.5},
+       {35., 0.5}},
+      {"Ellipse",
+       std::make_shared<EllipseBounds>(2., 1., 6., 4.),
+       {-8., -6.},
+       {8., 6.}},
+      {"Infinite", std::make_shared<InfiniteBounds>(), {-1., -1.}, {1., 1.}},
+      {"Line", std::make_shared<LineBounds>(2., 20.), {-3., -25.}, {3., 25.}},
+      {"Rectangle",
+       std::make_shared<RectangleBounds>(3., 2.),
+       {-4., -3.},
+       {4., 3.}},
+      {"Trapezoid",
+       std::make_shared<TrapezoidBounds>(1., 3., 2.),
+       {-4., -3.},
+       {4., 3.}},
+  };
+
+  // Boundary checks which are evaluated for every bounds type
+  SymMatrix2D bounds_cov;
+  bounds_cov << 0.1, 0.01, 0.01, 0.1;
+  const std::vector<std::pair<std::string, BoundaryCheck>> bounds_checks = {
+      {"No tolerance", BoundaryCheck(true)},
+      {"Abs. tolerance", BoundaryCheck(true, true, 0.3, 0.3)},
+      {"Cov. tolerance", BoundaryCheck(bounds_cov, 3.0)},
+  };
+
+  for (const auto& bcase : bounds_cases) {
+    const SurfaceBounds& bounds = *bcase.bounds;
+    std::uniform_real_distribution<double> loc0(bcase.lower[0],
+                                                bcase.upper[0]);
+    std::uniform_real_distribution<double> loc1(bcase.lower[1],
+                                                bcase.upper[1]);
+    std::vector<Vector2D> points(NPOINTS);
+    std::generate(points.begin(), points.end(),
+                  [&]() { return Vector2D(loc0(rng), loc1(rng)); });
+    std::vector<bool> inside;
+
+    for (const auto& [check_name, check] : bounds_checks) {
+      print_bench_header(bcase.name + " bounds, " + check_name);
+      auto single_result = Acts::Test::microBenchmark(
+          [&](const Vector2D& point) { return bounds.inside(point, check); },
+          points, NRUNS, warmup);
+      print_bench_result("Single", single_result);
+      auto batch_result = Acts::Test::microBenchmark(
+          [&] {
+            bounds.insideBatch(points, check, inside);
+            return inside.back();
+          },
+          1, NRUNS, warmup);
+      // report the time per point to compare with the single point checks
+      batch_result.iters_per_run = points.size();
+      print_bench_result("Batch", batch_result);
+    }
+  }
+
   return 0;
 }
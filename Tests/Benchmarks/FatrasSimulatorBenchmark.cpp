@@ -0,0 +1,235 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/program_options.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <random>
+#include <vector>
+
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/MagneticField/ConstantBField.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/Navigator.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Propagator/StraightLineStepper.hpp"
+#include "Acts/Tests/CommonHelpers/CylindricalTrackingGeometry.hpp"
+#include "Acts/Tests/CommonHelpers/PredefinedMaterials.hpp"
+#include "Acts/Utilities/Logger.hpp"
+#include "Acts/Utilities/UnitVectors.hpp"
+#include "Acts/Utilities/Units.hpp"
+#include "ActsFatras/Kernel/PhysicsList.hpp"
+#include "ActsFatras/Kernel/Simulator.hpp"
+#include "ActsFatras/Physics/StandardPhysicsLists.hpp"
+#include "ActsFatras/Physics/Tabulated/InteractionTable.hpp"
+#include "ActsFatras/Selectors/ChargeSelectors.hpp"
+
+namespace po = boost::program_options;
+using namespace Acts::UnitLiterals;
+
+namespace {
+/// Number of heap allocations in the process.
+std::atomic<size_t> s_allocations{0u};
+}  // namespace
+
+// count all heap allocations; the array versions forward to these
+void* operator new(std::size_t size) {
+  ++s_allocations;
+  if (void* ptr = std::malloc(size)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+void operator delete(void* ptr) noexcept {
+  std::free(ptr);
+}
+void operator delete(void* ptr, std::size_t) noexcept {
+  std::free(ptr);
+}
+
+namespace {
+/// Generate hits on sensitive surfaces only.
+struct SensitiveSurfaceSelector {
+  bool operator()(const Acts::Surface& surface) const {
+    return surface.associatedDetectorElement() != nullptr;
+  }
+};
+
+using Navigator = Acts::Navigator;
+using ChargedStepper = Acts::EigenStepper<Acts::ConstantBField>;
+using ChargedPropagator = Acts::Propagator<ChargedStepper, Navigator>;
+using NeutralStepper = Acts::StraightLineStepper;
+using NeutralPropagator = Acts::Propagator<NeutralStepper, Navigator>;
+using NeutralSimulator =
+    ActsFatras::ParticleSimulator<NeutralPropagator, ActsFatras::PhysicsList<>,
+                                  ActsFatras::NoSurface>;
+using InputEvents = std::vector<std::vector<ActsFatras::Particle>>;
+
+/// Simulate all events with the given charged particle physics list.
+template <typename physics_list_t>
+int simulateEvents(
+    std::shared_ptr<const Acts::TrackingGeometry> trackingGeometry,
+    double bz, physics_list_t physics, const InputEvents& inputEvents,
+    std::mt19937& generator) {
+  using ChargedSimulator =
+      ActsFatras::ParticleSimulator<ChargedPropagator, physics_list_t,
+                                    SensitiveSurfaceSelector>;
+  using Simulator =
+      ActsFatras::Simulator<ActsFatras::ChargedSelector, ChargedSimulator,
+                            ActsFatras::NeutralSelector, NeutralSimulator>;
+
+  Acts::GeometryContext geoCtx;
+  Acts::MagneticFieldContext magCtx;
+
+  Navigator navigator(trackingGeometry);
+  ChargedPropagator chargedPropagator(
+      ChargedStepper(Acts::ConstantBField(0, 0, bz)), navigator);
+  NeutralPropagator neutralPropagator(NeutralStepper(), navigator);
+  ChargedSimulator chargedSimulator(std::move(chargedPropagator),
+                                    Acts::Logging::INFO);
+  chargedSimulator.physics = std::move(physics);
+  NeutralSimulator neutralSimulator(std::move(neutralPropagator),
+                                    Acts::Logging::INFO);
+  Simulator simulator(std::move(chargedSimulator), std::move(neutralSimulator));
+
+  size_t nPrimaries = 0;
+  size_t nParticles = 0;
+  size_t nHits = 0;
+  size_t nFailed = 0;
+  size_t nAllocations = 0;
+  std::chrono::duration<double> elapsed(0);
+  for (const auto& input : inputEvents) {
+    const size_t allocationsBefore = s_allocations;
+    const auto start = std::chrono::steady_clock::now();
+    // output containers as used in the examples framework
+    std::vector<ActsFatras::Particle> particlesInitial, particlesFinal;
+    std::vector<ActsFatras::Hit> hits;
+    particlesInitial.reserve(input.size());
+    particlesFinal.reserve(input.size());
+    hits.reserve(16u * input.size());
+    auto ret = simulator.simulate(geoCtx, magCtx, generator, input,
+                                  particlesInitial, particlesFinal, hits);
+    elapsed += std::chrono::steady_clock::now() - start;
+    nAllocations += s_allocations - allocationsBefore;
+    if (not ret.ok()) {
+      std::cerr << "error: simulation failed with " << ret.error() << std::endl;
+      return 1;
+    }
+    nPrimaries += input.size();
+    nParticles += particlesInitial.size();
+    nHits += hits.size();
+    nFailed += ret.value().size();
+  }
+
+  const double nEvents = inputEvents.size();
+  std::cout << "Simulated particles per event: " << nParticles / nEvents
+            << std::endl;
+  std::cout << "Hits per event:                " << nHits / nEvents
+            << std::endl;
+  std::cout << "Failed particles per event:    " << nFailed / nEvents
+            << std::endl;
+  std::cout << "Allocations per event:         " << nAllocations / nEvents
+            << std::endl;
+  std::cout << "Primary particles per second:  "
+            << nPrimaries / elapsed.count() << std::endl;
+  std::cout << "Simulated particles per second: "
+            << nParticles / elapsed.count() << std::endl;
+  return 0;
+}
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  unsigned int events = 1;
+  unsigned int particlesPerEvent = 1;
+  double ptInGeV = 1;
+  double bzInT = 2;
+  bool tabulated = false;
+
+  try {
+    po::options_description desc("Allowed options");
+    // clang-format off
+    desc.add_options()
+      ("help", "produce help message")
+      ("events",po::value<unsigned int>(&events)->default_value(100),"number of events to simulate")
+      ("particles",po::value<unsigned int>(&particlesPerEvent)->default_value(100),"number of primary particles per event")
+      ("pT",po::value<double>(&ptInGeV)->default_value(1),"transverse momentum in GeV")
+      ("B",po::value<double>(&bzInT)->default_value(2),"longitudinal magnetic field in T")
+      ("tabulated",po::bool_switch(&tabulated),"use the tabulated electro-magnetic physics list");
+    // clang-format on
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if (vm.count("help")) {
+      std::cout << desc << std::endl;
+      return 0;
+    }
+  } catch (std::exception& e) {
+    std::cerr << "error: " << e.what() << std::endl;
+    return 1;
+  }
+
+  // setup the test detector
+  Acts::GeometryContext geoCtx;
+  Acts::Test::CylindricalTrackingGeometry cGeometry(
+      std::cref<Acts::GeometryContext>(geoCtx));
+  auto trackingGeometry = cGeometry();
+
+  // pions and photons from the origin in the central region
+  std::mt19937 generator(42u);
+  std::uniform_real_distribution<double> phiDist(-M_PI, M_PI);
+  std::uniform_real_distribution<double> etaDist(-2, 2);
+  InputEvents inputEvents(events);
+  for (auto& input : inputEvents) {
+    for (unsigned int i = 1; i <= particlesPerEvent; ++i) {
+      const double charge = (i % 3 == 0) ? 0 : ((i % 2 == 0) ? -1 : 1);
+      const auto pdg = (charge == 0)  ? Acts::PdgParticle::eGamma
+                       : (charge < 0) ? Acts::PdgParticle::ePionMinus
+                                      : Acts::PdgParticle::ePionPlus;
+      const double mass = (i % 3 == 0) ? 0 : 139.57_MeV;
+      const double theta = 2 * std::atan(std::exp(-etaDist(generator)));
+      input.push_back(
+          ActsFatras::Particle(
+              ActsFatras::Barcode().setVertexPrimary(1u).setParticle(i), pdg,
+              charge, mass)
+              .setDirection(Acts::makeDirectionUnitFromPhiTheta(
+                  phiDist(generator), theta))
+              .setAbsMomentum(ptInGeV * 1_GeV / std::sin(theta)));
+    }
+  }
+
+  std::cout << "Simulating " << events << " events with " << particlesPerEvent
+            << " primary particles each" << std::endl;
+
+  if (not tabulated) {
+    return simulateEvents(
+        trackingGeometry, bzInT * 1_T,
+        ActsFatras::makeChargedElectroMagneticPhysicsList(100_MeV),
+        inputEvents, generator);
+  }
+  // tables for all materials in the test detector and the simulated particles
+  auto tables = std::make_shared<const ActsFatras::InteractionTables>(
+      std::vector<Acts::Material>{Acts::Test::makeBeryllium(),
+                                  Acts::Test::makeSilicon()},
+      std::vector<Acts::PdgParticle>{
+          Acts::PdgParticle::eElectron, Acts::PdgParticle::ePositron,
+          Acts::PdgParticle::ePionPlus, Acts::PdgParticle::ePionMinus});
+  std::cout << "Using " << tables->size() << " interaction tables"
+            << std::endl;
+  return simulateEvents(
+      trackingGeometry, bzInT * 1_T,
+      ActsFatras::makeTabulatedElectroMagneticPhysicsList(100_MeV, tables),
+      inputEvents, generator);
+}
@@ -0,0 +1,136 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/program_options.hpp>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "Acts/EventData/Measurement.hpp"
+#include "Acts/EventData/MeasurementHelpers.hpp"
+#include "Acts/EventData/MultiTrajectory.hpp"
+#include "Acts/Fitter/BatchGainMatrixSmoother.hpp"
+#include "Acts/Fitter/BatchGainMatrixUpdater.hpp"
+#include "Acts/Fitter/GainMatrixSmoother.hpp"
+#include "Acts/Fitter/GainMatrixUpdater.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+
+namespace po = boost::program_options;
+using namespace Acts;
+
+using SourceLink = MinimalSourceLink;
+
+template <ParID_t... params>
+using MeasurementType = Measurement<SourceLink, params...>;
+
+int main(int argc, char* argv[]) {
+  unsigned int nTracks = 1000;
+  unsigned int nStates = 10;
+  unsigned int nRuns = 100;
+
+  try {
+    po::options_description desc("Allowed options");
+    // clang-format off
+  desc.add_options()
+      ("help", "produce help message")
+      ("tracks",po::value<unsigned int>(&nTracks)->default_value(1000),"number of tracks")
+      ("states",po::value<unsigned int>(&nStates)->default_value(10),"number of track states per track")
+      ("runs",po::value<unsigned int>(&nRuns)->default_value(100),"number of benchmark runs");
+    // clang-format on
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if (vm.count("help") != 0u) {
+      std::cout << desc << std::endl;
+      return 0;
+    }
+  } catch (std::exception& e) {
+    std::cerr << "error: " << e.what() << std::endl;
+    return 1;
+  }
+
+  GeometryContext tgContext = GeometryContext();
+
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<double> locDist(-0.5, 0.5);
+
+  // One pixel-like measurement per surface
+  std::vector<FittableMeasurement<SourceLink>> measurements;
+  measurements.reserve(nStates);
+  for (unsigned int istate = 0; istate < nStates; ++istate) {
+    auto plane = Surface::makeShared<PlaneSurface>(
+        Vector3D::UnitX() * (istate + 1), Vector3D::UnitX());
+    SymMatrix2D cov;
+    cov << 0.04, 0, 0, 0.1;
+    measurements.push_back(MeasurementType<ParDef::eLOC_0, ParDef::eLOC_1>(
+        plane, {}, std::move(cov), locDist(gen), locDist(gen)));
+  }
+
+  // nTracks independent tracks with nStates states each
+  MultiTrajectory<SourceLink> traj;
+  std::vector<size_t> indices;
+  std::vector<size_t> tips;
+  for (unsigned int itrack = 0; itrack < nTracks; ++itrack) {
+    size_t iprevious = SIZE_MAX;
+    for (const auto& meas : measurements) {
+      BoundSymMatrix cov;
+      cov.setZero();
+      cov.diagonal() << 0.08, 0.3, 0.01, 0.01, 0.0001, 1;
+      BoundVector pars;
+      pars << locDist(gen), locDist(gen), 0.5 * M_PI, 0.3 * M_PI, 0.01, 0.;
+
+      iprevious = traj.addTrackState(TrackStatePropMask::All, iprevious);
+      auto ts = traj.getTrackState(iprevious);
+      ts.uncalibrated() = SourceLink{&meas};
+      std::visit([&](const auto& m) { ts.setCalibrated(m); }, meas);
+      ts.predicted() = pars;
+      ts.predictedCovariance() = cov;
+      ts.jacobian().setIdentity();
+      indices.push_back(iprevious);
+    }
+    tips.push_back(iprevious);
+  }
+
+  std::cout << "Kalman update of " << indices.size() << " track states:"
+            << std::endl;
+  GainMatrixUpdater updater;
+  auto singleUpdate = Acts::Test::microBenchmark(
+      [&] {
+        for (auto index : indices) {
+          (void)updater(tgContext, traj.getTrackState(index));
+        }
+      },
+      1, nRuns);
+  std::cout << "- GainMatrixUpdater: " << singleUpdate << std::endl;
+
+  BatchGainMatrixUpdater batchUpdater;
+  auto batchUpdate = Acts::Test::microBenchmark(
+      [&] { return batchUpdater(tgContext, traj, indices).ok(); }, 1, nRuns);
+  std::cout << "- BatchGainMatrixUpdater: " << batchUpdate << std::endl;
+
+  std::cout << "Kalman smoothing of " << tips.size() << " tracks:" << std::endl;
+  GainMatrixSmoother smoother;
+  auto singleSmooth = Acts::Test::microBenchmark(
+      [&] {
+        for (auto tip : tips) {
+          (void)smoother(tgContext, traj, tip);
+        }
+      },
+      1, nRuns);
+  std::cout << "- GainMatrixSmoother: " << singleSmooth << std::endl;
+
+  BatchGainMatrixSmoother batchSmoother;
+  auto batchSmooth = Acts::Test::microBenchmark(
+      [&] { return batchSmoother(tgContext, traj, tips).ok(); }, 1, nRuns);
+  std::cout << "- BatchGainMatrixSmoother: " << batchSmooth << std::endl;
+
+  return 0;
+}
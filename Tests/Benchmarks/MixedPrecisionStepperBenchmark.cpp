@@ -0,0 +1,175 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/program_options.hpp>
+#include <iostream>
+
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/MagneticField/BFieldMapUtils.hpp"
+#include "Acts/MagneticField/InterpolatedBFieldMap.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/MagneticField/SolenoidBField.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/MixedPrecisionEigenStepper.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+#include "Acts/Utilities/Logger.hpp"
+#include "Acts/Utilities/Units.hpp"
+
+namespace po = boost::program_options;
+using namespace Acts;
+using namespace Acts::UnitLiterals;
+
+/// Sample the solenoid field into an (r,z) field map of the given precision
+template <typename value_t>
+auto makeSolenoidMap(const SolenoidBField& solenoid, double rMax, double zMax,
+                     size_t nBinsR, size_t nBinsZ) {
+  auto localToGlobalBin = [](std::array<size_t, 2> bins,
+                             std::array<size_t, 2> sizes) {
+    return (bins[1] * sizes[0] + bins[0]);
+  };
+  std::vector<double> rPos, zPos;
+  for (size_t i = 0; i < nBinsR; ++i) {
+    rPos.push_back(i * rMax / (nBinsR - 1));
+  }
+  for (size_t j = 0; j < nBinsZ; ++j) {
+    zPos.push_back(-zMax + j * 2 * zMax / (nBinsZ - 1));
+  }
+  std::vector<value_t> bField(nBinsR * nBinsZ);
+  for (size_t i = 0; i < nBinsR; ++i) {
+    for (size_t j = 0; j < nBinsZ; ++j) {
+      Vector2D b = solenoid.getField(Vector2D(rPos[i], zPos[j]));
+      bField[localToGlobalBin({{i, j}}, {{nBinsR, nBinsZ}})] =
+          b.template cast<typename value_t::Scalar>();
+    }
+  }
+  // positions and field values are already in native units
+  auto mapper = fieldMapperRZ(localToGlobalBin, rPos, zPos, bField, 1., 1.);
+  using BField_t = InterpolatedBFieldMap<decltype(mapper)>;
+  typename BField_t::Config cfg(std::move(mapper));
+  return BField_t(std::move(cfg));
+}
+
+int main(int argc, char* argv[]) {
+  unsigned int toys = 1;
+  double ptInGeV = 1;
+  double maxPathInM = 1;
+  unsigned int lvl = Acts::Logging::INFO;
+  bool withCov = true;
+  bool helixTransport = false;
+
+  // Create a test context
+  GeometryContext tgContext = GeometryContext();
+  MagneticFieldContext mfContext = MagneticFieldContext();
+
+  try {
+    po::options_description desc("Allowed options");
+    // clang-format off
+  desc.add_options()
+      ("help", "produce help message")
+      ("toys",po::value<unsigned int>(&toys)->default_value(20000),"number of tracks to propagate")
+      ("pT",po::value<double>(&ptInGeV)->default_value(1),"transverse momentum in GeV")
+      ("path",po::value<double>(&maxPathInM)->default_value(2),"maximum path length in m")
+      ("cov",po::value<bool>(&withCov)->default_value(true),"propagation with covariance matrix")
+      ("helix",po::value<bool>(&helixTransport)->default_value(false),"local helix transport jacobian for the single precision stepper")
+      ("verbose",po::value<unsigned int>(&lvl)->default_value(Acts::Logging::INFO),"logging level");
+    // clang-format on
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if (vm.count("help") != 0u) {
+      std::cout << desc << std::endl;
+      return 0;
+    }
+  } catch (std::exception& e) {
+    std::cerr << "error: " << e.what() << std::endl;
+    return 1;
+  }
+
+  ACTS_LOCAL_LOGGER(
+      getDefaultLogger("MixedPrecision_Stepper", Acts::Logging::Level(lvl)));
+
+  // print information about profiling setup
+  ACTS_INFO("propagating " << toys << " tracks with pT = " << ptInGeV
+                           << "GeV in a solenoid field map");
+
+  const double L = 5.8_m;
+  const double R = (2.56 + 2.46) * 0.5 * 0.5_m;
+  SolenoidBField solenoid({R, L, 1154, 2_T});
+  auto bFieldD = makeSolenoidMap<Vector2D>(solenoid, 2 * R, L, 150, 200);
+  auto bFieldF = makeSolenoidMap<Vector2F>(solenoid, 2 * R, L, 150, 200);
+  using BFieldD = decltype(bFieldD);
+  using BFieldF = decltype(bFieldF);
+  using Covariance = BoundSymMatrix;
+
+  PropagatorOptions<> options(tgContext, mfContext);
+  options.pathLimit = maxPathInM * UnitConstants::m;
+  // the step size evolution differs between the configurations, make sure the
+  // path limit is always reached to compare the end positions
+  options.maxSteps = 100000;
+
+  Vector3D pos(0, 0, 0);
+  Vector3D mom(ptInGeV * UnitConstants::GeV, 0,
+               0.5 * ptInGeV * UnitConstants::GeV);
+  Covariance cov;
+  // clang-format off
+  cov << 10_mm, 0, 0, 0, 0, 0,
+         0, 10_mm, 0, 0, 0, 0,
+         0, 0, 1, 0, 0, 0,
+         0, 0, 0, 1, 0, 0,
+         0, 0, 0, 0, 1_e / 10_GeV, 0,
+         0, 0, 0, 0, 0, 0;
+  // clang-format on
+
+  std::optional<Covariance> covOpt = std::nullopt;
+  if (withCov) {
+    covOpt = cov;
+  }
+  CurvilinearParameters pars(covOpt, pos, mom, +1, 0.);
+
+  // Run one configuration and return the end position of the first track
+  auto run = [&](const auto& propagator, const std::string& name) {
+    Vector3D endPosition = Vector3D::Zero();
+    size_t steps = 0;
+    const auto bench_result = Acts::Test::microBenchmark(
+        [&] {
+          auto r = propagator.propagate(pars, options).value();
+          endPosition = r.endParameters->position();
+          steps = r.steps;
+          return r;
+        },
+        1, toys);
+    ACTS_INFO(name << " execution stats: " << bench_result);
+    ACTS_DEBUG(name << " reached position (" << endPosition.x() << ", "
+                    << endPosition.y() << ", " << endPosition.z() << ") in "
+                    << steps << " steps");
+    return endPosition;
+  };
+
+  Propagator<EigenStepper<BFieldD>> propagatorD(
+      EigenStepper<BFieldD>(std::move(bFieldD)));
+  const Vector3D endD = run(propagatorD, "double precision");
+
+  Vector3D endF;
+  if (helixTransport) {
+    Propagator<MixedPrecisionEigenStepper<BFieldF, true>> propagatorF(
+        MixedPrecisionEigenStepper<BFieldF, true>(std::move(bFieldF)));
+    endF = run(propagatorF, "single precision");
+  } else {
+    Propagator<MixedPrecisionEigenStepper<BFieldF>> propagatorF(
+        MixedPrecisionEigenStepper<BFieldF>(std::move(bFieldF)));
+    endF = run(propagatorF, "single precision");
+  }
+
+  ACTS_INFO("end position deviation = " << (endD - endF).norm() / 1_um
+                                        << "um");
+
+  return 0;
+}
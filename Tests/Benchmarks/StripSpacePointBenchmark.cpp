@@ -0,0 +1,211 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/program_options.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Plugins/Digitization/CartesianSegmentation.hpp"
+#include "Acts/Plugins/Digitization/DigitizationModule.hpp"
+#include "Acts/Plugins/Digitization/DoubleHitSpacePointBuilder.hpp"
+#include "Acts/Plugins/Digitization/PlanarModuleCluster.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Surfaces/RectangleBounds.hpp"
+#include "Acts/Tests/CommonHelpers/DetectorElementStub.hpp"
+#include "Acts/Utilities/Units.hpp"
+
+namespace po = boost::program_options;
+using namespace Acts::UnitLiterals;
+
+namespace {
+using Cluster = Acts::PlanarModuleCluster;
+using ClusterPairs = std::vector<std::pair<const Cluster*, const Cluster*>>;
+using Builder = Acts::SpacePointBuilder<Acts::SpacePoint<Cluster>>;
+
+Acts::Vector3D globalPosition(const Acts::GeometryContext& gctx,
+                              const Cluster& cluster) {
+  Acts::Vector3D pos, mom;
+  auto par = cluster.parameters();
+  cluster.referenceSurface().localToGlobal(
+      gctx, Acts::Vector2D(par[Acts::eLOC_0], par[Acts::eLOC_1]), mom, pos);
+  return pos;
+}
+
+/// Compare all combinations of front and back clusters as done previously.
+void makeClusterPairsExhaustive(const Acts::GeometryContext& gctx,
+                                const Acts::DoubleHitSpacePointConfig& cfg,
+                                const std::vector<const Cluster*>& front,
+                                const std::vector<const Cluster*>& back,
+                                ClusterPairs& clusterPairs) {
+  for (auto cf : front) {
+    const Acts::Vector3D posFront = globalPosition(gctx, *cf);
+    double diffMin = std::numeric_limits<double>::max();
+    const Cluster* best = nullptr;
+    for (auto cb : back) {
+      double diff = Acts::detail::differenceOfClustersChecked(
+          posFront, globalPosition(gctx, *cb), cfg.vertex, cfg.diffDist,
+          cfg.diffTheta2, cfg.diffPhi2);
+      if ((0. <= diff) and (diff < diffMin)) {
+        diffMin = diff;
+        best = cb;
+      }
+    }
+    if (best != nullptr) {
+      clusterPairs.emplace_back(cf, best);
+    }
+  }
+}
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  unsigned int nModules = 1;
+  unsigned int nClusters = 1;
+  unsigned int nRepetitions = 1;
+
+  try {
+    po::options_description desc("Allowed options");
+    // clang-format off
+    desc.add_options()
+      ("help", "produce help message")
+      ("modules",po::value<unsigned int>(&nModules)->default_value(500),"number of stereo module pairs")
+      ("clusters",po::value<unsigned int>(&nClusters)->default_value(50),"number of clusters per module")
+      ("repetitions",po::value<unsigned int>(&nRepetitions)->default_value(5),"number of repetitions");
+    // clang-format on
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if (vm.count("help")) {
+      std::cout << desc << std::endl;
+      return 0;
+    }
+  } catch (std::exception& e) {
+    std::cerr << "error: " << e.what() << std::endl;
+    return 1;
+  }
+
+  Acts::GeometryContext gctx;
+
+  // strip modules with 80um pitch and a small stereo angle
+  auto bounds = std::make_shared<const Acts::RectangleBounds>(30_mm, 25_mm);
+  auto segmentation =
+      std::make_shared<const Acts::CartesianSegmentation>(bounds, 750u, 1u);
+  const Acts::DigitizationModule digMod(segmentation, 0.15_mm, 1, 0.);
+  std::vector<std::unique_ptr<Acts::Test::DetectorElementStub>> elements;
+  std::vector<std::shared_ptr<const Acts::Surface>> surfaces;
+  for (unsigned int i = 0; i < nModules; ++i) {
+    const double phi = 2 * M_PI * i / nModules;
+    for (double stereo : {0.026, -0.026}) {
+      Acts::Transform3D trf(Acts::AngleAxis3D(phi, Acts::Vector3D::UnitZ()) *
+                            Acts::AngleAxis3D(stereo, Acts::Vector3D::UnitZ()));
+      trf.translation() =
+          Acts::Vector3D(-std::sin(phi), std::cos(phi), 0.) * 200_mm +
+          Acts::Vector3D(0., 0., (0 < stereo) ? 300_mm : 302_mm);
+      elements.push_back(std::make_unique<Acts::Test::DetectorElementStub>(
+          std::make_shared<const Acts::Transform3D>(trf)));
+      surfaces.push_back(Acts::Surface::makeShared<Acts::PlaneSurface>(
+          bounds, *elements.back()));
+    }
+  }
+
+  // clusters from straight tracks parallel to the module normal
+  std::mt19937 rng(42u);
+  std::uniform_real_distribution<double> uniformX(-25_mm, 25_mm);
+  std::uniform_real_distribution<double> uniformY(-20_mm, 20_mm);
+  Acts::ActsSymMatrixD<3> cov = Acts::ActsSymMatrixD<3>::Zero();
+  std::vector<Cluster> clusters;
+  clusters.reserve(2 * nModules * nClusters);
+  for (unsigned int i = 0; i < nModules; ++i) {
+    const auto& surfaceFront = surfaces[2 * i];
+    const Acts::Vector3D dirX = surfaceFront->transform(gctx).rotation().col(0);
+    const Acts::Vector3D dirY = surfaceFront->transform(gctx).rotation().col(1);
+    for (unsigned int j = 0; j < nClusters; ++j) {
+      const Acts::Vector3D offset = uniformX(rng) * dirX + uniformY(rng) * dirY;
+      for (unsigned int s = 0; s < 2; ++s) {
+        const auto& surface = surfaces[2 * i + s];
+        Acts::Vector2D local;
+        surface->globalToLocal(gctx, surface->center(gctx) + offset,
+                               Acts::Vector3D::UnitZ(), local);
+        clusters.emplace_back(surface, Identifier{}, cov, local.x(), 0., 0.,
+                              std::vector<Acts::DigitizationCell>{}, &digMod);
+      }
+    }
+  }
+  std::vector<std::pair<std::vector<const Cluster*>,
+                        std::vector<const Cluster*>>>
+      clustersPerSurfacePair(nModules);
+  for (size_t k = 0; k < clusters.size(); k += 2) {
+    auto& clustersPair = clustersPerSurfacePair[k / (2 * nClusters)];
+    clustersPair.first.push_back(&clusters[k]);
+    clustersPair.second.push_back(&clusters[k + 1]);
+  }
+  for (auto& clustersPair : clustersPerSurfacePair) {
+    std::shuffle(clustersPair.second.begin(), clustersPair.second.end(), rng);
+  }
+
+  Acts::DoubleHitSpacePointConfig cfg;
+  cfg.diffDist = 3_mm;
+  cfg.diffTheta2 = 1e-4;
+  cfg.diffPhi2 = 1e-4;
+  Builder builder(cfg);
+
+  std::cout << "Pairing clusters on " << nModules << " module pairs with "
+            << nClusters << " clusters each" << std::endl;
+
+  ClusterPairs referencePairs, clusterPairs;
+  std::chrono::duration<double> elapsedExhaustive(0);
+  std::chrono::duration<double> elapsedBinned(0);
+  std::chrono::duration<double> elapsedSpacePoints(0);
+  std::vector<Acts::SpacePoint<Cluster>> spacePoints;
+  for (unsigned int r = 0; r < nRepetitions; ++r) {
+    referencePairs.clear();
+    auto start = std::chrono::steady_clock::now();
+    for (const auto& clustersPair : clustersPerSurfacePair) {
+      makeClusterPairsExhaustive(gctx, cfg, clustersPair.first,
+                                 clustersPair.second, referencePairs);
+    }
+    elapsedExhaustive += std::chrono::steady_clock::now() - start;
+
+    clusterPairs.clear();
+    start = std::chrono::steady_clock::now();
+    builder.makeClusterPairs(gctx, clustersPerSurfacePair, clusterPairs);
+    elapsedBinned += std::chrono::steady_clock::now() - start;
+
+    spacePoints.clear();
+    start = std::chrono::steady_clock::now();
+    builder.calculateSpacePoints(gctx, clusterPairs, spacePoints);
+    elapsedSpacePoints += std::chrono::steady_clock::now() - start;
+  }
+  if (clusterPairs != referencePairs) {
+    std::cerr << "error: binned cluster pairs differ from the reference"
+              << std::endl;
+    return 1;
+  }
+
+  const double nPairs = nRepetitions * clusterPairs.size();
+  std::cout << "Cluster pairs:                  " << clusterPairs.size()
+            << std::endl;
+  std::cout << "Space points:                   " << spacePoints.size()
+            << std::endl;
+  std::cout << "Exhaustive pairs per second:    "
+            << nPairs / elapsedExhaustive.count() << std::endl;
+  std::cout << "Binned pairs per second:        "
+            << nPairs / elapsedBinned.count() << std::endl;
+  std::cout << "Space points per second:        "
+            << nRepetitions * spacePoints.size() / elapsedSpacePoints.count()
+            << std::endl;
+  return 0;
+}
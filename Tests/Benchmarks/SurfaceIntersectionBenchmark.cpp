@@ -11,6 +11,7 @@
 #include <boost/test/unit_test.hpp>
 
 #include <cmath>
+#include <random>
 
 #include "Acts/Geometry/GeometryContext.hpp"
 #include "Acts/Surfaces/CylinderBounds.hpp"
@@ -20,6 +21,7 @@
 #include "Acts/Surfaces/RadialBounds.hpp"
 #include "Acts/Surfaces/RectangleBounds.hpp"
 #include "Acts/Surfaces/StrawSurface.hpp"
+#include "Acts/Surfaces/SurfaceBatchIntersector.hpp"
 #include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
 #include "Acts/Utilities/Units.hpp"
 
@@ -33,6 +35,8 @@ namespace Test {
 // Some randomness & number crunching
 unsigned int ntests = 10;
 unsigned int nrepts = 2000;
+unsigned int nlines = 1000;
+unsigned int nruns = 200;
 const bool boundaryCheck = false;
 const bool testPlane = true;
 const bool testDisc = true;
@@ -126,5 +130,96 @@ BOOST_DATA_TEST_CASE(
   }
 }
 
+/// Print the result together with the rate of intersections
+void printRate(const std::string& name, const MicroBenchmarkResult& result) {
+  std::cout << "- " << name << ": " << 1e9 / result.iterTimeAverage().count()
+            << " intersections/s" << std::endl
+            << result << std::endl;
+}
+
+BOOST_AUTO_TEST_CASE(benchmark_surface_batch_intersections) {
+  // Random directions as for the single intersections above
+  std::mt19937 rng(23);
+  std::uniform_real_distribution<double> phiDist(-M_PI, M_PI);
+  std::uniform_real_distribution<double> thetaDist(-0.3, 0.3);
+  std::vector<Vector3D> directions;
+  std::vector<Vector3D> strawDirections;
+  for (unsigned int il = 0; il < nlines; ++il) {
+    double phi = phiDist(rng);
+    double theta = thetaDist(rng);
+    directions.emplace_back(std::cos(phi) * std::sin(theta),
+                            std::sin(phi) * std::sin(theta), std::cos(theta));
+    strawDirections.emplace_back(std::cos(phi) * std::sin(theta + M_PI),
+                                 std::sin(phi) * std::sin(theta + M_PI),
+                                 std::cos(theta + M_PI));
+  }
+  std::vector<Vector3D> origins(nlines, origin);
+  std::vector<Vector3D> strawOrigins(nlines, originStraw);
+
+  std::vector<const Surface*> surfaces = {aPlane.get(), aDisc.get(),
+                                          aCylinder.get(), aStraw.get()};
+  std::vector<std::string> names = {"Plane", "Disc", "Cylinder", "Straw"};
+  SurfaceBatchIntersector intersector(tgContext, surfaces);
+  std::chrono::milliseconds warmup(200);
+  std::vector<SurfaceIntersection> intersections;
+
+  for (const BoundaryCheck bcheck : {false, true}) {
+    // The batch intersections are compared with the estimates of the
+    // surfaces, which also return the closest solution only
+    std::cout << std::endl
+              << "Benchmarking many lines with one surface, boundary check "
+              << (bcheck ? "on" : "off") << "..." << std::endl;
+    for (size_t is = 0; is < surfaces.size(); ++is) {
+      const Surface& surface = *surfaces[is];
+      const bool isStraw = (surface.type() == Surface::Straw);
+      const Vector3D& sOrigin = isStraw ? originStraw : origin;
+      const auto& sOrigins = isStraw ? strawOrigins : origins;
+      const auto& sDirections = isStraw ? strawDirections : directions;
+      printRate(names[is] + " single",
+                microBenchmark(
+                    [&](const Vector3D& direction) {
+                      return surface.intersectionEstimate(
+                          tgContext, sOrigin, direction, bcheck);
+                    },
+                    sDirections, nruns, warmup));
+      auto batchResult = microBenchmark(
+          [&] {
+            intersector.intersect(is, sOrigins, sDirections, bcheck,
+                                  intersections);
+            return intersections.back();
+          },
+          1, nruns, warmup);
+      batchResult.iters_per_run = nlines;
+      printRate(names[is] + " batch", batchResult);
+    }
+
+    std::cout << std::endl
+              << "Benchmarking one line with many surfaces, boundary check "
+              << (bcheck ? "on" : "off") << "..." << std::endl;
+    auto singleResult = microBenchmark(
+        [&](const Vector3D& direction) {
+          intersections.clear();
+          for (const Surface* surface : surfaces) {
+            intersections.emplace_back(
+                surface->intersectionEstimate(tgContext, origin, direction,
+                                              bcheck),
+                surface);
+          }
+          return intersections.back();
+        },
+        directions, nruns, warmup);
+    singleResult.iters_per_run *= surfaces.size();
+    printRate("All surfaces single", singleResult);
+    auto batchResult = microBenchmark(
+        [&](const Vector3D& direction) {
+          intersector.intersect(origin, direction, bcheck, intersections);
+          return intersections.back();
+        },
+        directions, nruns, warmup);
+    batchResult.iters_per_run *= surfaces.size();
+    printRate("All surfaces batch", batchResult);
+  }
+}
+
 }  // namespace Test
 }  // namespace Acts
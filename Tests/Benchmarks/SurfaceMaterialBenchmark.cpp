@@ -0,0 +1,121 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Acts/Material/BinnedSurfaceMaterial.hpp"
+#include "Acts/Material/MaterialProperties.hpp"
+#include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+#include "Acts/Utilities/BinUtility.hpp"
+#include "Acts/Utilities/Definitions.hpp"
+
+using namespace Acts;
+
+int main(int argc, char* argv[]) {
+  size_t nBins0 = 100;
+  size_t nBins1 = 200;
+  size_t nMaterials = 8;
+  size_t runs = 1000;
+  if (argc >= 2) {
+    nBins0 = std::stoi(argv[1]);
+  }
+  if (argc >= 3) {
+    nBins1 = std::stoi(argv[2]);
+  }
+  if (argc >= 4) {
+    nMaterials = std::stoi(argv[3]);
+  }
+  if (argc >= 5) {
+    runs = std::stoi(argv[4]);
+  }
+
+  // A cylinder-like map in (phi, z) with a handful of distinct materials,
+  // similar to the mapped material of a barrel layer
+  BinUtility binUtility(nBins0, -M_PI, M_PI, closed, binPhi);
+  binUtility += BinUtility(nBins1, -500., 500., open, binZ);
+
+  std::mt19937 rng(42);
+  std::vector<MaterialProperties> materials;
+  std::uniform_real_distribution<float> thickness(0.1, 2.);
+  for (size_t im = 0; im < nMaterials; ++im) {
+    materials.emplace_back(95., 465., 28., 14., 2.3e-3, thickness(rng));
+  }
+  std::uniform_int_distribution<size_t> material(0, nMaterials - 1);
+  MaterialPropertiesMatrix full(nBins1, MaterialPropertiesVector(nBins0));
+  for (auto& row : full) {
+    for (auto& bin : row) {
+      bin = materials[material(rng)];
+    }
+  }
+
+  auto storage = std::make_shared<MaterialPropertiesVector>();
+  for (const auto& row : full) {
+    storage->insert(storage->end(), row.begin(), row.end());
+  }
+  const BinnedSurfaceMaterial owned(binUtility, full);
+  const BinnedSurfaceMaterial shared(
+      binUtility,
+      std::shared_ptr<const MaterialProperties>(storage, storage->data()));
+
+  // === MEMORY ===
+
+  const size_t nBins = nBins0 * nBins1;
+  const size_t bytesMatrix = nBins1 * sizeof(MaterialPropertiesVector) +
+                             nBins * sizeof(MaterialProperties);
+  const size_t bytesPalette =
+      owned.palette().size() * sizeof(MaterialProperties) +
+      nBins * sizeof(uint32_t);
+  std::cout << "Material map with " << nBins0 << " x " << nBins1 << " bins and "
+            << owned.palette().size() << " unique entries" << std::endl;
+  std::cout << "- nested vector storage: " << bytesMatrix << " bytes"
+            << std::endl;
+  std::cout << "- palette storage: " << bytesPalette << " bytes" << std::endl;
+
+  // === BENCHMARKS ===
+
+  std::uniform_real_distribution<double> phi(-M_PI, M_PI);
+  std::uniform_real_distribution<double> z(-500., 500.);
+  std::vector<Vector3D> positions;
+  for (size_t ip = 0; ip < 4096; ++ip) {
+    const double p = phi(rng);
+    positions.emplace_back(100. * std::cos(p), 100. * std::sin(p), z(rng));
+  }
+
+  auto run_bench = [&](auto&& lookup, const std::string& name) {
+    auto bench_result = Acts::Test::microBenchmark(
+        [&](const Vector3D& position) {
+          return lookup(position).thicknessInX0();
+        },
+        positions, runs);
+    std::cout << "- " << name << ": " << bench_result << std::endl;
+  };
+  std::cout << "Global position lookup:" << std::endl;
+  run_bench(
+      [&](const Vector3D& position) -> const MaterialProperties& {
+        return full[binUtility.bin(position, 1)][binUtility.bin(position, 0)];
+      },
+      "nested vector");
+  run_bench(
+      [&](const Vector3D& position) -> const MaterialProperties& {
+        return owned.materialProperties(position);
+      },
+      "palette");
+  run_bench(
+      [&](const Vector3D& position) -> const MaterialProperties& {
+        return shared.materialProperties(position);
+      },
+      "shared");
+
+  return 0;
+}
@@ -0,0 +1,103 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include <memory>
+#include <random>
+
+#include "Acts/EventData/MeasurementHelpers.hpp"
+#include "Acts/EventData/MultiTrajectory.hpp"
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Fitter/BatchGainMatrixSmoother.hpp"
+#include "Acts/Fitter/GainMatrixSmoother.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+
+namespace Acts {
+namespace Test {
+
+using Covariance = BoundSymMatrix;
+
+using SourceLink = MinimalSourceLink;
+
+// Create a test context
+GeometryContext tgContext = GeometryContext();
+
+BOOST_AUTO_TEST_CASE(batch_gain_matrix_smoother) {
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<double> locDist(-0.5, 0.5);
+  std::uniform_real_distribution<double> jacDist(-0.05, 0.05);
+
+  // Two identical trajectories, one for the single and one for the batched
+  // smoothing. Each holds several tracks of different lengths.
+  MultiTrajectory<SourceLink> trajSingle;
+  MultiTrajectory<SourceLink> trajBatch;
+  std::vector<size_t> tips;
+  for (size_t itrack = 0; itrack < 8; ++itrack) {
+    size_t nStates = 2 + itrack % 5;
+    size_t iprevious = SIZE_MAX;
+    for (size_t istate = 0; istate < nStates; ++istate) {
+      auto plane = Surface::makeShared<PlaneSurface>(
+          Vector3D::UnitX() * (istate + 1), Vector3D::UnitX());
+
+      Covariance covPred;
+      covPred.setZero();
+      covPred.diagonal() << 0.08, 0.3, 0.01, 0.01, 0.0001, 1;
+      covPred(0, 1) = covPred(1, 0) = 0.01;
+      Covariance covFilt = 0.5 * covPred;
+      BoundVector parPred;
+      parPred << locDist(gen), locDist(gen), 0.5 * M_PI, 0., 0.01, 0.;
+      BoundVector parFilt = parPred;
+      parFilt[eLOC_0] += 0.1 * locDist(gen);
+      parFilt[eLOC_1] += 0.1 * locDist(gen);
+      Covariance jac = Covariance::Identity();
+      jac(0, 2) = jacDist(gen);
+      jac(1, 3) = jacDist(gen);
+
+      size_t index = 0;
+      for (auto* traj : {&trajSingle, &trajBatch}) {
+        index = traj->addTrackState(TrackStatePropMask::All, iprevious);
+        auto ts = traj->getTrackState(index);
+        ts.setReferenceSurface(plane);
+        ts.predicted() = parPred;
+        ts.predictedCovariance() = covPred;
+        ts.filtered() = parFilt;
+        ts.filteredCovariance() = covFilt;
+        ts.jacobian() = jac;
+        ts.pathLength() = istate + 1.;
+      }
+      iprevious = index;
+    }
+    tips.push_back(iprevious);
+  }
+
+  GainMatrixSmoother gms;
+  for (auto tip : tips) {
+    BOOST_CHECK(gms(tgContext, trajSingle, tip).ok());
+  }
+
+  BatchGainMatrixSmoother bgms;
+  BOOST_CHECK(bgms(tgContext, trajBatch, tips).ok());
+
+  double tol = 1e-9;
+  for (auto tip : tips) {
+    trajBatch.visitBackwards(tip, [&](const auto& tsBatch) {
+      auto tsSingle = trajSingle.getTrackState(tsBatch.index());
+      BoundVector parSingle = tsSingle.smoothed();
+      BoundVector parBatch = tsBatch.smoothed();
+      Covariance covSingle = tsSingle.smoothedCovariance();
+      Covariance covBatch = tsBatch.smoothedCovariance();
+      CHECK_CLOSE_ABS(parBatch, parSingle, tol);
+      CHECK_CLOSE_ABS(covBatch, covSingle, tol);
+    });
+  }
+}
+
+}  // namespace Test
+}  // namespace Acts
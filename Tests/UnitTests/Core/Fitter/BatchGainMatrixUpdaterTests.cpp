@@ -0,0 +1,124 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include <memory>
+#include <random>
+
+#include "Acts/EventData/Measurement.hpp"
+#include "Acts/EventData/MeasurementHelpers.hpp"
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Fitter/BatchGainMatrixUpdater.hpp"
+#include "Acts/Fitter/GainMatrixUpdater.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+#include "Acts/Utilities/ParameterDefinitions.hpp"
+
+namespace Acts {
+namespace Test {
+
+using Covariance = BoundSymMatrix;
+
+using SourceLink = MinimalSourceLink;
+
+template <ParID_t... params>
+using MeasurementType = Measurement<SourceLink, params...>;
+
+// Create a test context
+GeometryContext tgContext = GeometryContext();
+
+BOOST_AUTO_TEST_CASE(batch_gain_matrix_updater) {
+  auto plane = Surface::makeShared<PlaneSurface>(Vector3D::UnitX(),
+                                                 Vector3D::UnitX());
+
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<double> locDist(-0.5, 0.5);
+  std::uniform_real_distribution<double> varDist(0.01, 0.1);
+
+  // Measurements with different dimensions
+  std::vector<FittableMeasurement<SourceLink>> measurements;
+  for (size_t i = 0; i < 30; ++i) {
+    switch (i % 3) {
+      case 0: {
+        ActsSymMatrixD<1> cov;
+        cov << varDist(gen);
+        measurements.push_back(MeasurementType<ParDef::eLOC_0>(
+            plane, {}, std::move(cov), locDist(gen)));
+        break;
+      }
+      case 1: {
+        SymMatrix2D cov;
+        cov << varDist(gen), 0.001, 0.001, varDist(gen);
+        measurements.push_back(
+            MeasurementType<ParDef::eLOC_0, ParDef::eLOC_1>(
+                plane, {}, std::move(cov), locDist(gen), locDist(gen)));
+        break;
+      }
+      default: {
+        ActsSymMatrixD<3> cov;
+        cov.setZero();
+        cov.diagonal() << varDist(gen), varDist(gen), 0.0001;
+        measurements.push_back(
+            MeasurementType<ParDef::eLOC_0, ParDef::eLOC_1, ParDef::ePHI>(
+                plane, {}, std::move(cov), locDist(gen), locDist(gen),
+                0.5 * M_PI + 0.1 * locDist(gen)));
+      }
+    }
+  }
+
+  // Two identical trajectories, one for the single and one for the batched
+  // update
+  MultiTrajectory<SourceLink> trajSingle;
+  MultiTrajectory<SourceLink> trajBatch;
+  std::vector<size_t> indices;
+  for (const auto& meas : measurements) {
+    Covariance covTrk;
+    covTrk.setZero();
+    covTrk.diagonal() << 0.08, 0.3, 0.01, 0.01, 0.0001, 1;
+    covTrk(0, 1) = covTrk(1, 0) = 0.01;
+    BoundVector parValues;
+    parValues << locDist(gen), locDist(gen), 0.5 * M_PI, 0.3 * M_PI, 0.01, 0.;
+
+    for (auto* traj : {&trajSingle, &trajBatch}) {
+      size_t index = traj->addTrackState(TrackStatePropMask::All);
+      auto ts = traj->getTrackState(index);
+      ts.uncalibrated() = SourceLink{&meas};
+      std::visit([&](const auto& m) { ts.setCalibrated(m); }, meas);
+      ts.predicted() = parValues;
+      ts.predictedCovariance() = covTrk;
+      if (traj == &trajBatch) {
+        indices.push_back(index);
+      }
+    }
+  }
+
+  GainMatrixUpdater gmu;
+  for (auto index : indices) {
+    BOOST_CHECK(gmu(tgContext, trajSingle.getTrackState(index)).ok());
+  }
+
+  BatchGainMatrixUpdater bgmu;
+  BOOST_CHECK(bgmu(tgContext, trajBatch, indices).ok());
+
+  double tol = 1e-9;
+  for (auto index : indices) {
+    auto tsSingle = trajSingle.getTrackState(index);
+    auto tsBatch = trajBatch.getTrackState(index);
+    BoundVector parSingle = tsSingle.filtered();
+    BoundVector parBatch = tsBatch.filtered();
+    Covariance covSingle = tsSingle.filteredCovariance();
+    Covariance covBatch = tsBatch.filteredCovariance();
+    CHECK_CLOSE_ABS(parBatch, parSingle, tol);
+    CHECK_CLOSE_ABS(covBatch, covSingle, tol);
+    CHECK_CLOSE_REL(tsBatch.chi2(), tsSingle.chi2(), 1e-6);
+  }
+}
+
+}  // namespace Test
+}  // namespace Acts
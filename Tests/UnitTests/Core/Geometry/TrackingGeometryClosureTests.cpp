@@ -179,5 +179,50 @@ BOOST_AUTO_TEST_CASE(TrackingGeometry_testVisitSurfaces) {
   BOOST_CHECK_EQUAL(nSurfaces, 9u);
 }
 
+BOOST_AUTO_TEST_CASE(TrackingGeometry_testGeometryIdLookup) {
+  // every volume can be found by its identifier
+  for (GeometryID::Value ivol = 1; ivol <= 5; ++ivol) {
+    auto vol = tGeometry.findVolume(GeometryID().setVolume(ivol));
+    BOOST_CHECK_NE(vol, nullptr);
+    BOOST_CHECK_EQUAL(vol->geoID().volume(), ivol);
+  }
+  BOOST_CHECK_EQUAL(tGeometry.findVolume(GeometryID().setVolume(6)), nullptr);
+
+  // every sensitive surface has a contiguous ordinal
+  std::vector<const Surface*> visited;
+  tGeometry.visitSurfaces([&](const Surface* srf) { visited.push_back(srf); });
+  BOOST_CHECK_EQUAL(tGeometry.sensitiveSurfaces().size(), visited.size());
+  std::vector<bool> used(visited.size(), false);
+  for (const Surface* srf : visited) {
+    BOOST_CHECK_EQUAL(tGeometry.findSurface(srf->geoID()), srf);
+    size_t ordinal = tGeometry.surfaceOrdinal(srf->geoID());
+    BOOST_REQUIRE_LT(ordinal, visited.size());
+    BOOST_CHECK(not used[ordinal]);
+    used[ordinal] = true;
+    BOOST_CHECK_EQUAL(tGeometry.sensitiveSurfaces()[ordinal], srf);
+    // the layer is found from the surface identifier
+    auto lay = tGeometry.findLayer(srf->geoID());
+    BOOST_CHECK_NE(lay, nullptr);
+    BOOST_CHECK_EQUAL(lay->geoID().layer(), srf->geoID().layer());
+  }
+  // ordinals are ordered by identifier
+  const auto& surfaces = tGeometry.sensitiveSurfaces();
+  for (size_t i = 1; i < surfaces.size(); ++i) {
+    BOOST_CHECK_LT(surfaces[i - 1]->geoID(), surfaces[i]->geoID());
+  }
+
+  // non-sensitive and unknown identifiers are rejected
+  auto layerId = visited.front()->geoID();
+  layerId.setSensitive(0);
+  BOOST_CHECK_EQUAL(tGeometry.findSurface(layerId), nullptr);
+  BOOST_CHECK_EQUAL(tGeometry.surfaceOrdinal(layerId), SIZE_MAX);
+  auto unknownId = visited.front()->geoID();
+  unknownId.setSensitive(1000);
+  BOOST_CHECK_EQUAL(tGeometry.findSurface(unknownId), nullptr);
+  unknownId.setSensitive(1).setLayer(100);
+  BOOST_CHECK_EQUAL(tGeometry.findSurface(unknownId), nullptr);
+  BOOST_CHECK_EQUAL(tGeometry.findLayer(unknownId), nullptr);
+}
+
 }  //  end of namespace Test
 }  //  end of namespace Acts
@@ -0,0 +1,318 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include <sstream>
+#include <stdexcept>
+
+#include "Acts/Geometry/AbstractVolume.hpp"
+#include "Acts/Geometry/ApproachDescriptor.hpp"
+#include "Acts/Geometry/CuboidVolumeBounds.hpp"
+#include "Acts/Geometry/DetectorElementBase.hpp"
+#include "Acts/Geometry/TrackingGeometry.hpp"
+#include "Acts/Geometry/TrackingGeometrySnapshot.hpp"
+#include "Acts/Geometry/TrackingVolume.hpp"
+#include "Acts/Propagator/Navigator.hpp"
+#include "Acts/Surfaces/SurfaceArray.hpp"
+#include "Acts/Tests/CommonHelpers/CubicTrackingGeometry.hpp"
+#include "Acts/Tests/CommonHelpers/CylindricalTrackingGeometry.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+#include "Acts/Utilities/BoundingBox.hpp"
+
+namespace Acts {
+namespace Test {
+
+// Create a test context
+GeometryContext tgContext = GeometryContext();
+
+void checkSurface(const Surface& original, const Surface& restored) {
+  BOOST_CHECK_EQUAL(original.geoID(), restored.geoID());
+  BOOST_CHECK_EQUAL(original.type(), restored.type());
+  BOOST_CHECK(original.transform(tgContext).isApprox(
+      restored.transform(tgContext)));
+  BOOST_CHECK_EQUAL(original.bounds().type(), restored.bounds().type());
+  auto oValues = original.bounds().values();
+  auto rValues = restored.bounds().values();
+  BOOST_CHECK_EQUAL_COLLECTIONS(oValues.begin(), oValues.end(),
+                                rValues.begin(), rValues.end());
+  // sensitive surfaces stay sensitive
+  const DetectorElementBase* oElement = original.associatedDetectorElement();
+  const DetectorElementBase* rElement = restored.associatedDetectorElement();
+  BOOST_CHECK_EQUAL(oElement != nullptr, rElement != nullptr);
+  if (oElement != nullptr and rElement != nullptr) {
+    CHECK_CLOSE_ABS(oElement->thickness(), rElement->thickness(), 1e-12);
+    BOOST_CHECK_EQUAL(&rElement->surface(), &restored);
+  }
+  BOOST_CHECK_EQUAL(original.surfaceMaterial() != nullptr,
+                    restored.surfaceMaterial() != nullptr);
+  if (original.surfaceMaterial() != nullptr and
+      restored.surfaceMaterial() != nullptr) {
+    BOOST_CHECK_EQUAL(original.surfaceMaterial()->materialProperties(0, 0),
+                      restored.surfaceMaterial()->materialProperties(0, 0));
+  }
+}
+
+void checkLayer(const Layer& original, const Layer& restored) {
+  BOOST_CHECK_EQUAL(original.geoID(), restored.geoID());
+  BOOST_CHECK_EQUAL(original.layerType(), restored.layerType());
+  CHECK_CLOSE_ABS(original.thickness(), restored.thickness(), 1e-12);
+  checkSurface(original.surfaceRepresentation(),
+               restored.surfaceRepresentation());
+
+  BOOST_CHECK_EQUAL(original.approachDescriptor() != nullptr,
+                    restored.approachDescriptor() != nullptr);
+  if (original.approachDescriptor() != nullptr) {
+    const auto& oApproach = original.approachDescriptor()->containedSurfaces();
+    const auto& rApproach = restored.approachDescriptor()->containedSurfaces();
+    BOOST_CHECK_EQUAL(oApproach.size(), rApproach.size());
+    for (size_t is = 0; is < oApproach.size(); ++is) {
+      checkSurface(*oApproach[is], *rApproach[is]);
+    }
+  }
+
+  const SurfaceArray* oArray = original.surfaceArray();
+  const SurfaceArray* rArray = restored.surfaceArray();
+  BOOST_CHECK_EQUAL(oArray != nullptr, rArray != nullptr);
+  if (oArray == nullptr or rArray == nullptr) {
+    return;
+  }
+  BOOST_CHECK_EQUAL(oArray->surfaces().size(), rArray->surfaces().size());
+  for (size_t is = 0; is < oArray->surfaces().size(); ++is) {
+    checkSurface(*oArray->surfaces()[is], *rArray->surfaces()[is]);
+  }
+  BOOST_CHECK_EQUAL(oArray->size(), rArray->size());
+  for (size_t bin = 0; bin < oArray->size(); ++bin) {
+    if (not oArray->isValidBin(bin)) {
+      continue;
+    }
+    // the lookup from the bin center and the neighbors are identical
+    const Vector3D center = oArray->getBinCenter(bin);
+    BOOST_CHECK(center.isApprox(rArray->getBinCenter(bin)));
+    const auto& oContent = oArray->at(center);
+    const auto& rContent = rArray->at(center);
+    BOOST_CHECK_EQUAL(oContent.size(), rContent.size());
+    for (size_t is = 0; is < oContent.size(); ++is) {
+      BOOST_CHECK_EQUAL(oContent[is]->geoID(), rContent[is]->geoID());
+    }
+    BOOST_CHECK_EQUAL(oArray->neighbors(center).size(),
+                      rArray->neighbors(center).size());
+  }
+}
+
+void checkVolume(const TrackingVolume& original,
+                 const TrackingVolume& restored) {
+  BOOST_CHECK_EQUAL(original.volumeName(), restored.volumeName());
+  BOOST_CHECK_EQUAL(original.geoID(), restored.geoID());
+  BOOST_CHECK(original.transform().isApprox(restored.transform()));
+  BOOST_CHECK_EQUAL(original.volumeBounds().type(),
+                    restored.volumeBounds().type());
+  BOOST_CHECK_EQUAL(original.colorCode(), restored.colorCode());
+
+  const auto& oBoundaries = original.boundarySurfaces();
+  const auto& rBoundaries = restored.boundarySurfaces();
+  BOOST_CHECK_EQUAL(oBoundaries.size(), rBoundaries.size());
+  for (size_t ib = 0; ib < oBoundaries.size(); ++ib) {
+    checkSurface(oBoundaries[ib]->surfaceRepresentation(),
+                 rBoundaries[ib]->surfaceRepresentation());
+    for (auto navDir : {backward, forward}) {
+      const TrackingVolume* oAttached = oBoundaries[ib]->attachedVolume(navDir);
+      const TrackingVolume* rAttached = rBoundaries[ib]->attachedVolume(navDir);
+      BOOST_CHECK_EQUAL(oAttached != nullptr, rAttached != nullptr);
+      if (oAttached != nullptr and rAttached != nullptr) {
+        BOOST_CHECK_EQUAL(oAttached->geoID(), rAttached->geoID());
+      }
+      BOOST_CHECK_EQUAL(
+          oBoundaries[ib]->attachedVolumeArray(navDir) != nullptr,
+          rBoundaries[ib]->attachedVolumeArray(navDir) != nullptr);
+    }
+  }
+
+  BOOST_CHECK_EQUAL(original.confinedLayers() != nullptr,
+                    restored.confinedLayers() != nullptr);
+  if (original.confinedLayers() != nullptr) {
+    const auto& oLayers = original.confinedLayers()->arrayObjects();
+    const auto& rLayers = restored.confinedLayers()->arrayObjects();
+    BOOST_CHECK_EQUAL(oLayers.size(), rLayers.size());
+    for (size_t il = 0; il < oLayers.size(); ++il) {
+      checkLayer(*oLayers[il], *rLayers[il]);
+    }
+  }
+
+  BOOST_CHECK_EQUAL(original.confinedVolumes() != nullptr,
+                    restored.confinedVolumes() != nullptr);
+  if (original.confinedVolumes() != nullptr) {
+    const auto& oVolumes = original.confinedVolumes()->arrayObjects();
+    const auto& rVolumes = restored.confinedVolumes()->arrayObjects();
+    BOOST_CHECK_EQUAL(oVolumes.size(), rVolumes.size());
+    for (size_t iv = 0; iv < oVolumes.size(); ++iv) {
+      checkVolume(*oVolumes[iv], *rVolumes[iv]);
+    }
+  }
+}
+
+/// Write and read back a geometry, check the restored object graph and the
+/// navigation lookups at a set of positions
+void checkRoundTrip(const TrackingGeometry& original,
+                    const std::vector<Vector3D>& positions) {
+  std::stringstream snapshot;
+  writeTrackingGeometrySnapshot(tgContext, original, snapshot);
+  auto restored = readTrackingGeometrySnapshot(snapshot);
+  BOOST_REQUIRE(restored != nullptr);
+
+  checkVolume(*original.highestTrackingVolume(),
+              *restored->highestTrackingVolume());
+
+  for (const auto& position : positions) {
+    auto oVolume = original.lowestTrackingVolume(tgContext, position);
+    auto rVolume = restored->lowestTrackingVolume(tgContext, position);
+    BOOST_REQUIRE(oVolume != nullptr);
+    BOOST_REQUIRE(rVolume != nullptr);
+    BOOST_CHECK_EQUAL(oVolume->geoID(), rVolume->geoID());
+    auto oLayer = oVolume->associatedLayer(tgContext, position);
+    auto rLayer = rVolume->associatedLayer(tgContext, position);
+    BOOST_CHECK_EQUAL(oLayer != nullptr, rLayer != nullptr);
+    if (oLayer != nullptr and rLayer != nullptr) {
+      BOOST_CHECK_EQUAL(oLayer->geoID(), rLayer->geoID());
+    }
+  }
+
+  // the identifier lookup is rebuilt as well
+  original.visitSurfaces([&](const Surface* surface) {
+    auto rSurface = restored->findSurface(surface->geoID());
+    BOOST_CHECK(rSurface != nullptr);
+  });
+}
+
+BOOST_AUTO_TEST_CASE(TrackingGeometrySnapshot_Cylindrical) {
+  CylindricalTrackingGeometry cGeometry(tgContext);
+  auto tGeometry = cGeometry();
+
+  std::vector<Vector3D> positions;
+  for (double r : {0., 15., 33., 75., 120., 200.}) {
+    for (double z : {-500., -100., 0., 250.}) {
+      for (double phi : {-3., -0.5, 1., 2.5}) {
+        positions.emplace_back(r * std::cos(phi), r * std::sin(phi), z);
+      }
+    }
+  }
+  checkRoundTrip(*tGeometry, positions);
+}
+
+BOOST_AUTO_TEST_CASE(TrackingGeometrySnapshot_Cubic) {
+  CubicTrackingGeometry cGeometry(tgContext);
+  auto tGeometry = cGeometry();
+
+  std::vector<Vector3D> positions;
+  for (double x : {-1.5, -0.5, 0.5, 1.5}) {
+    for (double y : {-0.4, 0., 0.4}) {
+      positions.emplace_back(x * UnitConstants::m, y * UnitConstants::m, 0.);
+    }
+  }
+  checkRoundTrip(*tGeometry, positions);
+}
+
+BOOST_AUTO_TEST_CASE(TrackingGeometrySnapshot_BoundingVolumeHierarchy) {
+  using Box = Volume::BoundingBox;
+
+  // a small grid of boxes in an octree
+  auto vBounds = std::make_shared<const CuboidVolumeBounds>(10., 10., 10.);
+  std::vector<std::unique_ptr<const Volume>> volumes;
+  std::vector<std::unique_ptr<Box>> boxStore;
+  std::vector<Box*> boxes;
+  for (double x : {-100., 0., 100.}) {
+    for (double y : {-100., 0., 100.}) {
+      for (double z : {-100., 0., 100.}) {
+        auto transform =
+            std::make_shared<const Transform3D>(Translation3D(x, y, z));
+        volumes.push_back(std::make_unique<AbstractVolume>(transform, vBounds));
+        boxStore.push_back(
+            std::make_unique<Box>(volumes.back()->boundingBox()));
+        boxes.push_back(boxStore.back().get());
+      }
+    }
+  }
+  Box* top = make_octree(boxStore, boxes, 2, 0.5);
+  auto tVolume = TrackingVolume::create(
+      std::make_shared<const Transform3D>(Transform3D::Identity()),
+      std::make_shared<const CuboidVolumeBounds>(200., 200., 200.),
+      std::move(boxStore), std::move(volumes), top, nullptr, "BVH");
+  TrackingGeometry tGeometry(tVolume);
+
+  std::stringstream snapshot;
+  writeTrackingGeometrySnapshot(tgContext, tGeometry, snapshot);
+  auto restored = readTrackingGeometrySnapshot(snapshot);
+  BOOST_REQUIRE(restored != nullptr);
+  const TrackingVolume* oVolume = tGeometry.highestTrackingVolume();
+  const TrackingVolume* rVolume = restored->highestTrackingVolume();
+  checkVolume(*oVolume, *rVolume);
+  BOOST_REQUIRE(rVolume->hasBoundingVolumeHierarchy());
+  BOOST_CHECK_EQUAL(oVolume->descendantVolumes().size(),
+                    rVolume->descendantVolumes().size());
+  CHECK_CLOSE_ABS(oVolume->boundingVolumeHierarchy()->min(),
+                  rVolume->boundingVolumeHierarchy()->min(), 1e-9);
+  CHECK_CLOSE_ABS(oVolume->boundingVolumeHierarchy()->max(),
+                  rVolume->boundingVolumeHierarchy()->max(), 1e-9);
+
+  // the hierarchy finds the same surfaces
+  NavigationOptions<Surface> options(forward, true);
+  size_t nHits = 0;
+  for (double phi : {-2.5, -1., 0.3, 0.8, 2.}) {
+    for (double dz : {-0.5, 0., 0.2}) {
+      const Vector3D position(-150., 20. * phi, 5.);
+      const Vector3D direction =
+          Vector3D(std::cos(phi), std::sin(phi), dz).normalized();
+      auto oHits = oVolume->compatibleSurfacesFromHierarchy(
+          tgContext, position, direction, 0., options);
+      auto rHits = rVolume->compatibleSurfacesFromHierarchy(
+          tgContext, position, direction, 0., options);
+      BOOST_REQUIRE_EQUAL(oHits.size(), rHits.size());
+      nHits += oHits.size();
+      for (size_t ih = 0; ih < oHits.size(); ++ih) {
+        BOOST_CHECK_EQUAL(oHits[ih].object->geoID(),
+                          rHits[ih].object->geoID());
+        CHECK_CLOSE_ABS(oHits[ih].intersection.pathLength,
+                        rHits[ih].intersection.pathLength, 1e-9);
+      }
+    }
+  }
+  BOOST_CHECK_GT(nHits, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(TrackingGeometrySnapshot_InvalidInput) {
+  std::stringstream garbage("this is not a tracking geometry snapshot");
+  BOOST_CHECK_THROW(readTrackingGeometrySnapshot(garbage), std::runtime_error);
+
+  CubicTrackingGeometry cGeometry(tgContext);
+  auto tGeometry = cGeometry();
+  std::stringstream snapshot;
+  writeTrackingGeometrySnapshot(tgContext, *tGeometry, snapshot);
+  const std::string content = snapshot.str();
+
+  // truncated input
+  std::stringstream truncated(content.substr(0, content.size() / 2));
+  BOOST_CHECK_THROW(readTrackingGeometrySnapshot(truncated),
+                    std::runtime_error);
+
+  // different format version
+  std::string versioned = content;
+  versioned[8] = static_cast<char>(versioned[8] + 1);
+  std::stringstream wrongVersion(versioned);
+  BOOST_CHECK_THROW(readTrackingGeometrySnapshot(wrongVersion),
+                    std::runtime_error);
+
+  // corrupted count of the surface material table right after the header
+  std::string counted = content;
+  counted[27] = static_cast<char>(0x7f);
+  std::stringstream wrongCount(counted);
+  BOOST_CHECK_THROW(readTrackingGeometrySnapshot(wrongCount),
+                    std::runtime_error);
+}
+
+}  // namespace Test
+}  // namespace Acts
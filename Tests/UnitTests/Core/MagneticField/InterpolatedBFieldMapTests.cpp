@@ -10,6 +10,7 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include "Acts/MagneticField/BFieldMapUtils.hpp"
 #include "Acts/MagneticField/InterpolatedBFieldMap.hpp"
 #include "Acts/MagneticField/MagneticFieldContext.hpp"
 #include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
@@ -113,6 +114,54 @@ BOOST_AUTO_TEST_CASE(InterpolatedBFieldMap_rz) {
   BOOST_CHECK(not c.isInside((pos << 0, 2, -4.7).finished()));
   BOOST_CHECK(not c.isInside((pos << 5, 2, 14.).finished()));
 }
+
+BOOST_AUTO_TEST_CASE(InterpolatedBFieldMap_xyz_single_precision) {
+  // field values linear in x, y and z so interpolation should be exact
+  auto value = [](double x, double y, double z) {
+    return Vector3D(x * 0.5 + y, 2 - z, x * y * 0.1 + 1);
+  };
+  auto localToGlobalBin = [](std::array<size_t, 3> bins,
+                             std::array<size_t, 3> sizes) {
+    return (bins[0] * (sizes[1] * sizes[2]) + bins[1] * sizes[2] + bins[2]);
+  };
+
+  std::vector<double> xPos = {-2., 0., 2., 4.};
+  std::vector<double> yPos = {-1., 1., 3.};
+  std::vector<double> zPos = {0., 5., 10.};
+  std::vector<Vector3D> bFieldD;
+  std::vector<Vector3F> bFieldF;
+  for (double x : xPos) {
+    for (double y : yPos) {
+      for (double z : zPos) {
+        bFieldD.push_back(value(x, y, z));
+        bFieldF.push_back(value(x, y, z).cast<float>());
+      }
+    }
+  }
+
+  using MapperD_t = decltype(fieldMapperXYZ(localToGlobalBin, xPos, yPos, zPos,
+                                            bFieldD));
+  using MapperF_t = decltype(fieldMapperXYZ(localToGlobalBin, xPos, yPos, zPos,
+                                            bFieldF));
+  static_assert(
+      std::is_same_v<typename MapperF_t::FieldType, Vector3F>,
+      "Single precision field map must store single precision values");
+
+  InterpolatedBFieldMap<MapperD_t>::Config cfgD(
+      fieldMapperXYZ(localToGlobalBin, xPos, yPos, zPos, bFieldD));
+  InterpolatedBFieldMap<MapperF_t>::Config cfgF(
+      fieldMapperXYZ(localToGlobalBin, xPos, yPos, zPos, bFieldF));
+  InterpolatedBFieldMap<MapperD_t> bD(std::move(cfgD));
+  InterpolatedBFieldMap<MapperF_t> bF(std::move(cfgF));
+
+  for (const Vector3D& pos :
+       {Vector3D(0.3, 0.2, 1.1), Vector3D(-1.5, 2.5, 7.), Vector3D(3., -.5, 9.)}) {
+    InterpolatedBFieldMap<MapperD_t>::Cache cacheD(mfContext);
+    InterpolatedBFieldMap<MapperF_t>::Cache cacheF(mfContext);
+    CHECK_CLOSE_REL(bD.getField(pos), bF.getField(pos), 1e-6);
+    CHECK_CLOSE_REL(bD.getField(pos, cacheD), bF.getField(pos, cacheF), 1e-6);
+  }
+}
 }  // namespace Test
 
 }  // namespace Acts
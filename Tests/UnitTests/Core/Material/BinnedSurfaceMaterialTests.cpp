@@ -9,6 +9,9 @@
 #include <boost/test/unit_test.hpp>
 
 #include <climits>
+#include <memory>
+#include <stdexcept>
+#include <vector>
 
 #include "Acts/Material/BinnedSurfaceMaterial.hpp"
 #include "Acts/Material/Material.hpp"
@@ -57,5 +60,97 @@ BOOST_AUTO_TEST_CASE(BinnedSurfaceMaterial_construction_test) {
   BinnedSurfaceMaterial bsmMoveAssigned(std::move(bsmAssigned));
 }
 
+/// Test referencing shared properties storage
+BOOST_AUTO_TEST_CASE(BinnedSurfaceMaterial_shared_test) {
+  BinUtility xyBinning(2, -1., 1., open, binX);
+  xyBinning += BinUtility(3, -3., 3., open, binY);
+
+  // external storage with the first bin running fastest
+  auto storage = std::make_shared<std::vector<MaterialProperties>>();
+  MaterialPropertiesMatrix m(3);
+  for (size_t bin1 = 0; bin1 < 3; ++bin1) {
+    for (size_t bin0 = 0; bin0 < 2; ++bin0) {
+      MaterialProperties mp(1. + bin0, 2. + bin1, 3., 4., 5., 1. + bin0);
+      storage->push_back(mp);
+      m[bin1].push_back(mp);
+    }
+  }
+  std::shared_ptr<const MaterialProperties> shared(storage,
+                                                   storage->data());
+  BinnedSurfaceMaterial bsmShared(xyBinning, shared, 0.5);
+  BinnedSurfaceMaterial bsmOwned(xyBinning, m, 0.5);
+
+  BOOST_CHECK(bsmShared.isShared());
+  BOOST_CHECK(not bsmOwned.isShared());
+  BOOST_CHECK(bsmShared.palette().empty());
+  BOOST_CHECK(bsmShared.fullMaterial() == m);
+  for (size_t bin1 = 0; bin1 < 3; ++bin1) {
+    for (size_t bin0 = 0; bin0 < 2; ++bin0) {
+      // no copy is taken
+      BOOST_CHECK_EQUAL(&bsmShared.materialProperties(bin0, bin1),
+                        storage->data() + bin1 * 2 + bin0);
+      BOOST_CHECK_EQUAL(bsmShared.materialProperties(bin0, bin1),
+                        bsmOwned.materialProperties(bin0, bin1));
+    }
+  }
+  Vector2D lp(0.5, -2.5);
+  BOOST_CHECK_EQUAL(bsmShared.materialProperties(lp),
+                    bsmOwned.materialProperties(lp));
+
+  // scaling takes a copy and leaves the external storage untouched
+  bsmShared *= 2.;
+  bsmOwned *= 2.;
+  BOOST_CHECK(not bsmShared.isShared());
+  BOOST_CHECK_EQUAL(bsmShared.materialProperties(1, 2),
+                    bsmOwned.materialProperties(1, 2));
+  BOOST_CHECK_EQUAL((*storage)[5].thickness(), 2.f);
+}
+
+/// Test the deduplication of owned properties
+BOOST_AUTO_TEST_CASE(BinnedSurfaceMaterial_palette_test) {
+  BinUtility xyBinning(4, -1., 1., open, binX);
+  xyBinning += BinUtility(3, -3., 3., open, binY);
+
+  MaterialProperties vacuum;
+  MaterialProperties silicon(95., 465., 28., 14., 2.3e-3, 0.3);
+  MaterialProperties support(400., 900., 12., 6., 1.7e-3, 2.);
+  MaterialPropertiesMatrix m(3, MaterialPropertiesVector(4, vacuum));
+  m[0][1] = silicon;
+  m[1][1] = silicon;
+  m[1][2] = silicon;
+  m[2][3] = support;
+
+  BinnedSurfaceMaterial bsm(xyBinning, m);
+  BOOST_CHECK(not bsm.isShared());
+  BOOST_CHECK_EQUAL(bsm.palette().size(), 3u);
+  BOOST_CHECK(bsm.fullMaterial() == m);
+  for (size_t bin1 = 0; bin1 < 3; ++bin1) {
+    for (size_t bin0 = 0; bin0 < 4; ++bin0) {
+      BOOST_CHECK_EQUAL(bsm.materialProperties(bin0, bin1), m[bin1][bin0]);
+    }
+  }
+  // identical bins share a single palette entry
+  BOOST_CHECK_EQUAL(&bsm.materialProperties(1, 0),
+                    &bsm.materialProperties(2, 1));
+
+  // one-dimensional binning
+  BinnedSurfaceMaterial bsm1D(BinUtility(4, -1., 1., open, binX), m[1]);
+  BOOST_CHECK_EQUAL(bsm1D.palette().size(), 2u);
+  BOOST_CHECK_EQUAL(bsm1D.materialProperties(Vector2D(-0.1, 0.)), silicon);
+  BOOST_CHECK_EQUAL(bsm1D.materialProperties(Vector2D(0.9, 0.)), vacuum);
+
+  // scaling applies to all bins
+  bsm *= 0.5;
+  MaterialProperties halfSilicon = silicon;
+  halfSilicon.scaleThickness(0.5);
+  BOOST_CHECK_EQUAL(bsm.materialProperties(1, 1), halfSilicon);
+  BOOST_CHECK_EQUAL(bsm.materialProperties(2, 1), halfSilicon);
+
+  // rows must have the same number of bins
+  m[2].pop_back();
+  BOOST_CHECK_THROW(BinnedSurfaceMaterial(xyBinning, m),
+                    std::invalid_argument);
+}
+
 }  // namespace Test
 }  // namespace Acts
@@ -0,0 +1,128 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/data/test_case.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/MagneticField/ConstantBField.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Propagator/RiddersPropagator.hpp"
+#include "Acts/Propagator/StraightLineStepper.hpp"
+#include "Acts/Propagator/detail/AnalyticalTransport.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+#include "Acts/Utilities/Units.hpp"
+
+namespace bdata = boost::unit_test::data;
+using namespace Acts::UnitLiterals;
+
+namespace Acts {
+namespace Test {
+
+using Covariance = BoundSymMatrix;
+using EigenPropagatorType = Propagator<EigenStepper<ConstantBField>>;
+using StraightPropagatorType = Propagator<StraightLineStepper>;
+
+// Create a test context
+GeometryContext tgContext = GeometryContext();
+MagneticFieldContext mfContext = MagneticFieldContext();
+
+/// Propagate curvilinear start parameters with a covariance over a given path
+/// and return the covariance at the end.
+template <typename propagator_t>
+Covariance propagateCovariance(const propagator_t& propagator, double pT,
+                               double phi, double theta, double charge,
+                               double pathLimit) {
+  PropagatorOptions<> options(tgContext, mfContext);
+  options.maxStepSize = 0.1 * pathLimit;
+  options.pathLimit = pathLimit;
+  options.tolerance = 1e-9;
+
+  Vector3D pos(1., 0., 0.);
+  Vector3D mom(pT * std::cos(phi), pT * std::sin(phi), pT / std::tan(theta));
+
+  Covariance cov;
+  // take some major correlations (off-diagonals)
+  // clang-format off
+  cov <<
+   10_mm, 0, 0.123, 0, 0.5, 0,
+   0, 10_mm, 0, 0.162, 0, 0,
+   0.123, 0, 0.1, 0, 0, 0,
+   0, 0.162, 0, 0.1, 0, 0,
+   0.5, 0, 0, 0, 1_e / 10_GeV, 0,
+   0, 0, 0, 0, 0, 1_us;
+  // clang-format on
+  CurvilinearParameters start(cov, pos, mom, charge, 0.);
+
+  const auto result = propagator.propagate(start, options).value();
+  return *(result.endParameters->covariance());
+}
+
+BOOST_AUTO_TEST_SUITE(AnalyticalTransport)
+
+BOOST_AUTO_TEST_CASE(analytical_transport_zero_field) {
+  FreeMatrix jacobian = FreeMatrix::Identity();
+  jacobian(2, 5) = 0.5;
+  jacobian(6, 7) = -0.25;
+  FreeMatrix jacobianHelix = jacobian;
+
+  detail::transportStraightLine(jacobian, 12_mm, 0.1);
+  detail::transportHelix(jacobianHelix, Vector3D(0., 0.6, 0.8), 1_e / 1_GeV,
+                         Vector3D::Zero(), 12_mm, 0.1);
+  BOOST_CHECK(jacobian.isApprox(jacobianHelix));
+  // The straight line step only moves the position along the direction
+  CHECK_CLOSE_ABS(jacobian(0, 4), 12_mm, 1e-12);
+  CHECK_CLOSE_ABS(jacobian(2, 5), 0.5, 1e-12);
+  CHECK_CLOSE_ABS(jacobian(2, 7), -0.25 * 12_mm, 1e-12);
+  CHECK_CLOSE_ABS(jacobian(3, 7), 0.1, 1e-12);
+}
+
+BOOST_AUTO_TEST_CASE(analytical_transport_small_angle_continuity) {
+  // Turning angles just below and above the switch to the series expansion
+  // must give continuous results
+  const Vector3D direction = Vector3D(1., 0.5, 0.2).normalized();
+  const Vector3D bField(0., 0., 2_T);
+  const double qop = 1_e / 1_GeV;
+  const double hSwitch = 0.1 / (std::abs(qop) * bField.norm());
+
+  FreeMatrix below = FreeMatrix::Identity();
+  FreeMatrix above = FreeMatrix::Identity();
+  detail::transportHelix(below, direction, qop, bField, 0.999999 * hSwitch, 0.);
+  detail::transportHelix(above, direction, qop, bField, 1.000001 * hSwitch, 0.);
+  BOOST_CHECK(below.isApprox(above, 1e-5));
+}
+
+BOOST_DATA_TEST_CASE(
+    analytical_transport_vs_ridders,
+    bdata::make({0.5_GeV, 2_GeV, 10_GeV}) *
+        bdata::make({-135_degree, 20_degree, 90_degree}) *
+        bdata::make({30_degree, 80_degree}) * bdata::make({1_e, -1_e}),
+    pT, phi, theta, charge) {
+  // Constant field eigen stepper
+  EigenPropagatorType epropagator(
+      EigenStepper<ConstantBField>(ConstantBField(0., 0., 2_T)));
+  RiddersPropagator<EigenPropagatorType> repropagator(epropagator);
+  CHECK_CLOSE_COVARIANCE(
+      propagateCovariance(repropagator, pT, phi, theta, charge, 50_cm),
+      propagateCovariance(epropagator, pT, phi, theta, charge, 50_cm), 1e-3);
+
+  // Straight line stepper
+  StraightPropagatorType spropagator(StraightLineStepper{});
+  RiddersPropagator<StraightPropagatorType> rspropagator(spropagator);
+  CHECK_CLOSE_COVARIANCE(
+      propagateCovariance(rspropagator, pT, phi, theta, charge, 50_cm),
+      propagateCovariance(spropagator, pT, phi, theta, charge, 50_cm), 1e-3);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Test
+}  // namespace Acts
@@ -0,0 +1,155 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/data/test_case.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/MagneticField/BFieldMapUtils.hpp"
+#include "Acts/MagneticField/ConstantBField.hpp"
+#include "Acts/MagneticField/InterpolatedBFieldMap.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/MixedPrecisionEigenStepper.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+#include "Acts/Utilities/Units.hpp"
+
+namespace bdata = boost::unit_test::data;
+using namespace Acts::UnitLiterals;
+
+namespace Acts {
+namespace Test {
+
+using Covariance = BoundSymMatrix;
+
+// Create a test context
+GeometryContext tgContext = GeometryContext();
+MagneticFieldContext mfContext = MagneticFieldContext();
+
+/// Build a field map with a slowly varying field in the given precision
+template <typename value_t>
+auto makeFieldMap() {
+  auto localToGlobalBin = [](std::array<size_t, 3> bins,
+                             std::array<size_t, 3> sizes) {
+    return (bins[0] * (sizes[1] * sizes[2]) + bins[1] * sizes[2] + bins[2]);
+  };
+  std::vector<double> xyzPos = {-3_m, -1.5_m, 0_m, 1.5_m, 3_m};
+  std::vector<value_t> bField;
+  for (double x : xyzPos) {
+    for (double y : xyzPos) {
+      for (double z : xyzPos) {
+        // field values are given in Tesla
+        Vector3D b(0.05 * x / 1_m, -0.05 * y / 1_m, 2. - 0.1 * z / 1_m);
+        bField.push_back(b.template cast<typename value_t::Scalar>());
+      }
+    }
+  }
+  auto mapper =
+      fieldMapperXYZ(localToGlobalBin, xyzPos, xyzPos, xyzPos, bField, 1_mm);
+  using BField_t = InterpolatedBFieldMap<decltype(mapper)>;
+  typename BField_t::Config cfg(std::move(mapper));
+  return BField_t(std::move(cfg));
+}
+
+/// Propagate curvilinear start parameters with a covariance over a given path
+/// and return the end parameters.
+template <typename stepper_t>
+CurvilinearParameters propagate(stepper_t stepper, double pT, double phi,
+                                double theta, double charge,
+                                double pathLimit) {
+  Propagator<stepper_t> propagator(std::move(stepper));
+  PropagatorOptions<> options(tgContext, mfContext);
+  options.maxStepSize = 10_cm;
+  options.pathLimit = pathLimit;
+  options.tolerance = 1e-4;
+
+  Vector3D pos(0., 0., 0.);
+  Vector3D mom(pT * std::cos(phi), pT * std::sin(phi), pT / std::tan(theta));
+
+  Covariance cov;
+  // take some major correlations (off-diagonals)
+  // clang-format off
+  cov <<
+   10_mm, 0, 0.123, 0, 0.5, 0,
+   0, 10_mm, 0, 0.162, 0, 0,
+   0.123, 0, 0.1, 0, 0, 0,
+   0, 0.162, 0, 0.1, 0, 0,
+   0.5, 0, 0, 0, 1_e / 10_GeV, 0,
+   0, 0, 0, 0, 0, 1_us;
+  // clang-format on
+  CurvilinearParameters start(cov, pos, mom, charge, 0.);
+
+  const auto result = propagator.propagate(start, options).value();
+  return *result.endParameters;
+}
+
+/// Check that two end parameters agree within the single precision budget
+void checkEndParameters(const CurvilinearParameters& ref,
+                        const CurvilinearParameters& test, double pathLimit) {
+  // the accumulated rounding of the step increments stays well below the
+  // integration tolerance
+  BOOST_CHECK_LT((ref.position() - test.position()).norm(), 1e-5 * pathLimit);
+  BOOST_CHECK_LT((ref.momentum().normalized() - test.momentum().normalized())
+                     .norm(),
+                 1e-5);
+  CHECK_CLOSE_REL(ref.momentum().norm(), test.momentum().norm(), 1e-12);
+  CHECK_CLOSE_COVARIANCE(*ref.covariance(), *test.covariance(), 1e-3);
+}
+
+BOOST_AUTO_TEST_SUITE(MixedPrecisionEigenStepperTests)
+
+BOOST_DATA_TEST_CASE(mixed_precision_constant_field,
+                     bdata::make({0.5_GeV, 2_GeV, 10_GeV}) *
+                         bdata::make({-135_degree, 20_degree}) *
+                         bdata::make({30_degree, 80_degree}) *
+                         bdata::make({1_e, -1_e}),
+                     pT, phi, theta, charge) {
+  ConstantBField bField(0., 0., 2_T);
+  const double pathLimit = 1_m;
+  const auto ref = propagate(EigenStepper<ConstantBField>(bField), pT, phi,
+                             theta, charge, pathLimit);
+  const auto test = propagate(MixedPrecisionEigenStepper<ConstantBField>(bField),
+                              pT, phi, theta, charge, pathLimit);
+  checkEndParameters(ref, test, pathLimit);
+}
+
+BOOST_DATA_TEST_CASE(mixed_precision_field_map,
+                     bdata::make({0.5_GeV, 2_GeV, 10_GeV}) *
+                         bdata::make({-135_degree, 20_degree}) *
+                         bdata::make({30_degree, 80_degree}) *
+                         bdata::make({1_e, -1_e}),
+                     pT, phi, theta, charge) {
+  // Double precision reference stepper and field map
+  auto bFieldD = makeFieldMap<Vector3D>();
+  // Single precision stepper and field map
+  auto bFieldF = makeFieldMap<Vector3F>();
+  using BFieldD = decltype(bFieldD);
+  using BFieldF = decltype(bFieldF);
+
+  const double pathLimit = 1_m;
+  const auto ref = propagate(EigenStepper<BFieldD>(bFieldD), pT, phi, theta,
+                             charge, pathLimit);
+  const auto test = propagate(MixedPrecisionEigenStepper<BFieldF>(bFieldF), pT,
+                              phi, theta, charge, pathLimit);
+  checkEndParameters(ref, test, pathLimit);
+
+  // The local helix approximation of the transport jacobian neglects the
+  // field gradient along the step, it only has to agree loosely
+  const auto helix =
+      propagate(MixedPrecisionEigenStepper<BFieldF, true>(bFieldF), pT, phi,
+                theta, charge, pathLimit);
+  BOOST_CHECK_LT((ref.position() - helix.position()).norm(), 1e-5 * pathLimit);
+  CHECK_CLOSE_COVARIANCE(*ref.covariance(), *helix.covariance(), 5e-2);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Test
+}  // namespace Acts
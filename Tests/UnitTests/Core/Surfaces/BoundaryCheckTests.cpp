@@ -1,6 +1,6 @@
 // This file is part of the Acts project.
 //
-// Copyright (C) 2017-2018 CERN for the benefit of the Acts project
+// Copyright (C) 2017-2020 CERN for the benefit of the Acts project
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -10,6 +10,8 @@
 #include <boost/test/tools/output_test_stream.hpp>
 #include <boost/test/unit_test.hpp>
 
+#include <vector>
+
 #include "Acts/Surfaces/BoundaryCheck.hpp"
 #include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
 #include "Acts/Utilities/Definitions.hpp"
@@ -124,6 +126,43 @@ BOOST_AUTO_TEST_CASE(BoundaryCheckTriangleCovariance) {
   BOOST_CHECK(check.isInside({0, 4}, vertices));
   BOOST_CHECK(!check.isInside({0, 5}, vertices));
 }
+// Precomputed polygon edges w/ single and batched checks
+BOOST_AUTO_TEST_CASE(BoundaryCheckPolygonEdges) {
+  // both orientations of the same pentagon
+  std::vector<Vector2D> ccw = {{-2, 0}, {2, 0}, {3, 2}, {0, 4}, {-3, 2}};
+  std::vector<Vector2D> cw(ccw.rbegin(), ccw.rend());
+
+  // test points on a grid that does not touch the edges
+  std::vector<Vector2D> points;
+  for (int i = -30; i <= 30; ++i) {
+    for (int j = -30; j <= 30; ++j) {
+      points.emplace_back(0.17 * i + 0.013, 0.17 * j + 2.007);
+    }
+  }
+
+  SymMatrix2D cov;
+  cov << 0.5, 0.2, 0.2, 0.3;
+  std::vector<BoundaryCheck> checks = {
+      BoundaryCheck(false), BoundaryCheck(true),
+      BoundaryCheck(true, true, 0.5, 0.2), BoundaryCheck(true, false, 0.5),
+      BoundaryCheck(cov, 2.0)};
+
+  for (const auto& vertices : {ccw, cw}) {
+    detail::ConvexPolygonEdges edges(vertices);
+    CHECK_CLOSE_ABS(edges.min(), Vector2D(-3, 0), 1e-12);
+    CHECK_CLOSE_ABS(edges.max(), Vector2D(3, 4), 1e-12);
+    for (const auto& check : checks) {
+      std::vector<bool> inside;
+      check.isInside(points, edges, inside);
+      BOOST_CHECK_EQUAL(inside.size(), points.size());
+      for (size_t i = 0; i < points.size(); ++i) {
+        bool expected = check.isInside(points[i], vertices);
+        BOOST_CHECK_EQUAL(check.isInside(points[i], edges), expected);
+        BOOST_CHECK_EQUAL(inside[i], expected);
+      }
+    }
+  }
+}
 BOOST_AUTO_TEST_SUITE_END()
 }  // namespace Test
 }  // namespace Acts
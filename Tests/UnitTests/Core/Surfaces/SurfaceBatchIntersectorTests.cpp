@@ -0,0 +1,172 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include <random>
+#include <stdexcept>
+
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Surfaces/ConeSurface.hpp"
+#include "Acts/Surfaces/CylinderSurface.hpp"
+#include "Acts/Surfaces/DiscSurface.hpp"
+#include "Acts/Surfaces/PerigeeSurface.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Surfaces/RectangleBounds.hpp"
+#include "Acts/Surfaces/StrawSurface.hpp"
+#include "Acts/Surfaces/SurfaceBatchIntersector.hpp"
+#include "Acts/Surfaces/TrapezoidBounds.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+#include "Acts/Utilities/Definitions.hpp"
+#include "Acts/Utilities/Units.hpp"
+
+namespace Acts {
+
+using namespace UnitLiterals;
+
+namespace Test {
+
+// Create a test context
+GeometryContext tgContext = GeometryContext();
+
+/// Surfaces of all kernel types, placed with some random transform
+std::vector<std::shared_ptr<const Surface>> makeSurfaces() {
+  auto transform = std::make_shared<Transform3D>(
+      Transform3D::Identity() * Translation3D(30_cm, -7_cm, -87_mm) *
+      AngleAxis3D(0.42, Vector3D(-3., 1., 8).normalized()));
+
+  std::vector<std::shared_ptr<const Surface>> surfaces;
+  surfaces.push_back(Surface::makeShared<PlaneSurface>(
+      transform, std::make_shared<RectangleBounds>(30_cm, 20_cm)));
+  surfaces.push_back(Surface::makeShared<PlaneSurface>(
+      transform, std::make_shared<TrapezoidBounds>(10_cm, 30_cm, 20_cm)));
+  surfaces.push_back(Surface::makeShared<PlaneSurface>(transform));
+  surfaces.push_back(Surface::makeShared<DiscSurface>(transform, 5_cm, 30_cm));
+  surfaces.push_back(
+      Surface::makeShared<DiscSurface>(transform, 5_cm, 30_cm, 0.8));
+  surfaces.push_back(Surface::makeShared<DiscSurface>(transform));
+  surfaces.push_back(
+      Surface::makeShared<CylinderSurface>(transform, 20_cm, 30_cm));
+  surfaces.push_back(
+      Surface::makeShared<CylinderSurface>(transform, 20_cm, 30_cm, 1.2, 0.3));
+  surfaces.push_back(Surface::makeShared<StrawSurface>(transform, 2_cm, 30_cm));
+  surfaces.push_back(Surface::makeShared<PerigeeSurface>(transform));
+  surfaces.push_back(
+      Surface::makeShared<ConeSurface>(transform, 0.3, 5_cm, 30_cm));
+  return surfaces;
+}
+
+/// Random lines passing near the origin of the surfaces
+void makeLines(size_t nLines, std::vector<Vector3D>& positions,
+               std::vector<Vector3D>& directions) {
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> uniform(-1., 1.);
+  for (size_t il = 0; il < nLines; ++il) {
+    positions.emplace_back(30_cm + 40_cm * uniform(rng),
+                           -7_cm + 40_cm * uniform(rng),
+                           -87_mm + 40_cm * uniform(rng));
+    directions.push_back(
+        Vector3D(uniform(rng), uniform(rng), uniform(rng)).normalized());
+  }
+}
+
+/// Compare with the intersection estimate of the surface itself
+void checkIntersection(const SurfaceIntersection& batched,
+                       const Surface& surface, const Vector3D& position,
+                       const Vector3D& direction,
+                       const BoundaryCheck& bcheck) {
+  auto reference =
+      surface.intersectionEstimate(tgContext, position, direction, bcheck);
+  BOOST_CHECK_EQUAL(batched.object, &surface);
+  BOOST_CHECK(batched.intersection.status == reference.status);
+  if (reference.status != Intersection::Status::unreachable) {
+    CHECK_CLOSE_ABS(batched.intersection.pathLength, reference.pathLength,
+                    1e-9);
+    BOOST_CHECK(batched.intersection.position.isApprox(reference.position,
+                                                       1e-12));
+  }
+}
+
+std::vector<BoundaryCheck> boundaryChecks() {
+  SymMatrix2D cov;
+  cov << 1_cm * 1_cm, 0., 0., 2_cm * 2_cm;
+  return {BoundaryCheck(false), BoundaryCheck(true),
+          BoundaryCheck(true, true, 1_cm, 1_cm), BoundaryCheck(cov, 3.)};
+}
+
+BOOST_AUTO_TEST_SUITE(Surfaces)
+
+/// Unit test for one line intersected with many surfaces
+BOOST_AUTO_TEST_CASE(SurfaceBatchIntersector_ManySurfaces) {
+  auto surfaces = makeSurfaces();
+  std::vector<const Surface*> sPointers;
+  for (const auto& surface : surfaces) {
+    sPointers.push_back(surface.get());
+  }
+  SurfaceBatchIntersector intersector(tgContext, sPointers);
+  BOOST_CHECK_EQUAL(intersector.surfaces().size(), surfaces.size());
+
+  std::vector<Vector3D> positions;
+  std::vector<Vector3D> directions;
+  makeLines(500, positions, directions);
+
+  std::vector<SurfaceIntersection> intersections;
+  for (const auto& bcheck : boundaryChecks()) {
+    for (size_t il = 0; il < positions.size(); ++il) {
+      intersector.intersect(positions[il], directions[il], bcheck,
+                            intersections);
+      BOOST_REQUIRE_EQUAL(intersections.size(), surfaces.size());
+      for (size_t is = 0; is < surfaces.size(); ++is) {
+        checkIntersection(intersections[is], *surfaces[is], positions[il],
+                          directions[il], bcheck);
+      }
+    }
+  }
+}
+
+/// Unit test for many lines intersected with one surface
+BOOST_AUTO_TEST_CASE(SurfaceBatchIntersector_ManyLines) {
+  auto surfaces = makeSurfaces();
+  std::vector<const Surface*> sPointers;
+  for (const auto& surface : surfaces) {
+    sPointers.push_back(surface.get());
+  }
+  SurfaceBatchIntersector intersector(tgContext, sPointers);
+
+  std::vector<Vector3D> positions;
+  std::vector<Vector3D> directions;
+  makeLines(500, positions, directions);
+
+  std::vector<SurfaceIntersection> intersections;
+  for (const auto& bcheck : boundaryChecks()) {
+    for (size_t is = 0; is < surfaces.size(); ++is) {
+      intersector.intersect(is, positions, directions, bcheck, intersections);
+      BOOST_REQUIRE_EQUAL(intersections.size(), positions.size());
+      for (size_t il = 0; il < positions.size(); ++il) {
+        checkIntersection(intersections[il], *surfaces[is], positions[il],
+                          directions[il], bcheck);
+      }
+    }
+  }
+
+  // invalid input
+  std::vector<Vector3D> noDirections;
+  BOOST_CHECK_THROW(intersector.intersect(0, positions, noDirections, true,
+                                          intersections),
+                    std::invalid_argument);
+  BOOST_CHECK_THROW(intersector.intersect(surfaces.size(), positions,
+                                          directions, true, intersections),
+                    std::out_of_range);
+  BOOST_CHECK_THROW(SurfaceBatchIntersector(tgContext, {nullptr}),
+                    std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Test
+}  // namespace Acts
@@ -132,6 +132,21 @@ BOOST_AUTO_TEST_CASE(TrapezoidBoundsProperties, *utf::expected_failures(3)) {
   /// Test inside
   BOOST_CHECK(trapezoidBoundsObject.inside(inRectangle, BoundaryCheck(true)));
   BOOST_CHECK(!trapezoidBoundsObject.inside(outside, BoundaryCheck(true)));
+  //
+  /// Test batched inside
+  std::vector<Vector2D> positions{origin, outside, inRectangle, {6.5, 2.1}};
+  std::vector<bool> inside;
+  for (const auto& bcheck : {BoundaryCheck(true), BoundaryCheck(false),
+                             BoundaryCheck(true, true, 1., 1.)}) {
+    trapezoidBoundsObject.insideBatch(positions, bcheck, inside);
+    BOOST_CHECK_EQUAL(inside.size(), positions.size());
+    for (size_t i = 0; i < positions.size(); ++i) {
+      BOOST_CHECK_EQUAL(inside[i],
+                        trapezoidBoundsObject.inside(positions[i], bcheck));
+    }
+  }
+  BOOST_CHECK(not inside[1]);
+  BOOST_CHECK(inside[3]);
 }
 /// Unit test for testing TrapezoidBounds assignment
 BOOST_AUTO_TEST_CASE(TrapezoidBoundsAssignment) {
@@ -8,6 +8,12 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <random>
+
 #include "Acts/Utilities/detail/Axis.hpp"
 
 namespace Acts {
@@ -369,6 +375,89 @@ BOOST_AUTO_TEST_CASE(wrapBin) {
   BOOST_CHECK_EQUAL(a6.wrapBin(7), 2u);
 }
 
+BOOST_AUTO_TEST_CASE(variable_axis_lookup) {
+  // very uneven bins to exercise the lookup table limits
+  std::vector<double> edges = {-5.0, -4.999, -1.0, 0.0,   1e-3,
+                               2e-3, 0.5,    3.0,  100.0, 1e4};
+  Axis<AxisType::Variable, AxisBoundaryType::Open> a(edges);
+  auto reference = [&](double x) -> size_t {
+    return std::distance(edges.begin(),
+                         std::upper_bound(edges.begin(), edges.end(), x));
+  };
+
+  // exactly on and next to every edge
+  for (double edge : edges) {
+    for (double x : {std::nextafter(edge, -1e5), edge,
+                     std::nextafter(edge, 1e5)}) {
+      BOOST_CHECK_EQUAL(a.getBin(x), reference(x));
+    }
+  }
+  // random values inside and outside of the axis range
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> uniform(-10., 1.1e4);
+  std::uniform_real_distribution<double> narrow(-5.5, 3.5);
+  for (size_t i = 0; i < 10000; ++i) {
+    double x = uniform(rng);
+    BOOST_CHECK_EQUAL(a.getBin(x), reference(x));
+    x = narrow(rng);
+    BOOST_CHECK_EQUAL(a.getBin(x), reference(x));
+  }
+  // not-a-number ends up in the overflow bin
+  BOOST_CHECK_EQUAL(a.getBin(std::numeric_limits<double>::quiet_NaN()),
+                    edges.size());
+}
+
+BOOST_AUTO_TEST_CASE(variable_axis_lookup_log) {
+  // many bin edges share a lookup cell at the lower end
+  std::vector<double> edges;
+  for (size_t i = 0; i <= 1000; ++i) {
+    edges.push_back(std::pow(10., -6. + 12. * i / 1000.));
+  }
+  Axis<AxisType::Variable, AxisBoundaryType::Open> a(edges);
+  auto reference = [&](double x) -> size_t {
+    return std::distance(edges.begin(),
+                         std::upper_bound(edges.begin(), edges.end(), x));
+  };
+
+  for (double edge : edges) {
+    for (double x : {std::nextafter(edge, -1.), edge,
+                     std::nextafter(edge, 1e7)}) {
+      BOOST_CHECK_EQUAL(a.getBin(x), reference(x));
+    }
+  }
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> exponent(-7., 7.);
+  for (size_t i = 0; i < 10000; ++i) {
+    double x = std::pow(10., exponent(rng));
+    BOOST_CHECK_EQUAL(a.getBin(x), reference(x));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(add_bins) {
+  Axis<AxisType::Equidistant, AxisBoundaryType::Open> a1(0.0, 10.0, 10u);
+  Axis<AxisType::Equidistant, AxisBoundaryType::Bound> a2(0.0, 10.0, 10u);
+  Axis<AxisType::Equidistant, AxisBoundaryType::Closed> a3(0.0, 10.0, 10u);
+  Axis<AxisType::Variable, AxisBoundaryType::Open> a4({0.0, 0.5, 3.0, 10.0});
+
+  std::vector<std::array<double, 2>> points;
+  for (double x : {-1e9, -10.5, -0.5, std::nextafter(0., -1.), 0., 0.5, 1.,
+                   std::nextafter(1., 0.), 9.999, std::nextafter(10., 0.),
+                   10., 10.5, 25., 1e9}) {
+    points.push_back({{0., x}});
+  }
+  auto check = [&](const auto& axis) {
+    std::vector<size_t> bins(points.size(), 1u);
+    axis.addBins(points, 1u, 3u, bins);
+    for (size_t i = 0; i < points.size(); ++i) {
+      BOOST_CHECK_EQUAL(bins[i], 1u + 3u * axis.getBin(points[i][1]));
+    }
+  };
+  check(a1);
+  check(a2);
+  check(a3);
+  check(a4);
+}
+
 }  // namespace Test
 
 }  // namespace Acts
@@ -0,0 +1,109 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include <memory>
+#include <vector>
+
+#include "Acts/Utilities/BinUtility.hpp"
+#include "Acts/Utilities/BinnedArrayT.hpp"
+#include "Acts/Utilities/BinnedArrayXD.hpp"
+
+namespace Acts {
+namespace Test {
+
+using Object = std::shared_ptr<const int>;
+using TAP = std::pair<Object, Vector3D>;
+
+/// Compare all lookups of the specialised and the generic array
+void checkConsistency(const BinnedArray<Object>& tArray,
+                      const BinnedArray<Object>& xdArray) {
+  BOOST_CHECK(tArray.arrayObjects() == xdArray.arrayObjects());
+  BOOST_CHECK(tArray.objectGrid() == xdArray.objectGrid());
+  for (double v = -20.; v <= 120.; v += 0.25) {
+    for (const Vector3D& pos : {Vector3D(v, 0.5, 0.5), Vector3D(0.5, v, 0.5),
+                                Vector3D(0.5, 0.5, v), Vector3D(v, v, v)}) {
+      std::array<size_t, 3> tBins = {9, 9, 9};
+      std::array<size_t, 3> xdBins = {9, 9, 9};
+      BOOST_CHECK_EQUAL(tArray.object(pos, tBins),
+                        xdArray.object(pos, xdBins));
+      BOOST_CHECK(tBins == xdBins);
+      BOOST_CHECK(tArray.objectCluster(tBins) ==
+                  xdArray.objectCluster(xdBins));
+    }
+    Vector2D lpos(v, 100. - v);
+    BOOST_CHECK_EQUAL(tArray.object(lpos), xdArray.object(lpos));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(BinnedArrayT_equidistant) {
+  std::vector<TAP> taps;
+  for (int i = 0; i < 10; ++i) {
+    double c = 10. * i + 5.;
+    taps.emplace_back(std::make_shared<const int>(i), Vector3D(c, c, c));
+  }
+  // a leftover object outside the binning is ignored
+  taps.emplace_back(std::make_shared<const int>(-1),
+                    Vector3D(200., 200., 200.));
+
+  BinnedArrayXD<Object> xdArray(
+      taps, std::make_unique<const BinUtility>(10, 0., 100., open, binZ));
+  auto tArray = makeBinnedArray<Object>(
+      taps, std::make_unique<const BinUtility>(10, 0., 100., open, binZ));
+  using Expected = BinnedArrayT<Object, binZ, equidistant>;
+  BOOST_CHECK(dynamic_cast<const Expected*>(tArray.get()) != nullptr);
+  BOOST_CHECK_EQUAL(tArray->arrayObjects().size(), 10u);
+  checkConsistency(*tArray, xdArray);
+}
+
+BOOST_AUTO_TEST_CASE(BinnedArrayT_arbitrary) {
+  std::vector<float> boundaries = {0., 1., 3., 7., 15., 31., 63., 100.};
+  std::vector<TAP> taps;
+  for (size_t i = 0; i + 1 < boundaries.size(); ++i) {
+    double c = 0.5 * (boundaries[i] + boundaries[i + 1]);
+    // cylinder layers at constant radius
+    taps.emplace_back(std::make_shared<const int>(i), Vector3D(c, 0., 0.));
+  }
+
+  BinnedArrayXD<Object> xdArray(
+      taps, std::make_unique<const BinUtility>(boundaries, open, binR));
+  auto tArray = makeBinnedArray<Object>(
+      taps, std::make_unique<const BinUtility>(boundaries, open, binR));
+  using Expected = BinnedArrayT<Object, binR, arbitrary>;
+  BOOST_CHECK(dynamic_cast<const Expected*>(tArray.get()) != nullptr);
+  checkConsistency(*tArray, xdArray);
+  // exactly on the boundaries
+  for (float b : boundaries) {
+    Vector3D pos(b, 0., 0.);
+    BOOST_CHECK_EQUAL(tArray->object(pos), xdArray.object(pos));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(BinnedArrayT_fallback) {
+  std::vector<TAP> taps = {
+      {std::make_shared<const int>(0), Vector3D(1., 0., 0.)}};
+  // closed binning and more than one dimension use the generic array
+  auto closedArray = makeBinnedArray<Object>(
+      taps, std::make_unique<const BinUtility>(4, -M_PI, M_PI, closed, binPhi));
+  BOOST_CHECK(dynamic_cast<const BinnedArrayXD<Object>*>(closedArray.get()) !=
+              nullptr);
+  auto bu = std::make_unique<BinUtility>(10, 0., 10., open, binX);
+  *bu += BinUtility(10, 0., 10., open, binY);
+  auto xyArray = makeBinnedArray<Object>(taps, std::move(bu));
+  BOOST_CHECK(dynamic_cast<const BinnedArrayXD<Object>*>(xyArray.get()) !=
+              nullptr);
+  // direct construction with an unsupported binning is rejected
+  using Array = BinnedArrayT<Object, binX, equidistant>;
+  BOOST_CHECK_THROW(
+      Array(taps, std::make_unique<const BinUtility>(10, 0., 10., open, binY)),
+      std::invalid_argument);
+}
+
+}  // namespace Test
+}  // namespace Acts
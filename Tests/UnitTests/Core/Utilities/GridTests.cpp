@@ -960,6 +960,33 @@ BOOST_AUTO_TEST_CASE(grid_test_2d_mixed_at) {
   BOOST_CHECK_EQUAL(g.atPosition(Point({{0.4, 2.3}})), 5.);
 }
 
+BOOST_AUTO_TEST_CASE(grid_test_2d_mixed_bins_from_positions) {
+  using Point = std::array<double, 2>;
+  EquidistantAxis a(0.0, 6.0, 4u);
+  VariableAxis b({0.0, 1.5, 3.0, 7.0, 8.0});
+  Grid<double, EquidistantAxis, VariableAxis> g(
+      std::make_tuple(std::move(a), std::move(b)));
+  for (size_t bin = 0; bin < g.size(); ++bin) {
+    g.at(bin) = bin;
+  }
+
+  std::mt19937 rng(1234);
+  std::uniform_real_distribution<double> uniform(-1.0, 9.0);
+  std::vector<Point> points;
+  for (size_t i = 0; i < 1000; ++i) {
+    points.push_back({{uniform(rng), uniform(rng)}});
+  }
+  points.push_back({{6.0, 8.0}});
+  points.push_back({{0.0, 0.0}});
+
+  std::vector<size_t> bins;
+  g.globalBinsFromPositions(points, bins);
+  BOOST_CHECK_EQUAL(bins.size(), points.size());
+  for (size_t i = 0; i < points.size(); ++i) {
+    BOOST_CHECK_EQUAL(bins[i], g.globalBinFromPosition(points[i]));
+  }
+}
+
 BOOST_AUTO_TEST_CASE(grid_interpolation) {
   using Point = std::array<double, 3>;
   EquidistantAxis a(1.0, 3.0, 2u);
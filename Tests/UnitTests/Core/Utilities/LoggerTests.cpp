@@ -10,8 +10,13 @@
 
 #include <boost/test/unit_test.hpp>
 #include <fstream>
+#include <iomanip>
+#include <sstream>
 #include <string>
+#include <thread>
+#include <vector>
 
+#include "Acts/Utilities/AsyncLogging.hpp"
 #include "Acts/Utilities/Logger.hpp"
 
 namespace Acts {
@@ -225,5 +230,161 @@ BOOST_AUTO_TEST_CASE(VERBOSE_test) {
     BOOST_TEST(line == lines.at(i), detail::failure_msg(line, lines.at(i)));
   }
 }
+
+/// @brief unit test for the compile-time minimum debug level
+///
+/// Messages below #ACTS_LOG_MIN_LEVEL must not even be evaluated.
+BOOST_AUTO_TEST_CASE(compile_time_level_test) {
+  std::ostringstream out;
+  auto log = detail::create_logger("TestLogger", &out, VERBOSE);
+  ACTS_LOCAL_LOGGER(std::move(log));
+
+  size_t evaluated = 0;
+  auto message = [&]() {
+    ++evaluated;
+    return "message";
+  };
+  ACTS_VERBOSE(message());
+  ACTS_LOG(Acts::Logging::DEBUG, message());
+  ACTS_FATAL(message());
+
+  const size_t expected = (VERBOSE >= ACTS_LOG_MIN_LEVEL ? 1 : 0) +
+                          (DEBUG >= ACTS_LOG_MIN_LEVEL ? 1 : 0) +
+                          (FATAL >= ACTS_LOG_MIN_LEVEL ? 1 : 0);
+  BOOST_CHECK_EQUAL(evaluated, expected);
+}
+
+/// @brief unit test for the asynchronous print policy
+///
+/// This test checks that messages from several threads are all written by the
+/// sink, in order per thread, once the logger is destroyed.
+BOOST_AUTO_TEST_CASE(async_test) {
+  constexpr size_t nThreads = 4;
+  constexpr size_t nMessages = 200;
+  std::ostringstream out;
+  // a small buffer to exercise waiting for the writer
+  auto sink = std::make_shared<AsyncSink>(8);
+  {
+    auto output = std::make_unique<LevelOutputDecorator>(
+        std::make_unique<NamedOutputDecorator>(
+            std::make_unique<DefaultPrintPolicy>(&out), "TestLogger"));
+    auto log = std::make_unique<const Logger>(
+        std::make_unique<AsyncPrintPolicy>(sink, std::move(output)),
+        std::make_unique<DefaultFilterPolicy>(DEBUG));
+    ACTS_LOCAL_LOGGER(std::move(log));
+
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < nThreads; ++t) {
+      threads.emplace_back([&, t]() {
+        for (size_t i = 0; i < nMessages; ++i) {
+          ACTS_DEBUG(t << " " << i);
+          ACTS_VERBOSE("hidden");
+        }
+      });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  }
+
+  std::vector<size_t> next(nThreads, 0u);
+  std::istringstream in(out.str());
+  size_t nLines = 0;
+  for (std::string line; std::getline(in, line); ++nLines) {
+    const std::string prefix = "TestLogger     DEBUG     ";
+    BOOST_REQUIRE_EQUAL(line.substr(0, prefix.size()), prefix);
+    std::istringstream fields(line.substr(prefix.size()));
+    size_t t = 0;
+    size_t i = 0;
+    fields >> t >> i;
+    BOOST_REQUIRE_LT(t, nThreads);
+    BOOST_CHECK_EQUAL(i, next[t]++);
+  }
+  BOOST_CHECK_EQUAL(nLines, nThreads * nMessages);
+}
+
+/// @brief unit test for the buffers of exited threads
+///
+/// Short-lived threads must not leave their buffers behind, but all their
+/// messages must still be written.
+BOOST_AUTO_TEST_CASE(async_thread_exit_test) {
+  constexpr size_t nThreads = 50;
+  constexpr size_t nMessages = 20;
+  std::ostringstream out;
+  auto sink = std::make_shared<AsyncSink>(8);
+  {
+    AsyncPrintPolicy policy(sink, std::make_unique<DefaultPrintPolicy>(&out));
+    for (size_t t = 0; t < nThreads; ++t) {
+      std::thread([&]() {
+        for (size_t i = 0; i < nMessages; ++i) {
+          std::ostringstream message;
+          message << "message";
+          policy.flush(INFO, message);
+        }
+      }).join();
+    }
+    sink->flush();
+    BOOST_CHECK_EQUAL(sink->numThreadBuffers(), 0u);
+  }
+
+  std::istringstream in(out.str());
+  size_t nLines = 0;
+  for (std::string line; std::getline(in, line); ++nLines) {
+    BOOST_CHECK_EQUAL(line, "message");
+  }
+  BOOST_CHECK_EQUAL(nLines, nThreads * nMessages);
+}
+
+/// @brief unit test for messages issued while a thread exits
+///
+/// A thread-local object destroyed after the buffers of its thread must
+/// still be able to log.
+BOOST_AUTO_TEST_CASE(async_late_thread_exit_test) {
+  struct LogOnExit {
+    AsyncPrintPolicy* policy = nullptr;
+    ~LogOnExit() {
+      std::ostringstream message;
+      message << "exit";
+      policy->flush(INFO, message);
+    }
+  };
+
+  std::ostringstream out;
+  auto sink = std::make_shared<AsyncSink>();
+  {
+    AsyncPrintPolicy policy(sink, std::make_unique<DefaultPrintPolicy>(&out));
+    std::thread([&]() {
+      // constructed before and thus destroyed after the thread buffers
+      thread_local LogOnExit onExit;
+      onExit.policy = &policy;
+      std::ostringstream message;
+      message << "message";
+      policy.flush(INFO, message);
+    }).join();
+  }
+  BOOST_CHECK_EQUAL(out.str(), "message\nexit\n");
+}
+
+/// @brief unit test for the message origin of deferred messages
+///
+/// The decorators run on the writer thread, but must report the thread which
+/// issued the message.
+BOOST_AUTO_TEST_CASE(async_origin_test) {
+  std::ostringstream out;
+  auto sink = std::make_shared<AsyncSink>();
+  {
+    auto output = std::make_unique<ThreadOutputDecorator>(
+        std::make_unique<DefaultPrintPolicy>(&out));
+    AsyncPrintPolicy policy(sink, std::move(output));
+    std::ostringstream message;
+    message << "message";
+    policy.flush(INFO, message);
+  }
+
+  std::ostringstream expected;
+  expected << std::left << std::setw(20) << std::this_thread::get_id()
+           << "message" << std::endl;
+  BOOST_CHECK_EQUAL(out.str(), expected.str());
+}
 }  // namespace Test
 }  // namespace Acts
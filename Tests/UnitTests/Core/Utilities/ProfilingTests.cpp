@@ -0,0 +1,90 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Acts/Utilities/Profiling.hpp"
+
+namespace Acts {
+namespace Test {
+
+BOOST_AUTO_TEST_SUITE(Utilities)
+
+BOOST_AUTO_TEST_CASE(ProfilingRecordBuffer) {
+  Profiling::RecordBuffer buffer(3u, 7u);
+  std::vector<Profiling::Record> records;
+
+  // empty buffer
+  BOOST_CHECK_EQUAL(buffer.drain(records), 0u);
+  BOOST_CHECK(records.empty());
+
+  // capacity is rounded up to four; the two oldest records are overwritten
+  for (int64_t i = 0; i < 6; ++i) {
+    buffer.push("test", i, i, i + 1);
+  }
+  BOOST_CHECK_EQUAL(buffer.drain(records), 2u);
+  BOOST_CHECK_EQUAL(records.size(), 4u);
+  for (size_t i = 0; i < records.size(); ++i) {
+    BOOST_CHECK_EQUAL(records[i].context, i + 2u);
+    BOOST_CHECK_EQUAL(records[i].start, static_cast<int64_t>(i + 2u));
+    BOOST_CHECK_EQUAL(records[i].thread, 7u);
+  }
+
+  // drained records are removed
+  records.clear();
+  BOOST_CHECK_EQUAL(buffer.drain(records), 0u);
+  BOOST_CHECK(records.empty());
+}
+
+BOOST_AUTO_TEST_CASE(ProfilingScopedTimer) {
+  // nothing is recorded while disabled
+  Profiling::collect();
+  { Profiling::ScopedTimer timer("disabled"); }
+  BOOST_CHECK(Profiling::collect().empty());
+
+  Profiling::setEnabled(true);
+  auto work = [](uint64_t context) {
+    Profiling::setThreadContext(context);
+    for (int i = 0; i < 10; ++i) {
+      Profiling::ScopedTimer timer("work");
+    }
+  };
+  std::vector<std::thread> threads;
+  for (uint64_t context = 0; context < 4; ++context) {
+    threads.emplace_back(work, context);
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  Profiling::setEnabled(false);
+
+  auto records = Profiling::collect();
+  BOOST_CHECK_EQUAL(records.size(), 40u);
+  std::set<uint32_t> threadIds;
+  for (size_t i = 0; i < records.size(); ++i) {
+    BOOST_CHECK_EQUAL(std::string(records[i].name), "work");
+    BOOST_CHECK_LE(records[i].start, records[i].stop);
+    BOOST_CHECK_LT(records[i].context, 4u);
+    if (0u < i) {
+      BOOST_CHECK_LE(records[i - 1].start, records[i].start);
+    }
+    threadIds.insert(records[i].thread);
+  }
+  // every thread records into its own buffer
+  BOOST_CHECK_EQUAL(threadIds.size(), 4u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Test
+}  // namespace Acts
@@ -20,6 +20,7 @@
 #include "Acts/Utilities/Units.hpp"
 #include "Acts/Vertexing/FsmwMode1dFinder.hpp"
 #include "Acts/Vertexing/FullBilloirVertexFitter.hpp"
+#include "Acts/Vertexing/GridDensityVertexFinder.hpp"
 #include "Acts/Vertexing/HelicalTrackLinearizer.hpp"
 #include "Acts/Vertexing/ImpactPointEstimator.hpp"
 #include "Acts/Vertexing/IterativeVertexFinder.hpp"
@@ -514,5 +515,158 @@ BOOST_AUTO_TEST_CASE(iterative_finder_test_user_track_type) {
   }
 }
 
+/// Seed finder that counts the seeds returned as the vertex constraint
+/// while tracks were to be removed from its cached state, and whether
+/// seeding is then repeated with a new state
+template <typename finder_t>
+struct ConstraintCountingSeedFinder {
+  using State = typename finder_t::State;
+
+  struct Counters {
+    unsigned int nConstraintSeeds = 0;
+    unsigned int nNewStateSeeds = 0;
+    bool lastWasConstraint = false;
+  };
+
+  finder_t finder;
+  std::shared_ptr<Counters> counters;
+
+  Result<std::vector<Vertex<BoundParameters>>> find(
+      const std::vector<const BoundParameters*>& trackVector,
+      const VertexingOptions<BoundParameters>& vertexingOptions,
+      State& state) const {
+    if (counters->lastWasConstraint and not state.isInitialized) {
+      ++counters->nNewStateSeeds;
+    }
+    bool removeTracks =
+        state.isInitialized and not state.tracksToRemove.empty();
+    auto res = finder.find(trackVector, vertexingOptions, state);
+    counters->lastWasConstraint =
+        removeTracks and res.ok() and
+        (*res).back().fullPosition() ==
+            vertexingOptions.vertexConstraint.fullPosition();
+    if (counters->lastWasConstraint) {
+      ++counters->nConstraintSeeds;
+    }
+    return res;
+  }
+};
+
+///
+/// @brief Unit test for IterativeVertexFinder with a cached grid seed finder
+///
+BOOST_AUTO_TEST_CASE(iterative_finder_test_grid_seeder) {
+  // Set up RNG
+  int mySeed = 27182;
+  std::mt19937 gen(mySeed);
+
+  ConstantBField bField(0.0, 0.0, 1_T);
+  EigenStepper<ConstantBField> stepper(bField);
+  auto propagator = std::make_shared<Propagator>(stepper);
+  Linearizer::Config ltConfig(bField, propagator);
+  Linearizer linearizer(ltConfig);
+
+  using BilloirFitter = FullBilloirVertexFitter<BoundParameters, Linearizer>;
+  BilloirFitter::Config vertexFitterCfg;
+  BilloirFitter bFitter(vertexFitterCfg);
+
+  using IPEstimator = ImpactPointEstimator<BoundParameters, Propagator>;
+  IPEstimator::Config ipEstimatorCfg(bField, propagator);
+  IPEstimator ipEstimator(ipEstimatorCfg);
+
+  using GridSeedFinder = GridDensityVertexFinder<4000, 55, BilloirFitter>;
+  using SeedFinder = ConstraintCountingSeedFinder<GridSeedFinder>;
+  using VertexFinder = IterativeVertexFinder<BilloirFitter, SeedFinder>;
+
+  static_assert(VertexFinderConcept<VertexFinder>,
+                "Vertex finder does not fulfill vertex finder concept.");
+
+  // Finders with and without the cached grid state
+  auto counters = std::make_shared<SeedFinder::Counters>();
+  auto makeFinder = [&](bool cacheGrid) {
+    GridSeedFinder::Config seedFinderCfg(250_mm);
+    seedFinderCfg.cacheGridStateForTrackRemoval = cacheGrid;
+    SeedFinder sFinder{GridSeedFinder(seedFinderCfg), counters};
+    VertexFinder::Config cfg(bFitter, linearizer, std::move(sFinder),
+                             ipEstimator);
+    cfg.reassignTracksAfterFirstFit = true;
+    return VertexFinder(cfg);
+  };
+  VertexFinder cachedFinder = makeFinder(true);
+  VertexFinder finder = makeFinder(false);
+  VertexFinder::State state;
+
+  std::shared_ptr<PerigeeSurface> perigeeSurface =
+      Surface::makeShared<PerigeeSurface>(Vector3D(0., 0., 0.));
+
+  // Number of test events
+  unsigned int nEvents = 5;
+
+  for (unsigned int iEvent = 0; iEvent < nEvents; ++iEvent) {
+    std::vector<std::unique_ptr<const BoundParameters>> tracks;
+    std::vector<const BoundParameters*> tracksPtr;
+
+    // One vertex is close to the vertex constraint, where a seed finder
+    // that signals an unchanged state returns its seed
+    unsigned int nVertices = nVertexDist(gen) + 1;
+    for (unsigned int iVertex = 0; iVertex < nVertices; ++iVertex) {
+      double x = vXYDist(gen);
+      double y = vXYDist(gen);
+      double z = (iVertex == 0) ? 0.05 * vZDist(gen) : vZDist(gen);
+      unsigned int nTracks = nTracksDist(gen);
+      for (unsigned int iTrack = 0; iTrack < nTracks; iTrack++) {
+        double q = qDist(gen) < 0 ? -1. : 1.;
+        // Every third track is displaced with a precise impact parameter,
+        // such that it fails the track selection of the grid seed finder
+        bool displaced = (iTrack % 3 == 0);
+        BoundVector paramVec;
+        paramVec << std::sqrt(x * x + y * y) + d0Dist(gen) +
+                        (displaced ? 0.1_mm : 0.),
+            z + z0Dist(gen), phiDist(gen), thetaDist(gen), q / pTDist(gen), 0.;
+
+        double res_d0 = displaced ? 10_um : resIPDist(gen);
+        double res_z0 = resIPDist(gen);
+        double res_ph = resAngDist(gen);
+        double res_th = resAngDist(gen);
+        double res_qp = resQoPDist(gen);
+        Covariance covMat;
+        covMat << res_d0 * res_d0, 0., 0., 0., 0., 0., 0., res_z0 * res_z0, 0.,
+            0., 0., 0., 0., 0., res_ph * res_ph, 0., 0., 0., 0., 0., 0.,
+            res_th * res_th, 0., 0., 0., 0., 0., 0., res_qp * res_qp, 0., 0.,
+            0., 0., 0., 0., 1.;
+        tracks.push_back(std::make_unique<BoundParameters>(
+            geoContext, std::move(covMat), paramVec, perigeeSurface));
+      }
+    }
+    std::shuffle(std::begin(tracks), std::end(tracks), gen);
+    for (const auto& trk : tracks) {
+      tracksPtr.push_back(trk.get());
+    }
+
+    VertexingOptions<BoundParameters> vertexingOptions(geoContext,
+                                                       magFieldContext);
+
+    auto cachedRes = cachedFinder.find(tracksPtr, vertexingOptions, state);
+    auto res = finder.find(tracksPtr, vertexingOptions, state);
+    BOOST_REQUIRE(cachedRes.ok());
+    BOOST_REQUIRE(res.ok());
+
+    // The cached grid must not change the found vertices
+    const auto& cachedVertices = *cachedRes;
+    const auto& vertices = *res;
+    BOOST_REQUIRE_EQUAL(cachedVertices.size(), vertices.size());
+    for (size_t iv = 0; iv < vertices.size(); ++iv) {
+      CHECK_CLOSE_ABS(cachedVertices[iv].fullPosition(),
+                      vertices[iv].fullPosition(), 1_um);
+      BOOST_CHECK_EQUAL(cachedVertices[iv].tracks().size(),
+                        vertices[iv].tracks().size());
+    }
+  }
+  // The seed finder signalled that no removed track was in its grid, and
+  // each of these seeds was replaced by one from a new state
+  BOOST_CHECK_GT(counters->nConstraintSeeds, 0u);
+  BOOST_CHECK_EQUAL(counters->nNewStateSeeds, counters->nConstraintSeeds);
+}
+
 }  // namespace Test
 }  // namespace Acts
@@ -242,6 +242,96 @@ BOOST_AUTO_TEST_CASE(track_density_finder_random_test) {
   }
 }
 
+///
+/// @brief Unit test for TrackDensityVertexFinder with cached density state,
+/// i.e. tests if removing tracks from the cached state gives the same result
+/// as building the state from the remaining tracks
+///
+BOOST_AUTO_TEST_CASE(track_density_finder_track_removal_test) {
+  Covariance covMat = Covariance::Identity();
+
+  // Perigee surface for track parameters
+  Vector3D pos0{0, 0, 0};
+  std::shared_ptr<PerigeeSurface> perigeeSurface =
+      Surface::makeShared<PerigeeSurface>(pos0);
+
+  VertexingOptions<BoundParameters> vertexingOptions(geoContext,
+                                                     magFieldContext);
+  using Finder =
+      TrackDensityVertexFinder<DummyVertexFitter<>,
+                               GaussianTrackDensity<BoundParameters>>;
+  Finder::Config cfg;
+  cfg.cacheDensityStateForTrackRemoval = true;
+  Finder cachedFinder(cfg);
+  Finder::State cachedState;
+
+  int mySeed = 27182;
+  std::mt19937 gen(mySeed);
+  unsigned int nTracks = 200;
+
+  std::vector<BoundParameters> trackVec;
+  trackVec.reserve(nTracks);
+
+  // Create nTracks tracks for test case
+  for (unsigned int i = 0; i < nTracks; i++) {
+    // The position of the particle
+    Vector3D pos(xdist(gen), ydist(gen), 0);
+    if ((i % 4) == 0) {
+      pos[eZ] = z2dist(gen);
+    } else {
+      pos[eZ] = z1dist(gen);
+    }
+
+    // Create momentum and charge of track
+    double pt = pTDist(gen);
+    double phi = phiDist(gen);
+    double eta = etaDist(gen);
+    Vector3D mom(pt * std::cos(phi), pt * std::sin(phi), pt * std::sinh(eta));
+    double charge = etaDist(gen) > 0 ? 1 : -1;
+
+    trackVec.push_back(BoundParameters(geoContext, covMat, pos, mom, charge, 0,
+                                       perigeeSurface));
+  }
+
+  std::vector<const BoundParameters*> trackPtrVec;
+  for (const auto& trk : trackVec) {
+    trackPtrVec.push_back(&trk);
+  }
+
+  auto res1 = cachedFinder.find(trackPtrVec, vertexingOptions, cachedState);
+  BOOST_CHECK(res1.ok());
+  BOOST_CHECK(cachedState.isInitialized);
+
+  // Remove the tracks around the first vertex
+  std::vector<const BoundParameters*> remainingTracks;
+  for (unsigned int i = 0; i < nTracks; i++) {
+    if ((i % 4) == 0) {
+      remainingTracks.push_back(trackPtrVec[i]);
+    } else {
+      cachedState.tracksToRemove.push_back(trackPtrVec[i]);
+    }
+  }
+
+  auto res2 = cachedFinder.find(remainingTracks, vertexingOptions, cachedState);
+  BOOST_CHECK(cachedState.tracksToRemove.empty());
+
+  // Build the density from the remaining tracks only
+  Finder freshFinder;
+  Finder::State freshState;
+  auto res3 = freshFinder.find(remainingTracks, vertexingOptions, freshState);
+
+  if (res2.ok() and res3.ok()) {
+    BOOST_CHECK(!(*res2).empty());
+    BOOST_CHECK(!(*res3).empty());
+    Vector3D result2 = (*res2).back().position();
+    Vector3D result3 = (*res3).back().position();
+    CHECK_CLOSE_ABS(result2[eZ], result3[eZ], 1_nm);
+    CHECK_CLOSE_ABS(result2[eZ], -3_mm, 1_mm);
+  } else {
+    BOOST_FAIL("Vertex seed finding failed.");
+  }
+}
+
 // Dummy user-defined InputTrack type
 struct InputTrack {
   InputTrack(const BoundParameters& params) : m_parameters(params) {}
@@ -0,0 +1,253 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "ACTFW/Io/Binary/BinaryMaterialDecorator.hpp"
+#include "ACTFW/Io/Binary/BinaryMaterialWriter.hpp"
+#include "Acts/Geometry/GeometryID.hpp"
+#include "Acts/Material/BinnedSurfaceMaterial.hpp"
+#include "Acts/Material/HomogeneousSurfaceMaterial.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Utilities/BinUtility.hpp"
+#include "Acts/Utilities/Definitions.hpp"
+#include "BinaryMaterialFormat.hpp"
+
+namespace FW {
+namespace Test {
+
+const Acts::GeometryID kHomogeneous =
+    Acts::GeometryID().setVolume(1).setLayer(2).setSensitive(1);
+const Acts::GeometryID kBinned1D =
+    Acts::GeometryID().setVolume(1).setLayer(2).setSensitive(2);
+const Acts::GeometryID kBinned2D =
+    Acts::GeometryID().setVolume(2).setLayer(4).setApproach(1);
+const Acts::GeometryID kWithout =
+    Acts::GeometryID().setVolume(3).setLayer(2).setSensitive(1);
+
+Acts::MaterialProperties makeProperties(float i) {
+  return Acts::MaterialProperties(10.f + i, 20.f + i, 6.f, 3.f, 0.1f * i,
+                                  0.5f + i);
+}
+
+Acts::DetectorMaterialMaps makeMaterialMaps() {
+  Acts::DetectorMaterialMaps maps;
+  maps.first[kHomogeneous] =
+      std::make_shared<const Acts::HomogeneousSurfaceMaterial>(
+          makeProperties(1.f), 0.5);
+
+  Acts::MaterialPropertiesVector vector;
+  for (int i = 0; i < 3; ++i) {
+    vector.push_back(makeProperties(2.f + i));
+  }
+  maps.first[kBinned1D] = std::make_shared<const Acts::BinnedSurfaceMaterial>(
+      Acts::BinUtility(3u, -1.f, 1.f, Acts::open, Acts::binX), vector, 0.25);
+
+  Acts::BinUtility binUtility(2u, -2.f, 2.f, Acts::open, Acts::binR);
+  binUtility += Acts::BinUtility(4u, -M_PI, M_PI, Acts::closed, Acts::binPhi);
+  Acts::MaterialPropertiesMatrix matrix(4u);
+  for (int bin1 = 0; bin1 < 4; ++bin1) {
+    for (int bin0 = 0; bin0 < 2; ++bin0) {
+      matrix[bin1].push_back(makeProperties(10.f + 2 * bin1 + bin0));
+    }
+  }
+  maps.first[kBinned2D] = std::make_shared<const Acts::BinnedSurfaceMaterial>(
+      binUtility, matrix, 1.);
+  return maps;
+}
+
+std::shared_ptr<Acts::Surface> makeSurface(Acts::GeometryID geoId) {
+  auto surface = Acts::Surface::makeShared<Acts::PlaneSurface>(
+      Acts::Vector3D(0., 0., 0.), Acts::Vector3D(0., 0., 1.));
+  surface->assignGeoID(geoId);
+  return surface;
+}
+
+/// Check whether the address lies within a mapping of the given file.
+bool isMappedFrom(const void* ptr, const std::string& fileName) {
+  const auto address = reinterpret_cast<uintptr_t>(ptr);
+  std::ifstream maps("/proc/self/maps");
+  std::string line;
+  while (std::getline(maps, line)) {
+    if (line.size() <= fileName.size() or
+        line.compare(line.size() - fileName.size() - 1u, std::string::npos,
+                     "/" + fileName) != 0) {
+      continue;
+    }
+    std::istringstream range(line);
+    uintptr_t begin = 0u, end = 0u;
+    char dash = 0;
+    range >> std::hex >> begin >> dash >> end;
+    if ((begin <= address) and (address < end)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void checkMaterial(const Acts::Surface& surface,
+                   const Acts::ISurfaceMaterial& expected) {
+  const Acts::ISurfaceMaterial* material = surface.surfaceMaterial();
+  BOOST_REQUIRE(material != nullptr);
+  BOOST_CHECK_EQUAL(material->factor(Acts::forward, Acts::postUpdate),
+                    expected.factor(Acts::forward, Acts::postUpdate));
+
+  auto bsm = dynamic_cast<const Acts::BinnedSurfaceMaterial*>(material);
+  auto expectedBsm =
+      dynamic_cast<const Acts::BinnedSurfaceMaterial*>(&expected);
+  BOOST_REQUIRE_EQUAL(bsm == nullptr, expectedBsm == nullptr);
+  if (bsm == nullptr) {
+    BOOST_CHECK(dynamic_cast<const Acts::HomogeneousSurfaceMaterial*>(
+                    material) != nullptr);
+    BOOST_CHECK(material->materialProperties(0, 0) ==
+                expected.materialProperties(0, 0));
+    return;
+  }
+  const Acts::BinUtility& binUtility = bsm->binUtility();
+  const Acts::BinUtility& expectedBinUtility = expectedBsm->binUtility();
+  BOOST_REQUIRE_EQUAL(binUtility.dimensions(), expectedBinUtility.dimensions());
+  for (size_t d = 0; d < binUtility.dimensions(); ++d) {
+    const auto& bData = binUtility.binningData()[d];
+    const auto& expectedBData = expectedBinUtility.binningData()[d];
+    BOOST_CHECK_EQUAL(bData.bins(), expectedBData.bins());
+    BOOST_CHECK_EQUAL(bData.min, expectedBData.min);
+    BOOST_CHECK_EQUAL(bData.max, expectedBData.max);
+    BOOST_CHECK_EQUAL(bData.option, expectedBData.option);
+    BOOST_CHECK_EQUAL(bData.binvalue, expectedBData.binvalue);
+  }
+  for (size_t bin1 = 0; bin1 < binUtility.bins(1); ++bin1) {
+    for (size_t bin0 = 0; bin0 < binUtility.bins(0); ++bin0) {
+      BOOST_CHECK(bsm->materialProperties(bin0, bin1) ==
+                  expectedBsm->materialProperties(bin0, bin1));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(binary_material_round_trip) {
+  const std::string fileName = "binary-material-round-trip.bin";
+  const auto maps = makeMaterialMaps();
+
+  BinaryMaterialWriter::Config writerCfg;
+  writerCfg.fileName = fileName;
+  BinaryMaterialWriter(writerCfg, Acts::Logging::WARNING).write(maps);
+
+  for (bool useRecordsInPlace : {true, false}) {
+    BOOST_TEST_CONTEXT("useRecordsInPlace=" << useRecordsInPlace) {
+      auto homogeneous = makeSurface(kHomogeneous);
+      auto binned1D = makeSurface(kBinned1D);
+      auto binned2D = makeSurface(kBinned2D);
+      auto without = makeSurface(kWithout);
+      without->assignSurfaceMaterial(maps.first.at(kHomogeneous));
+      {
+        BinaryMaterialDecorator::Config cfg;
+        cfg.fileName = fileName;
+        cfg.useRecordsInPlace = useRecordsInPlace;
+        BinaryMaterialDecorator decorator(cfg, Acts::Logging::WARNING);
+        decorator.decorate(*homogeneous);
+        decorator.decorate(*binned1D);
+        decorator.decorate(*binned2D);
+        decorator.decorate(*without);
+      }
+      // the surface material stays valid without the decorator
+      checkMaterial(*homogeneous, *maps.first.at(kHomogeneous));
+      checkMaterial(*binned1D, *maps.first.at(kBinned1D));
+      checkMaterial(*binned2D, *maps.first.at(kBinned2D));
+      BOOST_CHECK(without->surfaceMaterial() == nullptr);
+
+      // binned material references the mapped records only if requested
+      const bool inPlace =
+          useRecordsInPlace and detail::isMaterialPropertiesLayout();
+      BOOST_CHECK_EQUAL(
+          isMappedFrom(
+              &binned2D->surfaceMaterial()->materialProperties(0, 0),
+              fileName),
+          inPlace);
+    }
+  }
+  std::remove(fileName.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(binary_material_invalid_files) {
+  const std::string fileName = "binary-material-invalid.bin";
+  BinaryMaterialDecorator::Config cfg;
+  cfg.fileName = fileName;
+
+  BinaryMaterialWriter::Config writerCfg;
+  writerCfg.fileName = fileName;
+  BinaryMaterialWriter writer(writerCfg, Acts::Logging::WARNING);
+  const auto maps = makeMaterialMaps();
+
+  auto readFile = [&]() {
+    std::ifstream file(fileName, std::ios_base::binary);
+    return std::vector<char>(std::istreambuf_iterator<char>(file), {});
+  };
+  auto writeFile = [&](const std::vector<char>& content) {
+    std::ofstream file(fileName, std::ios_base::binary | std::ios_base::trunc);
+    file.write(content.data(), content.size());
+  };
+
+  // missing and empty file
+  std::remove(fileName.c_str());
+  BOOST_CHECK_THROW(BinaryMaterialDecorator(cfg, Acts::Logging::FATAL),
+                    std::runtime_error);
+  writeFile({});
+  BOOST_CHECK_THROW(BinaryMaterialDecorator(cfg, Acts::Logging::FATAL),
+                    std::runtime_error);
+
+  writer.write(maps);
+  const std::vector<char> valid = readFile();
+  BOOST_CHECK_NO_THROW(BinaryMaterialDecorator(cfg, Acts::Logging::FATAL));
+
+  // bad magic
+  std::vector<char> content = valid;
+  content[7] = '0';
+  writeFile(content);
+  BOOST_CHECK_THROW(BinaryMaterialDecorator(cfg, Acts::Logging::FATAL),
+                    std::runtime_error);
+  // incompatible properties record size
+  content = valid;
+  content[offsetof(detail::MaterialMapHeader, propertiesSize)] += 4;
+  writeFile(content);
+  BOOST_CHECK_THROW(BinaryMaterialDecorator(cfg, Acts::Logging::FATAL),
+                    std::runtime_error);
+  // truncated within the header, the surfaces, and the properties
+  for (size_t size : {size_t(12u), sizeof(detail::MaterialMapHeader) + 8u,
+                      valid.size() - sizeof(detail::MaterialMapProperties)}) {
+    BOOST_TEST_CONTEXT("size=" << size) {
+      writeFile(std::vector<char>(valid.begin(), valid.begin() + size));
+      BOOST_CHECK_THROW(BinaryMaterialDecorator(cfg, Acts::Logging::FATAL),
+                        std::runtime_error);
+    }
+  }
+  // surface entry that refers to properties beyond the stored ones
+  content = valid;
+  const uint64_t firstProperties = 1000u;
+  std::memcpy(content.data() + sizeof(detail::MaterialMapHeader) +
+                  offsetof(detail::MaterialMapSurface, firstProperties),
+              &firstProperties, sizeof(firstProperties));
+  writeFile(content);
+  BOOST_CHECK_THROW(BinaryMaterialDecorator(cfg, Acts::Logging::FATAL),
+                    std::runtime_error);
+  std::remove(fileName.c_str());
+}
+
+}  // namespace Test
+}  // namespace FW
@@ -0,0 +1,198 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <dfe/dfe_namedtuple.hpp>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "ACTFW/EventData/SimParticle.hpp"
+#include "ACTFW/Framework/AlgorithmContext.hpp"
+#include "ACTFW/Framework/WhiteBoard.hpp"
+#include "ACTFW/Io/Binary/BinaryParticleReader.hpp"
+#include "ACTFW/Io/Binary/ColumnarTable.hpp"
+#include "ACTFW/Utilities/Paths.hpp"
+#include "BinaryEventData.hpp"
+
+namespace FW {
+namespace Test {
+
+struct Row {
+  uint64_t id = 0u;
+  uint8_t flag = 0u;
+  int32_t index = 0;
+  float x = 0.0f;
+  double y = 0.0;
+
+  DFE_NAMEDTUPLE(Row, id, flag, index, x, y);
+};
+/// Same columns as `Row` with a different type for the last one.
+struct OtherRow {
+  uint64_t id = 0u;
+  uint8_t flag = 0u;
+  int32_t index = 0;
+  float x = 0.0f;
+  float y = 0.0f;
+
+  DFE_NAMEDTUPLE(OtherRow, id, flag, index, x, y);
+};
+
+std::vector<Row> makeRows(size_t n) {
+  std::vector<Row> rows(n);
+  for (size_t i = 0; i < n; ++i) {
+    rows[i].id = 3u * i + 1u;
+    rows[i].flag = i % 7u;
+    rows[i].index = -static_cast<int32_t>(i);
+    rows[i].x = 0.5f * i;
+    rows[i].y = -0.25 * i;
+  }
+  return rows;
+}
+
+/// Keep only the first `size` bytes of the file.
+void truncateFile(const std::string& path, size_t size) {
+  std::vector<char> buffer(size);
+  {
+    std::ifstream in(path, std::ios_base::binary);
+    in.read(buffer.data(), buffer.size());
+  }
+  std::ofstream out(path, std::ios_base::binary | std::ios_base::trunc);
+  out.write(buffer.data(), buffer.size());
+}
+
+BOOST_AUTO_TEST_CASE(columnar_table_round_trip) {
+  const std::string path = "columnar-table-round-trip.bin";
+
+  for (size_t n : {0u, 1u, 17u, 1000u}) {
+    const auto rows = makeRows(n);
+    writeColumnarTable(path, rows);
+    MappedColumnarTable<Row> table(path);
+
+    BOOST_CHECK_EQUAL(table.size(), n);
+    for (size_t i = 0; i < n; ++i) {
+      const Row row = table.record(i);
+      BOOST_CHECK_EQUAL(row.id, rows[i].id);
+      BOOST_CHECK_EQUAL(row.flag, rows[i].flag);
+      BOOST_CHECK_EQUAL(row.index, rows[i].index);
+      BOOST_CHECK_EQUAL(row.x, rows[i].x);
+      BOOST_CHECK_EQUAL(row.y, rows[i].y);
+      // columns are read in place
+      BOOST_CHECK_EQUAL(table.column<0>()[i], rows[i].id);
+      BOOST_CHECK_EQUAL(table.column<4>()[i], rows[i].y);
+    }
+    // all columns start at aligned offsets within the mapping
+    BOOST_CHECK_EQUAL(reinterpret_cast<uintptr_t>(table.column<0>()) % 64u,
+                      0u);
+    BOOST_CHECK_EQUAL(reinterpret_cast<uintptr_t>(table.column<1>()) % 64u,
+                      0u);
+    BOOST_CHECK_EQUAL(reinterpret_cast<uintptr_t>(table.column<2>()) % 64u,
+                      0u);
+    BOOST_CHECK_EQUAL(reinterpret_cast<uintptr_t>(table.column<3>()) % 64u,
+                      0u);
+    BOOST_CHECK_EQUAL(reinterpret_cast<uintptr_t>(table.column<4>()) % 64u,
+                      0u);
+  }
+  std::remove(path.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(columnar_table_invalid_files) {
+  const std::string path = "columnar-table-invalid.bin";
+
+  // missing file
+  std::remove(path.c_str());
+  BOOST_CHECK_THROW(MappedColumnarTable<Row>{path}, std::runtime_error);
+  // empty file
+  { std::ofstream out(path, std::ios_base::binary | std::ios_base::trunc); }
+  BOOST_CHECK_THROW(MappedColumnarTable<Row>{path}, std::runtime_error);
+  // bad magic
+  writeColumnarTable(path, makeRows(10u));
+  {
+    std::fstream file(path, std::ios_base::binary | std::ios_base::in |
+                                std::ios_base::out);
+    file.write("NOTACOL1", 8);
+  }
+  BOOST_CHECK_THROW(MappedColumnarTable<Row>{path}, std::runtime_error);
+  // different columns
+  writeColumnarTable(path, makeRows(10u));
+  BOOST_CHECK_THROW(MappedColumnarTable<OtherRow>{path}, std::runtime_error);
+  // truncated header and column descriptions
+  writeColumnarTable(path, makeRows(10u));
+  truncateFile(path, 40u);
+  BOOST_CHECK_THROW(MappedColumnarTable<Row>{path}, std::runtime_error);
+  // truncated data
+  writeColumnarTable(path, makeRows(10u));
+  truncateFile(path, detail::dataOffset(5u) + 64u);
+  BOOST_CHECK_THROW(MappedColumnarTable<Row>{path}, std::runtime_error);
+  // number of rows that does not fit the file
+  writeColumnarTable(path, makeRows(10u));
+  {
+    std::fstream file(path, std::ios_base::binary | std::ios_base::in |
+                                std::ios_base::out);
+    const uint64_t numRows = UINT64_MAX / 2u;
+    file.seekp(offsetof(detail::ColumnarHeader, numRows));
+    file.write(reinterpret_cast<const char*>(&numRows), sizeof(numRows));
+  }
+  BOOST_CHECK_THROW(MappedColumnarTable<Row>{path}, std::runtime_error);
+  std::remove(path.c_str());
+}
+
+/// Write the particle identifiers as a particle table for event 0.
+std::string writeParticles(const std::string& stem,
+                           const std::vector<uint64_t>& ids) {
+  std::vector<BinaryParticleData> rows(ids.size());
+  for (size_t i = 0; i < ids.size(); ++i) {
+    rows[i].particle_id = ids[i];
+    rows[i].particle_type = 13;
+    rows[i].px = 1.0f;
+    rows[i].m = 0.1f;
+    rows[i].q = -1.0f;
+  }
+  const std::string path = perEventFilepath("", stem + ".bin", 0u);
+  writeColumnarTable(path, rows);
+  return path;
+}
+
+ProcessCode readParticles(const std::string& stem, size_t& numParticles) {
+  BinaryParticleReader::Config cfg;
+  cfg.inputDir = "";
+  cfg.inputStem = stem;
+  cfg.outputParticles = "particles";
+  BinaryParticleReader reader(cfg, Acts::Logging::FATAL);
+  WhiteBoard store;
+  AlgorithmContext ctx(0, 0, store);
+  auto ret = reader.read(ctx);
+  if (ret == ProcessCode::SUCCESS) {
+    numParticles = store.get<SimParticleContainer>("particles").size();
+  }
+  return ret;
+}
+
+BOOST_AUTO_TEST_CASE(columnar_table_particles_order) {
+  const std::string stem = "columnar-table-particles";
+  size_t numParticles = 0u;
+
+  // strictly ordered identifiers are adopted as-is
+  auto path = writeParticles(stem, {1u, 2u, 5u, 1u << 20u});
+  BOOST_CHECK(readParticles(stem, numParticles) == ProcessCode::SUCCESS);
+  BOOST_CHECK_EQUAL(numParticles, 4u);
+  // misordered and duplicate identifiers are rejected
+  writeParticles(stem, {1u, 5u, 2u});
+  BOOST_CHECK(readParticles(stem, numParticles) == ProcessCode::ABORT);
+  writeParticles(stem, {1u, 2u, 2u});
+  BOOST_CHECK(readParticles(stem, numParticles) == ProcessCode::ABORT);
+  std::remove(path.c_str());
+}
+
+}  // namespace Test
+}  // namespace FW
@@ -153,6 +153,28 @@ BOOST_AUTO_TEST_CASE(HitsOnEmptySurface) {
                   eps);
 }
 
+BOOST_AUTO_TEST_CASE(HitsOnMaterialSurfaceWithBuffers) {
+  Fixture<EverySurface> f(0.5, makeMaterialSurface());
+  // buffers already contain outputs from other particles
+  std::vector<Particle> generated(3u);
+  std::vector<Hit> hits(5u);
+  f.interactor.generatedParticlesBuffer = &generated;
+  f.interactor.hitsBuffer = &hits;
+
+  // outputs are appended to the buffers and not stored in the result
+  f.interactor(f.state, f.stepper, f.result);
+  f.interactor(f.state, f.stepper, f.result);
+  BOOST_TEST(f.result.generatedParticles.size() == 0u);
+  BOOST_TEST(f.result.hits.size() == 0u);
+  BOOST_TEST(f.result.numHits == 2u);
+  BOOST_TEST(generated.size() == 5u);
+  BOOST_TEST(hits.size() == 7u);
+  // hit indices only count the hits of the simulated particle
+  BOOST_TEST(hits[5].index() == 0u);
+  BOOST_TEST(hits[6].index() == 1u);
+  BOOST_TEST(hits[6].particleId() == f.interactor.particle.particleId());
+}
+
 BOOST_AUTO_TEST_CASE(HitsOnMaterialSurface) {
   Fixture<EverySurface> f(0.5, makeMaterialSurface());
 
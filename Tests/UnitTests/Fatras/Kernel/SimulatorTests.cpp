@@ -0,0 +1,234 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <deque>
+#include <random>
+#include <system_error>
+#include <vector>
+
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "ActsFatras/Kernel/Simulator.hpp"
+#include "ActsFatras/Selectors/ChargeSelectors.hpp"
+#include "ActsFatras/Utilities/PhiloxRandomEngine.hpp"
+
+using namespace ActsFatras;
+
+namespace {
+
+/// Single particle simulator that only draws random numbers.
+///
+/// Randomly fails, loses momentum, creates hits, and generates up to two
+/// generations of secondaries. Failures occur after some outputs have already
+/// been written to the buffers.
+struct MockParticleSimulator {
+  double failureProbability = 0.1;
+
+  template <typename generator_t>
+  Acts::Result<InteractorResult> simulate(
+      const Acts::GeometryContext &, const Acts::MagneticFieldContext &,
+      generator_t &generator, const Particle &particle,
+      std::vector<Particle> &generatedParticles,
+      std::vector<Hit> &hits) const {
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+
+    InteractorResult result;
+    result.particle = particle;
+    result.particle.setAbsMomentum(particle.absMomentum() *
+                                   (0.5 + 0.5 * uniform(generator)));
+    const auto nHits = static_cast<int32_t>(10 * uniform(generator));
+    for (int32_t i = 0; i < nHits; ++i) {
+      Acts::GeometryID geoId;
+      geoId.setVolume(1 + 10 * uniform(generator));
+      hits.emplace_back(geoId, particle.particleId(), particle.position4(),
+                        particle.momentum4(), particle.momentum4(), i);
+    }
+    result.numHits = nHits;
+    if (particle.particleId().generation() < 2u) {
+      const auto nSecondaries = static_cast<int>(3 * uniform(generator));
+      for (int i = 0; i < nSecondaries; ++i) {
+        // all secondaries get the same id and must be renumbered
+        generatedParticles.push_back(
+            Particle(particle.particleId().makeDescendant(0u),
+                     Acts::PdgParticle::eElectron, -1, 0.5)
+                .setAbsMomentum(uniform(generator)));
+      }
+    }
+
+    if (uniform(generator) < failureProbability) {
+      return std::make_error_code(std::errc::invalid_argument);
+    }
+    return result;
+  }
+};
+
+using MockSimulator = Simulator<ChargedSelector, MockParticleSimulator,
+                                NeutralSelector, MockParticleSimulator>;
+
+struct Fixture {
+  Acts::GeometryContext geoCtx;
+  Acts::MagneticFieldContext magCtx;
+  MockSimulator simulator{MockParticleSimulator(), MockParticleSimulator()};
+  std::vector<Particle> primaries;
+
+  Fixture() {
+    for (unsigned int i = 1; i <= 64; ++i) {
+      primaries.push_back(
+          Particle(Barcode().setVertexPrimary(1u).setParticle(i),
+                   (i % 3 == 0) ? Acts::PdgParticle::eGamma
+                                : Acts::PdgParticle::ePionPlus,
+                   (i % 3 == 0) ? 0 : 1, 0.1)
+              .setAbsMomentum(i));
+    }
+  }
+};
+
+bool compareById(const Particle &lhs, const Particle &rhs) {
+  return lhs.particleId() < rhs.particleId();
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(FatrasSimulator)
+
+BOOST_AUTO_TEST_CASE(FailedParticles) {
+  Fixture f;
+  std::mt19937 generator(42u);
+  std::vector<Particle> initial, final;
+  std::vector<Hit> hits;
+
+  auto ret = f.simulator.simulate(f.geoCtx, f.magCtx, generator, f.primaries,
+                                  initial, final, hits);
+  BOOST_REQUIRE(ret.ok());
+  const auto &failed = ret.value();
+  BOOST_CHECK(not failed.empty());
+  // every remaining particle was simulated exactly once
+  BOOST_CHECK_EQUAL(initial.size(), final.size());
+  for (size_t i = 0; i < initial.size(); ++i) {
+    BOOST_CHECK(initial[i].particleId() == final[i].particleId());
+  }
+  // failed particles do not appear in the output
+  for (const auto &failedParticle : failed) {
+    for (const auto &particle : initial) {
+      BOOST_CHECK(
+          not(particle.particleId() == failedParticle.particle.particleId()));
+    }
+  }
+  // every hit belongs to a successfully simulated particle
+  for (const auto &hit : hits) {
+    BOOST_CHECK(std::any_of(
+        initial.begin(), initial.end(),
+        [&](const Particle &p) { return p.particleId() == hit.particleId(); }));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(ScratchBuffers) {
+  Fixture f;
+
+  // outputs are directly used as buffers
+  std::mt19937 generator(23u);
+  std::vector<Particle> initial, final;
+  std::vector<Hit> hits;
+  auto ret = f.simulator.simulate(f.geoCtx, f.magCtx, generator, f.primaries,
+                                  initial, final, hits);
+  BOOST_REQUIRE(ret.ok());
+
+  // outputs are filled from separate scratch buffers
+  std::mt19937 generatorDeque(23u);
+  std::deque<Particle> initialDeque, finalDeque;
+  std::deque<Hit> hitsDeque;
+  auto retDeque =
+      f.simulator.simulate(f.geoCtx, f.magCtx, generatorDeque, f.primaries,
+                           initialDeque, finalDeque, hitsDeque);
+  BOOST_REQUIRE(retDeque.ok());
+
+  // results must be identical including the ordering
+  BOOST_CHECK_EQUAL(ret.value().size(), retDeque.value().size());
+  BOOST_REQUIRE_EQUAL(initial.size(), initialDeque.size());
+  BOOST_REQUIRE_EQUAL(final.size(), finalDeque.size());
+  BOOST_REQUIRE_EQUAL(hits.size(), hitsDeque.size());
+  for (size_t i = 0; i < initial.size(); ++i) {
+    BOOST_CHECK(initial[i].particleId() == initialDeque[i].particleId());
+    BOOST_CHECK(final[i].particleId() == finalDeque[i].particleId());
+    BOOST_CHECK_EQUAL(final[i].absMomentum(), finalDeque[i].absMomentum());
+  }
+  for (size_t i = 0; i < hits.size(); ++i) {
+    BOOST_CHECK(hits[i].particleId() == hitsDeque[i].particleId());
+    BOOST_CHECK(hits[i].geometryId() == hitsDeque[i].geometryId());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(IndependentPrimaries) {
+  Fixture f;
+  const uint64_t seed = 1234u;
+  auto makeGenerator = [=](const Particle &particle) {
+    return PhiloxRandomEngine(seed, particle.particleId().value());
+  };
+
+  // simulate all primaries in input order into one container
+  std::vector<Particle> initial, final;
+  std::vector<Hit> hits;
+  std::vector<MockSimulator::FailedParticle> failed;
+  for (const auto &primary : f.primaries) {
+    auto ret =
+        f.simulator.simulatePrimary(f.geoCtx, f.magCtx, makeGenerator, primary,
+                                    initial, final, hits, failed);
+    BOOST_REQUIRE(ret.ok());
+  }
+  BOOST_CHECK(not failed.empty());
+  BOOST_CHECK_EQUAL(initial.size(), final.size());
+
+  // simulate in reverse order into separate containers per primary
+  std::vector<Particle> initialReversed, finalReversed;
+  std::vector<Hit> hitsReversed;
+  std::vector<MockSimulator::FailedParticle> failedReversed;
+  for (auto primary = f.primaries.rbegin(); primary != f.primaries.rend();
+       ++primary) {
+    std::vector<Particle> initialPrimary, finalPrimary;
+    std::vector<Hit> hitsPrimary;
+    auto ret = f.simulator.simulatePrimary(f.geoCtx, f.magCtx, makeGenerator,
+                                           *primary, initialPrimary,
+                                           finalPrimary, hitsPrimary,
+                                           failedReversed);
+    BOOST_REQUIRE(ret.ok());
+    initialReversed.insert(initialReversed.end(), initialPrimary.begin(),
+                           initialPrimary.end());
+    finalReversed.insert(finalReversed.end(), finalPrimary.begin(),
+                         finalPrimary.end());
+    hitsReversed.insert(hitsReversed.end(), hitsPrimary.begin(),
+                        hitsPrimary.end());
+  }
+
+  // results must be identical up to the ordering
+  BOOST_REQUIRE_EQUAL(initial.size(), initialReversed.size());
+  BOOST_REQUIRE_EQUAL(final.size(), finalReversed.size());
+  BOOST_REQUIRE_EQUAL(hits.size(), hitsReversed.size());
+  BOOST_CHECK_EQUAL(failed.size(), failedReversed.size());
+  std::sort(final.begin(), final.end(), compareById);
+  std::sort(finalReversed.begin(), finalReversed.end(), compareById);
+  for (size_t i = 0; i < final.size(); ++i) {
+    BOOST_CHECK(final[i].particleId() == finalReversed[i].particleId());
+    BOOST_CHECK_EQUAL(final[i].absMomentum(), finalReversed[i].absMomentum());
+  }
+  auto compareHits = [](const Hit &lhs, const Hit &rhs) {
+    return (lhs.particleId() < rhs.particleId()) or
+           ((lhs.particleId() == rhs.particleId()) and
+            (lhs.index() < rhs.index()));
+  };
+  std::sort(hits.begin(), hits.end(), compareHits);
+  std::sort(hitsReversed.begin(), hitsReversed.end(), compareHits);
+  for (size_t i = 0; i < hits.size(); ++i) {
+    BOOST_CHECK(hits[i].particleId() == hitsReversed[i].particleId());
+    BOOST_CHECK(hits[i].geometryId() == hitsReversed[i].geometryId());
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,145 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/data/test_case.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <cmath>
+#include <memory>
+#include <random>
+#include <stdexcept>
+
+#include "Acts/Material/Interactions.hpp"
+#include "Acts/Material/MaterialProperties.hpp"
+#include "Acts/Tests/CommonHelpers/PredefinedMaterials.hpp"
+#include "Acts/Utilities/Units.hpp"
+#include "ActsFatras/EventData/Particle.hpp"
+#include "ActsFatras/Physics/Tabulated/InteractionTable.hpp"
+#include "ActsFatras/Physics/Tabulated/TabulatedInteractions.hpp"
+#include "ActsFatras/Utilities/ParticleData.hpp"
+#include "Dataset.hpp"
+
+using namespace Acts::UnitLiterals;
+using Generator = std::ranlux48;
+
+namespace {
+const auto tables = std::make_shared<const ActsFatras::InteractionTables>(
+    std::vector<Acts::Material>{Acts::Test::makeBeryllium(),
+                                Acts::Test::makeSilicon()},
+    std::vector<Acts::PdgParticle>{
+        Acts::PdgParticle::eElectron, Acts::PdgParticle::ePositron,
+        Acts::PdgParticle::eMuon, Acts::PdgParticle::eAntiMuon,
+        Acts::PdgParticle::ePionPlus});
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(FatrasTabulatedInteractions)
+
+BOOST_AUTO_TEST_CASE(CompareWithAnalytic) {
+  for (auto pdg : {Acts::PdgParticle::eElectron, Acts::PdgParticle::eMuon,
+                   Acts::PdgParticle::ePionPlus}) {
+    const auto m = ActsFatras::findMass(pdg);
+    const auto q = ActsFatras::findCharge(pdg);
+    const auto material = Acts::Test::makeSilicon();
+    const auto* table = tables->find(material, pdg);
+    BOOST_REQUIRE(table);
+
+    // scan between the grid points
+    for (float betaGamma = 0.15f; betaGamma < 5e4f; betaGamma *= 1.37f) {
+      for (float thickness : {20_um, 150_um, 320_um, 1_mm, 5_mm}) {
+        const Acts::MaterialProperties slab(material, thickness);
+        const float qOverP = q / (m * betaGamma);
+        const auto theta0 =
+            Acts::computeMultipleScatteringTheta0(slab, pdg, m, qOverP, q);
+        const auto energyLoss =
+            Acts::computeEnergyLossLandau(slab, pdg, m, qOverP, q);
+        const auto energyLossSigma =
+            Acts::computeEnergyLossLandauSigma(slab, pdg, m, qOverP, q);
+
+        ActsFatras::InteractionTable::Values values;
+        BOOST_REQUIRE(table->lookup(slab.thicknessInX0(), betaGamma, values));
+        BOOST_CHECK_CLOSE(values.theta0, theta0, 0.1);
+        BOOST_CHECK_CLOSE(values.energyLossSigma, energyLossSigma, 0.1);
+        // the most probable value can be close to zero for thin materials
+        BOOST_CHECK_SMALL(values.energyLoss - energyLoss,
+                          1e-3f * (std::abs(energyLoss) + energyLossSigma));
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(OutsideRange) {
+  const auto* table =
+      tables->find(Acts::Test::makeSilicon(), Acts::PdgParticle::eMuon);
+  BOOST_REQUIRE(table);
+  ActsFatras::InteractionTable::Values values;
+  BOOST_CHECK(not table->lookup(1e-3f, 1e-3f, values));
+  BOOST_CHECK(not table->lookup(1e-3f, 1e9f, values));
+  BOOST_CHECK(not table->lookup(1e-9f, 10.0f, values));
+  BOOST_CHECK(not table->lookup(10.0f, 10.0f, values));
+  BOOST_CHECK(not table->lookup(NAN, 10.0f, values));
+  BOOST_CHECK(table->lookup(1e-3f, 10.0f, values));
+  // unknown material and particles are not available
+  BOOST_CHECK(not tables->find(Acts::Material(), Acts::PdgParticle::eMuon));
+  BOOST_CHECK(not tables->find(Acts::Test::makeSilicon(),
+                               Acts::PdgParticle::ePionMinus));
+}
+
+BOOST_AUTO_TEST_CASE(InvalidConfig) {
+  ActsFatras::InteractionTable::Config cfg;
+  cfg.pdg = Acts::PdgParticle::eGamma;
+  BOOST_CHECK_THROW(
+      ActsFatras::InteractionTable(Acts::Test::makeSilicon(), cfg),
+      std::invalid_argument);
+  cfg.pdg = Acts::PdgParticle::eMuon;
+  cfg.mass = 105.7_MeV;
+  cfg.charge = -1_e;
+  BOOST_CHECK_THROW(ActsFatras::InteractionTable(Acts::Material(), cfg),
+                    std::invalid_argument);
+  cfg.thicknessBins = 1u;
+  BOOST_CHECK_THROW(
+      ActsFatras::InteractionTable(Acts::Test::makeSilicon(), cfg),
+      std::invalid_argument);
+}
+
+BOOST_DATA_TEST_CASE(Process, Dataset::parameters, pdg, phi, lambda, p, seed) {
+  Generator gen(seed);
+  ActsFatras::Particle before = Dataset::makeParticle(pdg, phi, lambda, p);
+  ActsFatras::Particle after = before;
+  const auto slab = Acts::MaterialProperties(Acts::Test::makeBeryllium(),
+                                             1_mm);
+
+  ActsFatras::TabulatedInteractions process;
+  process.tables = tables;
+  const auto outgoing = process(gen, slab, after);
+  // energy loss changes momentum and energy
+  BOOST_TEST(after.absMomentum() < before.absMomentum());
+  BOOST_TEST(after.energy() < before.energy());
+  // scattering changes the direction
+  BOOST_TEST(0 < (after.unitDirection() - before.unitDirection()).norm());
+  // no new particles are created
+  BOOST_TEST(outgoing.empty());
+}
+
+BOOST_AUTO_TEST_CASE(AnalyticFallback) {
+  ActsFatras::Particle particle =
+      Dataset::makeParticle(Acts::PdgParticle::eMuon, 0, 0, 1_GeV);
+  // material that is not tabulated
+  const auto slab = Acts::Test::makePercentSlab();
+
+  ActsFatras::TabulatedInteractions withTables;
+  withTables.tables = tables;
+  ActsFatras::TabulatedInteractions withoutTables;
+  const auto values = withTables.computeValues(slab, particle);
+  const auto analytic = withoutTables.computeValues(slab, particle);
+  BOOST_CHECK_EQUAL(values.theta0, analytic.theta0);
+  BOOST_CHECK_EQUAL(values.energyLoss, analytic.energyLoss);
+  BOOST_CHECK_EQUAL(values.energyLossSigma, analytic.energyLossSigma);
+  BOOST_CHECK(0 < values.theta0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,112 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include <array>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "ActsFatras/EventData/Barcode.hpp"
+#include "ActsFatras/Utilities/PhiloxRandomEngine.hpp"
+
+using namespace ActsFatras;
+
+namespace {
+std::vector<uint32_t> draw(PhiloxRandomEngine& engine, size_t n) {
+  std::vector<uint32_t> values;
+  for (size_t i = 0; i < n; ++i) {
+    values.push_back(engine());
+  }
+  return values;
+}
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(FatrasPhiloxRandomEngine)
+
+BOOST_AUTO_TEST_CASE(KnownAnswers) {
+  // reference values from the Random123 known-answer tests for philox4x32_10
+  using Block = std::array<uint32_t, 4>;
+  BOOST_CHECK(PhiloxRandomEngine::bijection({{0u, 0u, 0u, 0u}}, {{0u, 0u}}) ==
+              (Block{{0x6627e8d5u, 0xe169c58du, 0xbc57ac4cu, 0x9b00dbd8u}}));
+  BOOST_CHECK(PhiloxRandomEngine::bijection(
+                  {{0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu}},
+                  {{0xffffffffu, 0xffffffffu}}) ==
+              (Block{{0x408f276du, 0x41c83b0eu, 0xa20bc7c6u, 0x6d5451fdu}}));
+  BOOST_CHECK(PhiloxRandomEngine::bijection(
+                  {{0x243f6a88u, 0x85a308d3u, 0x13198a2eu, 0x03707344u}},
+                  {{0xa4093822u, 0x299f31d0u}}) ==
+              (Block{{0xd16cfe09u, 0x94fdccebu, 0x5001e420u, 0x24126ea1u}}));
+
+  // the first block of the default stream is the zero counter and key
+  PhiloxRandomEngine engine;
+  BOOST_CHECK_EQUAL(engine(), 0x6627e8d5u);
+  BOOST_CHECK_EQUAL(engine(), 0xe169c58du);
+  BOOST_CHECK_EQUAL(engine(), 0xbc57ac4cu);
+  BOOST_CHECK_EQUAL(engine(), 0x9b00dbd8u);
+}
+
+BOOST_AUTO_TEST_CASE(Streams) {
+  const uint64_t seed = 1234567890u;
+  const auto id1 = Barcode().setVertexPrimary(1).setParticle(2);
+  const auto id2 = id1.makeDescendant(1);
+
+  // identical seed and stream give identical sequences
+  PhiloxRandomEngine a(seed, id1.value());
+  PhiloxRandomEngine b(seed, id1.value());
+  BOOST_CHECK(a == b);
+  BOOST_CHECK(draw(a, 11) == draw(b, 11));
+  BOOST_CHECK(a == b);
+
+  // different streams or seeds give different sequences
+  PhiloxRandomEngine c(seed, id2.value());
+  PhiloxRandomEngine d(seed + 1, id1.value());
+  PhiloxRandomEngine e(seed, id1.value());
+  const auto values = draw(e, 16);
+  BOOST_CHECK(draw(c, 16) != values);
+  BOOST_CHECK(draw(d, 16) != values);
+
+  // streams are independent of the order in which they are used
+  PhiloxRandomEngine f(seed, id2.value());
+  PhiloxRandomEngine g(seed, id1.value());
+  draw(f, 5);
+  BOOST_CHECK(draw(g, 16) == values);
+}
+
+BOOST_AUTO_TEST_CASE(Discard) {
+  for (unsigned long long n : {0ull, 1ull, 3ull, 4ull, 5ull, 8ull, 13ull}) {
+    PhiloxRandomEngine a(42u, 7u);
+    PhiloxRandomEngine b(42u, 7u);
+    // start within a block
+    a();
+    b();
+    a.discard(n);
+    for (unsigned long long i = 0; i < n; ++i) {
+      b();
+    }
+    BOOST_CHECK(a == b);
+    BOOST_CHECK_EQUAL(a(), b());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Distributions) {
+  // must be usable with the standard library distributions
+  PhiloxRandomEngine engine(1u, 2u);
+  std::uniform_real_distribution<double> uniform(0.0, 1.0);
+  double sum = 0.0;
+  for (int i = 0; i < 10000; ++i) {
+    const double u = uniform(engine);
+    BOOST_CHECK_LE(0.0, u);
+    BOOST_CHECK_LT(u, 1.0);
+    sum += u;
+  }
+  BOOST_CHECK_CLOSE(sum / 10000, 0.5, 2.);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,63 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "ActsFatras/Utilities/RandomVariatesBatch.hpp"
+
+using namespace ActsFatras;
+
+BOOST_AUTO_TEST_SUITE(FatrasRandomVariatesBatch)
+
+BOOST_AUTO_TEST_CASE(Distributions) {
+  std::mt19937 generator(42u);
+  RandomVariatesBatch<16u> batch;
+
+  const size_t n = 100000u;
+  double sumUniform = 0, sumNormal = 0, sumNormal2 = 0;
+  std::vector<double> landau;
+  for (size_t i = 0; i < n; ++i) {
+    const auto& variates = batch.next(generator);
+    BOOST_CHECK((0 <= variates.uniform) and (variates.uniform < 1));
+    sumUniform += variates.uniform;
+    sumNormal += variates.normal;
+    sumNormal2 += variates.normal * variates.normal;
+    landau.push_back(variates.landau);
+  }
+  BOOST_CHECK_SMALL(sumUniform / n - 0.5, 0.01);
+  BOOST_CHECK_SMALL(sumNormal / n, 0.01);
+  BOOST_CHECK_CLOSE(sumNormal2 / n, 1.0, 2.0);
+  // the median of the standard Landau distribution is at 1.3558
+  std::nth_element(landau.begin(), landau.begin() + n / 2, landau.end());
+  BOOST_CHECK_SMALL(landau[n / 2] - 1.3558, 0.02);
+}
+
+BOOST_AUTO_TEST_CASE(Reproducible) {
+  std::mt19937 generator1(23u), generator2(23u);
+  RandomVariatesBatch<4u> batch1;
+  RandomVariatesBatch<4u> batch2;
+  for (size_t i = 0; i < 10u; ++i) {
+    const auto variates1 = batch1.next(generator1);
+    const auto variates2 = batch2.next(generator2);
+    BOOST_CHECK_EQUAL(variates1.uniform, variates2.uniform);
+    BOOST_CHECK_EQUAL(variates1.normal, variates2.normal);
+    BOOST_CHECK_EQUAL(variates1.landau, variates2.landau);
+  }
+  // a reset batch draws new variates from the generator
+  batch1.reset();
+  const auto variates1 = batch1.next(generator1);
+  const auto variates2 = batch2.next(generator2);
+  BOOST_CHECK_NE(variates1.uniform, variates2.uniform);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
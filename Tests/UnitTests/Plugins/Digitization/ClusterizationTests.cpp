@@ -12,6 +12,7 @@
 #include <algorithm>
 #include <chrono>
 #include <ctime>
+#include <random>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -520,5 +521,144 @@ BOOST_AUTO_TEST_CASE(create_Clusters2) {
   }
   CHECK_CLOSE_REL(data9, (nClustersNoTouch * 2) * 2, 1e-5);
 }
+
+/// Reference labelling of an occupancy grid using a flood fill.
+std::vector<size_t> floodFillClusterSizes(std::vector<int> grid, size_t nBins0,
+                                          size_t nBins1, bool commonCorner) {
+  std::vector<size_t> sizes;
+  std::vector<std::pair<int, int>> stack;
+  for (size_t start = 0; start < grid.size(); ++start) {
+    if (grid[start] == 0) {
+      continue;
+    }
+    size_t size = 0;
+    grid[start] = 0;
+    stack.emplace_back(start % nBins0, start / nBins0);
+    while (not stack.empty()) {
+      auto [i0, i1] = stack.back();
+      stack.pop_back();
+      ++size;
+      for (int d1 = -1; d1 <= 1; ++d1) {
+        for (int d0 = -1; d0 <= 1; ++d0) {
+          int n0 = i0 + d0;
+          int n1 = i1 + d1;
+          if ((not commonCorner and (d0 != 0) and (d1 != 0)) or (n0 < 0) or
+              (n1 < 0) or (int(nBins0) <= n0) or (int(nBins1) <= n1) or
+              (grid[n0 + nBins0 * n1] == 0)) {
+            continue;
+          }
+          grid[n0 + nBins0 * n1] = 0;
+          stack.emplace_back(n0, n1);
+        }
+      }
+    }
+    sizes.push_back(size);
+  }
+  std::sort(sizes.begin(), sizes.end());
+  return sizes;
+}
+
+/// Compare the cell labelling with a flood fill on random grids.
+BOOST_DATA_TEST_CASE(label_Clusters_random,
+                     bdata::xrange(20) * bdata::make({true, false}), seed,
+                     commonCorner) {
+  const size_t nBins0 = 50;
+  const size_t nBins1 = 40;
+  std::mt19937 rng(seed);
+  std::bernoulli_distribution occupied(0.05 + 0.02 * seed);
+
+  std::vector<int> grid(nBins0 * nBins1, 0);
+  std::vector<Acts::DigitizationCell> cells;
+  for (size_t i1 = 0; i1 < nBins1; ++i1) {
+    for (size_t i0 = 0; i0 < nBins0; ++i0) {
+      if (occupied(rng)) {
+        grid[i0 + nBins0 * i1] = 1;
+        cells.emplace_back(i0, i1, 1.);
+      }
+    }
+  }
+  // input order must not matter
+  std::shuffle(cells.begin(), cells.end(), rng);
+
+  std::vector<size_t> labels;
+  size_t nClusters = Acts::labelClusters(cells, labels, commonCorner);
+  BOOST_CHECK_EQUAL(labels.size(), cells.size());
+  std::vector<size_t> sizes(nClusters, 0);
+  for (auto label : labels) {
+    BOOST_REQUIRE_LT(label, nClusters);
+    ++sizes[label];
+  }
+  std::sort(sizes.begin(), sizes.end());
+  auto reference = floodFillClusterSizes(grid, nBins0, nBins1, commonCorner);
+  BOOST_CHECK_EQUAL_COLLECTIONS(sizes.begin(), sizes.end(), reference.begin(),
+                                reference.end());
+
+  // the map-based interface gives the same result
+  std::unordered_map<size_t, std::pair<Acts::DigitizationCell, bool>> cellMap;
+  for (auto& cell : cells) {
+    cellMap.insert({cell.channel0 + nBins0 * cell.channel1, {cell, false}});
+  }
+  auto clusters = Acts::createClusters(cellMap, nBins0, commonCorner, 0.);
+  std::vector<size_t> mapSizes;
+  for (auto& cluster : clusters) {
+    mapSizes.push_back(cluster.size());
+  }
+  std::sort(mapSizes.begin(), mapSizes.end());
+  BOOST_CHECK_EQUAL_COLLECTIONS(mapSizes.begin(), mapSizes.end(),
+                                reference.begin(), reference.end());
+}
+
+/// Large clusters are handled without recursion.
+BOOST_AUTO_TEST_CASE(label_Clusters_large) {
+  // a fully occupied module and a diagonal line
+  const size_t nBins = 1000;
+  std::vector<Acts::DigitizationCell> cells;
+  for (size_t i1 = 0; i1 < nBins; ++i1) {
+    for (size_t i0 = 0; i0 < nBins; ++i0) {
+      cells.emplace_back(i0, i1, 1.);
+    }
+  }
+  std::vector<size_t> labels;
+  BOOST_CHECK_EQUAL(Acts::labelClusters(cells, labels, false), 1u);
+
+  cells.clear();
+  for (size_t i = 0; i < nBins; ++i) {
+    cells.emplace_back(i, i, 1.);
+  }
+  BOOST_CHECK_EQUAL(Acts::labelClusters(cells, labels, true), 1u);
+  BOOST_CHECK_EQUAL(Acts::labelClusters(cells, labels, false), nBins);
+}
+
+/// Cells at the same position are merged before the energy cut.
+BOOST_AUTO_TEST_CASE(label_Clusters_duplicates) {
+  std::vector<Acts::DigitizationCell> cells = {
+      {2, 3, 0.5}, {7, 7, 0.5}, {2, 3, 0.75}, {3, 3, 2.}, {7, 7, 0.25}};
+
+  std::vector<size_t> labels;
+  // analogue readout, the merged (2,3) cell passes the cut, (7,7) does not
+  BOOST_CHECK_EQUAL(Acts::labelClusters(cells, labels, true, 1., true), 1u);
+  std::vector<size_t> expected = {0u, Acts::kNoCluster, 0u, 0u,
+                                  Acts::kNoCluster};
+  BOOST_CHECK_EQUAL_COLLECTIONS(labels.begin(), labels.end(),
+                                expected.begin(), expected.end());
+  auto clusters = Acts::createClusters(cells, true, 1., true);
+  BOOST_REQUIRE_EQUAL(clusters.size(), 1u);
+  BOOST_REQUIRE_EQUAL(clusters[0].size(), 2u);
+  CHECK_CLOSE_REL(clusters[0][0].data, 1.25, 1e-6);
+  CHECK_CLOSE_REL(clusters[0][1].data, 2., 1e-6);
+
+  // digital readout, the merged cells keep the first content only
+  BOOST_CHECK_EQUAL(Acts::labelClusters(cells, labels, true, 1., false), 1u);
+  expected = {Acts::kNoCluster, Acts::kNoCluster, Acts::kNoCluster, 0u,
+              Acts::kNoCluster};
+  BOOST_CHECK_EQUAL_COLLECTIONS(labels.begin(), labels.end(),
+                                expected.begin(), expected.end());
+
+  // no cut, two separate clusters ordered by position
+  BOOST_CHECK_EQUAL(Acts::labelClusters(cells, labels), 2u);
+  expected = {0u, 1u, 0u, 0u, 1u};
+  BOOST_CHECK_EQUAL_COLLECTIONS(labels.begin(), labels.end(),
+                                expected.begin(), expected.end());
+}
 }  // namespace Test
 }  // namespace Acts
@@ -16,6 +16,8 @@
 #include "Acts/Tests/CommonHelpers/DetectorElementStub.hpp"
 #include "Acts/Utilities/Definitions.hpp"
 
+#include <random>
+
 namespace bdata = boost::unit_test::data;
 namespace tt = boost::test_tools;
 using namespace Acts::UnitLiterals;
@@ -147,5 +149,109 @@ BOOST_DATA_TEST_CASE(DoubleHitsSpacePointBuilder_basic, bdata::xrange(1),
   BOOST_CHECK_EQUAL(resultSP.size(), 1u);
 }
 
+/// The binned pair search and the cached strip ends must reproduce the
+/// exhaustive comparison of all clusters.
+BOOST_DATA_TEST_CASE(DoubleHitsSpacePointBuilder_binned, bdata::xrange(5),
+                     seed) {
+  // strip modules with a small stereo angle and 80um pitch
+  auto bounds = std::make_shared<const RectangleBounds>(30_mm, 25_mm);
+  auto segmentation =
+      std::make_shared<const CartesianSegmentation>(bounds, 750u, 1u);
+  const DigitizationModule digMod(segmentation, 0.15_mm, 1, 0.);
+  std::vector<std::unique_ptr<DetectorElementStub>> elements;
+  std::vector<std::shared_ptr<const Surface>> surfaces;
+  for (double stereo : {0.026, -0.026}) {
+    Transform3D trf(AngleAxis3D(stereo, Vector3D::UnitZ()));
+    trf.translation() =
+        Vector3D(0, 200_mm, (0 < stereo) ? 300_mm : 302_mm);
+    elements.push_back(std::make_unique<DetectorElementStub>(
+        std::make_shared<const Transform3D>(trf)));
+    surfaces.push_back(
+        Surface::makeShared<PlaneSurface>(bounds, *elements.back()));
+  }
+
+  // clusters at the strip centers from straight tracks
+  std::mt19937 rng(seed);
+  std::uniform_real_distribution<double> uniformX(-25_mm, 25_mm);
+  std::uniform_real_distribution<double> uniformY(-20_mm, 20_mm);
+  ActsSymMatrixD<3> cov = ActsSymMatrixD<3>::Zero();
+  std::vector<PlanarModuleCluster> clusters;
+  clusters.reserve(2 * 100);
+  std::vector<const PlanarModuleCluster*> front, back;
+  for (size_t i = 0; i < 100; ++i) {
+    Vector3D global(uniformX(rng), uniformY(rng), 0.);
+    for (size_t s = 0; s < 2; ++s) {
+      Vector2D local;
+      Vector3D position = surfaces[s]->center(tgContext) + global;
+      surfaces[s]->globalToLocal(tgContext, position, Vector3D::UnitZ(),
+                                 local);
+      clusters.emplace_back(surfaces[s], Identifier{}, cov, local.x(), 0., 0.,
+                            std::vector<DigitizationCell>{}, &digMod);
+    }
+  }
+  for (size_t i = 0; i < clusters.size(); i += 2) {
+    front.push_back(&clusters[i]);
+    back.push_back(&clusters[i + 1]);
+  }
+  // the input order must not matter for the results
+  std::shuffle(back.begin(), back.end(), rng);
+
+  DoubleHitSpacePointConfig cfg;
+  cfg.diffDist = 3_mm;
+  cfg.diffTheta2 = 1e-4;
+  cfg.diffPhi2 = 1e-4;
+  SpacePointBuilder<SpacePoint<PlanarModuleCluster>> builder(cfg);
+
+  // exhaustive reference
+  std::vector<std::pair<const PlanarModuleCluster*, const PlanarModuleCluster*>>
+      reference;
+  auto global = [&](const PlanarModuleCluster* cluster) {
+    Vector3D pos, mom;
+    auto par = cluster->parameters();
+    cluster->referenceSurface().localToGlobal(
+        tgContext, Vector2D(par[eLOC_0], par[eLOC_1]), mom, pos);
+    return pos;
+  };
+  for (auto cf : front) {
+    double diffMin = std::numeric_limits<double>::max();
+    const PlanarModuleCluster* best = nullptr;
+    for (auto cb : back) {
+      double diff = detail::differenceOfClustersChecked(
+          global(cf), global(cb), cfg.vertex, cfg.diffDist, cfg.diffTheta2,
+          cfg.diffPhi2);
+      if (0. <= diff and diff < diffMin) {
+        diffMin = diff;
+        best = cb;
+      }
+    }
+    if (best != nullptr) {
+      reference.emplace_back(cf, best);
+    }
+  }
+
+  std::vector<std::pair<const PlanarModuleCluster*, const PlanarModuleCluster*>>
+      clusterPairs;
+  builder.makeClusterPairs(tgContext, front, back, clusterPairs);
+  BOOST_CHECK_GT(clusterPairs.size(), 50u);
+  BOOST_CHECK(clusterPairs == reference);
+
+  // multiple pairs of surfaces at once
+  clusterPairs.clear();
+  builder.makeClusterPairs(tgContext, {{front, back}, {{}, back}, {front, back}},
+                           clusterPairs);
+  BOOST_CHECK_EQUAL(clusterPairs.size(), 2 * reference.size());
+
+  // space points with cached strip ends are identical
+  std::vector<SpacePoint<PlanarModuleCluster>> spacePoints, referencePoints;
+  builder.calculateSpacePoints(tgContext, reference, spacePoints);
+  for (const auto& cp : reference) {
+    builder.calculateSpacePoints(tgContext, {cp}, referencePoints);
+  }
+  BOOST_REQUIRE_EQUAL(spacePoints.size(), referencePoints.size());
+  for (size_t i = 0; i < spacePoints.size(); ++i) {
+    BOOST_CHECK_EQUAL(spacePoints[i].vector, referencePoints[i].vector);
+  }
+}
+
 }  // end of namespace Test
 }  // end of namespace Acts
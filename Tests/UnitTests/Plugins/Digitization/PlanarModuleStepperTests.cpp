@@ -17,8 +17,11 @@
 #include "Acts/Surfaces/RectangleBounds.hpp"
 #include "Acts/Surfaces/Surface.hpp"
 #include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+#include "Acts/Utilities/Intersection.hpp"
 #include "Acts/Utilities/Units.hpp"
 
+#include <algorithm>
+
 namespace bdata = boost::unit_test::data;
 namespace tt = boost::test_tools;
 using namespace Acts::UnitLiterals;
@@ -55,6 +58,74 @@ PlanarModuleStepper pmStepper;
 // Create a test context
 GeometryContext tgContext = GeometryContext();
 
+/// Reference steps from the intersections with the segmentation surfaces.
+std::vector<DigitizationStep> surfaceSteps(const DigitizationModule& dm,
+                                           const Vector3D& start,
+                                           const Vector3D& end) {
+  Vector3D direction = (end - start).normalized();
+  std::vector<Intersection> intersections;
+  for (auto& surface : dm.stepSurfaces(start, end)) {
+    auto intersection =
+        surface->intersectionEstimate(tgContext, start, direction, true);
+    // the surfaces can extend beyond the sensitive volume at tilted edges
+    if (intersection and intersection.pathLength < (end - start).norm()) {
+      intersections.push_back(intersection);
+    }
+  }
+  intersections.push_back(
+      Intersection(end, (end - start).norm(), Intersection::Status::reachable));
+  std::sort(intersections.begin(), intersections.end());
+  std::vector<DigitizationStep> steps;
+  Vector3D last = start;
+  for (auto& intersection : intersections) {
+    auto step = dm.digitizationStep(last, intersection.position);
+    // the analytic traversal does not create empty steps at corners
+    if (0 < step.stepLength) {
+      steps.push_back(step);
+    }
+    last = intersection.position;
+  }
+  return steps;
+}
+
+/// Reference entry and exit from the intersections with the boundaries.
+std::vector<Vector3D> surfaceBoundaries(const DigitizationModule& dm,
+                                        const Vector3D& position,
+                                        const Vector3D& direction) {
+  std::vector<Intersection> intersections;
+  for (auto& surface : dm.boundarySurfaces()) {
+    auto intersection =
+        surface->intersectionEstimate(tgContext, position, direction, true);
+    if (intersection) {
+      intersections.push_back(intersection);
+    }
+  }
+  std::sort(intersections.begin(), intersections.end());
+  std::vector<Vector3D> positions;
+  for (auto& intersection : intersections) {
+    positions.push_back(intersection.position);
+  }
+  return positions;
+}
+
+/// Compare analytic steps with the reference steps.
+void checkSteps(const std::vector<DigitizationStep>& steps,
+                const std::vector<DigitizationStep>& reference) {
+  BOOST_CHECK_EQUAL(steps.size(), reference.size());
+  for (size_t i = 0; i < std::min(steps.size(), reference.size()); ++i) {
+    BOOST_CHECK_EQUAL(steps[i].stepCell.channel0,
+                      reference[i].stepCell.channel0);
+    BOOST_CHECK_EQUAL(steps[i].stepCell.channel1,
+                      reference[i].stepCell.channel1);
+    CHECK_CLOSE_ABS(steps[i].stepLength, reference[i].stepLength, 1e-9);
+    CHECK_CLOSE_ABS(steps[i].driftLength, reference[i].driftLength, 1e-9);
+    CHECK_CLOSE_ABS(steps[i].stepCellCenter.x(),
+                    reference[i].stepCellCenter.x(), 1e-6);
+    CHECK_CLOSE_ABS(steps[i].stepCellCenter.y(),
+                    reference[i].stepCellCenter.y(), 1e-6);
+  }
+}
+
 /// The following test checks test cases where the entry and exit is
 /// guaranteed to be in on the readout/counter plane
 BOOST_DATA_TEST_CASE(
@@ -96,5 +167,82 @@ BOOST_DATA_TEST_CASE(
   }
 }
 
+/// Compare the analytic cell traversal with the segmentation surfaces.
+BOOST_DATA_TEST_CASE(
+    analytic_traversal_test,
+    bdata::random((bdata::seed = 10,
+                   bdata::distribution = std::uniform_real_distribution<>(
+                       -halfX + sguardX, halfX - sguardX))) ^
+        bdata::random((bdata::seed = 11,
+                       bdata::distribution = std::uniform_real_distribution<>(
+                           -halfX + sguardX, halfX - sguardX))) ^
+        bdata::random((bdata::seed = 12,
+                       bdata::distribution =
+                           std::uniform_real_distribution<>(-halfY, halfY))) ^
+        bdata::random((bdata::seed = 13,
+                       bdata::distribution =
+                           std::uniform_real_distribution<>(-halfY, halfY))) ^
+        bdata::xrange(ntests),
+    entryX, exitX, entryY, exitY, index) {
+  (void)index;
+
+  // inclined tracks crossing many cells in both directions
+  Vector3D entry(entryX, entryY, -hThickness);
+  Vector3D exit(exitX, exitY, hThickness);
+
+  std::vector<DigitizationStep> steps;
+  for (auto& dm : testModules) {
+    steps.clear();
+    pmStepper.cellSteps(tgContext, dm, entry, exit, steps);
+    checkSteps(steps, surfaceSteps(dm, entry, exit));
+    // total path length is conserved
+    double totalLength = 0;
+    for (auto& step : steps) {
+      totalLength += step.stepLength;
+    }
+    CHECK_CLOSE_REL(totalLength, (exit - entry).norm(), 1e-9);
+    // appending to the container does not modify existing steps
+    auto nSteps = steps.size();
+    pmStepper.cellSteps(tgContext, dm, exit, entry, steps);
+    BOOST_CHECK_EQUAL(steps.size(), 2 * nSteps);
+  }
+}
+
+/// Compare the analytic module boundaries with the boundary surfaces.
+BOOST_DATA_TEST_CASE(
+    analytic_boundary_test,
+    bdata::random((bdata::seed = 20,
+                   bdata::distribution = std::uniform_real_distribution<>(
+                       -halfX + sguardX, halfX - sguardX))) ^
+        bdata::random((bdata::seed = 21,
+                       bdata::distribution =
+                           std::uniform_real_distribution<>(-halfY, halfY))) ^
+        bdata::random((bdata::seed = 22,
+                       bdata::distribution =
+                           std::uniform_real_distribution<>(-1, 1))) ^
+        bdata::random((bdata::seed = 23,
+                       bdata::distribution =
+                           std::uniform_real_distribution<>(-1, 1))) ^
+        bdata::xrange(ntests),
+    posX, posY, dirX, dirY, index) {
+  (void)index;
+
+  Vector2D position(posX, posY);
+  // some tracks leave through the module edges
+  Vector3D direction = Vector3D(dirX, dirY, 0.05).normalized();
+
+  for (auto& dm : testModules) {
+    auto steps = pmStepper.cellSteps(tgContext, dm, position, direction);
+    auto boundaries = surfaceBoundaries(
+        dm, Vector3D(position.x(), position.y(), 0), direction);
+    BOOST_REQUIRE_GE(boundaries.size(), 2u);
+    BOOST_REQUIRE(not steps.empty());
+    CHECK_CLOSE_ABS((steps.front().stepEntry - boundaries[0]).norm(), 0,
+                    1e-9);
+    CHECK_CLOSE_ABS((steps.back().stepExit - boundaries[1]).norm(), 0, 1e-9);
+    checkSteps(steps, surfaceSteps(dm, boundaries[0], boundaries[1]));
+  }
+}
+
 }  // namespace Test
 }  // namespace Acts
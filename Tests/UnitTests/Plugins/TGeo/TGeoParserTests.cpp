@@ -16,6 +16,10 @@
 #include "Acts/Visualization/ObjVisualization.hpp"
 
 #include "TGeoManager.h"
+#include "TGeoMaterial.h"
+#include "TGeoMatrix.h"
+#include "TGeoMedium.h"
+#include "TGeoVolume.h"
 
 namespace Acts {
 
@@ -101,5 +105,89 @@ BOOST_AUTO_TEST_CASE(TGeoParser_Pixel_SelectInnermost) {
   }
 }
 
+/// @brief Unit test parallel parsing and node lookup by path
+BOOST_AUTO_TEST_CASE(TGeoParser_Pixel_Parallel) {
+  if (gGeoManager != nullptr) {
+    TGeoParser::Options tgpOptions;
+    tgpOptions.volumeNames = {"*"};
+    tgpOptions.targetNames = {"PixelActiveo2_1", "PixelActiveo4_1",
+                              "PixelActiveo5_1", "PixelActiveo6_1"};
+    tgpOptions.parseRanges.push_back({binR, {0., 40.}});
+    tgpOptions.unit = 10.;
+
+    TGeoParser::State serialState;
+    serialState.volume = gGeoManager->GetTopVolume();
+    TGeoParser::select(serialState, tgpOptions);
+
+    tgpOptions.numThreads = 4;
+    TGeoParser::State parallelState;
+    parallelState.volume = gGeoManager->GetTopVolume();
+    TGeoParser::select(parallelState, tgpOptions);
+
+    // Same selection in the same order
+    BOOST_CHECK_EQUAL(serialState.selectedNodes.size(),
+                      parallelState.selectedNodes.size());
+    for (size_t is = 0; is < serialState.selectedNodes.size(); ++is) {
+      const auto& snode = serialState.selectedNodes[is];
+      const auto& pnode = parallelState.selectedNodes[is];
+      BOOST_CHECK_EQUAL(snode.node, pnode.node);
+      BOOST_CHECK(snode.path == pnode.path);
+      // The path leads back to the node
+      BOOST_CHECK_EQUAL(
+          TGeoParser::findNode(*gGeoManager->GetTopVolume(), snode.path),
+          snode.node);
+    }
+    BOOST_CHECK_EQUAL(
+        TGeoParser::findNode(*gGeoManager->GetTopVolume(), {-1}), nullptr);
+  }
+}
+
+/// @brief Unit test parallel parsing of a geometry with divisions
+///
+/// This replaces the global geometry, hence it has to run last
+BOOST_AUTO_TEST_CASE(TGeoParser_Divisions_Parallel) {
+  new TGeoManager("divisions", "divisions");
+  TGeoMaterial* mat = new TGeoMaterial("Si", 28.09, 14, 2.33);
+  TGeoMedium* med = new TGeoMedium("MED", 1, mat);
+  TGeoVolume* top = gGeoManager->MakeBox("TOP", med, 100, 100, 100);
+  gGeoManager->SetTopVolume(top);
+  TGeoVolume* layer = gGeoManager->MakeBox("LAYER", med, 40, 40, 1);
+  layer->Divide("SLICE", 1, 8, -40, 10);
+  for (int il = 0; il < 4; ++il) {
+    top->AddNode(layer, il + 1, new TGeoTranslation(0, 0, -30 + 20 * il));
+  }
+  gGeoManager->CloseGeometry();
+
+  TGeoParser::Options tgpOptions;
+  tgpOptions.volumeNames = {"LAYER"};
+  tgpOptions.targetNames = {"SLICE*"};
+  tgpOptions.parseRanges.push_back({binX, {-310., 310.}});
+
+  TGeoParser::State serialState;
+  serialState.volume = top;
+  TGeoParser::select(serialState, tgpOptions);
+  // The six inner slices of each layer
+  BOOST_CHECK_EQUAL(serialState.selectedNodes.size(), 24u);
+
+  tgpOptions.numThreads = 4;
+  TGeoParser::State parallelState;
+  parallelState.volume = top;
+  TGeoParser::select(parallelState, tgpOptions);
+
+  // Same selection with the same transforms
+  BOOST_REQUIRE_EQUAL(serialState.selectedNodes.size(),
+                      parallelState.selectedNodes.size());
+  for (size_t is = 0; is < serialState.selectedNodes.size(); ++is) {
+    const auto& snode = serialState.selectedNodes[is];
+    const auto& pnode = parallelState.selectedNodes[is];
+    BOOST_CHECK_EQUAL(snode.node, pnode.node);
+    BOOST_CHECK(snode.path == pnode.path);
+    for (int it = 0; it < 3; ++it) {
+      BOOST_CHECK_EQUAL(snode.transform->GetTranslation()[it],
+                        pnode.transform->GetTranslation()[it]);
+    }
+  }
+}
+
 }  // namespace Test
 }  // namespace Acts